@@ -0,0 +1,249 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Records the latency of every benchmark iteration and reports its distribution in the
+//! same way for all benchmarks so that they stay comparable.
+
+use core::time::Duration;
+
+// every power of two range is divided into this number of linear sub buckets, the relative
+// error of a recorded value is therefore below 1 / (SUB_BUCKET_COUNT / 2)
+const SUB_BUCKET_BITS: u32 = 7;
+const SUB_BUCKET_COUNT: usize = 1 << SUB_BUCKET_BITS;
+const SUB_BUCKET_HALF_COUNT: usize = SUB_BUCKET_COUNT / 2;
+const NUMBER_OF_BUCKETS: usize =
+    (u64::BITS - SUB_BUCKET_BITS) as usize * SUB_BUCKET_HALF_COUNT + SUB_BUCKET_COUNT;
+
+/// The percentiles that are reported for every benchmark.
+pub const PERCENTILES: [f64; 4] = [50.0, 90.0, 99.0, 99.9];
+
+/// Defines how the results of a benchmark are printed.
+#[derive(clap::ValueEnum, Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub enum OutputFormat {
+    /// Human readable single line per benchmark
+    #[default]
+    Text,
+    /// Comma separated values, the header is printed once before the first benchmark
+    Csv,
+    /// One JSON object per line and benchmark
+    Json,
+}
+
+/// Log-linear histogram in the spirit of HDR histograms. The recording of a value costs
+/// one increment and no allocation, so it can be used in the hot loop of a benchmark. Values
+/// below 128 are recorded exactly, larger values with a relative error of less than 1.6%.
+#[derive(Debug, Clone)]
+pub struct LatencyHistogram {
+    counts: Vec<u64>,
+    count: u64,
+    min: u64,
+    max: u64,
+    sum: u128,
+    sum_of_squares: u128,
+}
+
+impl Default for LatencyHistogram {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl LatencyHistogram {
+    /// Creates a new empty [`LatencyHistogram`]
+    pub fn new() -> Self {
+        Self {
+            counts: vec![0; NUMBER_OF_BUCKETS],
+            count: 0,
+            min: u64::MAX,
+            max: 0,
+            sum: 0,
+            sum_of_squares: 0,
+        }
+    }
+
+    fn bucket_index(value: u64) -> usize {
+        let shift = (u64::BITS - value.leading_zeros()).saturating_sub(SUB_BUCKET_BITS);
+        shift as usize * SUB_BUCKET_HALF_COUNT + (value >> shift) as usize
+    }
+
+    fn highest_value_of_bucket(index: usize) -> u64 {
+        if index < SUB_BUCKET_COUNT {
+            return index as u64;
+        }
+
+        let shift = (index - SUB_BUCKET_HALF_COUNT) / SUB_BUCKET_HALF_COUNT;
+        let sub_bucket = (index - shift * SUB_BUCKET_HALF_COUNT) as u64;
+        (sub_bucket << shift) + ((1u64 << shift) - 1)
+    }
+
+    /// Records a single value
+    pub fn record(&mut self, value: u64) {
+        self.counts[Self::bucket_index(value)] += 1;
+        self.count += 1;
+        self.min = self.min.min(value);
+        self.max = self.max.max(value);
+        self.sum += value as u128;
+        self.sum_of_squares += value as u128 * value as u128;
+    }
+
+    /// Records the provided [`Duration`] in nanoseconds
+    pub fn record_duration(&mut self, value: Duration) {
+        self.record(value.as_nanos().min(u64::MAX as u128) as u64)
+    }
+
+    /// Returns the number of recorded values
+    pub fn len(&self) -> u64 {
+        self.count
+    }
+
+    /// Returns true when no value was recorded
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// Returns the smallest recorded value
+    pub fn min(&self) -> u64 {
+        if self.is_empty() {
+            0
+        } else {
+            self.min
+        }
+    }
+
+    /// Returns the largest recorded value
+    pub fn max(&self) -> u64 {
+        self.max
+    }
+
+    /// Returns the arithmetic mean of all recorded values
+    pub fn mean(&self) -> f64 {
+        if self.is_empty() {
+            return 0.0;
+        }
+
+        self.sum as f64 / self.count as f64
+    }
+
+    /// Returns the jitter, the standard deviation of all recorded values
+    pub fn jitter(&self) -> f64 {
+        if self.is_empty() {
+            return 0.0;
+        }
+
+        let mean = self.mean();
+        let variance = self.sum_of_squares as f64 / self.count as f64 - mean * mean;
+        variance.max(0.0).sqrt()
+    }
+
+    /// Returns the value below or equal to which `percentile` percent of all recorded values
+    /// are. The value is exact up to the resolution of the histogram.
+    pub fn percentile(&self, percentile: f64) -> u64 {
+        if self.is_empty() {
+            return 0;
+        }
+
+        let rank = ((percentile / 100.0 * self.count as f64).ceil() as u64).clamp(1, self.count);
+        let mut accumulated = 0;
+        for (index, count) in self.counts.iter().enumerate() {
+            accumulated += count;
+            if accumulated >= rank {
+                return Self::highest_value_of_bucket(index).min(self.max);
+            }
+        }
+
+        self.max
+    }
+}
+
+/// The result of a single benchmark run.
+#[derive(Debug)]
+pub struct LatencyReport<'a> {
+    /// Name of the benchmark, e.g. `publish-subscribe`
+    pub benchmark: &'a str,
+    /// Describes the benchmarked setup, e.g. the service type and the payload size
+    pub setup: String,
+    /// The number of iterations of the benchmark
+    pub iterations: u64,
+    /// The overall runtime of the benchmark
+    pub time: Duration,
+    /// The per iteration latencies in nanoseconds
+    pub histogram: &'a LatencyHistogram,
+}
+
+impl LatencyReport<'_> {
+    /// Prints the header of the [`OutputFormat`] if it has one. Must be called once before
+    /// the first [`LatencyReport::print()`].
+    pub fn print_header(format: OutputFormat) {
+        if format == OutputFormat::Csv {
+            println!(
+                "benchmark,setup,iterations,time_s,latency_ns,min_ns,p50_ns,p90_ns,p99_ns,p99_9_ns,max_ns,jitter_ns"
+            );
+        }
+    }
+
+    /// Returns the average latency, derived from the overall runtime of the benchmark
+    pub fn latency(&self) -> u128 {
+        self.time.as_nanos() / (self.iterations.max(1) as u128 * 2)
+    }
+
+    /// Prints the report in the provided [`OutputFormat`]
+    pub fn print(&self, format: OutputFormat) {
+        let [p50, p90, p99, p99_9] = PERCENTILES.map(|p| self.histogram.percentile(p));
+
+        match format {
+            OutputFormat::Text => println!(
+                "{} ::: Iterations: {}, Time: {} s, Latency: {} ns, Min: {} ns, P50: {} ns, P90: {} ns, P99: {} ns, P99.9: {} ns, Max: {} ns, Jitter: {:.1} ns",
+                self.setup,
+                self.iterations,
+                self.time.as_secs_f64(),
+                self.latency(),
+                self.histogram.min(),
+                p50,
+                p90,
+                p99,
+                p99_9,
+                self.histogram.max(),
+                self.histogram.jitter()
+            ),
+            OutputFormat::Csv => println!(
+                "{},\"{}\",{},{},{},{},{},{},{},{},{},{:.1}",
+                self.benchmark,
+                self.setup.replace('"', "\"\""),
+                self.iterations,
+                self.time.as_secs_f64(),
+                self.latency(),
+                self.histogram.min(),
+                p50,
+                p90,
+                p99,
+                p99_9,
+                self.histogram.max(),
+                self.histogram.jitter()
+            ),
+            OutputFormat::Json => println!(
+                "{{\"benchmark\":\"{}\",\"setup\":\"{}\",\"iterations\":{},\"time_s\":{},\"latency_ns\":{},\"min_ns\":{},\"p50_ns\":{},\"p90_ns\":{},\"p99_ns\":{},\"p99_9_ns\":{},\"max_ns\":{},\"jitter_ns\":{:.1}}}",
+                self.benchmark,
+                self.setup.replace('\\', "\\\\").replace('"', "\\\""),
+                self.iterations,
+                self.time.as_secs_f64(),
+                self.latency(),
+                self.histogram.min(),
+                p50,
+                p90,
+                p99,
+                p99_9,
+                self.histogram.max(),
+                self.histogram.jitter()
+            ),
+        }
+    }
+}
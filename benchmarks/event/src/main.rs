@@ -10,6 +10,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use benchmark_common::{LatencyHistogram, LatencyReport, OutputFormat};
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_log::set_log_level;
@@ -62,6 +63,7 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -72,11 +74,13 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             startup_barrier.wait();
             start_benchmark_barrier.wait();
 
-            notifier_a2b.notify().expect("failed to notify");
-
             for _ in 0..args.iterations {
-                while listener_b2a.blocking_wait_one().unwrap().is_none() {}
+                let round_trip_start = Time::now().expect("failed to acquire time");
                 notifier_a2b.notify().expect("failed to notify");
+                while listener_b2a.blocking_wait_one().unwrap().is_none() {}
+                histogram.record_duration(
+                    round_trip_start.elapsed().expect("failed to measure time") / 2,
+                );
             }
         });
 
@@ -104,20 +108,100 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: MaxEventId: {}, Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<T>(),
-        args.max_event_id,
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2)
-    );
+    LatencyReport {
+        benchmark: "event",
+        setup: format!(
+            "{}, MaxEventId: {}",
+            core::any::type_name::<T>(),
+            args.max_event_id
+        ),
+        iterations: args.iterations as u64,
+        time: stop,
+        histogram: &histogram,
+    }
+    .print(args.output_format);
 
     Ok(())
 }
 
+fn perform_wait_all_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+    let service_name = ServiceName::new("wait_all")?;
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let service = node
+        .service_builder(&service_name)
+        .event()
+        .event_id_max_value(args.max_event_id)
+        .create()?;
+
+    let notifier = service.notifier_builder().create()?;
+    let listener = service.listener_builder().create()?;
+    let event_ids = args
+        .event_id_pattern
+        .event_ids(args.number_of_event_ids, args.max_event_id);
+
+    let mut histogram = LatencyHistogram::new();
+    let mut wait_all_time = core::time::Duration::ZERO;
+    for _ in 0..args.iterations {
+        for event_id in &event_ids {
+            notifier.notify_with_custom_event_id(*event_id)?;
+        }
+
+        let mut number_of_received_event_ids = 0;
+        let wait_all_start = Time::now().expect("failed to acquire time");
+        listener.try_wait_all(|_| number_of_received_event_ids += 1)?;
+        let duration = wait_all_start.elapsed().expect("failed to measure time");
+
+        assert_eq!(number_of_received_event_ids, event_ids.len());
+        histogram.record_duration(duration);
+        wait_all_time += duration;
+    }
+
+    LatencyReport {
+        benchmark: "event-wait-all",
+        setup: format!(
+            "{}, MaxEventId: {}, Pattern: {:?}, EventIds: {}",
+            core::any::type_name::<T>(),
+            args.max_event_id,
+            args.event_id_pattern,
+            event_ids.len()
+        ),
+        iterations: args.iterations as u64,
+        // the report assumes round trips and halves the time, the acquisition is a single trip
+        time: wait_all_time * 2,
+        histogram: &histogram,
+    }
+    .print(args.output_format);
+
+    Ok(())
+}
+
+/// Defines which event ids are notified in the wait all benchmark.
+#[derive(clap::ValueEnum, Debug, Clone, Copy)]
+enum EventIdPattern {
+    /// Consecutive event ids starting at zero
+    Dense,
+    /// Event ids that are evenly spread over the whole event id range
+    Sparse,
+}
+
+impl EventIdPattern {
+    fn event_ids(&self, number_of_event_ids: usize, max_event_id: usize) -> Vec<EventId> {
+        let number_of_event_ids = number_of_event_ids.clamp(1, max_event_id + 1);
+        let stride = match self {
+            EventIdPattern::Dense => 1,
+            EventIdPattern::Sparse => (max_event_id + 1) / number_of_event_ids,
+        };
+
+        (0..number_of_event_ids)
+            .map(|n| EventId::new(n * stride))
+            .collect()
+    }
+}
+
 const ITERATIONS: usize = 1000000;
 const EVENT_ID_MAX_VALUE: usize = 128;
+const NUMBER_OF_EVENT_IDS: usize = 16;
 
 #[derive(Parser, Debug)]
 #[clap(version, about, long_about = None)]
@@ -152,6 +236,19 @@ struct Args {
     /// The number of additional listeners per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_listeners: usize,
+    /// Measure how long a Listener requires to acquire all notified event ids with
+    /// `try_wait_all` instead of the round trip latency
+    #[clap(long)]
+    wait_all: bool,
+    /// The number of event ids that are notified per iteration in the wait all benchmark
+    #[clap(long, default_value_t = NUMBER_OF_EVENT_IDS)]
+    number_of_event_ids: usize,
+    /// How the notified event ids are distributed in the wait all benchmark
+    #[clap(long, value_enum, default_value_t = EventIdPattern::Dense)]
+    event_id_pattern: EventIdPattern,
+    /// The format in which the results are printed.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -163,15 +260,25 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
         set_log_level(iceoryx2_bb_log::LogLevel::Error);
     }
 
+    LatencyReport::print_header(args.output_format);
+
     let mut at_least_one_benchmark_did_run = false;
 
     if args.bench_ipc || args.bench_all {
-        perform_benchmark::<ipc::Service>(&args)?;
+        if args.wait_all {
+            perform_wait_all_benchmark::<ipc::Service>(&args)?;
+        } else {
+            perform_benchmark::<ipc::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
     if args.bench_local || args.bench_all {
-        perform_benchmark::<local::Service>(&args)?;
+        if args.wait_all {
+            perform_wait_all_benchmark::<local::Service>(&args)?;
+        } else {
+            perform_benchmark::<local::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
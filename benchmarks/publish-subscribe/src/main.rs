@@ -12,6 +12,7 @@
 
 use core::mem::MaybeUninit;
 
+use benchmark_common::{LatencyHistogram, LatencyReport, OutputFormat};
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_log::set_log_level;
@@ -68,6 +69,7 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -96,6 +98,7 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             };
 
             for _ in 0..args.iterations {
+                let round_trip_start = Time::now().expect("failed to acquire time");
                 sample.send().unwrap();
                 sample = unsafe {
                     sender_a2b
@@ -104,6 +107,9 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
                         .assume_init()
                 };
                 while receiver_b2a.receive().unwrap().is_none() {}
+                histogram.record_duration(
+                    round_trip_start.elapsed().expect("failed to measure time") / 2,
+                );
             }
         });
 
@@ -149,14 +155,18 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns, Sample Size: {}",
-        core::any::type_name::<T>(),
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-        args.payload_size
-    );
+    LatencyReport {
+        benchmark: "publish-subscribe",
+        setup: format!(
+            "{}, Sample Size: {}",
+            core::any::type_name::<T>(),
+            args.payload_size
+        ),
+        iterations: args.iterations,
+        time: stop,
+        histogram: &histogram,
+    }
+    .print(args.output_format);
 
     Ok(())
 }
@@ -198,6 +208,9 @@ struct Args {
     /// The number of additional subscribers per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_subscribers: usize,
+    /// The format in which the results are printed.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -209,6 +222,8 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
         set_log_level(iceoryx2_bb_log::LogLevel::Error);
     }
 
+    LatencyReport::print_header(args.output_format);
+
     let mut at_least_one_benchmark_did_run = false;
 
     if args.bench_ipc || args.bench_all {
@@ -10,6 +10,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use benchmark_common::{LatencyHistogram, LatencyReport, OutputFormat};
 use clap::Parser;
 use iceoryx2_bb_lock_free::spsc::index_queue::FixedSizeIndexQueue;
 use iceoryx2_bb_lock_free::spsc::queue::Queue;
@@ -69,6 +70,7 @@ fn perform_benchmark<Q: PushPop>(
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -77,8 +79,12 @@ fn perform_benchmark<Q: PushPop>(
             start_benchmark_barrier.wait();
 
             for _ in 0..args.iterations {
+                let round_trip_start = Time::now().expect("failed to acquire time");
                 queue_a2b.push(0);
                 while !queue_b2a.pop() {}
+                histogram.record_duration(
+                    round_trip_start.elapsed().expect("failed to measure time") / 2,
+                );
             }
         });
 
@@ -104,13 +110,14 @@ fn perform_benchmark<Q: PushPop>(
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<Q>(),
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+    LatencyReport {
+        benchmark: "queue",
+        setup: core::any::type_name::<Q>().to_string(),
+        iterations: args.iterations,
+        time: stop,
+        histogram: &histogram,
+    }
+    .print(args.output_format);
 
     Ok(())
 }
@@ -127,11 +134,16 @@ struct Args {
     /// The cpu core that shall be used by participant 2
     #[clap(long, default_value_t = 1)]
     cpu_core_participant_2: usize,
+    /// The format in which the results are printed.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
     let args = Args::parse();
 
+    LatencyReport::print_header(args.output_format);
+
     perform_benchmark(&args, Queue::<usize, 1>::new(), Queue::<usize, 1>::new())?;
     perform_benchmark(&args, Queue::<usize, 2>::new(), Queue::<usize, 2>::new())?;
     perform_benchmark(&args, Queue::<usize, 16>::new(), Queue::<usize, 16>::new())?;
@@ -0,0 +1,188 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use benchmark_common::{LatencyHistogram, LatencyReport, OutputFormat};
+use clap::Parser;
+use iceoryx2_bb_log::set_log_level;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_cal::event::unix_datagram_socket::*;
+use iceoryx2_cal::event::{Listener, ListenerBuilder, Notifier, NotifierBuilder, TriggerId};
+use iceoryx2_cal::reactor::{Reactor, ReactorBuilder};
+use iceoryx2_cal::testing::{generate_isolated_config, generate_name};
+
+fn perform_benchmark<R: Reactor>(
+    args: &Args,
+    reactor: R,
+    backend: &str,
+) -> Result<(), Box<dyn core::error::Error>> {
+    let config = generate_isolated_config::<EventImpl>();
+
+    let mut listeners = Vec::with_capacity(args.number_of_attachments);
+    let mut notifiers = Vec::with_capacity(args.number_of_attachments);
+    for _ in 0..args.number_of_attachments {
+        let name = generate_name();
+        listeners.push(
+            unix_datagram_socket::ListenerBuilder::new(&name)
+                .config(&config)
+                .create()?,
+        );
+        notifiers.push(
+            unix_datagram_socket::NotifierBuilder::new(&name)
+                .config(&config)
+                .open()?,
+        );
+    }
+
+    let mut guards = Vec::with_capacity(args.number_of_attachments);
+    for listener in &listeners {
+        guards.push(reactor.attach(listener).expect("failed to attach listener"));
+    }
+
+    let number_of_triggered_attachments = args
+        .number_of_triggered_attachments
+        .clamp(1, args.number_of_attachments);
+    let stride = args.number_of_attachments / number_of_triggered_attachments;
+
+    let mut histogram = LatencyHistogram::new();
+    let mut wait_time = core::time::Duration::ZERO;
+    for _ in 0..args.iterations {
+        for n in 0..number_of_triggered_attachments {
+            notifiers[n * stride].notify(TriggerId::new(0))?;
+        }
+
+        let mut number_of_notifications = 0;
+        let wait_start = Time::now().expect("failed to acquire time");
+        while number_of_notifications < number_of_triggered_attachments {
+            reactor
+                .blocking_wait(|_| number_of_notifications += 1)
+                .expect("failed to wait on reactor");
+        }
+        let duration = wait_start.elapsed().expect("failed to measure time");
+
+        // consume the notifications so that the attachments do not trigger again
+        for n in 0..number_of_triggered_attachments {
+            listeners[n * stride].try_wait_all(|_| {})?;
+        }
+
+        histogram.record_duration(duration);
+        wait_time += duration;
+    }
+
+    LatencyReport {
+        benchmark: "reactor",
+        setup: format!(
+            "{}, Attachments: {}, Triggered: {}",
+            backend, args.number_of_attachments, number_of_triggered_attachments
+        ),
+        iterations: args.iterations as u64,
+        // the report assumes round trips and halves the time, the wait is a single trip
+        time: wait_time * 2,
+        histogram: &histogram,
+    }
+    .print(args.output_format);
+
+    Ok(())
+}
+
+fn create_and_perform_benchmark<R: Reactor>(
+    args: &Args,
+) -> Result<(), Box<dyn core::error::Error>> {
+    let reactor = <R as Reactor>::Builder::new()
+        .create()
+        .expect("failed to create reactor");
+    perform_benchmark(args, reactor, core::any::type_name::<R>())
+}
+
+const ITERATIONS: usize = 100000;
+const NUMBER_OF_ATTACHMENTS: usize = 64;
+const NUMBER_OF_TRIGGERED_ATTACHMENTS: usize = 1;
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// Number of iterations the notify --> wait cycle is repeated
+    #[clap(short, long, default_value_t = ITERATIONS)]
+    iterations: usize,
+    /// Run benchmark for every reactor
+    #[clap(short, long)]
+    bench_all: bool,
+    /// Run benchmark for the posix select based reactor
+    #[clap(long)]
+    bench_posix_select: bool,
+    /// Run benchmark for the epoll based reactor
+    #[clap(long)]
+    bench_epoll: bool,
+    /// Run benchmark for the io_uring based reactor
+    #[clap(long)]
+    bench_io_uring: bool,
+    /// The number of attachments of the reactor
+    #[clap(short, long, default_value_t = NUMBER_OF_ATTACHMENTS)]
+    number_of_attachments: usize,
+    /// The number of attachments that are notified in every iteration
+    #[clap(short = 't', long, default_value_t = NUMBER_OF_TRIGGERED_ATTACHMENTS)]
+    number_of_triggered_attachments: usize,
+    /// Activate full log output
+    #[clap(short, long)]
+    debug_mode: bool,
+    /// The format in which the results are printed.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+
+    if args.debug_mode {
+        set_log_level(iceoryx2_bb_log::LogLevel::Trace);
+    } else {
+        set_log_level(iceoryx2_bb_log::LogLevel::Error);
+    }
+
+    LatencyReport::print_header(args.output_format);
+
+    let mut at_least_one_benchmark_did_run = false;
+
+    if args.bench_posix_select || args.bench_all {
+        create_and_perform_benchmark::<iceoryx2_cal::reactor::posix_select::Reactor>(&args)?;
+        at_least_one_benchmark_did_run = true;
+    }
+
+    #[cfg(target_os = "linux")]
+    {
+        if args.bench_epoll || args.bench_all {
+            create_and_perform_benchmark::<iceoryx2_cal::reactor::epoll::Reactor>(&args)?;
+            at_least_one_benchmark_did_run = true;
+        }
+
+        if args.bench_io_uring || args.bench_all {
+            use iceoryx2_cal::reactor::io_uring;
+            let reactor = <io_uring::Reactor as Reactor>::Builder::new()
+                .create()
+                .expect("failed to create reactor");
+            let backend = if reactor.uses_io_uring() {
+                "io_uring"
+            } else {
+                "io_uring (unavailable, fallback to epoll)"
+            };
+            perform_benchmark(&args, reactor, backend)?;
+            at_least_one_benchmark_did_run = true;
+        }
+    }
+
+    if !at_least_one_benchmark_did_run {
+        println!(
+            "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+        );
+    }
+
+    Ok(())
+}
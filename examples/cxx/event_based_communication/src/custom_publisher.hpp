@@ -51,7 +51,11 @@ class CustomPublisher : public iox2::FileDescriptorBased {
                                   .expect("");
         auto event_service = node.service_builder(service_name).event().open_or_create().expect("");
 
-        auto notifier = event_service.notifier_builder().create().expect("");
+        // samples are sent with `send_and_notify()` which uses the default event id
+        auto notifier = event_service.notifier_builder()
+                            .default_event_id(iox2::EventId(iox::from<PubSubEvent, size_t>(PubSubEvent::SentSample)))
+                            .create()
+                            .expect("");
         auto listener = event_service.listener_builder().create().expect("");
         auto publisher = pubsub_service.publisher_builder().create().expect("");
 
@@ -100,10 +104,8 @@ class CustomPublisher : public iox2::FileDescriptorBased {
         sample.write_payload(TransmissionData {
             static_cast<int32_t>(counter), static_cast<int32_t>(counter), static_cast<double>(counter) * SOME_NUMBER });
         auto initialized_sample = assume_init(std::move(sample));
-        ::iox2::send(std::move(initialized_sample)).expect("");
-
-        m_notifier.notify_with_custom_event_id(iox2::EventId(iox::from<PubSubEvent, size_t>(PubSubEvent::SentSample)))
-            .expect("");
+        // only subscribers that already consumed all previous samples are woken up
+        ::iox2::send_and_notify(std::move(initialized_sample), m_notifier).expect("");
     }
 
     auto operator=(const CustomPublisher&) -> CustomPublisher& = delete;
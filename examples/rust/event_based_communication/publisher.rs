@@ -95,7 +95,11 @@ impl CustomPublisher {
             .open_or_create()?;
 
         let listener = event_service.listener_builder().create()?;
-        let notifier = event_service.notifier_builder().create()?;
+        // samples are sent with `send_and_notify()` which uses the default event id
+        let notifier = event_service
+            .notifier_builder()
+            .default_event_id(PubSubEvent::SentSample.into())
+            .create()?;
         let publisher = pubsub_service.publisher_builder().create()?;
 
         notifier.notify_with_custom_event_id(PubSubEvent::PublisherConnected.into())?;
@@ -140,9 +144,8 @@ impl CustomPublisher {
             funky: counter as f64 * 812.12,
         });
 
-        sample.send()?;
-        self.notifier
-            .notify_with_custom_event_id(PubSubEvent::SentSample.into())?;
+        // only subscribers that already consumed all previous samples are woken up
+        sample.send_and_notify(&self.notifier)?;
 
         Ok(())
     }
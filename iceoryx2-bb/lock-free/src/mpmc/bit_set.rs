@@ -44,7 +44,7 @@ use iceoryx2_bb_elementary::{
     relocatable_container::RelocatableContainer,
     relocatable_ptr::{PointerTrait, RelocatablePointer},
 };
-use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU8, IoxAtomicUsize};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicUsize};
 
 use iceoryx2_bb_log::{fail, fatal_panic};
 
@@ -58,7 +58,7 @@ pub mod details {
 
     use super::*;
 
-    pub type BitsetElement = IoxAtomicU8;
+    pub type BitsetElement = IoxAtomicUsize;
     const BITSET_ELEMENT_BITSIZE: usize = core::mem::size_of::<BitsetElement>() * 8;
 
     struct Id {
@@ -75,12 +75,21 @@ pub mod details {
         }
     }
 
+    /// The bits are stored in words followed by a summary where every bit marks a word that
+    /// may contain set bits. The summary allows [`BitSet::reset_all()`] and
+    /// [`BitSet::reset_next()`] to skip empty words so that their cost depends on the number
+    /// of set bits and not on the capacity.
+    ///
+    /// A bit is always set in the word first and afterwards in the summary. A summary bit is
+    /// only cleared when the word is consumed with it or when the word is rechecked after the
+    /// clearing, therefore a set bit can never be hidden by the summary.
     #[derive(Debug)]
     #[repr(C)]
     pub struct BitSet<PointerType: PointerTrait<BitsetElement>> {
         data_ptr: PointerType,
         capacity: usize,
         array_capacity: usize,
+        summary_capacity: usize,
         reset_position: IoxAtomicUsize,
         is_memory_initialized: IoxAtomicBool,
     }
@@ -96,17 +105,18 @@ pub mod details {
         /// let bitset = BitSet::new(123);
         /// ```
         pub fn new(capacity: usize) -> Self {
-            let array_capacity = Self::array_capacity(capacity);
-            let mut data_ptr = OwningPointer::<BitsetElement>::new_with_alloc(array_capacity);
+            let number_of_elements = Self::number_of_elements(capacity);
+            let mut data_ptr = OwningPointer::<BitsetElement>::new_with_alloc(number_of_elements);
 
-            for i in 0..array_capacity {
+            for i in 0..number_of_elements {
                 unsafe { data_ptr.as_mut_ptr().add(i).write(BitsetElement::new(0)) };
             }
 
             Self {
                 data_ptr,
                 capacity,
-                array_capacity,
+                array_capacity: Self::array_capacity(capacity),
+                summary_capacity: Self::summary_capacity(capacity),
                 is_memory_initialized: IoxAtomicBool::new(true),
                 reset_position: IoxAtomicUsize::new(0),
             }
@@ -119,6 +129,7 @@ pub mod details {
                 data_ptr: RelocatablePointer::new_uninit(),
                 capacity,
                 array_capacity: Self::array_capacity(capacity),
+                summary_capacity: Self::summary_capacity(capacity),
                 is_memory_initialized: IoxAtomicBool::new(false),
                 reset_position: IoxAtomicUsize::new(0),
             }
@@ -133,15 +144,16 @@ pub mod details {
                 "Memory already initialized. Initializing it twice may lead to undefined behavior.");
             }
 
+            let number_of_elements = Self::number_of_elements(self.capacity);
             let memory = fail!(from self, when allocator
             .allocate(Layout::from_size_align_unchecked(
-                    core::mem::size_of::<BitsetElement>() * self.array_capacity,
+                    core::mem::size_of::<BitsetElement>() * number_of_elements,
                     core::mem::align_of::<BitsetElement>())),
             "Failed to initialize since the allocation of the data memory failed.");
 
             self.data_ptr.init(memory);
 
-            for i in 0..self.array_capacity {
+            for i in 0..number_of_elements {
                 unsafe {
                     (self.data_ptr.as_ptr() as *mut BitsetElement)
                         .add(i)
@@ -167,9 +179,23 @@ pub mod details {
             capacity.div_ceil(BITSET_ELEMENT_BITSIZE)
         }
 
+        pub(super) const fn summary_capacity(capacity: usize) -> usize {
+            let array_capacity = Self::array_capacity(capacity);
+            // a single word is scanned directly and requires no summary
+            if array_capacity <= 1 {
+                0
+            } else {
+                array_capacity.div_ceil(BITSET_ELEMENT_BITSIZE)
+            }
+        }
+
+        pub(super) const fn number_of_elements(capacity: usize) -> usize {
+            Self::array_capacity(capacity) + Self::summary_capacity(capacity)
+        }
+
         /// Returns the required memory size for a BitSet with a specified capacity.
         pub const fn const_memory_size(capacity: usize) -> usize {
-            unaligned_mem_size::<BitsetElement>(Self::array_capacity(capacity))
+            unaligned_mem_size::<BitsetElement>(Self::number_of_elements(capacity))
         }
 
         /// Returns the capacity of the BitSet
@@ -186,55 +212,132 @@ pub mod details {
             );
         }
 
+        #[inline(always)]
+        fn word(&self, index: usize) -> &BitsetElement {
+            unsafe { &(*self.data_ptr.as_ptr().add(index)) }
+        }
+
+        #[inline(always)]
+        fn summary(&self, index: usize) -> &BitsetElement {
+            unsafe { &(*self.data_ptr.as_ptr().add(self.array_capacity + index)) }
+        }
+
         fn set_bit(&self, id: Id) -> bool {
-            let data_ref = unsafe { &(*self.data_ptr.as_ptr().add(id.index)) };
-            let mut current = data_ref.load(Ordering::Relaxed);
             let mask = 1 << id.bit;
+            if self.word(id.index).fetch_or(mask, Ordering::Relaxed) & mask != 0 {
+                return false;
+            }
 
-            loop {
-                if current & mask != 0 {
-                    return false;
-                }
+            if self.summary_capacity != 0 {
+                let summary_id = Id::new(id.index);
+                // release, whoever acquires the summary bit must see the bit in the word
+                self.summary(summary_id.index)
+                    .fetch_or(1 << summary_id.bit, Ordering::Release);
+            }
 
-                let current_with_bit = current | mask;
+            true
+        }
 
-                match data_ref.compare_exchange(
-                    current,
-                    current_with_bit,
-                    Ordering::Relaxed,
-                    Ordering::Relaxed,
-                ) {
-                    Ok(_) => {
-                        return true;
-                    }
-                    Err(v) => current = v,
-                }
+        fn clear_summary_bit_of_empty_word(&self, word_index: usize) {
+            if self.summary_capacity == 0 {
+                return;
             }
-        }
 
-        fn clear_bit(&self, id: Id) -> bool {
-            let data_ref = unsafe { &(*self.data_ptr.as_ptr().add(id.index)) };
-            let mut current = data_ref.load(Ordering::Relaxed);
+            let id = Id::new(word_index);
             let mask = 1 << id.bit;
+            self.summary(id.index).fetch_and(!mask, Ordering::AcqRel);
+
+            // a bit may have been set before the summary bit was cleared
+            if self.word(word_index).load(Ordering::Acquire) != 0 {
+                self.summary(id.index).fetch_or(mask, Ordering::Release);
+            }
+        }
+
+        /// Returns the index of the first word starting from `word_index` that may contain
+        /// set bits.
+        fn next_candidate_word(&self, word_index: usize) -> Option<usize> {
+            if word_index >= self.array_capacity {
+                return None;
+            }
 
+            if self.summary_capacity == 0 {
+                return Some(word_index);
+            }
+
+            let id = Id::new(word_index);
+            let mut index = id.index;
+            let mut value = self.summary(index).load(Ordering::Acquire) & (usize::MAX << id.bit);
             loop {
-                if current & mask == 0 {
-                    return false;
+                if value != 0 {
+                    return Some(index * BITSET_ELEMENT_BITSIZE + value.trailing_zeros() as usize);
+                }
+
+                index += 1;
+                if index == self.summary_capacity {
+                    return None;
+                }
+                value = self.summary(index).load(Ordering::Acquire);
+            }
+        }
+
+        fn reset_next_in_range(&self, start: usize, end: usize) -> Option<usize> {
+            let mut position = start;
+            while position < end {
+                let word_index = self.next_candidate_word(position / BITSET_ELEMENT_BITSIZE)?;
+                let word_start = word_index * BITSET_ELEMENT_BITSIZE;
+                if word_start >= end {
+                    return None;
                 }
 
-                let current_with_cleared_bit = current & !mask;
+                let lower_bits_mask = usize::MAX << position.saturating_sub(word_start);
+                let word = self.word(word_index);
+                let mut value = word.load(Ordering::Relaxed);
+                loop {
+                    let candidates = value & lower_bits_mask;
+                    if candidates == 0 {
+                        break;
+                    }
+
+                    let bit = candidates.trailing_zeros() as usize;
+                    if end <= word_start + bit {
+                        return None;
+                    }
 
-                match data_ref.compare_exchange(
-                    current,
-                    current_with_cleared_bit,
-                    Ordering::Relaxed,
-                    Ordering::Relaxed,
-                ) {
-                    Ok(_) => {
-                        return true;
+                    let value_with_cleared_bit = value & !(1 << bit);
+                    match word.compare_exchange(
+                        value,
+                        value_with_cleared_bit,
+                        Ordering::Relaxed,
+                        Ordering::Relaxed,
+                    ) {
+                        Ok(_) => {
+                            if value_with_cleared_bit == 0 {
+                                self.clear_summary_bit_of_empty_word(word_index);
+                            }
+                            self.reset_position
+                                .store(word_start + bit + 1, Ordering::Relaxed);
+                            return Some(word_start + bit);
+                        }
+                        Err(v) => value = v,
                     }
-                    Err(v) => current = v,
                 }
+
+                if value == 0 {
+                    self.clear_summary_bit_of_empty_word(word_index);
+                }
+
+                position = word_start + BITSET_ELEMENT_BITSIZE;
+            }
+
+            None
+        }
+
+        fn reset_word<F: FnMut(usize)>(&self, word_index: usize, callback: &mut F) {
+            let mut value = self.word(word_index).swap(0, Ordering::Relaxed);
+            let main_index = word_index * BITSET_ELEMENT_BITSIZE;
+            while value != 0 {
+                callback(main_index + value.trailing_zeros() as usize);
+                value &= value - 1;
             }
         }
 
@@ -258,14 +361,8 @@ pub mod details {
             self.verify_init("reset_next()");
 
             let current_position = self.reset_position.load(Ordering::Relaxed);
-            for pos in (current_position..self.capacity).chain(0..current_position) {
-                if self.clear_bit(Id::new(pos)) {
-                    self.reset_position.store(pos + 1, Ordering::Relaxed);
-                    return Some(pos);
-                }
-            }
-
-            None
+            self.reset_next_in_range(current_position, self.capacity)
+                .or_else(|| self.reset_next_in_range(0, current_position))
         }
 
         /// Reset every set bit in the BitSet and call the provided callback for every bit that
@@ -273,13 +370,19 @@ pub mod details {
         pub fn reset_all<F: FnMut(usize)>(&self, mut callback: F) {
             self.verify_init("reset_all()");
 
-            for i in 0..self.array_capacity {
-                let value = unsafe { (*self.data_ptr.as_ptr().add(i)).swap(0, Ordering::Relaxed) };
-                let main_index = i * BITSET_ELEMENT_BITSIZE;
-                for b in 0..BITSET_ELEMENT_BITSIZE {
-                    if value & (1 << b) != 0 {
-                        callback(main_index + b);
-                    }
+            if self.summary_capacity == 0 {
+                for i in 0..self.array_capacity {
+                    self.reset_word(i, &mut callback);
+                }
+                return;
+            }
+
+            for i in 0..self.summary_capacity {
+                let mut words = self.summary(i).swap(0, Ordering::AcqRel);
+                while words != 0 {
+                    let word_index = i * BITSET_ELEMENT_BITSIZE + words.trailing_zeros() as usize;
+                    self.reset_word(word_index, &mut callback);
+                    words &= words - 1;
                 }
             }
         }
@@ -293,8 +396,9 @@ pub struct FixedSizeBitSet<const CAPACITY: usize> {
     bitset: RelocatableBitSet,
     // TODO: we waste here some memory since rust does us not allow to perform const operations
     //       on generic parameters. Whenever this is supported, change this line into
-    //       data: [`details::BitsetElement; Self::array_capacity(CAPACITY)`]
-    //       For now we can live with it, since the bitsets are usually rather small
+    //       data: [`details::BitsetElement; Self::number_of_elements(CAPACITY)`]
+    //       For now we can live with it, since the bitsets are usually rather small.
+    //       CAPACITY elements always suffice for the words and their summary.
     data: [details::BitsetElement; CAPACITY],
 }
 
@@ -86,6 +86,12 @@ impl<PointerType: PointerTrait<UnsafeCell<u64>> + Debug> Consumer<'_, PointerTyp
     pub fn pop(&mut self) -> Option<u64> {
         unsafe { self.queue.pop() }
     }
+
+    /// Returns the value that would be acquired by the next [`Consumer::pop()`] without
+    /// removing it. If the queue is empty it returns [`None`].
+    pub fn peek(&self) -> Option<u64> {
+        unsafe { self.queue.peek() }
+    }
 }
 
 impl<PointerType: PointerTrait<UnsafeCell<u64>>> Drop for Consumer<'_, PointerType> {
@@ -366,6 +372,32 @@ pub mod details {
             Some(value)
         }
 
+        /// Returns the index that would be acquired by the next
+        /// [`SafelyOverflowingIndexQueue::pop()`] without removing it. If the queue is empty
+        /// [`None`] is returned. When the producer overflows the queue concurrently the
+        /// returned index can already be outdated.
+        ///
+        /// # Safety
+        ///
+        ///  * [`SafelyOverflowingIndexQueue::peek()`] cannot be called concurrently with
+        ///    [`SafelyOverflowingIndexQueue::pop()`]. The user has to ensure that at most one
+        ///    thread access these methods.
+        ///  * It has to be ensured that the memory is initialized with
+        ///    [`SafelyOverflowingIndexQueue::init()`].
+        pub unsafe fn peek(&self) -> Option<u64> {
+            let read_position = self.read_position.load(Ordering::Relaxed);
+            ////////////////
+            // SYNC POINT W
+            ////////////////
+            let is_empty = read_position == self.write_position.load(Ordering::Acquire);
+
+            if is_empty {
+                return None;
+            }
+
+            Some(unsafe { *self.at(read_position) })
+        }
+
         fn acquire_read_and_write_position(&self) -> (usize, usize) {
             loop {
                 let write_position = self.write_position.load(Ordering::Relaxed);
@@ -488,6 +520,16 @@ impl<const CAPACITY: usize> FixedSizeSafelyOverflowingIndexQueue<CAPACITY> {
         self.state.pop()
     }
 
+    /// See [`SafelyOverflowingIndexQueue::peek()`]
+    ///
+    /// # Safety
+    ///
+    /// * It must be ensured that no other thread/process calls this method concurrently
+    ///
+    pub unsafe fn peek(&self) -> Option<u64> {
+        self.state.peek()
+    }
+
     /// See [`SafelyOverflowingIndexQueue::capacity()`]
     pub const fn capacity(&self) -> usize {
         self.state.capacity()
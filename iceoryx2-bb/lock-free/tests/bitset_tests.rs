@@ -144,6 +144,74 @@ fn bit_set_reset_next_is_fair() {
     assert_that!(sut.reset_next(), eq None);
 }
 
+#[test]
+fn bit_set_reset_all_of_sparse_bits_works() {
+    const CAPACITY: usize = 70000;
+    const STRIDE: usize = 997;
+    let sut = BitSet::new(CAPACITY);
+
+    for id in (0..CAPACITY).step_by(STRIDE) {
+        assert_that!(sut.set(id), eq true);
+    }
+
+    let mut ids = vec![];
+    sut.reset_all(|id| ids.push(id));
+
+    let expected_ids: Vec<usize> = (0..CAPACITY).step_by(STRIDE).collect();
+    assert_that!(ids, eq expected_ids);
+
+    let mut counter = 0;
+    sut.reset_all(|_| {
+        counter += 1;
+    });
+
+    assert_that!(counter, eq 0);
+}
+
+#[test]
+fn bit_set_reset_next_of_sparse_bits_works() {
+    const CAPACITY: usize = 70000;
+    const STRIDE: usize = 4999;
+    let sut = BitSet::new(CAPACITY);
+
+    for id in (0..CAPACITY).step_by(STRIDE) {
+        assert_that!(sut.set(id), eq true);
+    }
+
+    for id in (0..CAPACITY).step_by(STRIDE) {
+        assert_that!(sut.reset_next(), eq Some(id));
+    }
+    assert_that!(sut.reset_next(), eq None);
+
+    assert_that!(sut.set(CAPACITY - 1), eq true);
+    assert_that!(sut.reset_next(), eq Some(CAPACITY - 1));
+    assert_that!(sut.reset_next(), eq None);
+}
+
+#[test]
+fn fixed_size_bit_set_with_small_capacity_works() {
+    fn fill_and_reset<const CAPACITY: usize>() {
+        let sut = FixedSizeBitSet::<CAPACITY>::new();
+
+        for id in 0..CAPACITY {
+            assert_that!(sut.set(id), eq true);
+        }
+
+        let mut counter = 0;
+        sut.reset_all(|id| {
+            assert_that!(id, eq counter);
+            counter += 1;
+        });
+
+        assert_that!(counter, eq CAPACITY);
+    }
+
+    fill_and_reset::<1>();
+    fill_and_reset::<2>();
+    fill_and_reset::<65>();
+    fill_and_reset::<129>();
+}
+
 #[test]
 fn bit_set_concurrent_set_and_reset_works() {
     let _watchdog = Watchdog::new_with_timeout(Duration::from_secs(60));
@@ -86,6 +86,33 @@ fn spsc_safely_overflowing_index_queue_push_pop_alteration_works() {
     }
 }
 
+#[test]
+fn spsc_safely_overflowing_index_queue_peek_returns_next_value_without_removing_it() {
+    const CAPACITY: usize = 4;
+    let sut = FixedSizeSafelyOverflowingIndexQueue::<CAPACITY>::new();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+    let mut sut_consumer = sut.acquire_consumer().unwrap();
+
+    assert_that!(sut_consumer.peek(), is_none);
+
+    for i in 0..CAPACITY {
+        assert_that!(sut_producer.push(i as u64), is_none);
+    }
+    assert_that!(sut_consumer.peek(), eq Some(0));
+    assert_that!(sut, len CAPACITY);
+
+    assert_that!(sut_producer.push(1234), eq Some(0));
+    assert_that!(sut_consumer.peek(), eq Some(1));
+
+    for i in 1..CAPACITY {
+        assert_that!(sut_consumer.peek(), eq Some(i as u64));
+        assert_that!(sut_consumer.pop(), eq Some(i as u64));
+    }
+    assert_that!(sut_consumer.peek(), eq Some(1234));
+    assert_that!(sut_consumer.pop(), eq Some(1234));
+    assert_that!(sut_consumer.peek(), is_none);
+}
+
 #[test]
 fn spsc_safely_overflowing_index_queue_get_consumer_twice_fails() {
     let sut = FixedSizeSafelyOverflowingIndexQueue::<1024>::new();
@@ -10,6 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+//! The [`DeadlineQueue`] manages multiple cyclic deadlines in a hierarchical timing wheel.
+//! Optionally, a timer slack can be defined with [`DeadlineQueueBuilder::timer_slack()`]
+//! so that deadlines which are close to each other are reported with one wakeup.
+//!
 //! # Example
 //!
 //! ```no_run
@@ -38,19 +42,45 @@
 
 pub use iceoryx2_bb_elementary::CallbackProgression;
 
-use core::{cell::RefCell, fmt::Debug, sync::atomic::Ordering, time::Duration};
+use core::{cell::RefCell, fmt::Debug, time::Duration};
 use iceoryx2_bb_log::fail;
-use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
 
 use crate::{
     clock::ClockType,
     clock::{Time, TimeError},
 };
 
+// every level of the timing wheel consists of 2^LEVEL_BITS slots
+const LEVEL_BITS: u32 = 6;
+const NUMBER_OF_SLOTS: usize = 1 << LEVEL_BITS;
+const SLOT_MASK: u64 = NUMBER_OF_SLOTS as u64 - 1;
+const NUMBER_OF_LEVELS: usize = 6;
+// the resolution of the timing wheel is 2^TICK_BITS ns, the exact deadline is stored in
+// every attachment so the resolution only affects the bucketing and not the precision
+const TICK_BITS: u32 = 10;
+// deadlines that are further away than the range of the wheel are stored in the last
+// level and cascaded down when the wheel advances
+const WHEEL_RANGE_MASK: u64 = (1 << (LEVEL_BITS * NUMBER_OF_LEVELS as u32)) - 1;
+const INVALID: u32 = u32::MAX;
+
 /// Represents an index to identify an added deadline_queue with [`DeadlineQueue::add_deadline_interval()`].
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
 pub struct DeadlineQueueIndex(u64);
 
+impl DeadlineQueueIndex {
+    fn new(position: u32, generation: u32) -> Self {
+        Self(((generation as u64) << 32) | position as u64)
+    }
+
+    fn position(&self) -> u32 {
+        self.0 as u32
+    }
+
+    fn generation(&self) -> u32 {
+        (self.0 >> 32) as u32
+    }
+}
+
 pub trait DeadlineQueueGuardable: Debug {}
 
 /// Represents the RAII guard of [`DeadlineQueue`] and is returned by [`DeadlineQueue::add_deadline_interval()`].
@@ -77,13 +107,14 @@ impl DeadlineQueueGuard<'_> {
 
 impl Drop for DeadlineQueueGuard<'_> {
     fn drop(&mut self) {
-        self.deadline_queue.remove(self.index.0);
+        self.deadline_queue.remove(self.index);
     }
 }
 
 /// Builder to create a [`DeadlineQueue`].
 pub struct DeadlineQueueBuilder {
     clock_type: ClockType,
+    timer_slack: Duration,
 }
 
 impl Default for DeadlineQueueBuilder {
@@ -97,6 +128,7 @@ impl DeadlineQueueBuilder {
     pub fn new() -> Self {
         Self {
             clock_type: ClockType::default(),
+            timer_slack: Duration::ZERO,
         }
     }
 
@@ -107,6 +139,16 @@ impl DeadlineQueueBuilder {
         self
     }
 
+    /// Defines the timer slack. Every deadline is delayed up to the next multiple of the
+    /// timer slack so that deadlines that are close to each other are reported together
+    /// with one wakeup. A deadline is never reported before it was hit.
+    /// By default it is [`Duration::ZERO`] and every deadline is reported as precisely as
+    /// possible.
+    pub fn timer_slack(mut self, value: Duration) -> Self {
+        self.timer_slack = value;
+        self
+    }
+
     /// Creates a new [`DeadlineQueue`]
     pub fn create(self) -> Result<DeadlineQueue, TimeError> {
         let start_time = fail!(from "DeadlineQueue::new()", when Time::now_with_clock(self.clock_type),
@@ -114,39 +156,192 @@ impl DeadlineQueueBuilder {
         let start_time = start_time.as_duration().as_nanos();
 
         Ok(DeadlineQueue {
-            attachments: RefCell::new(vec![]),
-            id_count: IoxAtomicU64::new(0),
+            internals: RefCell::new(Internals {
+                attachments: vec![],
+                free_positions: vec![],
+                len: 0,
+                elapsed_ticks: 0,
+                occupied: [0; NUMBER_OF_LEVELS],
+                slots: [[INVALID; NUMBER_OF_SLOTS]; NUMBER_OF_LEVELS],
+                expired: vec![],
+                deferred: vec![],
+            }),
+            start_time,
+            timer_slack: self.timer_slack.as_nanos().min(u64::MAX as u128) as u64,
             clock_type: self.clock_type,
-            previous_iteration: RefCell::new(start_time),
         })
     }
 }
 
 #[derive(Debug)]
 struct Attachment {
-    index: u64,
-    period: u128,
-    start_time: u128,
+    generation: u32,
+    is_in_use: bool,
+    period: u64,
+    start_time: u64,
+    // the time when the attachment is reported as missed, the deadline rounded up to the
+    // timer slack
+    due_time: u64,
+    level: u8,
+    slot: u8,
+    previous: u32,
+    next: u32,
 }
 
 impl Attachment {
-    fn new(index: u64, period: u128, clock_type: ClockType) -> Result<Self, TimeError> {
-        let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
-                                "Failed to create DeadlineQueue attachment since the current time could not be acquired.");
-        let start_time = start_time.as_duration().as_nanos();
+    fn schedule(&mut self, now: u64, timer_slack: u64) {
+        if self.period == 0 {
+            self.due_time = now;
+            return;
+        }
 
-        Ok(Self {
-            index,
-            period,
-            start_time,
-        })
+        // the next deadline is the first period boundary after now
+        let passed_periods = now.saturating_sub(self.start_time) / self.period + 1;
+        let deadline = self
+            .start_time
+            .saturating_add(passed_periods.saturating_mul(self.period));
+
+        self.due_time = match timer_slack {
+            0 | 1 => deadline,
+            _ => deadline.div_ceil(timer_slack).saturating_mul(timer_slack),
+        };
     }
+}
 
-    fn reset(&mut self, clock_type: ClockType) -> Result<(), TimeError> {
-        let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
-                                "Failed to reset DeadlineQueue attachment since the current time could not be acquired.");
-        self.start_time = start_time.as_duration().as_nanos();
-        Ok(())
+// Hierarchical timing wheel. Level `k` has slots that cover 2^(LEVEL_BITS * k) ticks. An
+// attachment is stored in the lowest level in which its due time and the current time
+// differ only in the slot index of that level. Every slot is an intrusive doubly linked
+// list of attachments, therefore insert and remove are O(1), and finding the next
+// occupied slot requires only a bit scan per level.
+#[derive(Debug)]
+struct Internals {
+    attachments: Vec<Attachment>,
+    free_positions: Vec<u32>,
+    len: usize,
+    elapsed_ticks: u64,
+    occupied: [u64; NUMBER_OF_LEVELS],
+    slots: [[u32; NUMBER_OF_SLOTS]; NUMBER_OF_LEVELS],
+    // reused buffers to avoid allocations when deadlines expire
+    expired: Vec<DeadlineQueueIndex>,
+    deferred: Vec<u32>,
+}
+
+impl Internals {
+    fn get(&self, index: DeadlineQueueIndex) -> Option<u32> {
+        let position = index.position();
+        match self.attachments.get(position as usize) {
+            Some(a) if a.is_in_use && a.generation == index.generation() => Some(position),
+            _ => None,
+        }
+    }
+
+    fn link(&mut self, position: u32) {
+        let due_ticks = self.attachments[position as usize].due_time >> TICK_BITS;
+        let when = due_ticks
+            .max(self.elapsed_ticks)
+            .min(self.elapsed_ticks | WHEEL_RANGE_MASK);
+
+        let significant_bits = 63 - ((self.elapsed_ticks ^ when) | SLOT_MASK).leading_zeros();
+        let level = (significant_bits / LEVEL_BITS) as usize;
+        let slot = ((when >> (LEVEL_BITS * level as u32)) & SLOT_MASK) as usize;
+
+        let head = self.slots[level][slot];
+        if head != INVALID {
+            self.attachments[head as usize].previous = position;
+        }
+
+        let attachment = &mut self.attachments[position as usize];
+        attachment.previous = INVALID;
+        attachment.next = head;
+        attachment.level = level as u8;
+        attachment.slot = slot as u8;
+
+        self.slots[level][slot] = position;
+        self.occupied[level] |= 1 << slot;
+    }
+
+    fn unlink(&mut self, position: u32) {
+        let attachment = &self.attachments[position as usize];
+        let (previous, next) = (attachment.previous, attachment.next);
+        let (level, slot) = (attachment.level as usize, attachment.slot as usize);
+
+        if next != INVALID {
+            self.attachments[next as usize].previous = previous;
+        }
+
+        if previous != INVALID {
+            self.attachments[previous as usize].next = next;
+        } else {
+            self.slots[level][slot] = next;
+            if next == INVALID {
+                self.occupied[level] &= !(1 << slot);
+            }
+        }
+    }
+
+    // returns the level, the slot and the first tick of the earliest occupied slot
+    fn next_slot(&self) -> Option<(usize, usize, u64)> {
+        for level in 0..NUMBER_OF_LEVELS {
+            if self.occupied[level] != 0 {
+                let slot = self.occupied[level].trailing_zeros() as u64;
+                let shift = LEVEL_BITS * level as u32;
+                let level_block = (1u64 << (shift + LEVEL_BITS)) - 1;
+                let first_tick = (self.elapsed_ticks & !level_block) | (slot << shift);
+                return Some((level, slot as usize, first_tick));
+            }
+        }
+
+        None
+    }
+
+    fn next_due_time(&self) -> Option<u64> {
+        let (level, slot, _) = self.next_slot()?;
+
+        let mut min_due_time = u64::MAX;
+        let mut position = self.slots[level][slot];
+        while position != INVALID {
+            let attachment = &self.attachments[position as usize];
+            min_due_time = min_due_time.min(attachment.due_time);
+            position = attachment.next;
+        }
+
+        Some(min_due_time)
+    }
+
+    // collects all attachments that are due at `now` in `expired`, schedules them for
+    // their next deadline and advances the wheel
+    fn expire(&mut self, now: u64, timer_slack: u64) {
+        let now_ticks = now >> TICK_BITS;
+
+        while let Some((level, slot, first_tick)) = self.next_slot() {
+            if now_ticks < first_tick {
+                break;
+            }
+
+            let mut position = self.slots[level][slot];
+            self.slots[level][slot] = INVALID;
+            self.occupied[level] &= !(1 << slot);
+
+            while position != INVALID {
+                let attachment = &mut self.attachments[position as usize];
+                let next = attachment.next;
+                if attachment.due_time <= now {
+                    attachment.schedule(now, timer_slack);
+                    self.expired
+                        .push(DeadlineQueueIndex::new(position, attachment.generation));
+                }
+                self.deferred.push(position);
+                position = next;
+            }
+        }
+
+        self.elapsed_ticks = self.elapsed_ticks.max(now_ticks);
+
+        let mut deferred = core::mem::take(&mut self.deferred);
+        for position in deferred.drain(..) {
+            self.link(position);
+        }
+        self.deferred = deferred;
     }
 }
 
@@ -154,11 +349,14 @@ impl Attachment {
 /// [`DeadlineQueue::add_deadline_interval()`], to wait on them by acquiring the waiting time to the next deadline_queue
 /// with [`DeadlineQueue::duration_until_next_deadline()`] and to acquire all missed deadline_queues via
 /// [`DeadlineQueue::missed_deadlines()`].
+///
+/// The deadlines are managed in a hierarchical timing wheel so that adding, resetting,
+/// removing and expiring a deadline is independent of the number of attachments.
 #[derive(Debug)]
 pub struct DeadlineQueue {
-    attachments: RefCell<Vec<Attachment>>,
-    id_count: IoxAtomicU64,
-    previous_iteration: RefCell<u128>,
+    internals: RefCell<Internals>,
+    start_time: u128,
+    timer_slack: u64,
 
     clock_type: ClockType,
 }
@@ -166,12 +364,25 @@ pub struct DeadlineQueue {
 impl DeadlineQueue {
     /// Returns the number of attachments.
     pub fn len(&self) -> usize {
-        self.attachments.borrow().len()
+        self.internals.borrow().len
     }
 
     /// Returns true if the deadline queue does not contain any attachments.
     pub fn is_empty(&self) -> bool {
-        self.attachments.borrow().is_empty()
+        self.len() == 0
+    }
+
+    /// Returns the timer slack that was defined with [`DeadlineQueueBuilder::timer_slack()`].
+    pub fn timer_slack(&self) -> Duration {
+        Duration::from_nanos(self.timer_slack)
+    }
+
+    // returns the time in ns since the creation of the deadline queue
+    fn now(&self) -> Result<u64, TimeError> {
+        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+                        "Unable to acquire the current time.");
+        let now = now.as_duration().as_nanos().saturating_sub(self.start_time);
+        Ok(now.min(u64::MAX as u128) as u64)
     }
 
     /// Adds a cyclic deadline to the [`DeadlineQueue`] and returns an [`DeadlineQueueGuard`] to
@@ -182,41 +393,69 @@ impl DeadlineQueue {
         &self,
         deadline: Duration,
     ) -> Result<DeadlineQueueGuard, TimeError> {
-        let current_idx = self.id_count.load(Ordering::Relaxed);
-        self.attachments.borrow_mut().push(Attachment::new(
-            current_idx,
-            deadline.as_nanos(),
-            self.clock_type,
-        )?);
-        self.id_count.fetch_add(1, Ordering::Relaxed);
+        let now = fail!(from self, when self.now(),
+                        "Failed to create DeadlineQueue attachment since the current time could not be acquired.");
+
+        let mut internals = self.internals.borrow_mut();
+        let mut attachment = Attachment {
+            generation: 0,
+            is_in_use: true,
+            period: deadline.as_nanos().min(u64::MAX as u128) as u64,
+            start_time: now,
+            due_time: now,
+            level: 0,
+            slot: 0,
+            previous: INVALID,
+            next: INVALID,
+        };
+        attachment.schedule(now, self.timer_slack);
+
+        let position = match internals.free_positions.pop() {
+            Some(position) => {
+                attachment.generation = internals.attachments[position as usize]
+                    .generation
+                    .wrapping_add(1);
+                internals.attachments[position as usize] = attachment;
+                position
+            }
+            None => {
+                internals.attachments.push(attachment);
+                (internals.attachments.len() - 1) as u32
+            }
+        };
+
+        internals.link(position);
+        internals.len += 1;
+        let generation = internals.attachments[position as usize].generation;
 
         Ok(DeadlineQueueGuard {
             deadline_queue: self,
-            index: DeadlineQueueIndex(current_idx),
+            index: DeadlineQueueIndex::new(position, generation),
         })
     }
 
-    fn remove(&self, index: u64) {
-        let mut index_to_remove = None;
-        for (n, attachment) in self.attachments.borrow().iter().enumerate() {
-            if attachment.index == index {
-                index_to_remove = Some(n);
-                break;
-            }
-        }
-
-        if let Some(n) = index_to_remove {
-            self.attachments.borrow_mut().remove(n);
+    fn remove(&self, index: DeadlineQueueIndex) {
+        let mut internals = self.internals.borrow_mut();
+        if let Some(position) = internals.get(index) {
+            internals.unlink(position);
+            internals.attachments[position as usize].is_in_use = false;
+            internals.free_positions.push(position);
+            internals.len -= 1;
         }
     }
 
     /// Resets the attached deadline_queue and wait again the full time.
     pub fn reset(&self, index: DeadlineQueueIndex) -> Result<(), TimeError> {
-        for attachment in &mut *self.attachments.borrow_mut() {
-            if attachment.index == index.0 {
-                attachment.reset(self.clock_type)?;
-                break;
-            }
+        let now = fail!(from self, when self.now(),
+                        "Failed to reset DeadlineQueue attachment since the current time could not be acquired.");
+
+        let mut internals = self.internals.borrow_mut();
+        if let Some(position) = internals.get(index) {
+            internals.unlink(position);
+            let attachment = &mut internals.attachments[position as usize];
+            attachment.start_time = now;
+            attachment.schedule(now, self.timer_slack);
+            internals.link(position);
         }
 
         Ok(())
@@ -229,65 +468,13 @@ impl DeadlineQueue {
             return Ok(Duration::MAX);
         }
 
-        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+        let now = fail!(from self, when self.now(),
                         "Unable to return next duration since the current time could not be acquired.");
-        let now = now.as_duration().as_nanos();
-        let mut has_missed_deadline = false;
-        self.handle_missed_deadlines(now, |_| {
-            has_missed_deadline = true;
-            CallbackProgression::Stop
-        });
-
-        if has_missed_deadline {
-            return Ok(Duration::ZERO);
-        }
-
-        // must be set after the return caused by a missed deadline, otherwise the user is unable
-        // to acquire the missed deadline
-        *self.previous_iteration.borrow_mut() = now;
 
-        let mut min_time = u128::MAX;
-        for attachment in &*self.attachments.borrow() {
-            min_time =
-                min_time.min(attachment.period - (now - attachment.start_time) % attachment.period);
-        }
-
-        Ok(Duration::from_nanos(min_time as _))
-    }
-
-    fn handle_missed_deadlines<F: FnMut(DeadlineQueueIndex) -> CallbackProgression>(
-        &self,
-        now: u128,
-        mut call: F,
-    ) {
-        let last = *self.previous_iteration.borrow();
-
-        for attachment in &*self.attachments.borrow() {
-            let duration_until_last = last.max(attachment.start_time) - attachment.start_time;
-            let duration_until_now = now - attachment.start_time;
-            match attachment.period {
-                0 => {
-                    if matches!(
-                        call(DeadlineQueueIndex(attachment.index)),
-                        CallbackProgression::Stop
-                    ) {
-                        return;
-                    }
-                }
-                _ => {
-                    let last = duration_until_last / attachment.period;
-                    let current = duration_until_now / attachment.period;
-
-                    if last < current
-                        && matches!(
-                            call(DeadlineQueueIndex(attachment.index)),
-                            CallbackProgression::Stop
-                        )
-                    {
-                        return;
-                    }
-                }
-            }
+        match self.internals.borrow().next_due_time() {
+            Some(due_time) if due_time > now => Ok(Duration::from_nanos(due_time - now)),
+            Some(_) => Ok(Duration::ZERO),
+            None => Ok(Duration::MAX),
         }
     }
 
@@ -297,12 +484,25 @@ impl DeadlineQueue {
         &self,
         mut call: F,
     ) -> Result<(), TimeError> {
-        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+        let now = fail!(from self, when self.now(),
                         "Unable to return next duration since the current time could not be acquired.");
 
-        let now = now.as_duration().as_nanos();
-        self.handle_missed_deadlines(now, |idx| -> CallbackProgression { call(idx) });
-        *self.previous_iteration.borrow_mut() = now;
+        // the callback is allowed to add, reset or remove deadlines, therefore the
+        // internals must not be borrowed while it is called
+        let mut expired = {
+            let mut internals = self.internals.borrow_mut();
+            internals.expire(now, self.timer_slack);
+            core::mem::take(&mut internals.expired)
+        };
+
+        for index in expired.iter() {
+            if call(*index) == CallbackProgression::Stop {
+                break;
+            }
+        }
+
+        expired.clear();
+        self.internals.borrow_mut().expired = expired;
 
         Ok(())
     }
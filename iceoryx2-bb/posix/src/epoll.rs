@@ -0,0 +1,372 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstracts the Linux epoll facility. Like the
+//! [`FileDescriptorSet`](crate::file_descriptor_set::FileDescriptorSet) it can be used to
+//! wait on multiple objects which implement the [`SynchronousMultiplexing`] trait but it
+//! has no upper limit of attachments and the cost of a wakeup depends only on the number
+//! of triggered [`FileDescriptor`]s and not on the number of attached ones.
+//!
+//! # Example
+//!
+//! ```ignore
+//! use iceoryx2_bb_posix::epoll::*;
+//! use iceoryx2_bb_posix::unix_datagram_socket::*;
+//! use core::time::Duration;
+//! use iceoryx2_bb_system_types::file_path::FilePath;
+//! use iceoryx2_bb_container::semantic_string::SemanticString;
+//!
+//! let socket_name = FilePath::new(b"some_socket").unwrap();
+//!
+//! let sut_receiver = UnixDatagramReceiverBuilder::new(&socket_name)
+//!     .creation_mode(CreationMode::PurgeAndCreate)
+//!     .create()
+//!     .unwrap();
+//!
+//! let sut_sender = UnixDatagramSenderBuilder::new(&socket_name)
+//!     .create()
+//!     .unwrap();
+//!
+//! let epoll = EpollBuilder::new().create().unwrap();
+//! let _guard = epoll.add(&sut_receiver).unwrap();
+//! let send_data: Vec<u8> = vec![1u8, 3u8, 3u8, 7u8, 13u8, 37u8];
+//! sut_sender.try_send(send_data.as_slice()).unwrap();
+//!
+//! // in some other process
+//! let result = epoll.timed_wait(Duration::from_secs(1),
+//!     |fd| println!("Fd was triggered {}", unsafe { fd.native_handle() })).unwrap();
+//! ```
+
+use core::{cell::UnsafeCell, fmt::Debug, time::Duration};
+
+use crate::file_descriptor::FileDescriptor;
+use crate::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::posix::Struct;
+use iceoryx2_pal_posix::*;
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum EpollCreateError {
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum EpollAddError {
+    AlreadyAttached,
+    InsufficientMemory,
+    WatchLimitReached,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum EpollModifyError {
+    NotAttached,
+    InsufficientMemory,
+    WatchLimitReached,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum EpollWaitError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+/// Detaches the [`FileDescriptor`] from the [`Epoll`] when it goes out of scope.
+pub struct EpollGuard<'epoll, 'fd> {
+    epoll: &'epoll Epoll,
+    fd: &'fd FileDescriptor,
+}
+
+impl<'fd> EpollGuard<'_, 'fd> {
+    pub fn file_descriptor(&self) -> &'fd FileDescriptor {
+        self.fd
+    }
+}
+
+impl Drop for EpollGuard<'_, '_> {
+    fn drop(&mut self) {
+        self.epoll.remove(self.fd)
+    }
+}
+
+/// Creates a new [`Epoll`].
+#[derive(Debug, Default)]
+pub struct EpollBuilder {}
+
+impl EpollBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn create(self) -> Result<Epoll, EpollCreateError> {
+        let msg = "Unable to create epoll";
+        let raw_fd = unsafe { posix::epoll_create1(posix::EPOLL_CLOEXEC) };
+
+        if raw_fd == -1 {
+            handle_errno!(EpollCreateError, from self,
+                Errno::EMFILE => (PerProcessFileHandleLimitReached, "{} since the processes file descriptor limit was reached.", msg),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{} since the system wide file descriptor limit was reached.", msg),
+                Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+            );
+        }
+
+        Ok(Epoll {
+            epoll_fd: unsafe { FileDescriptor::new_unchecked(raw_fd) },
+            internals: UnsafeCell::new(Internals {
+                events: vec![],
+                suspended: vec![],
+                len: 0,
+            }),
+        })
+    }
+}
+
+struct Internals {
+    events: Vec<posix::epoll_event>,
+    // attached file descriptors that are removed from the epoll until they are resumed
+    suspended: Vec<i32>,
+    len: usize,
+}
+
+/// Waits on multiple objects which implement the [`SynchronousMultiplexing`] trait with
+/// the Linux epoll facility. Waits until the attached objects become readable.
+pub struct Epoll {
+    epoll_fd: FileDescriptor,
+    internals: UnsafeCell<Internals>,
+}
+
+impl Debug for Epoll {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "Epoll {{ epoll_fd: {}, len: {} }}",
+            unsafe { self.epoll_fd.native_handle() },
+            self.internals().len
+        )
+    }
+}
+
+impl Epoll {
+    fn internals(&self) -> &Internals {
+        unsafe { &*self.internals.get() }
+    }
+
+    #[allow(clippy::mut_from_ref)]
+    fn internals_mut(&self) -> &mut Internals {
+        unsafe { &mut *self.internals.get() }
+    }
+
+    /// Attaches an object. As long as the returned [`EpollGuard`] lives the object is
+    /// monitored.
+    pub fn add<'epoll, 'fd, F: SynchronousMultiplexing>(
+        &'epoll self,
+        fd: &'fd F,
+    ) -> Result<EpollGuard<'epoll, 'fd>, EpollAddError> {
+        self.add_impl(fd.file_descriptor())
+    }
+
+    fn add_impl<'epoll, 'fd>(
+        &'epoll self,
+        fd: &'fd FileDescriptor,
+    ) -> Result<EpollGuard<'epoll, 'fd>, EpollAddError> {
+        let msg = "Unable to add file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        if self.is_suspended(raw_fd) {
+            fail!(from self, with EpollAddError::AlreadyAttached,
+                "{} {:?} since it is already attached.", msg, fd);
+        }
+
+        if self.control(posix::EPOLL_CTL_ADD, raw_fd) == -1 {
+            handle_errno!(EpollAddError, from self,
+                fatal Errno::EBADF => ("This should never happen! {} {:?} since it is not a valid file descriptor.", msg, fd);
+                fatal Errno::EPERM => ("This should never happen! {} {:?} since it does not support epoll.", msg, fd),
+                Errno::EEXIST => (AlreadyAttached, "{} {:?} since it is already attached.", msg, fd),
+                Errno::ENOMEM => (InsufficientMemory, "{} {:?} due to insufficient memory.", msg, fd),
+                Errno::ENOSPC => (WatchLimitReached,
+                    "{} {:?} since the per user limit of epoll watches (/proc/sys/fs/epoll/max_user_watches) was reached.", msg, fd),
+                v => (UnknownError(v as i32), "{} {:?} since an unknown error occurred ({}).", msg, fd, v)
+            );
+        }
+
+        let internals = self.internals_mut();
+        internals.len += 1;
+        if internals.events.len() < internals.len {
+            internals
+                .events
+                .resize(internals.len, posix::epoll_event::new());
+        }
+
+        Ok(EpollGuard { epoll: self, fd })
+    }
+
+    fn control(&self, operation: posix::int, raw_fd: i32) -> posix::int {
+        let mut event = posix::epoll_event {
+            events: posix::EPOLLIN,
+            data: raw_fd as u64,
+        };
+
+        unsafe { posix::epoll_ctl(self.epoll_fd.native_handle(), operation, raw_fd, &mut event) }
+    }
+
+    fn is_suspended(&self, raw_fd: i32) -> bool {
+        self.internals().suspended.contains(&raw_fd)
+    }
+
+    fn remove(&self, fd: &FileDescriptor) {
+        let raw_fd = unsafe { fd.native_handle() };
+        if self.is_suspended(raw_fd) {
+            let internals = self.internals_mut();
+            internals.suspended.retain(|&v| v != raw_fd);
+            internals.len -= 1;
+            return;
+        }
+
+        if self.control(posix::EPOLL_CTL_DEL, raw_fd) == -1 {
+            warn!(from self,
+                "Unable to remove file descriptor {:?} ({:?}). The file descriptor might still trigger wakeups.",
+                fd, Errno::get());
+        }
+
+        self.internals_mut().len -= 1;
+    }
+
+    /// Stops monitoring the attached [`FileDescriptor`] until [`Epoll::resume()`] is called.
+    /// A suspended [`FileDescriptor`] does not wake up the [`Epoll`] even when it is
+    /// readable, but it stays attached.
+    pub fn suspend(&self, fd: &FileDescriptor) -> Result<(), EpollModifyError> {
+        let msg = "Unable to suspend file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        if self.is_suspended(raw_fd) {
+            return Ok(());
+        }
+
+        // an epoll always reports hang ups and errors, therefore the file descriptor is
+        // removed instead of clearing its events
+        if self.control(posix::EPOLL_CTL_DEL, raw_fd) == -1 {
+            handle_errno!(EpollModifyError, from self,
+                Errno::ENOENT => (NotAttached, "{} {:?} since it is not attached.", msg, fd),
+                v => (UnknownError(v as i32), "{} {:?} since an unknown error occurred ({}).", msg, fd, v)
+            );
+        }
+
+        self.internals_mut().suspended.push(raw_fd);
+        Ok(())
+    }
+
+    /// Monitors a [`FileDescriptor`] that was suspended with [`Epoll::suspend()`] again. When
+    /// it is readable it wakes up the next wait.
+    pub fn resume(&self, fd: &FileDescriptor) -> Result<(), EpollModifyError> {
+        let msg = "Unable to resume file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        if !self.is_suspended(raw_fd) {
+            return Ok(());
+        }
+
+        if self.control(posix::EPOLL_CTL_ADD, raw_fd) == -1 {
+            handle_errno!(EpollModifyError, from self,
+                Errno::ENOMEM => (InsufficientMemory, "{} {:?} due to insufficient memory.", msg, fd),
+                Errno::ENOSPC => (WatchLimitReached,
+                    "{} {:?} since the per user limit of epoll watches (/proc/sys/fs/epoll/max_user_watches) was reached.", msg, fd),
+                v => (UnknownError(v as i32), "{} {:?} since an unknown error occurred ({}).", msg, fd, v)
+            );
+        }
+
+        self.internals_mut().suspended.retain(|&v| v != raw_fd);
+        Ok(())
+    }
+
+    /// Returns the number of attached [`FileDescriptor`]s
+    pub fn len(&self) -> usize {
+        self.internals().len
+    }
+
+    /// Returns true if the [`Epoll`] is empty, otherwise false
+    pub fn is_empty(&self) -> bool {
+        self.internals().len == 0
+    }
+
+    /// Blocks until at least one of the attached objects has become readable and calls
+    /// `fd_callback` for every one of them. Returns the number of triggered
+    /// [`FileDescriptor`]s.
+    pub fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        self.wait(-1, fd_callback)
+    }
+
+    /// Waits until either the timeout has passed or at least one of the attached objects
+    /// has become readable and calls `fd_callback` for every one of them. Returns the
+    /// number of triggered [`FileDescriptor`]s. The timeout is rounded up to the next
+    /// millisecond.
+    pub fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Duration,
+        fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        let timeout_in_ms = timeout
+            .as_nanos()
+            .div_ceil(1_000_000)
+            .min(posix::int::MAX as u128);
+        self.wait(timeout_in_ms as posix::int, fd_callback)
+    }
+
+    fn wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout_in_ms: posix::int,
+        mut fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        let msg = "Failure while waiting for file descriptor events";
+        let events = &mut self.internals_mut().events;
+        // epoll_wait requires space for at least one event
+        if events.is_empty() {
+            events.push(posix::epoll_event::new());
+        }
+        let events_ptr = events.as_mut_ptr();
+        let events_len = events.len().min(posix::int::MAX as usize);
+
+        let number_of_notifications = unsafe {
+            posix::epoll_wait(
+                self.epoll_fd.native_handle(),
+                events_ptr,
+                events_len as _,
+                timeout_in_ms,
+            )
+        };
+
+        if number_of_notifications == -1 {
+            handle_errno!(EpollWaitError, from self,
+                fatal Errno::EBADF => ("This should never happen! {} since the underlying epoll file descriptor is invalid.", msg);
+                fatal Errno::EFAULT => ("This should never happen! {} since the event buffer is not accessible.", msg);
+                fatal Errno::EINVAL => ("This should never happen! {} since the arguments are invalid.", msg),
+                Errno::EINTR => (Interrupt, "{} since an interrupt signal was received.", msg),
+                v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+            );
+        }
+
+        // the callback is allowed to attach further objects which may reallocate the events,
+        // therefore every event is copied before the callback is called
+        for n in 0..number_of_notifications as usize {
+            let data = self.internals().events[n].data;
+            let fd = FileDescriptor::non_owning_new(data as i32).unwrap();
+            fd_callback(&fd);
+        }
+
+        Ok(number_of_notifications as _)
+    }
+}
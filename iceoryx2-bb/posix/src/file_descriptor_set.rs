@@ -58,6 +58,9 @@ use iceoryx2_pal_posix::*;
 /// A trait which is implement by all objects which can be added to the [`FileDescriptorSet`].
 pub trait SynchronousMultiplexing: FileDescriptorBased {}
 
+// allows to attach objects that expose only their file descriptor
+impl SynchronousMultiplexing for FileDescriptor {}
+
 #[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
 pub enum FileDescriptorSetWaitError {
     Interrupt,
@@ -72,6 +75,11 @@ pub enum FileDescriptorSetAddError {
     CapacityExceeded,
 }
 
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FileDescriptorSetModifyError {
+    NotAttached,
+}
+
 /// Defines the event type one wants to wait on in
 /// [`FileDescriptorSet::timed_wait()`]
 #[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
@@ -111,6 +119,8 @@ pub struct FileDescriptorSet {
 struct Internals {
     fd_set: posix::fd_set,
     file_descriptors: Vec<i32>,
+    // attached file descriptors that are excluded from the wait until they are resumed
+    suspended: Vec<i32>,
     max_fd: i32,
 }
 
@@ -131,6 +141,7 @@ impl Default for FileDescriptorSet {
             internals: UnsafeCell::new(Internals {
                 fd_set: posix::fd_set::new(),
                 file_descriptors: vec![],
+                suspended: vec![],
                 max_fd: 0,
             }),
         };
@@ -209,6 +220,37 @@ impl FileDescriptorSet {
         self.internals_mut()
             .file_descriptors
             .retain(|&v| value != v);
+        self.internals_mut().suspended.retain(|&v| value != v);
+    }
+
+    /// Excludes the attached [`FileDescriptor`] from all waits until
+    /// [`FileDescriptorSet::resume()`] is called. It stays attached.
+    pub fn suspend(&self, fd: &FileDescriptor) -> Result<(), FileDescriptorSetModifyError> {
+        if !self.contains_impl(fd) {
+            fail!(from self, with FileDescriptorSetModifyError::NotAttached,
+                "Unable to suspend file descriptor {:?} since it is not attached.", fd);
+        }
+
+        let raw_fd = unsafe { fd.native_handle() };
+        if !self.internals().suspended.contains(&raw_fd) {
+            self.internals_mut().suspended.push(raw_fd);
+        }
+
+        Ok(())
+    }
+
+    /// Includes a [`FileDescriptor`] that was suspended with
+    /// [`FileDescriptorSet::suspend()`] in all waits again.
+    pub fn resume(&self, fd: &FileDescriptor) -> Result<(), FileDescriptorSetModifyError> {
+        if !self.contains_impl(fd) {
+            fail!(from self, with FileDescriptorSetModifyError::NotAttached,
+                "Unable to resume file descriptor {:?} since it is not attached.", fd);
+        }
+
+        let raw_fd = unsafe { fd.native_handle() };
+        self.internals_mut().suspended.retain(|&v| raw_fd != v);
+
+        Ok(())
     }
 
     /// Returns the maximum capacity of the [`FileDescriptorSet`]
@@ -264,6 +306,9 @@ impl FileDescriptorSet {
         mut fd_callback: F,
     ) -> Result<usize, FileDescriptorSetWaitError> {
         let mut fd_set: posix::fd_set = self.internals().fd_set;
+        for raw_fd in &self.internals().suspended {
+            unsafe { posix::FD_CLR(*raw_fd, &mut fd_set) };
+        }
 
         let read_fd: *mut posix::fd_set = match event {
             FileEvent::Read
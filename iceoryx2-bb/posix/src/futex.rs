@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstracts the Linux futex system call. A futex is a 32-bit value, usually stored in
+//! shared memory, on which a thread can sleep until another thread or process wakes it up.
+//! In contrast to a [`Semaphore`](crate::semaphore) the value is owned and modified by the
+//! user, the futex only provides the wait and wake operation. This allows to implement
+//! wakeup protocols where the notifying side skips the syscall when nobody sleeps.
+//!
+//! # Example
+//!
+//! ```ignore
+//! use iceoryx2_bb_posix::futex::*;
+//! use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU32;
+//! use core::sync::atomic::Ordering;
+//! use core::time::Duration;
+//!
+//! let value = IoxAtomicU32::new(0);
+//!
+//! // in the waiting thread, returns as soon as value != 0, the timeout passed or
+//! // it was woken up
+//! futex_wait(&value, 0, Some(Duration::from_millis(100))).unwrap();
+//!
+//! // in the notifying thread
+//! value.fetch_add(1, Ordering::SeqCst);
+//! futex_wake(&value, 1).unwrap();
+//! ```
+
+use core::time::Duration;
+
+use crate::clock::AsTimespec;
+use crate::handle_errno;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU32;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FutexWaitError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FutexWakeError {
+    UnknownError(i32),
+}
+
+/// Blocks as long as `value` contains `expected` until it is woken up with [`futex_wake()`]
+/// or the optional timeout has passed. Returns immediately when `value` does not contain
+/// `expected`. Since spurious wakeups are possible the caller has to verify the condition
+/// it waits for after the call returned.
+pub fn futex_wait(
+    value: &IoxAtomicU32,
+    expected: u32,
+    timeout: Option<Duration>,
+) -> Result<(), FutexWaitError> {
+    let msg = "Unable to wait on futex";
+    let timeout = timeout.map(|t| t.as_timespec());
+    let timeout_ptr = match timeout {
+        Some(ref t) => t as *const posix::timespec,
+        None => core::ptr::null(),
+    };
+
+    if unsafe { posix::futex_wait(value.as_ptr(), expected, timeout_ptr) } == 0 {
+        return Ok(());
+    }
+
+    handle_errno!(FutexWaitError, from "futex_wait()",
+        success Errno::EAGAIN => ();
+        success Errno::ETIMEDOUT => (),
+        Errno::EINTR => (Interrupt, "{} since an interrupt signal was received.", msg),
+        v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+    );
+}
+
+/// Wakes up to `number_of_waiters` threads that are sleeping in [`futex_wait()`] on `value`.
+/// Returns the number of threads that were woken up.
+pub fn futex_wake(value: &IoxAtomicU32, number_of_waiters: u32) -> Result<u32, FutexWakeError> {
+    let msg = "Unable to wake futex waiters";
+    let number_of_woken_up_waiters =
+        unsafe { posix::futex_wake(value.as_ptr(), number_of_waiters) };
+
+    if number_of_woken_up_waiters >= 0 {
+        return Ok(number_of_woken_up_waiters as u32);
+    }
+
+    handle_errno!(FutexWakeError, from "futex_wake()",
+        v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+    );
+}
@@ -0,0 +1,336 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstracts the Linux inotify facility. An [`Inotify`] watches directories or files for
+//! changes, for instance created or removed directory entries. It never blocks, the
+//! changes are collected with [`Inotify::try_read()`] and since it implements the
+//! [`SynchronousMultiplexing`] trait it can be attached to an
+//! [`Epoll`](crate::epoll::Epoll) or a
+//! [`FileDescriptorSet`](crate::file_descriptor_set::FileDescriptorSet) to wait for
+//! changes.
+//!
+//! # Example
+//!
+//! ```ignore
+//! use iceoryx2_bb_posix::inotify::*;
+//! use iceoryx2_bb_system_types::path::Path;
+//! use iceoryx2_bb_container::semantic_string::SemanticString;
+//!
+//! let inotify = InotifyBuilder::new().create().unwrap();
+//! let watch = inotify
+//!     .add_watch(
+//!         &Path::new(b"/tmp").unwrap(),
+//!         InotifyEvents::ENTRY_CREATED | InotifyEvents::ENTRY_DELETED,
+//!     )
+//!     .unwrap();
+//!
+//! // some other process creates a file in /tmp
+//! inotify
+//!     .try_read(|event| {
+//!         if event.events().contains(InotifyEvents::ENTRY_CREATED) {
+//!             println!("created {:?}", event.name());
+//!         }
+//!     })
+//!     .unwrap();
+//!
+//! inotify.remove_watch(watch);
+//! ```
+
+use core::fmt::Debug;
+use core::ops::{BitOr, BitOrAssign};
+
+use crate::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use crate::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_container::byte_string::strnlen;
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_log::warn;
+use iceoryx2_bb_system_types::path::Path;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+// large enough for at least one event with the longest possible name
+const EVENT_BUFFER_SIZE: usize = 4096;
+const EVENT_HEADER_SIZE: usize = core::mem::size_of::<posix::inotify_event>();
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum InotifyCreateError {
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum InotifyWatchError {
+    InsufficientPermissions,
+    DoesNotExist,
+    NotADirectory,
+    InsufficientMemory,
+    WatchLimitReached,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum InotifyReadError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+/// The events an [`Inotify`] watch reports. Multiple events can be combined with `|`.
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub struct InotifyEvents(u32);
+
+impl InotifyEvents {
+    /// The permissions, timestamps or ownership of the watched object or of one of its
+    /// entries changed.
+    pub const ATTRIBUTES_CHANGED: Self = Self(posix::IN_ATTRIB);
+    /// An entry was created in the watched directory.
+    pub const ENTRY_CREATED: Self = Self(posix::IN_CREATE);
+    /// An entry was removed from the watched directory.
+    pub const ENTRY_DELETED: Self = Self(posix::IN_DELETE);
+    /// An entry was moved into the watched directory.
+    pub const ENTRY_MOVED_IN: Self = Self(posix::IN_MOVED_TO);
+    /// An entry was moved out of the watched directory.
+    pub const ENTRY_MOVED_OUT: Self = Self(posix::IN_MOVED_FROM);
+    /// The watched object itself was removed.
+    pub const SELF_DELETED: Self = Self(posix::IN_DELETE_SELF);
+    /// The watched object itself was moved.
+    pub const SELF_MOVED: Self = Self(posix::IN_MOVE_SELF);
+    /// Reported when events were dropped since the event queue was full. Cannot be watched.
+    pub const QUEUE_OVERFLOW: Self = Self(posix::IN_Q_OVERFLOW);
+    /// Reported when the watch was removed, for instance since the watched object was
+    /// deleted. Cannot be watched.
+    pub const WATCH_REMOVED: Self = Self(posix::IN_IGNORED);
+
+    /// Returns an empty set of events.
+    pub const fn empty() -> Self {
+        Self(0)
+    }
+
+    /// Returns the combination of both sets of events.
+    pub const fn union(self, other: Self) -> Self {
+        Self(self.0 | other.0)
+    }
+
+    /// Returns true when all events of `other` are contained.
+    pub const fn contains(&self, other: Self) -> bool {
+        self.0 & other.0 == other.0
+    }
+
+    /// Returns true when at least one event of `other` is contained.
+    pub const fn intersects(&self, other: Self) -> bool {
+        self.0 & other.0 != 0
+    }
+
+    /// Returns the underlying bit mask.
+    pub const fn bits(&self) -> u32 {
+        self.0
+    }
+}
+
+impl BitOr for InotifyEvents {
+    type Output = Self;
+
+    fn bitor(self, rhs: Self) -> Self::Output {
+        self.union(rhs)
+    }
+}
+
+impl BitOrAssign for InotifyEvents {
+    fn bitor_assign(&mut self, rhs: Self) {
+        self.0 |= rhs.0
+    }
+}
+
+/// Identifies a watch that was added with [`Inotify::add_watch()`].
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub struct InotifyWatch(i32);
+
+/// A single change that was reported by [`Inotify::try_read()`].
+#[derive(Debug)]
+pub struct InotifyEvent<'a> {
+    watch: InotifyWatch,
+    events: InotifyEvents,
+    name: Option<&'a [u8]>,
+}
+
+impl InotifyEvent<'_> {
+    /// Returns the [`InotifyWatch`] that reported the change.
+    pub fn watch(&self) -> InotifyWatch {
+        self.watch
+    }
+
+    /// Returns the [`InotifyEvents`] that occurred.
+    pub fn events(&self) -> InotifyEvents {
+        self.events
+    }
+
+    /// Returns the name of the directory entry the change refers to. When the watched
+    /// object itself changed it returns [`None`].
+    pub fn name(&self) -> Option<&[u8]> {
+        self.name
+    }
+}
+
+/// Creates a new [`Inotify`].
+#[derive(Debug, Default)]
+pub struct InotifyBuilder {}
+
+impl InotifyBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn create(self) -> Result<Inotify, InotifyCreateError> {
+        let msg = "Unable to create inotify";
+        let raw_fd = unsafe { posix::inotify_init1(posix::IN_NONBLOCK | posix::IN_CLOEXEC) };
+
+        if raw_fd == -1 {
+            handle_errno!(InotifyCreateError, from self,
+                Errno::EMFILE => (PerProcessFileHandleLimitReached,
+                    "{} since either the processes file descriptor limit or the per user limit of inotify instances (/proc/sys/fs/inotify/max_user_instances) was reached.", msg),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{} since the system wide file descriptor limit was reached.", msg),
+                Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+            );
+        }
+
+        Ok(Inotify {
+            file_descriptor: unsafe { FileDescriptor::new_unchecked(raw_fd) },
+        })
+    }
+}
+
+/// Watches directories or files for changes with the Linux inotify facility. Becomes
+/// readable as soon as a change was reported.
+pub struct Inotify {
+    file_descriptor: FileDescriptor,
+}
+
+impl Debug for Inotify {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "Inotify {{ file_descriptor: {} }}", unsafe {
+            self.file_descriptor.native_handle()
+        })
+    }
+}
+
+impl FileDescriptorBased for Inotify {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl SynchronousMultiplexing for Inotify {}
+
+impl Inotify {
+    /// Watches the provided directory or file for the given [`InotifyEvents`]. Adding a
+    /// watch for a path that is already watched replaces its events and returns the same
+    /// [`InotifyWatch`].
+    pub fn add_watch(
+        &self,
+        path: &Path,
+        events: InotifyEvents,
+    ) -> Result<InotifyWatch, InotifyWatchError> {
+        let msg = "Unable to add watch";
+        let watch = unsafe {
+            posix::inotify_add_watch(
+                self.file_descriptor.native_handle(),
+                path.as_c_str(),
+                events.bits(),
+            )
+        };
+
+        if watch == -1 {
+            handle_errno!(InotifyWatchError, from self,
+                Errno::EACCES => (InsufficientPermissions, "{} for \"{}\" due to insufficient permissions.", msg, path),
+                Errno::ENOENT => (DoesNotExist, "{} for \"{}\" since it does not exist.", msg, path),
+                Errno::ENOTDIR => (NotADirectory, "{} for \"{}\" since a component of the path is not a directory.", msg, path),
+                Errno::ENOMEM => (InsufficientMemory, "{} for \"{}\" due to insufficient memory.", msg, path),
+                Errno::ENOSPC => (WatchLimitReached,
+                    "{} for \"{}\" since the per user limit of inotify watches (/proc/sys/fs/inotify/max_user_watches) was reached.", msg, path),
+                v => (UnknownError(v as i32), "{} for \"{}\" since an unknown error occurred ({}).", msg, path, v)
+            );
+        }
+
+        Ok(InotifyWatch(watch))
+    }
+
+    /// Removes a watch that was added with [`Inotify::add_watch()`]. A watch whose object
+    /// was removed is removed automatically and reports [`InotifyEvents::WATCH_REMOVED`].
+    pub fn remove_watch(&self, watch: InotifyWatch) {
+        if unsafe { posix::inotify_rm_watch(self.file_descriptor.native_handle(), watch.0) } == -1 {
+            warn!(from self, "Unable to remove watch {:?} ({:?}).", watch, Errno::get());
+        }
+    }
+
+    /// Calls `callback` for every change that was reported since the last call and returns
+    /// the number of changes. Does not block when no change was reported.
+    pub fn try_read<F: FnMut(&InotifyEvent)>(
+        &self,
+        mut callback: F,
+    ) -> Result<usize, InotifyReadError> {
+        let msg = "Unable to read inotify events";
+        let mut buffer = [0u8; EVENT_BUFFER_SIZE];
+        let mut number_of_events = 0;
+
+        loop {
+            let bytes_read = unsafe {
+                posix::read(
+                    self.file_descriptor.native_handle(),
+                    buffer.as_mut_ptr() as *mut posix::void,
+                    buffer.len(),
+                )
+            };
+
+            if bytes_read < 0 {
+                handle_errno!(InotifyReadError, from self,
+                    success Errno::EAGAIN => number_of_events,
+                    Errno::EINTR => (Interrupt, "{} since an interrupt signal was received.", msg),
+                    v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+                );
+            }
+
+            let bytes_read = bytes_read as usize;
+            if bytes_read == 0 {
+                return Ok(number_of_events);
+            }
+
+            let mut offset = 0;
+            while offset + EVENT_HEADER_SIZE <= bytes_read {
+                // the byte buffer has no alignment, therefore the header is read unaligned
+                let header = unsafe {
+                    core::ptr::read_unaligned(
+                        buffer.as_ptr().add(offset) as *const posix::inotify_event
+                    )
+                };
+                let name_start = offset + EVENT_HEADER_SIZE;
+                let name_end = (name_start + header.len as usize).min(bytes_read);
+                let name = &buffer[name_start..name_end];
+                let name_len = unsafe { strnlen(name.as_ptr().cast(), name.len()) };
+
+                callback(&InotifyEvent {
+                    watch: InotifyWatch(header.wd),
+                    events: InotifyEvents(header.mask),
+                    name: if name_len == 0 {
+                        None
+                    } else {
+                        Some(&name[..name_len])
+                    },
+                });
+
+                number_of_events += 1;
+                offset = name_end;
+            }
+        }
+    }
+}
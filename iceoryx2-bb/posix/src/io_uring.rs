@@ -0,0 +1,667 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstracts the Linux io_uring facility for readiness notifications. Like the
+//! [`Epoll`](crate::epoll::Epoll) it can be used to wait on multiple objects which implement
+//! the [`SynchronousMultiplexing`] trait until they become readable.
+//!
+//! Every attached object has exactly one poll request in flight. When it completes the
+//! object is reported and the request is re-armed with the next wait, so that an object
+//! which is still readable is reported again, like with a level triggered epoll. The
+//! re-armed requests are submitted by the same system call that waits for the completions
+//! and all available completions are harvested at once.
+//!
+//! io_uring requires Linux 5.11 or newer and can be disabled by the administrator. In that
+//! case [`IoUringBuilder::create()`] fails with [`IoUringCreateError::NotSupported`].
+//!
+//! # Example
+//!
+//! ```ignore
+//! use iceoryx2_bb_posix::io_uring::*;
+//! use iceoryx2_bb_posix::unix_datagram_socket::*;
+//! use core::time::Duration;
+//! use iceoryx2_bb_system_types::file_path::FilePath;
+//! use iceoryx2_bb_container::semantic_string::SemanticString;
+//!
+//! let socket_name = FilePath::new(b"some_socket").unwrap();
+//!
+//! let sut_receiver = UnixDatagramReceiverBuilder::new(&socket_name)
+//!     .creation_mode(CreationMode::PurgeAndCreate)
+//!     .create()
+//!     .unwrap();
+//!
+//! let sut_sender = UnixDatagramSenderBuilder::new(&socket_name)
+//!     .create()
+//!     .unwrap();
+//!
+//! let io_uring = IoUringBuilder::new().create().unwrap();
+//! let _guard = io_uring.add(&sut_receiver).unwrap();
+//! let send_data: Vec<u8> = vec![1u8, 3u8, 3u8, 7u8, 13u8, 37u8];
+//! sut_sender.try_send(send_data.as_slice()).unwrap();
+//!
+//! // in some other process
+//! let result = io_uring.timed_wait(Duration::from_secs(1),
+//!     |fd| println!("Fd was triggered {}", unsafe { fd.native_handle() })).unwrap();
+//! ```
+
+use core::{
+    cell::UnsafeCell,
+    fmt::Debug,
+    sync::atomic::{AtomicU32, Ordering},
+    time::Duration,
+};
+use std::collections::HashMap;
+
+use crate::clock::{ClockType, Time};
+use crate::file_descriptor::FileDescriptor;
+use crate::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::posix::Struct;
+use iceoryx2_pal_posix::*;
+
+const SUBMISSION_QUEUE_ENTRIES: u32 = 256;
+const REQUIRED_FEATURES: u32 =
+    posix::IORING_FEAT_SINGLE_MMAP | posix::IORING_FEAT_NODROP | posix::IORING_FEAT_EXT_ARG;
+// completions of poll removals carry no attachment and are ignored
+const POLL_REMOVE_USER_DATA: u64 = u64::MAX;
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum IoUringCreateError {
+    NotSupported,
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum IoUringAddError {
+    AlreadyAttached,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum IoUringModifyError {
+    NotAttached,
+    UnknownError(i32),
+}
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum IoUringWaitError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+/// Detaches the [`FileDescriptor`] from the [`IoUring`] when it goes out of scope.
+pub struct IoUringGuard<'io_uring, 'fd> {
+    io_uring: &'io_uring IoUring,
+    fd: &'fd FileDescriptor,
+}
+
+impl<'fd> IoUringGuard<'_, 'fd> {
+    pub fn file_descriptor(&self) -> &'fd FileDescriptor {
+        self.fd
+    }
+}
+
+impl Drop for IoUringGuard<'_, '_> {
+    fn drop(&mut self) {
+        self.io_uring.remove(self.fd)
+    }
+}
+
+/// Creates a new [`IoUring`].
+#[derive(Debug, Default)]
+pub struct IoUringBuilder {}
+
+impl IoUringBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn create(self) -> Result<IoUring, IoUringCreateError> {
+        let msg = "Unable to create io_uring";
+        let mut params = posix::io_uring_params::new();
+        params.flags = posix::IORING_SETUP_CLAMP;
+        let raw_fd = unsafe { posix::io_uring_setup(SUBMISSION_QUEUE_ENTRIES, &mut params) };
+
+        if raw_fd == -1 {
+            handle_errno!(IoUringCreateError, from self,
+                Errno::ENOSYS => (NotSupported, "{} since io_uring is not supported by the kernel.", msg),
+                Errno::EPERM => (NotSupported,
+                    "{} since io_uring is disabled on the system (/proc/sys/kernel/io_uring_disabled).", msg),
+                Errno::EMFILE => (PerProcessFileHandleLimitReached, "{} since the processes file descriptor limit was reached.", msg),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{} since the system wide file descriptor limit was reached.", msg),
+                Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+            );
+        }
+
+        let ring_fd = unsafe { FileDescriptor::new_unchecked(raw_fd) };
+
+        if params.features & REQUIRED_FEATURES != REQUIRED_FEATURES {
+            fail!(from self, with IoUringCreateError::NotSupported,
+                "{} since the kernel lacks required io_uring features (Linux 5.11 or newer is required).", msg);
+        }
+
+        let sq_off = params.sq_off;
+        let cq_off = params.cq_off;
+        let rings_size = (sq_off.array as usize + params.sq_entries as usize * 4).max(
+            cq_off.cqes as usize
+                + params.cq_entries as usize * core::mem::size_of::<posix::io_uring_cqe>(),
+        );
+        let sqes_size = params.sq_entries as usize * core::mem::size_of::<posix::io_uring_sqe>();
+
+        let rings = match Self::map(&ring_fd, rings_size, posix::IORING_OFF_SQ_RING) {
+            Some(rings) => rings,
+            None => {
+                fail!(from self, with IoUringCreateError::InsufficientMemory,
+                    "{} since the completion and submission queue could not be mapped ({:?}).", msg, Errno::get());
+            }
+        };
+
+        let sqes = match Self::map(&ring_fd, sqes_size, posix::IORING_OFF_SQES) {
+            Some(sqes) => sqes,
+            None => {
+                let errno = Errno::get();
+                unsafe { posix::munmap(rings as *mut posix::void, rings_size) };
+                fail!(from self, with IoUringCreateError::InsufficientMemory,
+                    "{} since the submission queue entries could not be mapped ({:?}).", msg, errno);
+            }
+        };
+
+        // the submission queue array maps every slot to the entry with the same index
+        // so that only the tail has to be advanced when an entry is written
+        let sq_array = unsafe { rings.add(sq_off.array as usize) } as *mut u32;
+        for i in 0..params.sq_entries {
+            unsafe { sq_array.add(i as usize).write(i) };
+        }
+
+        Ok(IoUring {
+            ring_fd,
+            rings,
+            rings_size,
+            sqes: sqes as *mut posix::io_uring_sqe,
+            sqes_size,
+            sq_head: unsafe { rings.add(sq_off.head as usize) } as *const AtomicU32,
+            sq_tail: unsafe { rings.add(sq_off.tail as usize) } as *const AtomicU32,
+            sq_flags: unsafe { rings.add(sq_off.flags as usize) } as *const AtomicU32,
+            sq_mask: unsafe { *(rings.add(sq_off.ring_mask as usize) as *const u32) },
+            sq_entries: params.sq_entries,
+            cq_head: unsafe { rings.add(cq_off.head as usize) } as *const AtomicU32,
+            cq_tail: unsafe { rings.add(cq_off.tail as usize) } as *const AtomicU32,
+            cq_mask: unsafe { *(rings.add(cq_off.ring_mask as usize) as *const u32) },
+            cqes: unsafe { rings.add(cq_off.cqes as usize) } as *const posix::io_uring_cqe,
+            internals: UnsafeCell::new(Internals {
+                attachments: HashMap::new(),
+                generation: 0,
+                rearm: vec![],
+                triggered: vec![],
+                suspended: vec![],
+            }),
+        })
+    }
+
+    fn map(ring_fd: &FileDescriptor, size: usize, offset: posix::off_t) -> Option<*mut u8> {
+        let memory = unsafe {
+            posix::mmap(
+                core::ptr::null_mut(),
+                size,
+                posix::PROT_READ | posix::PROT_WRITE,
+                posix::MAP_SHARED,
+                ring_fd.native_handle(),
+                offset,
+            )
+        };
+
+        (memory != posix::MAP_FAILED).then_some(memory as *mut u8)
+    }
+}
+
+struct Internals {
+    // maps the attached file descriptors to the generation of their poll request, a
+    // completion of an older generation belongs to a detached object
+    attachments: HashMap<i32, u32>,
+    generation: u32,
+    rearm: Vec<i32>,
+    triggered: Vec<i32>,
+    // attached file descriptors without a poll request until they are resumed
+    suspended: Vec<i32>,
+}
+
+/// Waits on multiple objects which implement the [`SynchronousMultiplexing`] trait with
+/// the Linux io_uring facility. Waits until the attached objects become readable.
+pub struct IoUring {
+    ring_fd: FileDescriptor,
+    rings: *mut u8,
+    rings_size: usize,
+    sqes: *mut posix::io_uring_sqe,
+    sqes_size: usize,
+    sq_head: *const AtomicU32,
+    sq_tail: *const AtomicU32,
+    sq_flags: *const AtomicU32,
+    sq_mask: u32,
+    sq_entries: u32,
+    cq_head: *const AtomicU32,
+    cq_tail: *const AtomicU32,
+    cq_mask: u32,
+    cqes: *const posix::io_uring_cqe,
+    internals: UnsafeCell<Internals>,
+}
+
+// the mappings are owned by the IoUring and are only accessed through it
+unsafe impl Send for IoUring {}
+
+impl Debug for IoUring {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "IoUring {{ ring_fd: {}, len: {} }}",
+            unsafe { self.ring_fd.native_handle() },
+            self.internals().attachments.len()
+        )
+    }
+}
+
+impl Drop for IoUring {
+    fn drop(&mut self) {
+        unsafe {
+            posix::munmap(self.sqes as *mut posix::void, self.sqes_size);
+            posix::munmap(self.rings as *mut posix::void, self.rings_size);
+        }
+    }
+}
+
+impl IoUring {
+    fn internals(&self) -> &Internals {
+        unsafe { &*self.internals.get() }
+    }
+
+    #[allow(clippy::mut_from_ref)]
+    fn internals_mut(&self) -> &mut Internals {
+        unsafe { &mut *self.internals.get() }
+    }
+
+    fn user_data(fd: i32, generation: u32) -> u64 {
+        ((generation as u64) << 32) | fd as u32 as u64
+    }
+
+    fn number_of_pending_submissions(&self) -> u32 {
+        let head = unsafe { &*self.sq_head }.load(Ordering::Acquire);
+        let tail = unsafe { &*self.sq_tail }.load(Ordering::Relaxed);
+        tail.wrapping_sub(head)
+    }
+
+    fn enter(
+        &self,
+        min_complete: u32,
+        flags: u32,
+        arg: Option<&posix::io_uring_getevents_arg>,
+    ) -> Result<(), Errno> {
+        let (flags, arg_ptr, arg_size) = match arg {
+            Some(arg) => (
+                flags | posix::IORING_ENTER_EXT_ARG,
+                arg as *const posix::io_uring_getevents_arg as *const posix::void,
+                core::mem::size_of::<posix::io_uring_getevents_arg>(),
+            ),
+            None => (flags, core::ptr::null(), 0),
+        };
+
+        if unsafe {
+            posix::io_uring_enter(
+                self.ring_fd.native_handle(),
+                self.number_of_pending_submissions(),
+                min_complete,
+                flags,
+                arg_ptr,
+                arg_size,
+            )
+        } == -1
+        {
+            return Err(Errno::get());
+        }
+
+        Ok(())
+    }
+
+    fn submit(&self) -> Result<(), Errno> {
+        loop {
+            match self.enter(0, 0, None) {
+                Err(Errno::EINTR) => continue,
+                v => return v,
+            }
+        }
+    }
+
+    fn push(&self, sqe: posix::io_uring_sqe) -> Result<(), Errno> {
+        if self.number_of_pending_submissions() == self.sq_entries {
+            self.submit()?;
+        }
+
+        let sq_tail = unsafe { &*self.sq_tail };
+        let tail = sq_tail.load(Ordering::Relaxed);
+        unsafe { self.sqes.add((tail & self.sq_mask) as usize).write(sqe) };
+        // release, the kernel must see the entry before the new tail
+        sq_tail.store(tail.wrapping_add(1), Ordering::Release);
+
+        Ok(())
+    }
+
+    fn push_poll_add(&self, fd: i32, generation: u32) -> Result<(), Errno> {
+        let mut sqe = posix::io_uring_sqe::new();
+        sqe.opcode = posix::IORING_OP_POLL_ADD;
+        sqe.fd = fd;
+        sqe.poll32_events = posix::IORING_POLLIN;
+        sqe.user_data = Self::user_data(fd, generation);
+        self.push(sqe)
+    }
+
+    fn push_poll_remove(&self, fd: i32, generation: u32) -> Result<(), Errno> {
+        let mut sqe = posix::io_uring_sqe::new();
+        sqe.opcode = posix::IORING_OP_POLL_REMOVE;
+        sqe.fd = -1;
+        sqe.addr = Self::user_data(fd, generation);
+        sqe.user_data = POLL_REMOVE_USER_DATA;
+        self.push(sqe)
+    }
+
+    /// Attaches an object. As long as the returned [`IoUringGuard`] lives the object is
+    /// monitored.
+    pub fn add<'io_uring, 'fd, F: SynchronousMultiplexing>(
+        &'io_uring self,
+        fd: &'fd F,
+    ) -> Result<IoUringGuard<'io_uring, 'fd>, IoUringAddError> {
+        self.add_impl(fd.file_descriptor())
+    }
+
+    fn add_impl<'io_uring, 'fd>(
+        &'io_uring self,
+        fd: &'fd FileDescriptor,
+    ) -> Result<IoUringGuard<'io_uring, 'fd>, IoUringAddError> {
+        let msg = "Unable to add file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        let internals = self.internals_mut();
+
+        if internals.attachments.contains_key(&raw_fd) {
+            fail!(from self, with IoUringAddError::AlreadyAttached,
+                "{} {:?} since it is already attached.", msg, fd);
+        }
+
+        internals.generation = internals.generation.wrapping_add(1);
+        let generation = internals.generation;
+
+        // the poll request is submitted together with the next wait
+        if let Err(e) = self.push_poll_add(raw_fd, generation) {
+            fail!(from self, with IoUringAddError::UnknownError(e as i32),
+                "{} {:?} since the poll request could not be submitted ({:?}).", msg, fd, e);
+        }
+
+        self.internals_mut().attachments.insert(raw_fd, generation);
+
+        Ok(IoUringGuard { io_uring: self, fd })
+    }
+
+    fn remove(&self, fd: &FileDescriptor) {
+        let raw_fd = unsafe { fd.native_handle() };
+        let generation = match self.internals_mut().attachments.remove(&raw_fd) {
+            Some(generation) => generation,
+            None => return,
+        };
+        self.internals_mut().suspended.retain(|&v| v != raw_fd);
+
+        // the poll request holds a reference to the underlying file, therefore it is removed
+        // right away and not with the next wait
+        if let Err(e) = self
+            .push_poll_remove(raw_fd, generation)
+            .and_then(|_| self.submit())
+        {
+            warn!(from self,
+                "Unable to remove file descriptor {:?} ({:?}). The underlying file is released when the IoUring goes out of scope.",
+                fd, e);
+        }
+    }
+
+    /// Stops monitoring the attached [`FileDescriptor`] until [`IoUring::resume()`] is
+    /// called. A suspended [`FileDescriptor`] does not wake up the [`IoUring`] even when it
+    /// is readable, but it stays attached.
+    pub fn suspend(&self, fd: &FileDescriptor) -> Result<(), IoUringModifyError> {
+        let msg = "Unable to suspend file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        let internals = self.internals_mut();
+        let generation = match internals.attachments.get(&raw_fd) {
+            Some(generation) => *generation,
+            None => {
+                fail!(from self, with IoUringModifyError::NotAttached,
+                    "{} {:?} since it is not attached.", msg, fd);
+            }
+        };
+
+        if internals.suspended.contains(&raw_fd) {
+            return Ok(());
+        }
+
+        // a triggered request is re-armed with the next wait, otherwise it is still in
+        // flight and is removed together with the next wait
+        let number_of_rearmed_requests = internals.rearm.len();
+        internals.rearm.retain(|&v| v != raw_fd);
+        if internals.rearm.len() == number_of_rearmed_requests {
+            if let Err(e) = self.push_poll_remove(raw_fd, generation) {
+                fail!(from self, with IoUringModifyError::UnknownError(e as i32),
+                    "{} {:?} since the poll request could not be removed ({:?}).", msg, fd, e);
+            }
+        }
+
+        // the completion of the removed request belongs to an older generation and is
+        // therefore ignored
+        let internals = self.internals_mut();
+        internals.generation = internals.generation.wrapping_add(1);
+        internals.attachments.insert(raw_fd, internals.generation);
+        internals.suspended.push(raw_fd);
+
+        Ok(())
+    }
+
+    /// Monitors a [`FileDescriptor`] that was suspended with [`IoUring::suspend()`] again.
+    /// When it is readable it wakes up the next wait.
+    pub fn resume(&self, fd: &FileDescriptor) -> Result<(), IoUringModifyError> {
+        let msg = "Unable to resume file descriptor";
+        let raw_fd = unsafe { fd.native_handle() };
+        if !self.internals().suspended.contains(&raw_fd) {
+            return Ok(());
+        }
+
+        let generation = match self.internals().attachments.get(&raw_fd) {
+            Some(generation) => *generation,
+            None => {
+                fail!(from self, with IoUringModifyError::NotAttached,
+                    "{} {:?} since it is not attached.", msg, fd);
+            }
+        };
+
+        // the poll request is submitted together with the next wait
+        if let Err(e) = self.push_poll_add(raw_fd, generation) {
+            fail!(from self, with IoUringModifyError::UnknownError(e as i32),
+                "{} {:?} since the poll request could not be submitted ({:?}).", msg, fd, e);
+        }
+
+        self.internals_mut().suspended.retain(|&v| v != raw_fd);
+        Ok(())
+    }
+
+    /// Returns the number of attached [`FileDescriptor`]s
+    pub fn len(&self) -> usize {
+        self.internals().attachments.len()
+    }
+
+    /// Returns true if the [`IoUring`] is empty, otherwise false
+    pub fn is_empty(&self) -> bool {
+        self.internals().attachments.is_empty()
+    }
+
+    /// Calls `fd_callback` for every attached object that has become readable without
+    /// blocking. Returns the number of triggered [`FileDescriptor`]s.
+    pub fn try_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(Some(Duration::ZERO), fd_callback)
+    }
+
+    /// Blocks until at least one of the attached objects has become readable and calls
+    /// `fd_callback` for every one of them. Returns the number of triggered
+    /// [`FileDescriptor`]s.
+    pub fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(None, fd_callback)
+    }
+
+    /// Waits until either the timeout has passed or at least one of the attached objects
+    /// has become readable and calls `fd_callback` for every one of them. Returns the
+    /// number of triggered [`FileDescriptor`]s.
+    pub fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Duration,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(Some(timeout), fd_callback)
+    }
+
+    fn rearm_triggered_requests(&self) {
+        let internals = self.internals_mut();
+        let mut rearm = core::mem::take(&mut internals.rearm);
+
+        let mut number_of_rearmed_requests = 0;
+        for fd in &rearm {
+            if let Some(generation) = self.internals().attachments.get(fd).copied() {
+                if let Err(e) = self.push_poll_add(*fd, generation) {
+                    warn!(from self,
+                        "Unable to re-arm the poll request of file descriptor {} ({:?}), retrying with the next wait.",
+                        fd, e);
+                    break;
+                }
+            }
+            number_of_rearmed_requests += 1;
+        }
+
+        rearm.drain(..number_of_rearmed_requests);
+        self.internals_mut().rearm = rearm;
+    }
+
+    fn harvest<F: FnMut(&FileDescriptor)>(&self, fd_callback: &mut F) -> usize {
+        let internals = self.internals_mut();
+        let mut triggered = core::mem::take(&mut internals.triggered);
+        triggered.clear();
+
+        let cq_head = unsafe { &*self.cq_head };
+        let mut head = cq_head.load(Ordering::Relaxed);
+        // acquire, the completions must be visible before the tail
+        let tail = unsafe { &*self.cq_tail }.load(Ordering::Acquire);
+        while head != tail {
+            let cqe = unsafe { *self.cqes.add((head & self.cq_mask) as usize) };
+            head = head.wrapping_add(1);
+
+            if cqe.user_data == POLL_REMOVE_USER_DATA {
+                continue;
+            }
+
+            let fd = cqe.user_data as u32 as i32;
+            let generation = (cqe.user_data >> 32) as u32;
+            if self.internals().attachments.get(&fd) == Some(&generation) {
+                triggered.push(fd);
+            }
+        }
+        // release, the kernel may reuse the completion slots only after they were read
+        cq_head.store(head, Ordering::Release);
+
+        self.internals_mut().rearm.extend_from_slice(&triggered);
+
+        // the callback is allowed to attach further objects, therefore it is called after
+        // all completions are processed
+        for fd in &triggered {
+            let fd = FileDescriptor::non_owning_new(*fd).unwrap();
+            fd_callback(&fd);
+        }
+
+        let number_of_notifications = triggered.len();
+        self.internals_mut().triggered = triggered;
+        number_of_notifications
+    }
+
+    fn wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Option<Duration>,
+        mut fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        let msg = "Failure while waiting for file descriptor events";
+        let start = Time::now_with_clock(ClockType::Monotonic).ok();
+
+        loop {
+            self.rearm_triggered_requests();
+
+            let remaining = timeout.map(|t| {
+                t.saturating_sub(
+                    start
+                        .as_ref()
+                        .and_then(|s| s.elapsed().ok())
+                        .unwrap_or(Duration::MAX),
+                )
+            });
+
+            let mut timespec = posix::__kernel_timespec::new();
+            let mut arg = posix::io_uring_getevents_arg::new();
+            let result = match remaining {
+                Some(remaining) if remaining.is_zero() => {
+                    let overflow = unsafe { &*self.sq_flags }.load(Ordering::Relaxed)
+                        & posix::IORING_SQ_CQ_OVERFLOW
+                        != 0;
+                    if self.number_of_pending_submissions() != 0 || overflow {
+                        self.enter(0, posix::IORING_ENTER_GETEVENTS, None)
+                    } else {
+                        Ok(())
+                    }
+                }
+                Some(remaining) => {
+                    timespec.tv_sec = remaining.as_secs().min(i64::MAX as u64) as i64;
+                    timespec.tv_nsec = remaining.subsec_nanos() as i64;
+                    arg.ts = &timespec as *const posix::__kernel_timespec as u64;
+                    self.enter(1, posix::IORING_ENTER_GETEVENTS, Some(&arg))
+                }
+                None => self.enter(1, posix::IORING_ENTER_GETEVENTS, None),
+            };
+
+            match result {
+                Ok(()) | Err(Errno::ETIMEDOUT) => (),
+                Err(Errno::EINTR) => {
+                    fail!(from self, with IoUringWaitError::Interrupt,
+                        "{} since an interrupt signal was received.", msg);
+                }
+                Err(v) => {
+                    fail!(from self, with IoUringWaitError::UnknownError(v as i32),
+                        "{} since an unknown error occurred ({}).", msg, v);
+                }
+            }
+
+            let number_of_notifications = self.harvest(&mut fd_callback);
+            // completions of detached objects can wake up the wait without a notification
+            if number_of_notifications != 0 || remaining.is_some_and(|r| r.is_zero()) {
+                return Ok(number_of_notifications);
+            }
+
+            if let (Some(_), Err(Errno::ETIMEDOUT)) = (remaining, result) {
+                return Ok(0);
+            }
+        }
+    }
+}
@@ -46,12 +46,20 @@ pub mod udp_socket;
 pub mod handle_errno;
 pub mod deadline_queue;
 pub mod directory;
+#[cfg(target_os = "linux")]
+pub mod epoll;
 pub mod file;
 pub mod file_descriptor;
 pub mod file_descriptor_set;
 pub mod file_lock;
 pub mod file_type;
+#[cfg(target_os = "linux")]
+pub mod futex;
 pub mod group;
+#[cfg(target_os = "linux")]
+pub mod inotify;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod ipc_capable;
 pub mod memory;
 pub mod memory_lock;
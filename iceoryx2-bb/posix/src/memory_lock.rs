@@ -76,12 +76,26 @@ impl MemoryLock {
         address: *const posix::void,
         len: usize,
     ) -> Result<MemoryLock, MemoryLockCreationError> {
+        Self::lock(address, len)?;
+        Ok(MemoryLock { address, len })
+    }
+
+    /// Locks a provided memory region without unlocking it again. The region stays locked
+    /// until it is unmapped or [`MemoryLock::unlock_all()`] is called.
+    ///
+    /// # Safety
+    ///   * the memory range [address, len] must be a valid mapped address range
+    ///
+    pub unsafe fn lock(
+        address: *const posix::void,
+        len: usize,
+    ) -> Result<(), MemoryLockCreationError> {
         if unsafe { posix::mlock(address, len) } == 0 {
-            return Ok(MemoryLock { address, len });
+            return Ok(());
         }
 
         let msg = "Unable to lock memory";
-        handle_errno!(MemoryLockCreationError, from "MemoryLock::new",
+        handle_errno!(MemoryLockCreationError, from "MemoryLock::lock",
             Errno::ENOMEM => (InvalidAddressRange, "{} since the specified range beginning from {:#16X} with a length of {} is not contained in the valid mapped pages in the address spaces of the current process.", msg, address as usize, len),
             Errno::EAGAIN => (UnableToLock, "{} since some or all memory could not be locked.", msg),
             Errno::EINVAL => (AddressNotAMultipleOfThePageSize, "{} since the address {:#16X} is not a multiple of the page-size {}.", msg, address as usize, SystemInfo::PageSize.value()),
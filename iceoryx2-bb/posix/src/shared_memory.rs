@@ -63,12 +63,13 @@
 //! println!("first byte: {}", shm.as_slice()[0]);
 //! ```
 
-use crate::file::{FileStatError, FileTruncateError};
+use crate::directory::Directory;
+use crate::file::{FileBuilder, FileStatError, FileTruncateError};
 use crate::file_descriptor::*;
 use crate::handle_errno;
 use crate::memory_lock::{MemoryLock, MemoryLockCreationError};
 use crate::signal::SignalHandler;
-use crate::system_configuration::Limit;
+use crate::system_configuration::{Limit, SystemInfo};
 use iceoryx2_bb_container::semantic_string::*;
 use iceoryx2_bb_elementary::enum_gen;
 use iceoryx2_bb_log::{error, fail, fatal_panic, trace};
@@ -78,12 +79,14 @@ use iceoryx2_bb_system_types::path::*;
 use iceoryx2_pal_configuration::PATH_SEPARATOR;
 use iceoryx2_pal_posix::posix::errno::Errno;
 use iceoryx2_pal_posix::posix::POSIX_SUPPORT_ADVANCED_SIGNAL_HANDLING;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_HUGE_PAGES;
 use iceoryx2_pal_posix::posix::POSIX_SUPPORT_PERSISTENT_SHARED_MEMORY;
 use iceoryx2_pal_posix::*;
+use lazy_static::lazy_static;
 
 use core::ptr::NonNull;
 use core::sync::atomic::Ordering;
-use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicBool;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU8};
 
 pub use crate::access_mode::AccessMode;
 pub use crate::creation_mode::CreationMode;
@@ -104,6 +107,7 @@ enum_gen! { SharedMemoryCreationError
     AlreadyExist,
     DoesNotExist,
     UnableToMapAtEnforcedBaseAddress,
+    HugePagesUnavailable,
     UnknownError(i32)
   mapping:
     FileTruncateError,
@@ -118,6 +122,154 @@ enum_gen! { SharedMemoryRemoveError
     UnknownError(i32)
 }
 
+/// Defines the size of the pages that back the [`SharedMemory`]. Huge pages reduce the number
+/// of TLB misses when large memory regions are accessed but they must be reserved by the
+/// system administrator (e.g. `vm.nr_hugepages`) and a hugetlbfs with the corresponding page
+/// size must be mounted. The mount points are discovered from `/proc/mounts`.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+#[repr(C)]
+pub enum PageSize {
+    /// The default page size of the system.
+    #[default]
+    Default,
+    /// 2 MiB huge pages, provided by a hugetlbfs mounted with `pagesize=2M`.
+    Huge2MiB,
+    /// 1 GiB huge pages, provided by a hugetlbfs mounted with `pagesize=1G`.
+    Huge1GiB,
+}
+
+impl PageSize {
+    /// Returns the size of a huge page in bytes or [`None`] when the default page size
+    /// is used.
+    pub fn huge_page_size(&self) -> Option<usize> {
+        match self {
+            PageSize::Default => None,
+            PageSize::Huge2MiB => Some(2 * 1024 * 1024),
+            PageSize::Huge1GiB => Some(1024 * 1024 * 1024),
+        }
+    }
+
+    /// Returns the mount point of the hugetlbfs that provides pages of this size. Returns
+    /// [`None`] for [`PageSize::Default`] or when no such hugetlbfs is mounted. The mount
+    /// points are discovered once per process when huge pages are used for the first time.
+    pub fn mount_point(&self) -> Option<Path> {
+        let huge_page_size = self.huge_page_size()?;
+        if !POSIX_SUPPORT_HUGE_PAGES {
+            return None;
+        }
+
+        lazy_static! {
+            static ref HUGE_PAGE_MOUNTS: Vec<HugePageMount> = HugePageMount::discover();
+        }
+
+        HUGE_PAGE_MOUNTS
+            .iter()
+            .find(|mount| mount.page_size == huge_page_size)
+            .map(|mount| mount.path)
+    }
+}
+
+#[derive(Debug, Clone, Copy)]
+struct HugePageMount {
+    path: Path,
+    page_size: usize,
+}
+
+impl HugePageMount {
+    const MOUNTS: &'static [u8] = b"/proc/mounts";
+    const MEMINFO: &'static [u8] = b"/proc/meminfo";
+
+    fn discover() -> Vec<HugePageMount> {
+        let mounts = match Self::read_proc_file(Self::MOUNTS) {
+            Some(v) => v,
+            None => return vec![],
+        };
+
+        let mut default_page_size = None;
+        let mut result = vec![];
+        for line in mounts.lines() {
+            let mut fields = line.split_whitespace();
+            let (Some(_), Some(mount_point), Some(fs_type), Some(options)) =
+                (fields.next(), fields.next(), fields.next(), fields.next())
+            else {
+                continue;
+            };
+
+            // whitespaces in mount points are escaped with octal sequences, those mount
+            // points are not supported
+            if fs_type != "hugetlbfs" || mount_point.contains('\\') {
+                continue;
+            }
+
+            // without the pagesize option the hugetlbfs uses the default huge page size
+            let page_size = match options
+                .split(',')
+                .find_map(|option| option.strip_prefix("pagesize="))
+            {
+                Some(value) => Self::parse_size(value),
+                None => *default_page_size.get_or_insert_with(Self::default_page_size),
+            };
+
+            if let (Some(page_size), Ok(path)) = (page_size, Path::new(mount_point.as_bytes())) {
+                trace!(from "PageSize::mount_point()",
+                    "discovered hugetlbfs at \"{}\" with a page size of {}", path, page_size);
+                result.push(HugePageMount { path, page_size });
+            }
+        }
+
+        result
+    }
+
+    fn default_page_size() -> Option<usize> {
+        let meminfo = Self::read_proc_file(Self::MEMINFO)?;
+        meminfo
+            .lines()
+            .find_map(|line| line.strip_prefix("Hugepagesize:"))
+            .and_then(|value| Self::parse_size(&value.replace(' ', "")))
+    }
+
+    // parses sizes like "2M", "1G", "1024M" or "2048kB"
+    fn parse_size(value: &str) -> Option<usize> {
+        let value = value.trim();
+        let (number, unit) = value.split_at(
+            value
+                .find(|c: char| !c.is_ascii_digit())
+                .unwrap_or(value.len()),
+        );
+
+        let factor = match unit {
+            "" => 1,
+            "k" | "K" | "kB" => 1024,
+            "m" | "M" => 1024 * 1024,
+            "g" | "G" => 1024 * 1024 * 1024,
+            _ => return None,
+        };
+
+        number.parse::<usize>().ok()?.checked_mul(factor)
+    }
+
+    // the files in procfs report a size of zero, therefore they are read until the end is
+    // reached
+    fn read_proc_file(file_path: &'static [u8]) -> Option<String> {
+        let file_path = FilePath::new(file_path).ok()?;
+        let file = FileBuilder::new(&file_path)
+            .open_existing(AccessMode::Read)
+            .ok()?;
+
+        let mut content = vec![];
+        let mut buffer = [0u8; 4096];
+        loop {
+            match file.read_range(content.len() as u64, &mut buffer) {
+                Ok(0) => break,
+                Ok(n) => content.extend_from_slice(&buffer[..n as usize]),
+                Err(_) => return None,
+            }
+        }
+
+        String::from_utf8(content).ok()
+    }
+}
+
 /// The builder for the [`SharedMemory`].
 #[derive(Debug)]
 pub struct SharedMemoryBuilder {
@@ -130,6 +282,7 @@ pub struct SharedMemoryBuilder {
     zero_memory: bool,
     access_mode: AccessMode,
     enforce_base_address: Option<u64>,
+    page_size: PageSize,
 }
 
 impl SharedMemoryBuilder {
@@ -144,6 +297,7 @@ impl SharedMemoryBuilder {
             creation_mode: None,
             zero_memory: true,
             enforce_base_address: None,
+            page_size: PageSize::Default,
         }
     }
 
@@ -161,6 +315,14 @@ impl SharedMemoryBuilder {
         self
     }
 
+    /// Defines the [`PageSize`] of the pages that back the shared memory. A shared memory
+    /// that is backed by huge pages can only be opened with the [`PageSize`] it was created
+    /// with.
+    pub fn page_size(mut self, value: PageSize) -> Self {
+        self.page_size = value;
+        self
+    }
+
     /// Opens an already existing shared memory.
     pub fn open_existing(
         mut self,
@@ -196,6 +358,8 @@ impl SharedMemoryBuilder {
             has_ownership: IoxAtomicBool::new(false),
             memory_lock: None,
             file_descriptor: fd,
+            page_size: self.page_size,
+            access_mode: self.access_mode,
         };
 
         trace!(from shm, "open");
@@ -232,12 +396,22 @@ impl SharedMemoryCreationBuilder {
         self
     }
 
-    /// The size of the shared memory.
+    /// The size of the shared memory. When the shared memory is backed by huge pages the size
+    /// is rounded up to a multiple of the huge page size.
     pub fn size(mut self, size: usize) -> Self {
         self.config.size = size;
         self
     }
 
+    /// Defines the [`PageSize`] of the pages that back the shared memory. When huge pages
+    /// are requested but not available on the system, [`SharedMemoryCreationBuilder::create()`]
+    /// fails with [`SharedMemoryCreationError::HugePagesUnavailable`]. Equivalent to
+    /// [`SharedMemoryBuilder::page_size()`].
+    pub fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
     /// Defines if a newly created [`SharedMemory`] owns the underlying resources. If they are not
     /// owned they will not be cleaned up and can be opened later but they need to be explicitly
     /// removed.
@@ -250,6 +424,15 @@ impl SharedMemoryCreationBuilder {
     pub fn create(mut self) -> Result<SharedMemory, SharedMemoryCreationError> {
         let msg = "Unable to create shared memory";
 
+        if let Some(huge_page_size) = self.config.page_size.huge_page_size() {
+            if !POSIX_SUPPORT_HUGE_PAGES {
+                fail!(from self.config, with SharedMemoryCreationError::HugePagesUnavailable,
+                    "{} since huge pages are not supported on this platform.", msg);
+            }
+
+            self.config.size = self.config.size.div_ceil(huge_page_size) * huge_page_size;
+        }
+
         let shm_created;
         let fd = match self
             .config
@@ -262,7 +445,7 @@ impl SharedMemoryCreationBuilder {
             }
             CreationMode::PurgeAndCreate => {
                 shm_created = true;
-                fail!(from self.config, when SharedMemory::shm_unlink(&self.config.name),
+                fail!(from self.config, when SharedMemory::shm_unlink(&self.config.name, self.config.page_size),
                     "Failed to remove already existing shared memory.");
                 SharedMemory::shm_create(&self.config.name, &self.config)?
             }
@@ -295,6 +478,8 @@ impl SharedMemoryCreationBuilder {
             has_ownership: IoxAtomicBool::new(self.config.has_ownership),
             memory_lock: None,
             file_descriptor: fd,
+            page_size: self.config.page_size,
+            access_mode: self.config.access_mode,
         };
 
         if !shm_created {
@@ -316,9 +501,22 @@ impl SharedMemoryCreationBuilder {
 
         fail!(from self.config, when shm.truncate(self.config.size), "{} since the shared memory truncation failed.", msg);
 
-        shm.base_address = fail!(from self.config, when SharedMemory::mmap(&shm.file_descriptor, &self.config),
-                                    "{} since the memory could not be mapped.", msg)
-            as *mut u8;
+        shm.base_address = match SharedMemory::mmap(&shm.file_descriptor, &self.config) {
+            Ok(base_address) => base_address as *mut u8,
+            Err(SharedMemoryCreationError::InsufficientMemory)
+                if self.config.page_size != PageSize::Default =>
+            {
+                // the huge page backed file was created but cannot be mapped, remove it
+                shm.acquire_ownership();
+                fail!(from self.config, with SharedMemoryCreationError::HugePagesUnavailable,
+                    "{} since not enough huge pages of the type {:?} are reserved in the system.",
+                    msg, self.config.page_size);
+            }
+            Err(e) => {
+                fail!(from self.config, with e,
+                    "{} since the memory could not be mapped.", msg);
+            }
+        };
 
         if self.config.enforce_base_address.is_some()
             && self.config.enforce_base_address.unwrap() != shm.base_address as u64
@@ -374,10 +572,15 @@ pub struct SharedMemory {
     has_ownership: IoxAtomicBool,
     file_descriptor: FileDescriptor,
     memory_lock: Option<MemoryLock>,
+    page_size: PageSize,
+    access_mode: AccessMode,
 }
 
 impl Drop for SharedMemory {
     fn drop(&mut self) {
+        // the memory must be unlocked before it is unmapped
+        self.memory_lock.take();
+
         if !self.base_address.is_null() {
             if unsafe { posix::munmap(self.base_address as *mut posix::void, self.size) } != 0 {
                 fatal_panic!(from self, "This should never happen! Unable to unmap since the base address or range is invalid.");
@@ -387,7 +590,7 @@ impl Drop for SharedMemory {
 
         if self.has_ownership() {
             match self.set_permission(Permission::OWNER_ALL) {
-                Ok(()) => match Self::shm_unlink(&self.name) {
+                Ok(()) => match Self::shm_unlink(&self.name, self.page_size) {
                     Ok(_) => {
                         trace!(from self, "delete");
                     }
@@ -404,16 +607,34 @@ impl Drop for SharedMemory {
 }
 
 impl SharedMemory {
-    /// Returns true if the shared memory exists and is accessible, otherwise false.
+    /// Returns true if the shared memory exists and is accessible, otherwise false. Only
+    /// shared memories that are backed by pages of the default size are considered, use
+    /// [`SharedMemory::does_exist_with_page_size()`] for huge page backed shared memories.
     pub fn does_exist(name: &FileName) -> bool {
-        let file_path =
-            FilePath::from_path_and_file(&Path::new(&[PATH_SEPARATOR; 1]).unwrap(), name).unwrap();
+        Self::does_exist_with_page_size(name, PageSize::Default)
+    }
+
+    /// Returns true if the shared memory that is backed by pages of the provided [`PageSize`]
+    /// exists and is accessible, otherwise false.
+    pub fn does_exist_with_page_size(name: &FileName, page_size: PageSize) -> bool {
+        let file_path = match Self::file_path(name, page_size) {
+            Some(v) => v,
+            None => return false,
+        };
+
         FileDescriptor::new(unsafe {
-            posix::shm_open(
-                file_path.as_c_str(),
-                AccessMode::Read.as_oflag(),
-                Permission::none().as_mode(),
-            )
+            match page_size {
+                PageSize::Default => posix::shm_open(
+                    file_path.as_c_str(),
+                    AccessMode::Read.as_oflag(),
+                    Permission::none().as_mode(),
+                ),
+                _ => posix::open_with_mode(
+                    file_path.as_c_str(),
+                    AccessMode::Read.as_oflag(),
+                    Permission::none().as_mode(),
+                ),
+            }
         })
         .is_some()
     }
@@ -443,30 +664,59 @@ impl SharedMemory {
         self.has_ownership.store(true, Ordering::Relaxed)
     }
 
-    /// Removes a shared memory file.
+    /// Removes a shared memory file that is backed by pages of the default size. Use
+    /// [`SharedMemory::remove_with_page_size()`] for huge page backed shared memories.
     pub fn remove(name: &FileName) -> Result<bool, SharedMemoryRemoveError> {
-        match Self::shm_unlink(name) {
-            Ok(true) => {
-                trace!(from "SharedMemory::remove", "\"{}\"", name);
-                Ok(true)
-            }
-            Ok(false) => Ok(false),
-            Err(v) => Err(v),
+        Self::remove_with_page_size(name, PageSize::Default)
+    }
+
+    /// Removes a shared memory file that is backed by pages of the provided [`PageSize`].
+    pub fn remove_with_page_size(
+        name: &FileName,
+        page_size: PageSize,
+    ) -> Result<bool, SharedMemoryRemoveError> {
+        let has_removed = Self::shm_unlink(name, page_size)?;
+
+        if has_removed {
+            trace!(from "SharedMemory::remove", "\"{}\" ({:?})", name, page_size);
         }
+
+        Ok(has_removed)
     }
 
-    /// Returns a list of all shared memory objects
+    /// Returns a list of all shared memory objects that are backed by pages of the default
+    /// size.
     pub fn list() -> Vec<FileName> {
-        let mut result = vec![];
+        Self::list_with_page_size(PageSize::Default)
+    }
 
-        let raw_shm_names = unsafe { posix::shm_list() };
-        for name in &raw_shm_names {
-            if let Ok(f) = unsafe { FileName::from_c_str(name.as_ptr() as *mut _) } {
-                result.push(f)
+    /// Returns a list of all shared memory objects that are backed by pages of the provided
+    /// [`PageSize`]. For huge pages these are all files in the corresponding hugetlbfs.
+    pub fn list_with_page_size(page_size: PageSize) -> Vec<FileName> {
+        if page_size == PageSize::Default {
+            let mut result = vec![];
+            let raw_shm_names = unsafe { posix::shm_list() };
+            for name in &raw_shm_names {
+                if let Ok(f) = unsafe { FileName::from_c_str(name.as_ptr() as *mut _) } {
+                    result.push(f)
+                }
             }
+
+            return result;
         }
 
-        result
+        let mount_point = match page_size.mount_point() {
+            Some(v) => v,
+            None => return vec![],
+        };
+
+        match Directory::new(&mount_point) {
+            Ok(directory) => match directory.contents() {
+                Ok(contents) => contents.iter().map(|entry| *entry.name()).collect(),
+                Err(_) => vec![],
+            },
+            Err(_) => vec![],
+        }
     }
 
     /// returns the name of the shared memory
@@ -492,6 +742,43 @@ impl SharedMemory {
         self.size
     }
 
+    /// returns the [`PageSize`] of the pages that back the shared memory
+    pub fn page_size(&self) -> PageSize {
+        self.page_size
+    }
+
+    /// Touches every page of the shared memory so that all pages are mapped into the process
+    /// space. Subsequent accesses do not cause page faults anymore, unless the system swaps the
+    /// memory out. Use [`SharedMemory::lock_in_memory()`] to prevent this.
+    ///
+    /// A writable mapping is pre-faulted for writing, so that also the first write to a page
+    /// does not fault. Every page is touched with an atomic add of zero, which does not
+    /// overwrite concurrent writes of other processes. A read-only mapping is pre-faulted
+    /// for reading.
+    pub fn pre_fault(&self) {
+        let page_size = SystemInfo::PageSize.value();
+        let is_writable = matches!(self.access_mode, AccessMode::Write | AccessMode::ReadWrite);
+        for offset in (0..self.size).step_by(page_size) {
+            let address = unsafe { self.base_address.add(offset) };
+            if is_writable {
+                unsafe { &*(address as *const IoxAtomicU8) }.fetch_add(0, Ordering::Relaxed);
+            } else {
+                unsafe { core::ptr::read_volatile(address) };
+            }
+        }
+        trace!(from self, "pre-faulted {} bytes", self.size);
+    }
+
+    /// Locks the shared memory into the physical memory so that it is never swapped out. All
+    /// pages are mapped into the process space. The lock is held until the shared memory is
+    /// unmapped.
+    pub fn lock_in_memory(&self) -> Result<(), MemoryLockCreationError> {
+        fail!(from self, when unsafe { MemoryLock::lock(self.base_address.cast(), self.size) },
+            "Unable to lock the shared memory in memory.");
+        trace!(from self, "locked {} bytes in memory", self.size);
+        Ok(())
+    }
+
     /// returns a slice to the memory
     pub fn as_slice(&self) -> &[u8] {
         unsafe { core::slice::from_raw_parts(self.base_address, self.size) }
@@ -506,21 +793,35 @@ impl SharedMemory {
         name: &FileName,
         config: &SharedMemoryBuilder,
     ) -> Result<FileDescriptor, SharedMemoryCreationError> {
-        let file_path =
-            FilePath::from_path_and_file(&Path::new(&[PATH_SEPARATOR; 1]).unwrap(), name).unwrap();
+        let msg = "Unable to create shared memory";
+        let file_path = match Self::file_path(name, config.page_size) {
+            Some(v) => v,
+            None => {
+                fail!(from config, with SharedMemoryCreationError::HugePagesUnavailable,
+                    "{} since no hugetlbfs is mounted for the page size {:?}.", msg, config.page_size);
+            }
+        };
+        let oflag = CreationMode::CreateExclusive.as_oflag() | config.access_mode.as_oflag();
         let fd = FileDescriptor::new(unsafe {
-            posix::shm_open(
-                file_path.as_c_str(),
-                CreationMode::CreateExclusive.as_oflag() | config.access_mode.as_oflag(),
-                config.permission.as_mode(),
-            )
+            match config.page_size {
+                PageSize::Default => {
+                    posix::shm_open(file_path.as_c_str(), oflag, config.permission.as_mode())
+                }
+                _ => {
+                    posix::open_with_mode(file_path.as_c_str(), oflag, config.permission.as_mode())
+                }
+            }
         });
 
         if let Some(v) = fd {
             return Ok(v);
         }
 
-        let msg = "Unable to create shared memory";
+        if config.page_size != PageSize::Default && Errno::get() == Errno::ENOENT {
+            fail!(from config, with SharedMemoryCreationError::HugePagesUnavailable,
+                "{} since the hugetlbfs for the page size {:?} is no longer mounted.", msg, config.page_size);
+        }
+
         handle_errno!(SharedMemoryCreationError, from config,
             Errno::EACCES => (InsufficientPermissions, "{} due to insufficient permissions.", msg),
             Errno::EINVAL => (InvalidName, "{} since the provided name \"{}\" is invalid.", msg, name),
@@ -536,21 +837,30 @@ impl SharedMemory {
         name: &FileName,
         config: &SharedMemoryBuilder,
     ) -> Result<FileDescriptor, SharedMemoryCreationError> {
-        let file_path =
-            FilePath::from_path_and_file(&Path::new(&[PATH_SEPARATOR; 1]).unwrap(), name).unwrap();
+        let msg = "Unable to open shared memory";
+        let file_path = match Self::file_path(name, config.page_size) {
+            Some(v) => v,
+            None => {
+                fail!(from config, with SharedMemoryCreationError::DoesNotExist,
+                    "{} since no hugetlbfs is mounted for the page size {:?}.", msg, config.page_size);
+            }
+        };
+        let oflag = config.access_mode.as_oflag();
         let fd = FileDescriptor::new(unsafe {
-            posix::shm_open(
-                file_path.as_c_str(),
-                config.access_mode.as_oflag(),
-                Permission::none().as_mode(),
-            )
+            match config.page_size {
+                PageSize::Default => {
+                    posix::shm_open(file_path.as_c_str(), oflag, Permission::none().as_mode())
+                }
+                _ => {
+                    posix::open_with_mode(file_path.as_c_str(), oflag, Permission::none().as_mode())
+                }
+            }
         });
 
         if let Some(v) = fd {
             return Ok(v);
         }
 
-        let msg = "Unable to open shared memory";
         handle_errno!(SharedMemoryCreationError, from config,
             Errno::ENOENT => (DoesNotExist, "{} since the shared memory does not exist.", msg),
             Errno::EACCES => (InsufficientPermissions, "{} due to insufficient permissions.", msg),
@@ -591,10 +901,19 @@ impl SharedMemory {
         );
     }
 
-    fn shm_unlink(name: &FileName) -> Result<bool, SharedMemoryRemoveError> {
-        let file_path =
-            FilePath::from_path_and_file(&Path::new(&[PATH_SEPARATOR; 1]).unwrap(), name).unwrap();
-        if unsafe { posix::shm_unlink(file_path.as_c_str()) } == 0 {
+    fn shm_unlink(name: &FileName, page_size: PageSize) -> Result<bool, SharedMemoryRemoveError> {
+        let file_path = match Self::file_path(name, page_size) {
+            Some(v) => v,
+            None => return Ok(false),
+        };
+        let result = unsafe {
+            match page_size {
+                PageSize::Default => posix::shm_unlink(file_path.as_c_str()),
+                _ => posix::unlink(file_path.as_c_str()),
+            }
+        };
+
+        if result == 0 {
             return Ok(true);
         }
 
@@ -614,6 +933,18 @@ impl SharedMemory {
     }
 }
 
+impl SharedMemory {
+    // returns None when no hugetlbfs is mounted for the huge page size
+    fn file_path(name: &FileName, page_size: PageSize) -> Option<FilePath> {
+        let path = match page_size {
+            PageSize::Default => Path::new(&[PATH_SEPARATOR; 1]).unwrap(),
+            _ => page_size.mount_point()?,
+        };
+
+        FilePath::from_path_and_file(&path, name).ok()
+    }
+}
+
 impl FileDescriptorBased for SharedMemory {
     fn file_descriptor(&self) -> &FileDescriptor {
         &self.file_descriptor
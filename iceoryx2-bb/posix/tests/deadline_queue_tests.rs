@@ -224,4 +224,115 @@ mod deadline_queue {
         let next_deadline = sut.duration_until_next_deadline().unwrap();
         assert_that!(next_deadline, ne Duration::ZERO);
     }
+
+    #[test]
+    fn reset_deadline_waits_again_the_full_time() {
+        let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+        let guard = sut
+            .add_deadline_interval(Duration::from_millis(100))
+            .unwrap();
+
+        std::thread::sleep(Duration::from_millis(60));
+        guard.reset().unwrap();
+        std::thread::sleep(Duration::from_millis(60));
+
+        let mut missed_deadlines = vec![];
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(missed_deadlines, len 0);
+        assert_that!(sut.duration_until_next_deadline().unwrap(), ge Duration::from_millis(1));
+    }
+
+    #[test]
+    fn many_attachments_with_removal_and_reset_work() {
+        const NUMBER_OF_ATTACHMENTS: usize = 1024;
+        let sut = DeadlineQueueBuilder::new().create().unwrap();
+        let mut guards = vec![];
+
+        for n in 0..NUMBER_OF_ATTACHMENTS {
+            guards.push(Some(
+                sut.add_deadline_interval(Duration::from_secs((n + 1) as u64))
+                    .unwrap(),
+            ));
+        }
+
+        for guard in guards.iter_mut().step_by(2) {
+            guard.take();
+        }
+
+        for guard in guards.iter().flatten() {
+            guard.reset().unwrap();
+        }
+
+        assert_that!(sut.len(), eq NUMBER_OF_ATTACHMENTS / 2);
+        assert_that!(sut.duration_until_next_deadline().unwrap(), le Duration::from_secs(2));
+        assert_that!(sut.duration_until_next_deadline().unwrap(), ge Duration::from_secs(1));
+
+        let new_guard = sut.add_deadline_interval(Duration::from_nanos(1)).unwrap();
+        std::thread::sleep(Duration::from_millis(10));
+
+        let mut missed_deadlines = vec![];
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(missed_deadlines, len 1);
+        assert_that!(missed_deadlines, contains new_guard.index());
+    }
+
+    #[test]
+    fn timer_slack_can_be_configured() {
+        let sut = DeadlineQueueBuilder::new()
+            .timer_slack(Duration::from_millis(5))
+            .create()
+            .unwrap();
+
+        assert_that!(sut.timer_slack(), eq Duration::from_millis(5));
+    }
+
+    #[test]
+    fn deadlines_within_timer_slack_are_reported_together() {
+        let sut = DeadlineQueueBuilder::new()
+            .timer_slack(Duration::from_millis(200))
+            .create()
+            .unwrap();
+
+        let guard_1 = sut
+            .add_deadline_interval(Duration::from_millis(10))
+            .unwrap();
+        let guard_2 = sut
+            .add_deadline_interval(Duration::from_millis(50))
+            .unwrap();
+
+        let next_deadline = sut.duration_until_next_deadline().unwrap();
+        assert_that!(next_deadline, ge Duration::from_millis(50));
+        assert_that!(next_deadline, le Duration::from_millis(200));
+
+        std::thread::sleep(Duration::from_millis(60));
+        let mut missed_deadlines = vec![];
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+        assert_that!(missed_deadlines, len 0);
+
+        std::thread::sleep(sut.duration_until_next_deadline().unwrap());
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(missed_deadlines, len 2);
+        assert_that!(missed_deadlines, contains guard_1.index());
+        assert_that!(missed_deadlines, contains guard_2.index());
+    }
 }
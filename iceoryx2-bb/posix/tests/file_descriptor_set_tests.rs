@@ -191,6 +191,46 @@ fn file_descriptor_set_blocking_wait_immediately_returns_notifications() {
     assert_that!(result[0], eq unsafe{sut_receiver.file_descriptor().native_handle()});
 }
 
+#[test]
+fn file_descriptor_set_does_not_report_suspended_fd_until_it_is_resumed() {
+    create_test_directory();
+    let socket_name = generate_socket_name();
+
+    let sut_receiver = UnixDatagramReceiverBuilder::new(&socket_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .create()
+        .unwrap();
+
+    let sut_sender = UnixDatagramSenderBuilder::new(&socket_name)
+        .create()
+        .unwrap();
+
+    let fd_set = FileDescriptorSet::new();
+    let _guard = fd_set.add(&sut_receiver).unwrap();
+    sut_sender.blocking_send(b"abc").unwrap();
+
+    assert_that!(fd_set.suspend(sut_receiver.file_descriptor()), is_ok);
+    assert_that!(fd_set.contains(&sut_receiver), eq true);
+
+    let mut counter = 0;
+    let number_of_notifications = fd_set
+        .timed_wait(TIMEOUT, FileEvent::Read, |_| counter += 1)
+        .unwrap();
+    assert_that!(number_of_notifications, eq 0);
+    assert_that!(counter, eq 0);
+
+    assert_that!(fd_set.resume(sut_receiver.file_descriptor()), is_ok);
+
+    let number_of_notifications = fd_set
+        .timed_wait(TIMEOUT, FileEvent::Read, |_| counter += 1)
+        .unwrap();
+    assert_that!(number_of_notifications, eq 1);
+    assert_that!(counter, eq 1);
+
+    let result = fd_set.suspend(sut_sender.file_descriptor());
+    assert_that!(result.err(), eq Some(FileDescriptorSetModifyError::NotAttached));
+}
+
 #[test]
 fn file_descriptor_guard_has_access_to_underlying_fd() {
     create_test_directory();
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(target_os = "linux")]
+mod futex {
+    use core::sync::atomic::Ordering;
+    use core::time::Duration;
+    use iceoryx2_bb_posix::futex::*;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_bb_testing::watchdog::Watchdog;
+    use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU32};
+    use std::sync::Barrier;
+    use std::time::Instant;
+
+    static TIMEOUT: Duration = Duration::from_millis(10);
+
+    #[test]
+    fn futex_wait_returns_immediately_when_value_does_not_match() {
+        let _watchdog = Watchdog::new();
+        let sut = IoxAtomicU32::new(1);
+
+        assert_that!(futex_wait(&sut, 0, None), is_ok);
+    }
+
+    #[test]
+    fn futex_timed_wait_blocks_at_least_timeout() {
+        let sut = IoxAtomicU32::new(0);
+
+        let start = Instant::now();
+        assert_that!(futex_wait(&sut, 0, Some(TIMEOUT)), is_ok);
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+    }
+
+    #[test]
+    fn futex_wake_without_waiters_wakes_nobody() {
+        let sut = IoxAtomicU32::new(0);
+
+        assert_that!(futex_wake(&sut, u32::MAX), eq Ok(0));
+    }
+
+    #[test]
+    fn futex_wake_wakes_up_blocking_waiter() {
+        let _watchdog = Watchdog::new();
+        let sut = IoxAtomicU32::new(0);
+        let has_woken_up = IoxAtomicBool::new(false);
+        let barrier = Barrier::new(2);
+
+        std::thread::scope(|s| {
+            s.spawn(|| {
+                barrier.wait();
+                while sut.load(Ordering::SeqCst) == 0 {
+                    futex_wait(&sut, 0, None).unwrap();
+                }
+                has_woken_up.store(true, Ordering::SeqCst);
+            });
+
+            barrier.wait();
+            std::thread::sleep(TIMEOUT);
+            assert_that!(has_woken_up.load(Ordering::SeqCst), eq false);
+
+            sut.store(1, Ordering::SeqCst);
+            assert_that!(futex_wake(&sut, 1), is_ok);
+        });
+
+        assert_that!(has_woken_up.load(Ordering::SeqCst), eq true);
+    }
+}
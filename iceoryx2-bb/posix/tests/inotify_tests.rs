@@ -0,0 +1,168 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(target_os = "linux")]
+mod inotify {
+    use core::time::Duration;
+    use iceoryx2_bb_container::semantic_string::SemanticString;
+    use iceoryx2_bb_posix::config::*;
+    use iceoryx2_bb_posix::directory::*;
+    use iceoryx2_bb_posix::epoll::*;
+    use iceoryx2_bb_posix::file::*;
+    use iceoryx2_bb_posix::inotify::*;
+    use iceoryx2_bb_posix::testing::create_test_directory;
+    use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+    use iceoryx2_bb_system_types::file_name::FileName;
+    use iceoryx2_bb_system_types::file_path::FilePath;
+    use iceoryx2_bb_system_types::path::Path;
+    use iceoryx2_bb_testing::assert_that;
+
+    static TIMEOUT: Duration = Duration::from_millis(100);
+    const DIRECTORY_EVENTS: InotifyEvents = InotifyEvents::ENTRY_CREATED;
+
+    fn generate_name(prefix: &[u8]) -> FileName {
+        let mut name = FileName::new(prefix).unwrap();
+        name.push_bytes(
+            UniqueSystemId::new()
+                .unwrap()
+                .value()
+                .to_string()
+                .as_bytes(),
+        )
+        .unwrap();
+        name
+    }
+
+    fn create_directory() -> Path {
+        create_test_directory();
+        let mut directory = test_directory();
+        directory
+            .add_path_entry(&generate_name(b"inotify_tests_dir_").into())
+            .unwrap();
+        Directory::create(&directory, Permission::OWNER_ALL).unwrap();
+        directory
+    }
+
+    fn create_file(directory: &Path, name: &FileName) -> FilePath {
+        let file_path = FilePath::from_path_and_file(directory, name).unwrap();
+        FileBuilder::new(&file_path)
+            .creation_mode(CreationMode::PurgeAndCreate)
+            .create()
+            .unwrap();
+        file_path
+    }
+
+    #[test]
+    fn inotify_try_read_without_changes_returns_no_events() {
+        let directory = create_directory();
+        let sut = InotifyBuilder::new().create().unwrap();
+        sut.add_watch(&directory, DIRECTORY_EVENTS).unwrap();
+
+        let mut counter = 0;
+        assert_that!(sut.try_read(|_| counter += 1), eq Ok(0));
+        assert_that!(counter, eq 0);
+
+        Directory::remove(&directory).unwrap();
+    }
+
+    #[test]
+    fn inotify_reports_created_and_deleted_entries() {
+        let directory = create_directory();
+        let sut = InotifyBuilder::new().create().unwrap();
+        let watch = sut
+            .add_watch(
+                &directory,
+                InotifyEvents::ENTRY_CREATED | InotifyEvents::ENTRY_DELETED,
+            )
+            .unwrap();
+
+        let file_name = generate_name(b"inotify_tests_file_");
+        let file_path = create_file(&directory, &file_name);
+        File::remove(&file_path).unwrap();
+
+        let mut events = vec![];
+        assert_that!(sut.try_read(|event| {
+            assert_that!(event.watch(), eq watch);
+            assert_that!(event.name(), eq Some(file_name.as_bytes()));
+            events.push(event.events());
+        }), eq Ok(2));
+
+        assert_that!(events[0].contains(InotifyEvents::ENTRY_CREATED), eq true);
+        assert_that!(events[1].contains(InotifyEvents::ENTRY_DELETED), eq true);
+        assert_that!(sut.try_read(|_| {}), eq Ok(0));
+
+        Directory::remove(&directory).unwrap();
+    }
+
+    #[test]
+    fn inotify_does_not_report_events_that_are_not_watched() {
+        let directory = create_directory();
+        let sut = InotifyBuilder::new().create().unwrap();
+        sut.add_watch(&directory, InotifyEvents::ENTRY_DELETED)
+            .unwrap();
+
+        let file_path = create_file(&directory, &generate_name(b"inotify_tests_file_"));
+
+        assert_that!(sut.try_read(|_| {}), eq Ok(0));
+
+        File::remove(&file_path).unwrap();
+        Directory::remove(&directory).unwrap();
+    }
+
+    #[test]
+    fn inotify_reports_removed_watch_when_directory_is_removed() {
+        let directory = create_directory();
+        let sut = InotifyBuilder::new().create().unwrap();
+        sut.add_watch(&directory, DIRECTORY_EVENTS).unwrap();
+
+        Directory::remove(&directory).unwrap();
+
+        let mut watch_removed = false;
+        sut.try_read(|event| {
+            watch_removed |= event.events().contains(InotifyEvents::WATCH_REMOVED);
+        })
+        .unwrap();
+        assert_that!(watch_removed, eq true);
+    }
+
+    #[test]
+    fn inotify_add_watch_for_non_existing_directory_fails() {
+        create_test_directory();
+        let mut directory = test_directory();
+        directory
+            .add_path_entry(&generate_name(b"inotify_tests_does_not_exist_").into())
+            .unwrap();
+        let sut = InotifyBuilder::new().create().unwrap();
+
+        assert_that!(sut.add_watch(&directory, DIRECTORY_EVENTS).err(), eq Some(InotifyWatchError::DoesNotExist));
+    }
+
+    #[test]
+    fn inotify_becomes_readable_on_change() {
+        let directory = create_directory();
+        let sut = InotifyBuilder::new().create().unwrap();
+        sut.add_watch(&directory, DIRECTORY_EVENTS).unwrap();
+
+        let epoll = EpollBuilder::new().create().unwrap();
+        let _guard = epoll.add(&sut).unwrap();
+        assert_that!(epoll.timed_wait(Duration::ZERO, |_| {}), eq Ok(0));
+
+        let file_path = create_file(&directory, &generate_name(b"inotify_tests_file_"));
+        assert_that!(epoll.timed_wait(TIMEOUT, |_| {}), eq Ok(1));
+
+        sut.try_read(|_| {}).unwrap();
+        assert_that!(epoll.timed_wait(Duration::ZERO, |_| {}), eq Ok(0));
+
+        File::remove(&file_path).unwrap();
+        Directory::remove(&directory).unwrap();
+    }
+}
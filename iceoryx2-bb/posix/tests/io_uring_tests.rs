@@ -0,0 +1,373 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(target_os = "linux")]
+mod io_uring {
+    use core::time::Duration;
+    use iceoryx2_bb_container::semantic_string::SemanticString;
+    use iceoryx2_bb_posix::config::*;
+    use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+    use iceoryx2_bb_posix::io_uring::*;
+    use iceoryx2_bb_posix::testing::create_test_directory;
+    use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+    use iceoryx2_bb_posix::unix_datagram_socket::*;
+    use iceoryx2_bb_system_types::file_name::FileName;
+    use iceoryx2_bb_system_types::file_path::FilePath;
+    use iceoryx2_bb_testing::{assert_that, test_requires};
+    use std::time::Instant;
+
+    static TIMEOUT: Duration = Duration::from_millis(10);
+
+    fn generate_socket_name() -> FilePath {
+        let mut file = FileName::new(b"io_uring_tests").unwrap();
+        file.push_bytes(
+            UniqueSystemId::new()
+                .unwrap()
+                .value()
+                .to_string()
+                .as_bytes(),
+        )
+        .unwrap();
+
+        FilePath::from_path_and_file(&test_directory(), &file).unwrap()
+    }
+
+    fn is_io_uring_supported() -> bool {
+        !matches!(
+            IoUringBuilder::new().create(),
+            Err(IoUringCreateError::NotSupported)
+        )
+    }
+
+    fn create_receiver_and_sender() -> (UnixDatagramReceiver, UnixDatagramSender) {
+        let socket_name = generate_socket_name();
+
+        let receiver = UnixDatagramReceiverBuilder::new(&socket_name)
+            .creation_mode(CreationMode::PurgeAndCreate)
+            .create()
+            .unwrap();
+
+        let sender = UnixDatagramSenderBuilder::new(&socket_name)
+            .create()
+            .unwrap();
+
+        (receiver, sender)
+    }
+
+    #[test]
+    fn io_uring_timed_wait_blocks_at_least_timeout() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, _sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+
+        let start = Instant::now();
+
+        let mut result = vec![];
+        sut.timed_wait(TIMEOUT, |fd| result.push(unsafe { fd.native_handle() }))
+            .unwrap();
+
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+        assert_that!(result, len 0);
+    }
+
+    #[test]
+    fn io_uring_add_and_remove_works() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+        let mut sockets = vec![];
+        let number_of_fds: usize = 256;
+
+        create_test_directory();
+        for _ in 0..number_of_fds {
+            let socket_name = generate_socket_name();
+            sockets.push(
+                UnixDatagramReceiverBuilder::new(&socket_name)
+                    .creation_mode(CreationMode::PurgeAndCreate)
+                    .create()
+                    .unwrap(),
+            );
+        }
+
+        assert_that!(sut.is_empty(), eq true);
+
+        let mut guards = vec![];
+        for (n, fd) in sockets.iter().enumerate() {
+            let guard = sut.add(fd);
+            assert_that!(guard, is_ok);
+            guards.push(guard);
+            assert_that!(sut.len(), eq n + 1);
+        }
+
+        for n in 0..number_of_fds {
+            guards.pop();
+            assert_that!(sut.len(), eq number_of_fds - n - 1);
+        }
+
+        assert_that!(sut.is_empty(), eq true);
+    }
+
+    #[test]
+    fn io_uring_add_same_fd_twice_fails() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+
+        create_test_directory();
+        let (socket, _sender) = create_receiver_and_sender();
+
+        let _guard = sut.add(&socket).unwrap();
+
+        let result = sut.add(&socket);
+        assert_that!(result.err(), eq Some(IoUringAddError::AlreadyAttached));
+        assert_that!(sut.len(), eq 1);
+    }
+
+    #[test]
+    fn io_uring_fd_can_be_added_again_after_guard_was_dropped() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+
+        create_test_directory();
+        let (socket, _sender) = create_receiver_and_sender();
+
+        let guard = sut.add(&socket).unwrap();
+        drop(guard);
+
+        let result = sut.add(&socket);
+        assert_that!(result, is_ok);
+    }
+
+    #[test]
+    fn io_uring_timed_wait_works() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+        let send_data: Vec<u8> = vec![1u8, 3u8, 3u8, 7u8, 13u8, 37u8];
+        sut_sender.blocking_send(send_data.as_slice()).unwrap();
+
+        let mut result = vec![];
+        let number_of_notifications = sut
+            .timed_wait(TIMEOUT, |fd| result.push(unsafe { fd.native_handle() }))
+            .unwrap();
+
+        assert_that!(number_of_notifications, eq 1);
+        assert_that!(result, len 1);
+        assert_that!(result[0], eq unsafe{sut_receiver.file_descriptor().native_handle()});
+    }
+
+    #[test]
+    fn io_uring_blocking_wait_immediately_returns_notifications() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+        let send_data: Vec<u8> = vec![1u8, 3u8, 3u8, 7u8, 13u8, 37u8];
+        sut_sender.blocking_send(send_data.as_slice()).unwrap();
+
+        let mut result = vec![];
+        let number_of_notifications = sut
+            .blocking_wait(|fd| result.push(unsafe { fd.native_handle() }))
+            .unwrap();
+
+        assert_that!(number_of_notifications, eq 1);
+        assert_that!(result, len 1);
+        assert_that!(result[0], eq unsafe{sut_receiver.file_descriptor().native_handle()});
+    }
+
+    #[test]
+    fn io_uring_does_not_report_removed_fd() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let guard = sut.add(&sut_receiver).unwrap();
+        sut_sender.blocking_send(b"abc").unwrap();
+        drop(guard);
+
+        let mut counter = 0;
+        let number_of_notifications = sut.timed_wait(TIMEOUT, |_| counter += 1).unwrap();
+
+        assert_that!(number_of_notifications, eq 0);
+        assert_that!(counter, eq 0);
+    }
+
+    #[test]
+    fn io_uring_does_not_report_suspended_fd_until_it_is_resumed() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+        // submits the poll request so that it is in flight when it is suspended
+        assert_that!(sut.try_wait(|_| ()), eq Ok(0));
+
+        assert_that!(sut.suspend(sut_receiver.file_descriptor()), is_ok);
+        assert_that!(sut.len(), eq 1);
+        sut_sender.blocking_send(b"abc").unwrap();
+
+        let mut counter = 0;
+        let number_of_notifications = sut.timed_wait(TIMEOUT, |_| counter += 1).unwrap();
+        assert_that!(number_of_notifications, eq 0);
+        assert_that!(counter, eq 0);
+
+        assert_that!(sut.resume(sut_receiver.file_descriptor()), is_ok);
+
+        let number_of_notifications = sut.timed_wait(TIMEOUT, |_| counter += 1).unwrap();
+        assert_that!(number_of_notifications, eq 1);
+        assert_that!(counter, eq 1);
+    }
+
+    #[test]
+    fn io_uring_triggered_fd_can_be_suspended_and_resumed() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+        sut_sender.blocking_send(b"abc").unwrap();
+
+        let mut counter = 0;
+        assert_that!(sut.timed_wait(TIMEOUT, |_| counter += 1), eq Ok(1));
+        assert_that!(sut.suspend(sut_receiver.file_descriptor()), is_ok);
+        assert_that!(sut.timed_wait(TIMEOUT, |_| counter += 1), eq Ok(0));
+
+        assert_that!(sut.resume(sut_receiver.file_descriptor()), is_ok);
+        assert_that!(sut.timed_wait(TIMEOUT, |_| counter += 1), eq Ok(1));
+        assert_that!(counter, eq 2);
+    }
+
+    #[test]
+    fn io_uring_suspend_of_not_attached_fd_fails() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, _sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let result = sut.suspend(sut_receiver.file_descriptor());
+        assert_that!(result.err(), eq Some(IoUringModifyError::NotAttached));
+    }
+
+    #[test]
+    fn io_uring_guard_has_access_to_underlying_fd() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, _sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let guard = sut.add(&sut_receiver).unwrap();
+
+        unsafe {
+            assert_that!(guard.file_descriptor().native_handle(), eq sut_receiver.file_descriptor().native_handle())
+        }
+    }
+
+    #[test]
+    fn io_uring_debug_works() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+        assert_that!(format!("{:?}", sut).starts_with("IoUring"), eq true);
+    }
+
+    #[test]
+    fn io_uring_triggering_many_returns_correct_number_of_notifications() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+        let mut sockets = vec![];
+        let mut senders = vec![];
+        let number_of_fds: usize = 128;
+
+        create_test_directory();
+        for _ in 0..number_of_fds {
+            let (receiver, sender) = create_receiver_and_sender();
+            sockets.push(receiver);
+            senders.push(sender);
+        }
+
+        let mut guards = vec![];
+        for fd in &sockets {
+            guards.push(sut.add(fd));
+        }
+
+        for sender in senders {
+            assert_that!(sender.try_send(b"abc"), eq Ok(true));
+        }
+
+        let mut counter = 0;
+        let number_of_notifications = sut
+            .timed_wait(TIMEOUT, |_| {
+                counter += 1;
+            })
+            .unwrap();
+
+        assert_that!(counter, eq number_of_fds);
+        assert_that!(number_of_notifications, eq number_of_fds);
+    }
+
+    #[test]
+    fn io_uring_reports_readable_fd_until_data_is_consumed() {
+        test_requires!(is_io_uring_supported());
+        create_test_directory();
+        let (sut_receiver, sut_sender) = create_receiver_and_sender();
+
+        let sut = IoUringBuilder::new().create().unwrap();
+        let _guard = sut.add(&sut_receiver).unwrap();
+        sut_sender.blocking_send(b"abc").unwrap();
+
+        for _ in 0..3 {
+            assert_that!(sut.try_wait(|_| {}).unwrap(), eq 1);
+        }
+
+        let mut buffer = [0u8; 8];
+        sut_receiver.try_receive(&mut buffer).unwrap();
+
+        assert_that!(sut.try_wait(|_| {}).unwrap(), eq 0);
+    }
+
+    #[test]
+    fn io_uring_handles_more_attachments_than_submission_queue_entries() {
+        test_requires!(is_io_uring_supported());
+        let sut = IoUringBuilder::new().create().unwrap();
+        let mut sockets = vec![];
+        let mut senders = vec![];
+        let number_of_fds: usize = 300;
+
+        create_test_directory();
+        for _ in 0..number_of_fds {
+            let (receiver, sender) = create_receiver_and_sender();
+            sockets.push(receiver);
+            senders.push(sender);
+        }
+
+        let mut guards = vec![];
+        for fd in &sockets {
+            guards.push(sut.add(fd).unwrap());
+        }
+
+        for sender in senders {
+            assert_that!(sender.try_send(b"abc"), eq Ok(true));
+        }
+
+        let number_of_notifications = sut.timed_wait(TIMEOUT, |_| {}).unwrap();
+
+        assert_that!(number_of_notifications, eq number_of_fds);
+    }
+}
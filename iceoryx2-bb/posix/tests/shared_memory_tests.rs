@@ -12,6 +12,7 @@
 
 use iceoryx2_bb_container::semantic_string::*;
 use iceoryx2_bb_elementary::math::ToB64;
+use iceoryx2_bb_posix::memory_lock::MemoryLockCreationError;
 use iceoryx2_bb_posix::{shared_memory::*, unique_system_id::UniqueSystemId};
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_bb_testing::{assert_that, test_requires};
@@ -260,3 +261,118 @@ fn shared_memory_existing_shm_can_be_listed() {
         assert_that!(shm_list, contains * shm.name());
     }
 }
+
+#[test]
+fn shared_memory_with_huge_pages_is_created_or_reports_unavailability() {
+    let shm_name = generate_shm_name();
+    let sut = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(1024)
+        .page_size(PageSize::Huge2MiB)
+        .permission(Permission::OWNER_ALL)
+        .zero_memory(true)
+        .create();
+
+    match sut {
+        Ok(sut) => {
+            assert_that!(sut.page_size(), eq PageSize::Huge2MiB);
+            assert_that!(sut.size() % PageSize::Huge2MiB.huge_page_size().unwrap(), eq 0);
+            assert_that!(PageSize::Huge2MiB.mount_point(), is_some);
+            assert_that!(SharedMemory::does_exist_with_page_size(&shm_name, PageSize::Huge2MiB), eq true);
+            assert_that!(SharedMemory::list_with_page_size(PageSize::Huge2MiB), contains shm_name);
+
+            // regular shared memory operations do not consider the hugetlbfs
+            assert_that!(SharedMemory::does_exist(&shm_name), eq false);
+            assert_that!(
+                SharedMemory::list(),
+                not_contains_match | n | *n == shm_name
+            );
+            let sut_open = SharedMemoryBuilder::new(&shm_name).open_existing(AccessMode::Read);
+            assert_that!(sut_open.err().unwrap(), eq SharedMemoryCreationError::DoesNotExist);
+
+            let sut_open = SharedMemoryBuilder::new(&shm_name)
+                .page_size(PageSize::Huge2MiB)
+                .open_existing(AccessMode::Read)
+                .unwrap();
+            assert_that!(sut_open.page_size(), eq PageSize::Huge2MiB);
+            assert_that!(sut_open.size(), eq sut.size());
+        }
+        Err(e) => {
+            assert_that!(e, eq SharedMemoryCreationError::HugePagesUnavailable);
+            assert_that!(SharedMemory::does_exist_with_page_size(&shm_name, PageSize::Huge2MiB), eq false);
+        }
+    }
+}
+
+#[test]
+fn shared_memory_pre_faulting_preserves_content() {
+    let shm_name = generate_shm_name();
+    let mut sut = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(65536)
+        .permission(Permission::OWNER_ALL)
+        .zero_memory(true)
+        .create()
+        .unwrap();
+
+    for (n, byte) in sut.as_mut_slice().iter_mut().enumerate() {
+        *byte = (n % 255) as u8;
+    }
+
+    sut.pre_fault();
+
+    for (n, byte) in sut.as_slice().iter().enumerate() {
+        let expected_byte = (n % 255) as u8;
+        assert_that!(*byte, eq expected_byte);
+    }
+}
+
+#[test]
+fn shared_memory_pre_faulting_read_only_mapping_works() {
+    let shm_name = generate_shm_name();
+    let mut sut = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(65536)
+        .permission(Permission::OWNER_ALL)
+        .zero_memory(true)
+        .create()
+        .unwrap();
+
+    for (n, byte) in sut.as_mut_slice().iter_mut().enumerate() {
+        *byte = (n % 255) as u8;
+    }
+
+    let sut_read_only = SharedMemoryBuilder::new(&shm_name)
+        .open_existing(AccessMode::Read)
+        .unwrap();
+    sut_read_only.pre_fault();
+
+    for (n, byte) in sut_read_only.as_slice().iter().enumerate() {
+        let expected_byte = (n % 255) as u8;
+        assert_that!(*byte, eq expected_byte);
+    }
+}
+
+#[test]
+fn shared_memory_can_be_locked_in_memory_or_reports_memory_limit() {
+    let shm_name = generate_shm_name();
+    let sut = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(4096)
+        .permission(Permission::OWNER_ALL)
+        .zero_memory(true)
+        .create()
+        .unwrap();
+
+    // the lockable memory is restricted by RLIMIT_MEMLOCK
+    match sut.lock_in_memory() {
+        Ok(()) => assert_that!(sut.as_slice()[0], eq 0),
+        Err(e) => assert_that!(
+            [
+                MemoryLockCreationError::UnableToLock,
+                MemoryLockCreationError::InsufficientPermissions
+            ],
+            contains e
+        ),
+    }
+}
@@ -58,10 +58,13 @@ use core::{fmt::Debug, time::Duration};
 
 use iceoryx2_bb_elementary::enum_gen;
 use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+pub use iceoryx2_bb_posix::shared_memory::PageSize;
 use iceoryx2_bb_system_types::file_name::*;
 use tiny_fn::tiny_fn;
 
-use crate::static_storage::file::{NamedConcept, NamedConceptBuilder, NamedConceptMgmt};
+use crate::static_storage::file::{
+    NamedConcept, NamedConceptBuilder, NamedConceptMgmt, NamedConceptRemoveError,
+};
 
 tiny_fn! {
     pub(crate) struct Initializer<T> = FnMut(value: &mut T, allocator: &mut BumpAllocator) -> bool;
@@ -83,6 +86,7 @@ pub enum DynamicStorageCreateError {
     AlreadyExists,
     InsufficientPermissions,
     InitializationFailed,
+    HugePagesUnavailable,
     InternalError,
 }
 
@@ -95,6 +99,29 @@ pub enum DynamicStorageOpenError {
     InternalError,
 }
 
+/// Describes failures when applying a [`MemoryResidency`] to a [`DynamicStorage`]
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum MemoryResidencyError {
+    InsufficientPermissions,
+    InsufficientResources,
+    InternalError,
+}
+
+/// Defines when the pages of a [`DynamicStorage`] are mapped into the process space.
+#[derive(Debug, Default, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum MemoryResidency {
+    /// The pages are mapped on first access. The first access of every page causes a page
+    /// fault.
+    #[default]
+    OnDemand,
+    /// All pages are touched once when the construct is created or opened so that no page
+    /// fault occurs on the hot path.
+    PreFaulted,
+    /// All pages are mapped and locked into the physical memory so that they are never
+    /// swapped out. Is limited by the lockable memory limit of the process (`RLIMIT_MEMLOCK`).
+    Locked,
+}
+
 enum_gen! {
     DynamicStorageOpenOrCreateError
   mapping:
@@ -113,6 +140,13 @@ pub trait DynamicStorageBuilder<'builder, T: Send + Sync, D: DynamicStorage<T>>:
     /// the already initialized [`DynamicStorage`] with the full size is used.
     fn supplementary_size(self, value: usize) -> Self;
 
+    /// Defines the [`PageSize`] of the pages that back the [`DynamicStorage`]. It is applied
+    /// when the [`DynamicStorage`] is created or opened, a [`DynamicStorage`] that is backed
+    /// by huge pages can only be opened with the [`PageSize`] it was created with.
+    /// Implementations that are not backed by pages ignore the setting. The actually used
+    /// [`PageSize`] is returned by [`DynamicStorage::page_size()`].
+    fn page_size(self, value: PageSize) -> Self;
+
     /// The timeout defines how long the [`DynamicStorageBuilder`] should wait for
     /// [`DynamicStorageBuilder::create()`]
     /// to finialize the initialization. This is required when the [`DynamicStorage`] is
@@ -152,6 +186,22 @@ pub trait DynamicStorage<T: Send + Sync>:
     /// resource remain even when every [`DynamicStorage`] instance in every process was removed.
     fn does_support_persistency() -> bool;
 
+    /// Removes the [`DynamicStorage`] that is backed by pages of the provided [`PageSize`].
+    /// [`NamedConceptMgmt::remove_cfg()`] removes only [`DynamicStorage`]s that are backed by
+    /// pages of the default size. Implementations that are not backed by pages ignore the
+    /// [`PageSize`].
+    ///
+    /// # Safety
+    ///
+    ///  * see [`NamedConceptMgmt::remove_cfg()`]
+    unsafe fn remove_with_page_size_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+        _page_size: PageSize,
+    ) -> Result<bool, NamedConceptRemoveError> {
+        Self::remove_cfg(name, cfg)
+    }
+
     /// Returns true if the storage holds the ownership, otherwise false.
     fn has_ownership(&self) -> bool;
 
@@ -168,6 +218,13 @@ pub trait DynamicStorage<T: Send + Sync>:
     /// thread-safe.
     fn get(&self) -> &T;
 
+    /// Returns the [`PageSize`] of the pages that back the [`DynamicStorage`].
+    fn page_size(&self) -> PageSize;
+
+    /// Applies the [`MemoryResidency`] to the underlying memory of the [`DynamicStorage`].
+    /// Implementations that are not backed by pages ignore the setting.
+    fn apply_memory_residency(&self, value: MemoryResidency) -> Result<(), MemoryResidencyError>;
+
     /// The default suffix of every dynamic storage
     fn default_suffix() -> FileName {
         unsafe { FileName::new_unchecked(b".dyn") }
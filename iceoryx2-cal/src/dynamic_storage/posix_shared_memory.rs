@@ -53,6 +53,7 @@ use iceoryx2_bb_log::warn;
 use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
 use iceoryx2_bb_posix::directory::*;
 use iceoryx2_bb_posix::file_descriptor::FileDescriptorManagement;
+use iceoryx2_bb_posix::memory_lock::MemoryLockCreationError;
 use iceoryx2_bb_posix::shared_memory::*;
 use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
@@ -72,6 +73,7 @@ const FINAL_PERMISSIONS: Permission = Permission::ALL;
 pub struct Builder<'builder, T: Send + Sync + Debug> {
     storage_name: FileName,
     supplementary_size: usize,
+    page_size: PageSize,
     has_ownership: bool,
     config: Configuration<T>,
     timeout: Duration,
@@ -160,6 +162,7 @@ impl<T: Send + Sync + Debug> NamedConceptBuilder<Storage<T>> for Builder<'_, T>
             has_ownership: true,
             storage_name: *storage_name,
             supplementary_size: 0,
+            page_size: PageSize::Default,
             config: Configuration::default(),
             timeout: Duration::ZERO,
             initializer: Initializer::new(|_, _| true),
@@ -184,7 +187,10 @@ impl<T: Send + Sync + Debug> Builder<'_, T> {
 
         let mut elapsed_time = Duration::ZERO;
         let shm = loop {
-            match SharedMemoryBuilder::new(&full_name).open_existing(AccessMode::ReadWrite) {
+            match SharedMemoryBuilder::new(&full_name)
+                .page_size(self.page_size)
+                .open_existing(AccessMode::ReadWrite)
+            {
                 Ok(v) => break v,
                 Err(SharedMemoryCreationError::DoesNotExist) => {
                     fail!(from self, with DynamicStorageOpenError::DoesNotExist,
@@ -257,6 +263,7 @@ impl<T: Send + Sync + Debug> Builder<'_, T> {
             // posix shared memory is always aligned to the greatest possible value (PAGE_SIZE)
             // therefore we do not have to add additional alignment space for T
             .size(core::mem::size_of::<Data<T>>() + self.supplementary_size)
+            .page_size(self.page_size)
             .permission(INIT_PERMISSIONS)
             .zero_memory(false)
             .has_ownership(self.has_ownership)
@@ -271,6 +278,10 @@ impl<T: Send + Sync + Debug> Builder<'_, T> {
                 fail!(from self, with DynamicStorageCreateError::InsufficientPermissions,
                     "{} due to insufficient permissions.", msg);
             }
+            Err(SharedMemoryCreationError::HugePagesUnavailable) => {
+                fail!(from self, with DynamicStorageCreateError::HugePagesUnavailable,
+                    "{} since huge pages of the type {:?} are not available.", msg, self.page_size);
+            }
             Err(_) => {
                 fail!(from self, with DynamicStorageCreateError::InternalError,
                     "{} since the underlying shared memory could not be created.", msg);
@@ -363,6 +374,11 @@ impl<'builder, T: Send + Sync + Debug> DynamicStorageBuilder<'builder, T, Storag
         self
     }
 
+    fn page_size(mut self, value: PageSize) -> Self {
+        self.page_size = value;
+        self
+    }
+
     fn create(mut self, initial_value: T) -> Result<Storage<T>, DynamicStorageCreateError> {
         let shm = self.create_impl()?;
         self.init_impl(shm, initial_value)
@@ -452,11 +468,33 @@ impl<T: Send + Sync + Debug> NamedConceptMgmt for Storage<T> {
         name: &FileName,
         cfg: &Self::Configuration,
     ) -> Result<bool, crate::static_storage::file::NamedConceptRemoveError> {
+        Self::remove_with_page_size_cfg(name, cfg, PageSize::Default)
+    }
+
+    fn remove_path_hint(
+        _value: &Path,
+    ) -> Result<(), crate::named_concept::NamedConceptPathHintRemoveError> {
+        Ok(())
+    }
+}
+
+impl<T: Send + Sync + Debug> DynamicStorage<T> for Storage<T> {
+    type Builder<'builder> = Builder<'builder, T>;
+
+    unsafe fn remove_with_page_size_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+        page_size: PageSize,
+    ) -> Result<bool, NamedConceptRemoveError> {
         let full_name = cfg.path_for(name).file_name();
         let msg = "Unable to remove dynamic_storage::posix_shared_memory";
-        let origin = "dynamic_storage::posix_shared_memory::Storage::remove_cfg()";
+        let origin = "dynamic_storage::posix_shared_memory::Storage::remove_with_page_size_cfg()";
 
-        match Builder::<T>::new(name).config(cfg).open() {
+        match Builder::<T>::new(name)
+            .config(cfg)
+            .page_size(page_size)
+            .open()
+        {
             Ok(s) => {
                 s.acquire_ownership();
                 Ok(true)
@@ -467,7 +505,9 @@ impl<T: Send + Sync + Debug> NamedConceptMgmt for Storage<T> {
                     "Removing DynamicStorage in broken state ({:?}) will not call drop of the underlying data type {:?}.",
                     e, core::any::type_name::<T>());
 
-                match iceoryx2_bb_posix::shared_memory::SharedMemory::remove(&full_name) {
+                match iceoryx2_bb_posix::shared_memory::SharedMemory::remove_with_page_size(
+                    &full_name, page_size,
+                ) {
                     Ok(v) => Ok(v),
                     Err(
                         iceoryx2_bb_posix::shared_memory::SharedMemoryRemoveError::InsufficientPermissions,
@@ -484,16 +524,6 @@ impl<T: Send + Sync + Debug> NamedConceptMgmt for Storage<T> {
         }
     }
 
-    fn remove_path_hint(
-        _value: &Path,
-    ) -> Result<(), crate::named_concept::NamedConceptPathHintRemoveError> {
-        Ok(())
-    }
-}
-
-impl<T: Send + Sync + Debug> DynamicStorage<T> for Storage<T> {
-    type Builder<'builder> = Builder<'builder, T>;
-
     fn does_support_persistency() -> bool {
         SharedMemory::does_support_persistency()
     }
@@ -506,6 +536,36 @@ impl<T: Send + Sync + Debug> DynamicStorage<T> for Storage<T> {
         unsafe { &(*(self.shm.base_address().as_ptr() as *const Data<T>)).data }
     }
 
+    fn page_size(&self) -> PageSize {
+        self.shm.page_size()
+    }
+
+    fn apply_memory_residency(&self, value: MemoryResidency) -> Result<(), MemoryResidencyError> {
+        let msg = "Unable to apply the memory residency";
+        match value {
+            MemoryResidency::OnDemand => Ok(()),
+            MemoryResidency::PreFaulted => {
+                self.shm.pre_fault();
+                Ok(())
+            }
+            MemoryResidency::Locked => match self.shm.lock_in_memory() {
+                Ok(()) => Ok(()),
+                Err(MemoryLockCreationError::InsufficientPermissions) => {
+                    fail!(from self, with MemoryResidencyError::InsufficientPermissions,
+                        "{} {:?} due to insufficient permissions.", msg, value);
+                }
+                Err(MemoryLockCreationError::UnableToLock) => {
+                    fail!(from self, with MemoryResidencyError::InsufficientResources,
+                        "{} {:?} since the lockable memory limit is exceeded.", msg, value);
+                }
+                Err(e) => {
+                    fail!(from self, with MemoryResidencyError::InternalError,
+                        "{} {:?} due to an internal error ({:?}).", msg, value, e);
+                }
+            },
+        }
+    }
+
     fn has_ownership(&self) -> bool {
         self.shm.has_ownership()
     }
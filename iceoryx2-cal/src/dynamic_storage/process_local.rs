@@ -295,6 +295,14 @@ impl<T: Send + Sync + Debug + 'static> DynamicStorage<T> for Storage<T> {
         unsafe { &*self.data.data_ptr }
     }
 
+    fn page_size(&self) -> PageSize {
+        PageSize::Default
+    }
+
+    fn apply_memory_residency(&self, _value: MemoryResidency) -> Result<(), MemoryResidencyError> {
+        Ok(())
+    }
+
     fn has_ownership(&self) -> bool {
         self.has_ownership.load(Ordering::Relaxed)
     }
@@ -460,6 +468,10 @@ impl<'builder, T: Send + Sync + Debug + 'static> DynamicStorageBuilder<'builder,
         self
     }
 
+    fn page_size(self, _value: PageSize) -> Self {
+        self
+    }
+
     fn open(self) -> Result<Storage<T>, DynamicStorageOpenError> {
         let msg = "Failed to open dynamic storage";
         let mut guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
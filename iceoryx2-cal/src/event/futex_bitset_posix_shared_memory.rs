@@ -0,0 +1,742 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Event`](crate::event::Event) for inter-process communication that is based on the Linux
+//! futex. The [`TriggerId`]s are tracked in a bitset in shared memory and a [`Notifier`] calls
+//! `futex_wake` only when the [`Listener`] is currently waiting, otherwise a notification does
+//! not require any syscall.
+//!
+//! To be attachable to a [`WaitSet`](https://docs.rs/iceoryx2/latest/iceoryx2/waitset/index.html)
+//! the [`Listener`] owns a unix datagram socket, the file descriptor bridge. The
+//! [`Listener`] arms the bridge whenever it has collected all pending notifications and the
+//! first [`Notifier`] that finds the bridge armed disarms it and sends a single datagram so
+//! that the file descriptor becomes readable. All further notifications are only tracked in
+//! the bitset until the [`Listener`] collected them and re-armed the bridge. The bridge can
+//! be disabled with [`ListenerBuilder::file_descriptor_bridge()`].
+
+use core::{
+    fmt::Debug,
+    sync::atomic::{fence, Ordering},
+    time::Duration,
+};
+
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_elementary::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_lock_free::mpmc::bit_set::RelocatableBitSet;
+use iceoryx2_bb_log::{debug, fail, fatal_panic, warn};
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_posix::{
+    clock::Time,
+    creation_mode::CreationMode,
+    file::File,
+    file_descriptor::{FileDescriptor, FileDescriptorBased},
+    file_descriptor_set::SynchronousMultiplexing,
+    futex::{futex_wait, futex_wake, FutexWaitError},
+    unix_datagram_socket::{
+        UnixDatagramReceiver, UnixDatagramReceiverBuilder, UnixDatagramSendError,
+        UnixDatagramSender, UnixDatagramSenderBuilder, UnixDatagramSenderCreationError,
+    },
+};
+pub use iceoryx2_bb_system_types::{file_name::FileName, file_path::FilePath, path::Path};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU32, IoxAtomicUsize};
+
+use crate::{
+    dynamic_storage::{
+        posix_shared_memory::Storage, DynamicStorage, DynamicStorageBuilder,
+        DynamicStorageCreateError, DynamicStorageOpenError,
+    },
+    event::{id_tracker::IdTracker, *},
+    named_concept::{NamedConceptConfiguration, NamedConceptMgmt},
+};
+
+const TRIGGER_ID_DEFAULT_MAX: TriggerId = TriggerId::new(u16::MAX as _);
+const BRIDGE_SUFFIX: &[u8] = b".bridge";
+const MAX_NUMBER_OF_WOKEN_UP_WAITERS: u32 = i32::MAX as u32;
+
+#[derive(Debug)]
+#[repr(C)]
+pub struct Management {
+    id_tracker: RelocatableBitSet,
+    wakeup_counter: IoxAtomicU32,
+    number_of_waiters: IoxAtomicU32,
+    is_bridge_armed: IoxAtomicBool,
+    has_bridge: bool,
+    reference_counter: IoxAtomicUsize,
+    has_listener: IoxAtomicBool,
+}
+
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub struct Configuration {
+    suffix: FileName,
+    prefix: FileName,
+    path: Path,
+}
+
+impl Default for Configuration {
+    fn default() -> Self {
+        Self {
+            path: EventImpl::default_path_hint(),
+            suffix: EventImpl::default_suffix(),
+            prefix: EventImpl::default_prefix(),
+        }
+    }
+}
+
+impl Configuration {
+    fn convert(&self) -> <Storage<Management> as NamedConceptMgmt>::Configuration {
+        <Storage<Management> as NamedConceptMgmt>::Configuration::default()
+            .prefix(&self.prefix)
+            .suffix(&self.suffix)
+            .path_hint(&self.path)
+    }
+
+    fn bridge_path_for(&self, name: &FileName) -> FilePath {
+        let mut path = self.path_for(name);
+        fatal_panic!(from self, when path.push_bytes(BRIDGE_SUFFIX),
+            "The path \"{}\" in combination with the bridge suffix exceeds the maximum supported path length of the operating system.",
+            path);
+        path
+    }
+}
+
+impl NamedConceptConfiguration for Configuration {
+    fn prefix(mut self, value: &FileName) -> Self {
+        self.prefix = *value;
+        self
+    }
+
+    fn get_prefix(&self) -> &FileName {
+        &self.prefix
+    }
+
+    fn suffix(mut self, value: &FileName) -> Self {
+        self.suffix = *value;
+        self
+    }
+
+    fn path_hint(mut self, value: &Path) -> Self {
+        self.path = *value;
+        self
+    }
+
+    fn get_suffix(&self) -> &FileName {
+        &self.suffix
+    }
+
+    fn get_path_hint(&self) -> &Path {
+        &self.path
+    }
+}
+
+#[derive(Debug)]
+pub struct EventImpl {}
+
+impl NamedConceptMgmt for EventImpl {
+    type Configuration = Configuration;
+
+    fn does_exist_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+    ) -> Result<bool, crate::static_storage::file::NamedConceptDoesExistError> {
+        Ok(fail!(from "Event::does_exist_cfg()",
+                when Storage::<Management>::does_exist_cfg(name, &cfg.convert()),
+                "Failed to check if Event \"{}\" exists.",
+                name))
+    }
+
+    fn list_cfg(
+        cfg: &Self::Configuration,
+    ) -> Result<Vec<FileName>, crate::static_storage::file::NamedConceptListError> {
+        Ok(fail!(from "Event::list_cfg()",
+                when Storage::<Management>::list_cfg(&cfg.convert()),
+                "Failed to list all Events."))
+    }
+
+    unsafe fn remove_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+    ) -> Result<bool, crate::static_storage::file::NamedConceptRemoveError> {
+        let has_removed_event = fail!(from "Event::remove_cfg()",
+                when Storage::<Management>::remove_cfg(name, &cfg.convert()),
+                "Failed to remove Event \"{}\".", name);
+
+        if let Err(e) = File::remove(&cfg.bridge_path_for(name)) {
+            warn!(from "Event::remove_cfg()",
+                "Unable to remove the file descriptor bridge of Event \"{}\" ({:?}).", name, e);
+        }
+
+        Ok(has_removed_event)
+    }
+
+    fn remove_path_hint(
+        value: &Path,
+    ) -> Result<(), crate::named_concept::NamedConceptPathHintRemoveError> {
+        crate::named_concept::remove_path_hint(value)
+    }
+}
+
+impl crate::event::Event for EventImpl {
+    type Notifier = Notifier;
+    type NotifierBuilder = NotifierBuilder;
+    type Listener = Listener;
+    type ListenerBuilder = ListenerBuilder;
+
+    fn has_trigger_id_limit() -> bool {
+        true
+    }
+
+    fn default_trigger_id_max() -> Option<TriggerId> {
+        Some(TRIGGER_ID_DEFAULT_MAX)
+    }
+}
+
+#[derive(Debug)]
+pub struct Notifier {
+    storage: Storage<Management>,
+    bridge: Option<UnixDatagramSender>,
+}
+
+impl Drop for Notifier {
+    fn drop(&mut self) {
+        if self
+            .storage
+            .get()
+            .reference_counter
+            .fetch_sub(1, Ordering::Relaxed)
+            == 1
+        {
+            self.storage.acquire_ownership();
+        }
+    }
+}
+
+impl NamedConcept for Notifier {
+    fn name(&self) -> &FileName {
+        self.storage.name()
+    }
+}
+
+impl Notifier {
+    fn notify_bridge(&self, bridge: &UnixDatagramSender) -> Result<(), NotifierNotifyError> {
+        let msg = "Failed to notify the file descriptor bridge of the listener";
+        match bridge.try_send(&[0u8]) {
+            // when the socket buffer is full the file descriptor is already readable
+            Ok(_) => Ok(()),
+            Err(
+                UnixDatagramSendError::ConnectionReset | UnixDatagramSendError::ConnectionRefused,
+            ) => {
+                fail!(from self, with NotifierNotifyError::Disconnected,
+                    "{} since the listener is no longer connected.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with NotifierNotifyError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        }
+    }
+}
+
+impl crate::event::Notifier for Notifier {
+    fn trigger_id_max(&self) -> TriggerId {
+        self.storage.get().id_tracker.trigger_id_max()
+    }
+
+    fn notify(&self, id: TriggerId) -> Result<(), NotifierNotifyError> {
+        let msg = "Failed to notify listener";
+        let mgmt = self.storage.get();
+        if !mgmt.has_listener.load(Ordering::Relaxed) {
+            fail!(from self, with NotifierNotifyError::Disconnected,
+                "{} since the listener is no longer connected.", msg);
+        }
+
+        if mgmt.id_tracker.trigger_id_max() < id {
+            fail!(from self, with NotifierNotifyError::TriggerIdOutOfBounds,
+                "{} since the TriggerId {:?} is greater than the max supported TriggerId {:?}.",
+                msg, id, mgmt.id_tracker.trigger_id_max());
+        }
+
+        // when the bit was already set, the notifier that set it has already woken up the
+        // listener and it was not yet collected
+        if !mgmt.id_tracker.set(id.as_value()) {
+            return Ok(());
+        }
+
+        // pairs with the listener which announces itself as waiter or arms the bridge
+        // before it checks the id tracker for the last time
+        fence(Ordering::SeqCst);
+        mgmt.wakeup_counter.fetch_add(1, Ordering::SeqCst);
+        if mgmt.number_of_waiters.load(Ordering::SeqCst) != 0 {
+            if let Err(e) = futex_wake(&mgmt.wakeup_counter, MAX_NUMBER_OF_WOKEN_UP_WAITERS) {
+                fail!(from self, with NotifierNotifyError::InternalFailure,
+                    "{} since the waiting listener could not be woken up ({:?}).", msg, e);
+            }
+        }
+
+        if let Some(bridge) = &self.bridge {
+            if mgmt.is_bridge_armed.load(Ordering::SeqCst)
+                && mgmt.is_bridge_armed.swap(false, Ordering::SeqCst)
+            {
+                self.notify_bridge(bridge)?;
+            }
+        }
+
+        Ok(())
+    }
+}
+
+#[derive(Debug)]
+pub struct NotifierBuilder {
+    name: FileName,
+    config: Configuration,
+    creation_timeout: Duration,
+}
+
+impl NamedConceptBuilder<EventImpl> for NotifierBuilder {
+    fn new(name: &FileName) -> Self {
+        Self {
+            name: *name,
+            config: Configuration::default(),
+            creation_timeout: Duration::ZERO,
+        }
+    }
+
+    fn config(mut self, config: &Configuration) -> Self {
+        self.config = *config;
+        self
+    }
+}
+
+impl NotifierBuilder {
+    fn open_bridge(&self) -> Result<UnixDatagramSender, NotifierCreateError> {
+        let msg = "Failed to open the file descriptor bridge of the Notifier";
+        match UnixDatagramSenderBuilder::new(&self.config.bridge_path_for(&self.name)).create() {
+            Ok(sender) => Ok(sender),
+            Err(UnixDatagramSenderCreationError::DoesNotExist) => {
+                fail!(from self, with NotifierCreateError::DoesNotExist,
+                    "{} since the corresponding listener does not exist.", msg);
+            }
+            Err(UnixDatagramSenderCreationError::InsufficientPermissions) => {
+                fail!(from self, with NotifierCreateError::InsufficientPermissions,
+                    "{} due to insufficient permissions.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with NotifierCreateError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        }
+    }
+}
+
+impl crate::event::NotifierBuilder<EventImpl> for NotifierBuilder {
+    fn timeout(mut self, timeout: Duration) -> Self {
+        self.creation_timeout = timeout;
+        self
+    }
+
+    fn open(self) -> Result<Notifier, NotifierCreateError> {
+        let msg = "Failed to open Notifier";
+
+        match <Storage<Management> as DynamicStorage<Management>>::Builder::new(&self.name)
+            .config(&self.config.convert())
+            .timeout(self.creation_timeout)
+            .open()
+        {
+            Ok(storage) => {
+                let mut ref_count = storage.get().reference_counter.load(Ordering::Relaxed);
+
+                loop {
+                    if !storage.get().has_listener.load(Ordering::Relaxed) || ref_count == 0 {
+                        fail!(from self, with NotifierCreateError::DoesNotExist,
+                            "{} since it has no listener and will no longer exist.", msg);
+                    }
+
+                    match storage.get().reference_counter.compare_exchange(
+                        ref_count,
+                        ref_count + 1,
+                        Ordering::Relaxed,
+                        Ordering::Relaxed,
+                    ) {
+                        Ok(_) => break,
+                        Err(v) => ref_count = v,
+                    };
+                }
+
+                // from here on the notifier owns a reference and must be dropped to release it
+                let mut notifier = Notifier {
+                    storage,
+                    bridge: None,
+                };
+
+                if notifier.storage.get().has_bridge {
+                    notifier.bridge = Some(self.open_bridge()?);
+                }
+
+                Ok(notifier)
+            }
+            Err(DynamicStorageOpenError::DoesNotExist) => {
+                fail!(from self, with NotifierCreateError::DoesNotExist,
+                    "{} since it does not exist.", msg);
+            }
+            Err(DynamicStorageOpenError::VersionMismatch) => {
+                fail!(from self, with NotifierCreateError::VersionMismatch,
+                    "{} since the version of the existing construct does not match.", msg);
+            }
+            Err(DynamicStorageOpenError::InitializationNotYetFinalized) => {
+                fail!(from self, with NotifierCreateError::InitializationNotYetFinalized,
+                    "{} since the initialization is after a timeout of {:?} still not finalized.",
+                    msg, self.creation_timeout);
+            }
+            Err(e) => {
+                fail!(from self, with NotifierCreateError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        }
+    }
+}
+
+#[derive(Debug)]
+struct Bridge {
+    receiver: UnixDatagramReceiver,
+    // used to make the file descriptor readable when the listener itself detects that it
+    // armed the bridge while notifications are still pending
+    sender: UnixDatagramSender,
+}
+
+#[derive(Debug)]
+pub struct Listener {
+    storage: Storage<Management>,
+    bridge: Option<Bridge>,
+}
+
+impl Drop for Listener {
+    fn drop(&mut self) {
+        self.storage
+            .get()
+            .has_listener
+            .store(false, Ordering::Relaxed);
+
+        if self
+            .storage
+            .get()
+            .reference_counter
+            .fetch_sub(1, Ordering::Relaxed)
+            == 1
+        {
+            self.storage.acquire_ownership();
+        }
+    }
+}
+
+impl NamedConcept for Listener {
+    fn name(&self) -> &FileName {
+        self.storage.name()
+    }
+}
+
+impl FileDescriptorBased for Listener {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        match &self.bridge {
+            Some(bridge) => bridge.receiver.file_descriptor(),
+            None => {
+                fatal_panic!(from self,
+                    "This should never happen! The file descriptor of a listener that was created without a file descriptor bridge was requested.")
+            }
+        }
+    }
+}
+
+impl SynchronousMultiplexing for Listener {}
+
+impl Listener {
+    /// Empties the bridge and arms it so that the next notification makes the file descriptor
+    /// readable again. Must be called before the id tracker is checked for the last time,
+    /// otherwise a notification that arrives in between is not signaled via the bridge.
+    fn arm_bridge(&self, bridge: &Bridge) -> Result<(), ListenerWaitError> {
+        let mgmt = self.storage.get();
+
+        // the bridge is emptied even when it is still armed, a notifier disarms it before it
+        // sends the datagram and the listener may have re-armed it in between. Such a late
+        // datagram belongs to a notification that was already collected and would otherwise
+        // keep the file descriptor readable while the bridge is armed.
+        let mut buffer = [0u8; 64];
+        loop {
+            match bridge.receiver.try_receive(&mut buffer) {
+                Ok(0) => break,
+                Ok(_) => (),
+                Err(e) => {
+                    fail!(from self, with ListenerWaitError::InternalFailure,
+                        "Failed to empty the file descriptor bridge due to an internal failure ({:?}).", e);
+                }
+            }
+        }
+
+        if mgmt.is_bridge_armed.load(Ordering::SeqCst) {
+            return Ok(());
+        }
+
+        mgmt.is_bridge_armed.store(true, Ordering::SeqCst);
+        fence(Ordering::SeqCst);
+        Ok(())
+    }
+
+    fn wait<R, W: FnMut(&Self) -> Result<Option<R>, ListenerWaitError>>(
+        &self,
+        mut try_wait_call: W,
+        timeout: Option<Duration>,
+    ) -> Result<Option<R>, ListenerWaitError> {
+        let msg = "Failed to wait for notifications";
+        let mgmt = self.storage.get();
+        let start = match timeout {
+            Some(_) => Some(fail!(from self, when Time::now(),
+                            with ListenerWaitError::InternalFailure,
+                            "{} since the current time could not be acquired.", msg)),
+            None => None,
+        };
+
+        loop {
+            // the notifier wakes us only up when it sees a waiter, therefore we announce
+            // ourselves before the id tracker is checked for the last time
+            mgmt.number_of_waiters.fetch_add(1, Ordering::SeqCst);
+            let wakeup_counter = mgmt.wakeup_counter.load(Ordering::SeqCst);
+
+            match try_wait_call(self) {
+                Ok(None) => (),
+                v => {
+                    mgmt.number_of_waiters.fetch_sub(1, Ordering::SeqCst);
+                    return v;
+                }
+            }
+
+            let remaining_time = match (timeout, &start) {
+                (Some(timeout), Some(start)) => {
+                    let elapsed = start.elapsed().unwrap_or(timeout);
+                    if elapsed >= timeout {
+                        mgmt.number_of_waiters.fetch_sub(1, Ordering::SeqCst);
+                        return Ok(None);
+                    }
+                    Some(timeout - elapsed)
+                }
+                _ => None,
+            };
+
+            let wait_result = futex_wait(&mgmt.wakeup_counter, wakeup_counter, remaining_time);
+            mgmt.number_of_waiters.fetch_sub(1, Ordering::SeqCst);
+
+            match wait_result {
+                Ok(()) => (),
+                Err(FutexWaitError::Interrupt) => {
+                    fail!(from self, with ListenerWaitError::InterruptSignal,
+                        "{} since an interrupt signal was received.", msg);
+                }
+                Err(e) => {
+                    fail!(from self, with ListenerWaitError::InternalFailure,
+                        "{} due to an internal failure ({:?}).", msg, e);
+                }
+            }
+        }
+    }
+
+    fn wait_all<F: FnMut(TriggerId)>(
+        &self,
+        mut callback: F,
+        timeout: Option<Duration>,
+    ) -> Result<(), ListenerWaitError> {
+        self.wait(
+            |this| {
+                let mut has_received_notification = false;
+                this.try_wait_all(|id| {
+                    has_received_notification = true;
+                    callback(id)
+                })?;
+                Ok(has_received_notification.then_some(()))
+            },
+            timeout,
+        )?;
+
+        Ok(())
+    }
+}
+
+impl crate::event::Listener for Listener {
+    fn try_wait_one(&self) -> Result<Option<TriggerId>, ListenerWaitError> {
+        let mgmt = self.storage.get();
+        if let Some(id) = unsafe { mgmt.id_tracker.acquire() } {
+            return Ok(Some(id));
+        }
+
+        let bridge = match &self.bridge {
+            Some(bridge) => bridge,
+            None => return Ok(None),
+        };
+
+        self.arm_bridge(bridge)?;
+        let id = unsafe { mgmt.id_tracker.acquire() };
+
+        // a notification arrived before the bridge was armed, further pending notifications
+        // would not make the file descriptor readable anymore
+        if id.is_some() && mgmt.is_bridge_armed.swap(false, Ordering::SeqCst) {
+            if let Err(e) = bridge.sender.try_send(&[0u8]) {
+                fail!(from self, with ListenerWaitError::InternalFailure,
+                    "Failed to notify the own file descriptor bridge due to an internal failure ({:?}).", e);
+            }
+        }
+
+        Ok(id)
+    }
+
+    fn timed_wait_one(&self, timeout: Duration) -> Result<Option<TriggerId>, ListenerWaitError> {
+        self.wait(|this| this.try_wait_one(), Some(timeout))
+    }
+
+    fn blocking_wait_one(&self) -> Result<Option<TriggerId>, ListenerWaitError> {
+        self.wait(|this| this.try_wait_one(), None)
+    }
+
+    fn try_wait_all<F: FnMut(TriggerId)>(&self, callback: F) -> Result<(), ListenerWaitError> {
+        if let Some(bridge) = &self.bridge {
+            self.arm_bridge(bridge)?;
+        }
+
+        unsafe { self.storage.get().id_tracker.acquire_all(callback) };
+        Ok(())
+    }
+
+    fn timed_wait_all<F: FnMut(TriggerId)>(
+        &self,
+        callback: F,
+        timeout: Duration,
+    ) -> Result<(), ListenerWaitError> {
+        self.wait_all(callback, Some(timeout))
+    }
+
+    fn blocking_wait_all<F: FnMut(TriggerId)>(&self, callback: F) -> Result<(), ListenerWaitError> {
+        self.wait_all(callback, None)
+    }
+}
+
+#[derive(Debug)]
+pub struct ListenerBuilder {
+    name: FileName,
+    config: Configuration,
+    trigger_id_max: TriggerId,
+    has_bridge: bool,
+}
+
+impl NamedConceptBuilder<EventImpl> for ListenerBuilder {
+    fn new(name: &FileName) -> Self {
+        Self {
+            name: *name,
+            config: Configuration::default(),
+            trigger_id_max: TRIGGER_ID_DEFAULT_MAX,
+            has_bridge: true,
+        }
+    }
+
+    fn config(mut self, config: &Configuration) -> Self {
+        self.config = *config;
+        self
+    }
+}
+
+impl ListenerBuilder {
+    /// Defines if the [`Listener`] owns a file descriptor bridge. Without the bridge the
+    /// [`Listener`] cannot be attached to a
+    /// [`Reactor`](crate::reactor::Reactor) and accessing its [`FileDescriptor`] panics.
+    /// By default, the bridge is enabled.
+    pub fn file_descriptor_bridge(mut self, value: bool) -> Self {
+        self.has_bridge = value;
+        self
+    }
+
+    fn create_bridge(&self) -> Option<Bridge> {
+        let origin = "create_bridge()";
+        let bridge_path = self.config.bridge_path_for(&self.name);
+        // the exclusive creation of the shared memory guarantees that a stale socket with the
+        // same name belongs to a dead listener
+        let receiver = match UnixDatagramReceiverBuilder::new(&bridge_path)
+            .creation_mode(CreationMode::PurgeAndCreate)
+            .create()
+        {
+            Ok(receiver) => receiver,
+            Err(e) => {
+                debug!(from origin, "Unable to create the receiver of the file descriptor bridge ({:?}).", e);
+                return None;
+            }
+        };
+
+        match UnixDatagramSenderBuilder::new(&bridge_path).create() {
+            Ok(sender) => Some(Bridge { receiver, sender }),
+            Err(e) => {
+                debug!(from origin, "Unable to create the sender of the file descriptor bridge ({:?}).", e);
+                None
+            }
+        }
+    }
+}
+
+impl crate::event::ListenerBuilder<EventImpl> for ListenerBuilder {
+    fn trigger_id_max(mut self, id: TriggerId) -> Self {
+        self.trigger_id_max = id;
+        self
+    }
+
+    fn create(self) -> Result<Listener, ListenerCreateError> {
+        let msg = "Failed to create Listener";
+        let id_tracker_capacity = self.trigger_id_max.as_value() + 1;
+        let mut bridge = None;
+
+        // the bridge is created in the initializer so that no notifier can open the event
+        // before the bridge exists
+        let storage = <Storage<Management> as DynamicStorage<Management>>::Builder::new(&self.name)
+            .config(&self.config.convert())
+            .supplementary_size(RelocatableBitSet::memory_size(id_tracker_capacity))
+            .initializer(|mgmt: &mut Management, allocator: &mut BumpAllocator| {
+                if unsafe { mgmt.id_tracker.init(allocator).is_err() } {
+                    debug!(from "init()", "Unable to initialize IdTracker.");
+                    return false;
+                }
+
+                if mgmt.has_bridge {
+                    bridge = self.create_bridge();
+                    return bridge.is_some();
+                }
+
+                true
+            })
+            .has_ownership(false)
+            .create(Management {
+                id_tracker: unsafe { RelocatableBitSet::new_uninit(id_tracker_capacity) },
+                wakeup_counter: IoxAtomicU32::new(0),
+                number_of_waiters: IoxAtomicU32::new(0),
+                is_bridge_armed: IoxAtomicBool::new(true),
+                has_bridge: self.has_bridge,
+                reference_counter: IoxAtomicUsize::new(1),
+                has_listener: IoxAtomicBool::new(true),
+            });
+
+        match storage {
+            Ok(storage) => Ok(Listener { storage, bridge }),
+            Err(DynamicStorageCreateError::AlreadyExists) => {
+                fail!(from self, with ListenerCreateError::AlreadyExists,
+                    "{} since it already exists.", msg);
+            }
+            Err(DynamicStorageCreateError::InsufficientPermissions) => {
+                fail!(from self, with ListenerCreateError::InsufficientPermissions,
+                    "{} due to insufficient permissions.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with ListenerCreateError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        }
+    }
+}
@@ -11,6 +11,8 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 pub mod common;
+#[cfg(target_os = "linux")]
+pub mod futex_bitset_posix_shared_memory;
 pub mod id_tracker;
 pub mod process_local_socketpair;
 pub mod sem_bitset_posix_shared_memory;
@@ -147,4 +149,11 @@ pub trait Event: Sized + NamedConceptMgmt + Debug {
     fn has_trigger_id_limit() -> bool {
         false
     }
+
+    /// The greatest [`TriggerId`] that shall be used when none is explicitly requested.
+    /// Events that allocate resources for every [`TriggerId`] up to
+    /// [`ListenerBuilder::trigger_id_max()`] return a bounded value.
+    fn default_trigger_id_max() -> Option<TriggerId> {
+        None
+    }
 }
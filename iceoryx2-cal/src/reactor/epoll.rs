@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Reactor`](crate::reactor::Reactor) based on the Linux epoll facility. In contrast to
+//! [`posix_select`](crate::reactor::posix_select) the number of attachments is not limited
+//! by `FD_SETSIZE` and a wakeup only costs time proportional to the number of triggered
+//! attachments.
+
+use core::{fmt::Debug, time::Duration};
+
+use iceoryx2_bb_log::fail;
+use iceoryx2_bb_posix::{
+    clock::{nanosleep, NanosleepError},
+    epoll::{
+        Epoll, EpollAddError, EpollBuilder, EpollCreateError, EpollGuard, EpollModifyError,
+        EpollWaitError,
+    },
+    file_descriptor::FileDescriptor,
+};
+
+use crate::reactor::{
+    ReactorAttachError, ReactorCreateError, ReactorModifyError, ReactorWaitError,
+};
+
+impl crate::reactor::ReactorGuard<'_, '_> for EpollGuard<'_, '_> {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        self.file_descriptor()
+    }
+}
+
+#[derive(Debug)]
+pub struct Reactor {
+    epoll: Epoll,
+}
+
+impl Reactor {
+    fn wait<F: FnMut(&FileDescriptor), W: FnMut(F) -> Result<usize, EpollWaitError>>(
+        &self,
+        fn_call: F,
+        mut wait_call: W,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        let msg = "Unable to wait on Reactor";
+        if self.epoll.is_empty() {
+            match nanosleep(timeout) {
+                Ok(()) => Ok(0),
+                Err(NanosleepError::InterruptedBySignal(_)) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred while waiting ({:?}).",
+                        msg, v);
+                }
+            }
+        } else {
+            match wait_call(fn_call) {
+                Ok(number_of_notifications) => Ok(number_of_notifications),
+                Err(EpollWaitError::Interrupt) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred in the underlying epoll ({:?}).",
+                        msg, v);
+                }
+            }
+        }
+    }
+}
+
+impl crate::reactor::Reactor for Reactor {
+    type Guard<'reactor, 'attachment> = EpollGuard<'reactor, 'attachment>;
+    type Builder = ReactorBuilder;
+
+    fn capacity(&self) -> usize {
+        // the only limits are the number of file descriptors of the process and the
+        // epoll watches of the user which are both reported as error when attaching
+        usize::MAX
+    }
+
+    fn len(&self) -> usize {
+        self.epoll.len()
+    }
+
+    fn is_empty(&self) -> bool {
+        self.epoll.is_empty()
+    }
+
+    fn attach<
+        'reactor,
+        'attachment,
+        F: iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing + Debug,
+    >(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        let msg = format!("Unable to attach {:?} to the reactor", value);
+        match self.epoll.add(value) {
+            Ok(guard) => Ok(guard),
+            Err(EpollAddError::AlreadyAttached) => {
+                fail!(from self, with ReactorAttachError::AlreadyAttached,
+                    "{msg} since it is already attached.");
+            }
+            Err(EpollAddError::WatchLimitReached) => {
+                fail!(from self, with ReactorAttachError::CapacityExceeded,
+                    "{msg} since the maximum number of epoll watches of the user was reached.");
+            }
+            Err(EpollAddError::InsufficientMemory) => {
+                fail!(from self, with ReactorAttachError::UnknownError(0),
+                    "{msg} due to insufficient memory.");
+            }
+            Err(EpollAddError::UnknownError(e)) => {
+                fail!(from self, with ReactorAttachError::UnknownError(e),
+                    "{msg} since an unknown failure occurred in the underlying epoll ({e}).");
+            }
+        }
+    }
+
+    fn suspend(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        match self.epoll.suspend(fd) {
+            Ok(()) => Ok(()),
+            Err(EpollModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to suspend {:?} since it is not attached.", fd);
+            }
+            Err(e) => {
+                fail!(from self, with ReactorModifyError::UnknownError(0),
+                    "Unable to suspend {:?} since an unknown failure occurred in the underlying epoll ({:?}).", fd, e);
+            }
+        }
+    }
+
+    fn resume(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        match self.epoll.resume(fd) {
+            Ok(()) => Ok(()),
+            Err(EpollModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to resume {:?} since it is not attached.", fd);
+            }
+            Err(e) => {
+                fail!(from self, with ReactorModifyError::UnknownError(0),
+                    "Unable to resume {:?} since the underlying epoll failed to monitor it again ({:?}).", fd, e);
+            }
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        self.wait(
+            fn_call,
+            |f: F| self.epoll.timed_wait(Duration::ZERO, f),
+            Duration::ZERO,
+        )
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        self.wait(fn_call, |f: F| self.epoll.timed_wait(timeout, f), timeout)
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        self.wait(fn_call, |f: F| self.epoll.blocking_wait(f), Duration::MAX)
+    }
+}
+
+pub struct ReactorBuilder {}
+
+impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
+    fn new() -> Self {
+        Self {}
+    }
+
+    fn create(self) -> Result<Reactor, ReactorCreateError> {
+        match EpollBuilder::new().create() {
+            Ok(epoll) => Ok(Reactor { epoll }),
+            Err(EpollCreateError::UnknownError(e)) => {
+                fail!(from "epoll::ReactorBuilder::create()", with ReactorCreateError::UnknownError(e),
+                    "Unable to create reactor since an unknown failure occurred in the underlying epoll ({e}).");
+            }
+            Err(e) => {
+                fail!(from "epoll::ReactorBuilder::create()", with ReactorCreateError::UnknownError(0),
+                    "Unable to create reactor since the underlying epoll could not be created ({:?}).", e);
+            }
+        }
+    }
+}
@@ -0,0 +1,274 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Reactor`](crate::reactor::Reactor) based on the Linux io_uring facility. The poll
+//! requests of triggered attachments are re-armed by the same system call that waits for
+//! the next notifications and all notifications that are available are harvested in one
+//! batch.
+//!
+//! When io_uring is not available, since the kernel is too old or io_uring was disabled by
+//! the administrator, the [`Reactor`] falls back to the [`epoll`](crate::reactor::epoll)
+//! reactor.
+
+use core::{fmt::Debug, time::Duration};
+
+use iceoryx2_bb_log::{debug, fail};
+use iceoryx2_bb_posix::{
+    clock::{nanosleep, NanosleepError},
+    epoll::EpollGuard,
+    file_descriptor::FileDescriptor,
+    io_uring::{
+        IoUring, IoUringAddError, IoUringBuilder, IoUringCreateError, IoUringGuard,
+        IoUringModifyError, IoUringWaitError,
+    },
+};
+
+use crate::reactor::{
+    epoll, Reactor as _, ReactorAttachError, ReactorBuilder as _, ReactorCreateError,
+    ReactorModifyError, ReactorWaitError,
+};
+
+pub enum Guard<'reactor, 'attachment> {
+    IoUring(IoUringGuard<'reactor, 'attachment>),
+    Epoll(EpollGuard<'reactor, 'attachment>),
+}
+
+impl crate::reactor::ReactorGuard<'_, '_> for Guard<'_, '_> {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        match self {
+            Guard::IoUring(guard) => guard.file_descriptor(),
+            Guard::Epoll(guard) => guard.file_descriptor(),
+        }
+    }
+}
+
+#[derive(Debug)]
+enum Backend {
+    IoUring(IoUring),
+    Epoll(epoll::Reactor),
+}
+
+#[derive(Debug)]
+pub struct Reactor {
+    backend: Backend,
+}
+
+impl Reactor {
+    /// Returns true when io_uring is used, false when the reactor fell back to epoll.
+    pub fn uses_io_uring(&self) -> bool {
+        matches!(self.backend, Backend::IoUring(_))
+    }
+
+    fn wait<F: FnMut(&FileDescriptor), W: FnMut(&IoUring, F) -> Result<usize, IoUringWaitError>>(
+        &self,
+        io_uring: &IoUring,
+        fn_call: F,
+        mut wait_call: W,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        let msg = "Unable to wait on Reactor";
+        if io_uring.is_empty() {
+            match nanosleep(timeout) {
+                Ok(()) => Ok(0),
+                Err(NanosleepError::InterruptedBySignal(_)) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred while waiting ({:?}).",
+                        msg, v);
+                }
+            }
+        } else {
+            match wait_call(io_uring, fn_call) {
+                Ok(number_of_notifications) => Ok(number_of_notifications),
+                Err(IoUringWaitError::Interrupt) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred in the underlying io_uring ({:?}).",
+                        msg, v);
+                }
+            }
+        }
+    }
+}
+
+impl crate::reactor::Reactor for Reactor {
+    type Guard<'reactor, 'attachment> = Guard<'reactor, 'attachment>;
+    type Builder = ReactorBuilder;
+
+    fn capacity(&self) -> usize {
+        // the only limit is the number of file descriptors of the process which is reported
+        // as error when attaching
+        usize::MAX
+    }
+
+    fn len(&self) -> usize {
+        match &self.backend {
+            Backend::IoUring(io_uring) => io_uring.len(),
+            Backend::Epoll(reactor) => reactor.len(),
+        }
+    }
+
+    fn is_empty(&self) -> bool {
+        match &self.backend {
+            Backend::IoUring(io_uring) => io_uring.is_empty(),
+            Backend::Epoll(reactor) => reactor.is_empty(),
+        }
+    }
+
+    fn attach<
+        'reactor,
+        'attachment,
+        F: iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing + Debug,
+    >(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        let io_uring = match &self.backend {
+            Backend::IoUring(io_uring) => io_uring,
+            Backend::Epoll(reactor) => return reactor.attach(value).map(Guard::Epoll),
+        };
+
+        let msg = format!("Unable to attach {:?} to the reactor", value);
+        match io_uring.add(value) {
+            Ok(guard) => Ok(Guard::IoUring(guard)),
+            Err(IoUringAddError::AlreadyAttached) => {
+                fail!(from self, with ReactorAttachError::AlreadyAttached,
+                    "{msg} since it is already attached.");
+            }
+            Err(IoUringAddError::UnknownError(e)) => {
+                fail!(from self, with ReactorAttachError::UnknownError(e),
+                    "{msg} since an unknown failure occurred in the underlying io_uring ({e}).");
+            }
+        }
+    }
+
+    fn suspend(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        let io_uring = match &self.backend {
+            Backend::IoUring(io_uring) => io_uring,
+            Backend::Epoll(reactor) => return reactor.suspend(fd),
+        };
+
+        match io_uring.suspend(fd) {
+            Ok(()) => Ok(()),
+            Err(IoUringModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to suspend {:?} since it is not attached.", fd);
+            }
+            Err(IoUringModifyError::UnknownError(e)) => {
+                fail!(from self, with ReactorModifyError::UnknownError(e),
+                    "Unable to suspend {:?} since an unknown failure occurred in the underlying io_uring ({e}).", fd);
+            }
+        }
+    }
+
+    fn resume(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        let io_uring = match &self.backend {
+            Backend::IoUring(io_uring) => io_uring,
+            Backend::Epoll(reactor) => return reactor.resume(fd),
+        };
+
+        match io_uring.resume(fd) {
+            Ok(()) => Ok(()),
+            Err(IoUringModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to resume {:?} since it is not attached.", fd);
+            }
+            Err(IoUringModifyError::UnknownError(e)) => {
+                fail!(from self, with ReactorModifyError::UnknownError(e),
+                    "Unable to resume {:?} since an unknown failure occurred in the underlying io_uring ({e}).", fd);
+            }
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        match &self.backend {
+            Backend::IoUring(io_uring) => self.wait(
+                io_uring,
+                fn_call,
+                |io_uring, f: F| io_uring.try_wait(f),
+                Duration::ZERO,
+            ),
+            Backend::Epoll(reactor) => reactor.try_wait(fn_call),
+        }
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        match &self.backend {
+            Backend::IoUring(io_uring) => self.wait(
+                io_uring,
+                fn_call,
+                |io_uring, f: F| io_uring.timed_wait(timeout, f),
+                timeout,
+            ),
+            Backend::Epoll(reactor) => reactor.timed_wait(fn_call, timeout),
+        }
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        match &self.backend {
+            Backend::IoUring(io_uring) => self.wait(
+                io_uring,
+                fn_call,
+                |io_uring, f: F| io_uring.blocking_wait(f),
+                Duration::MAX,
+            ),
+            Backend::Epoll(reactor) => reactor.blocking_wait(fn_call),
+        }
+    }
+}
+
+pub struct ReactorBuilder {}
+
+impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
+    fn new() -> Self {
+        Self {}
+    }
+
+    fn create(self) -> Result<Reactor, ReactorCreateError> {
+        match IoUringBuilder::new().create() {
+            Ok(io_uring) => Ok(Reactor {
+                backend: Backend::IoUring(io_uring),
+            }),
+            Err(IoUringCreateError::NotSupported) => {
+                debug!(from "io_uring::ReactorBuilder::create()",
+                    "io_uring is not available, falling back to epoll.");
+                let reactor = epoll::ReactorBuilder::new().create()?;
+                Ok(Reactor {
+                    backend: Backend::Epoll(reactor),
+                })
+            }
+            Err(IoUringCreateError::UnknownError(e)) => {
+                fail!(from "io_uring::ReactorBuilder::create()", with ReactorCreateError::UnknownError(e),
+                    "Unable to create reactor since an unknown failure occurred in the underlying io_uring ({e}).");
+            }
+            Err(e) => {
+                fail!(from "io_uring::ReactorBuilder::create()", with ReactorCreateError::UnknownError(0),
+                    "Unable to create reactor since the underlying io_uring could not be created ({:?}).", e);
+            }
+        }
+    }
+}
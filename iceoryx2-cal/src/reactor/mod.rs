@@ -10,6 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+#[cfg(target_os = "linux")]
+pub mod epoll;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod posix_select;
 
 use core::{fmt::Debug, time::Duration};
@@ -30,6 +34,12 @@ pub enum ReactorAttachError {
     UnknownError(i32),
 }
 
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ReactorModifyError {
+    NotAttached,
+    UnknownError(i32),
+}
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ReactorWaitError {
     Interrupt,
@@ -56,6 +66,13 @@ pub trait Reactor: Sized + Debug {
         value: &'attachment F,
     ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError>;
 
+    /// Stops monitoring an attached [`FileDescriptor`] until [`Reactor::resume()`] is called.
+    /// It stays attached but does not wake up any wait even when it is readable.
+    fn suspend(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError>;
+
+    /// Monitors a [`FileDescriptor`] that was suspended with [`Reactor::suspend()`] again.
+    fn resume(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError>;
+
     fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError>;
     fn timed_wait<F: FnMut(&FileDescriptor)>(
         &self,
@@ -18,11 +18,11 @@ use iceoryx2_bb_posix::{
     file_descriptor::FileDescriptor,
     file_descriptor_set::{
         FileDescriptorSet, FileDescriptorSetAddError, FileDescriptorSetGuard,
-        FileDescriptorSetWaitError, FileEvent,
+        FileDescriptorSetModifyError, FileDescriptorSetWaitError, FileEvent,
     },
 };
 
-use crate::reactor::{ReactorAttachError, ReactorWaitError};
+use crate::reactor::{ReactorAttachError, ReactorModifyError, ReactorWaitError};
 
 impl crate::reactor::ReactorGuard<'_, '_> for FileDescriptorSetGuard<'_, '_> {
     fn file_descriptor(&self) -> &FileDescriptor {
@@ -127,6 +127,26 @@ impl crate::reactor::Reactor for Reactor {
         }
     }
 
+    fn suspend(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        match self.set.suspend(fd) {
+            Ok(()) => Ok(()),
+            Err(FileDescriptorSetModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to suspend {:?} since it is not attached.", fd);
+            }
+        }
+    }
+
+    fn resume(&self, fd: &FileDescriptor) -> Result<(), ReactorModifyError> {
+        match self.set.resume(fd) {
+            Ok(()) => Ok(()),
+            Err(FileDescriptorSetModifyError::NotAttached) => {
+                fail!(from self, with ReactorModifyError::NotAttached,
+                    "Unable to resume {:?} since it is not attached.", fd);
+            }
+        }
+    }
+
     fn try_wait<F: FnMut(&FileDescriptor)>(
         &self,
         fn_call: F,
@@ -17,7 +17,8 @@ use core::time::Duration;
 use core::{fmt::Debug, marker::PhantomData};
 
 use crate::shared_memory::{
-    AllocationStrategy, SegmentId, SharedMemoryForPoolAllocator, ShmPointer,
+    AllocationStrategy, MemoryResidency, PageSize, SegmentId, SharedMemoryForPoolAllocator,
+    ShmPointer,
 };
 use crate::shared_memory::{
     PointerOffset, SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError,
@@ -60,6 +61,8 @@ struct MemoryConfig<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     base_name: FileName,
     shm: Shm::Configuration,
     allocator_config_hint: Allocator::Configuration,
+    page_size: PageSize,
+    memory_residency: MemoryResidency,
 }
 
 #[derive(Debug)]
@@ -67,6 +70,8 @@ struct ViewConfig<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     base_name: FileName,
     shm: Shm::Configuration,
     shm_builder_timeout: Duration,
+    page_size: PageSize,
+    memory_residency: MemoryResidency,
     _data: PhantomData<Allocator>,
 }
 
@@ -128,6 +133,8 @@ where
                 base_name: *name,
                 shm: Shm::Configuration::default(),
                 shm_builder_timeout: Duration::ZERO,
+                page_size: PageSize::Default,
+                memory_residency: MemoryResidency::OnDemand,
                 _data: PhantomData,
             },
         }
@@ -154,6 +161,16 @@ where
         self
     }
 
+    fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
+    fn memory_residency(mut self, value: MemoryResidency) -> Self {
+        self.config.memory_residency = value;
+        self
+    }
+
     fn open(self) -> Result<DynamicView<Allocator, Shm>, SharedMemoryOpenError> {
         let origin = format!("{:?}", self);
         let msg = "Unable to open ResizableSharedMemoryView";
@@ -198,6 +215,8 @@ where
                 base_name: *name,
                 allocator_config_hint: Allocator::Configuration::default(),
                 shm: Shm::Configuration::default(),
+                page_size: PageSize::Default,
+                memory_residency: MemoryResidency::OnDemand,
             },
             shared_state: SharedState {
                 allocation_strategy: AllocationStrategy::default(),
@@ -243,6 +262,16 @@ where
         self
     }
 
+    fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
+    fn memory_residency(mut self, value: MemoryResidency) -> Self {
+        self.config.memory_residency = value;
+        self
+    }
+
     fn create(mut self) -> Result<DynamicMemory<Allocator, Shm>, SharedMemoryCreateError> {
         let msg = "Unable to create ResizableSharedMemory";
         let origin = format!("{:?}", self);
@@ -363,6 +392,15 @@ where
         Ok((offset + payload_start_address) as *const u8)
     }
 
+    fn translate_offset(&self, offset: PointerOffset) -> Option<*const u8> {
+        let key = SlotMapKey::new(offset.segment_id().value() as usize);
+        let shared_memory_map = unsafe { &*self.shared_memory_map.get() };
+
+        shared_memory_map
+            .get(key)
+            .map(|entry| (offset.offset() + entry.shm.payload_start_address()) as *const u8)
+    }
+
     unsafe fn unregister_offset(&self, offset: PointerOffset) {
         let segment_id = offset.segment_id();
         let key = SlotMapKey::new(segment_id.value() as usize);
@@ -573,6 +611,8 @@ where
         Self::segment_builder(&config.base_name, &config.shm, segment_id)
             .has_ownership(true)
             .size(payload_size)
+            .page_size(config.page_size)
+            .memory_residency(config.memory_residency)
             .create(&config.allocator_config_hint)
     }
 
@@ -583,6 +623,8 @@ where
         Self::segment_builder(&config.base_name, &config.shm, segment_id)
             .has_ownership(false)
             .timeout(config.shm_builder_timeout)
+            .page_size(config.page_size)
+            .memory_residency(config.memory_residency)
             .open()
     }
 
@@ -729,6 +771,10 @@ where
         self.state().shared_memory_map.len()
     }
 
+    fn page_size(&self) -> PageSize {
+        self.state().builder_config.page_size
+    }
+
     fn allocate(&self, layout: Layout) -> Result<ShmPointer, ResizableShmAllocationError> {
         let msg = "Unable to allocate memory";
         let state = self.state_mut();
@@ -98,7 +98,8 @@ use iceoryx2_bb_elementary::enum_gen;
 
 use crate::named_concept::*;
 use crate::shared_memory::{
-    SegmentId, SharedMemory, SharedMemoryCreateError, SharedMemoryOpenError, ShmPointer,
+    MemoryResidency, PageSize, SegmentId, SharedMemory, SharedMemoryCreateError,
+    SharedMemoryOpenError, ShmPointer,
 };
 use crate::shm_allocator::{PointerOffset, ShmAllocationError, ShmAllocator};
 
@@ -134,6 +135,15 @@ pub trait ResizableSharedMemoryViewBuilder<
     /// timeout.
     fn timeout(self, value: Duration) -> Self;
 
+    /// Defines the [`PageSize`] of the pages that back the [`SharedMemory`] segments that
+    /// contain the chunks. It must be equal to the [`PageSize`] the [`ResizableSharedMemory`]
+    /// was created with.
+    fn page_size(self, value: PageSize) -> Self;
+
+    /// Defines the [`MemoryResidency`] of every [`SharedMemory`] segment that is mapped into
+    /// the process space.
+    fn memory_residency(self, value: MemoryResidency) -> Self;
+
     /// Opens already existing [`SharedMemory`]. If it does not exist or the initialization is not
     /// yet finished the method will fail.
     fn open(self) -> Result<ResizableShmView, SharedMemoryOpenError>;
@@ -162,6 +172,14 @@ pub trait ResizableSharedMemoryBuilder<
     /// acquired.
     fn allocation_strategy(self, value: AllocationStrategy) -> Self;
 
+    /// Defines the [`PageSize`] of the pages that back the [`SharedMemory`] segments that
+    /// contain the chunks.
+    fn page_size(self, value: PageSize) -> Self;
+
+    /// Defines the [`MemoryResidency`] of every [`SharedMemory`] segment that contains the
+    /// chunks.
+    fn memory_residency(self, value: MemoryResidency) -> Self;
+
     /// Creates new [`SharedMemory`]. If it already exists the method will fail.
     fn create(self) -> Result<ResizableShm, SharedMemoryCreateError>;
 }
@@ -183,6 +201,12 @@ pub trait ResizableSharedMemoryView<Allocator: ShmAllocator, Shm: SharedMemory<A
         offset: PointerOffset,
     ) -> Result<*const u8, SharedMemoryOpenError>;
 
+    /// Translates a received [`PointerOffset`] into the absolut pointer to the data without
+    /// registering it. Returns [`None`] when the segment of the [`PointerOffset`] is not yet
+    /// mapped into the process space. The pointer must not be used after the segment was
+    /// released with [`ResizableSharedMemoryView::unregister_offset()`].
+    fn translate_offset(&self, offset: PointerOffset) -> Option<*const u8>;
+
     /// Unregisters a received [`PointerOffset`] that was previously registered.
     ///
     /// # Safety
@@ -222,6 +246,9 @@ pub trait ResizableSharedMemory<Allocator: ShmAllocator, Shm: SharedMemory<Alloc
     /// Returns the number of active [`SharedMemory`] segments.
     fn number_of_active_segments(&self) -> usize;
 
+    /// Returns the [`PageSize`] of the pages that back the [`SharedMemory`] segments.
+    fn page_size(&self) -> PageSize;
+
     /// Allocates a new piece of [`SharedMemory`] if the provided [`Layout`] exceeds the current
     /// supported [`Layout`], the memory would be out-of-memory or the number of chunks exceeds the
     /// current supported amount of chunks, a new [`SharedMemory`] segment will be created. If this
@@ -25,10 +25,12 @@ use iceoryx2_bb_system_types::path::Path;
 
 use crate::static_storage::file::{
     NamedConcept, NamedConceptBuilder, NamedConceptConfiguration, NamedConceptMgmt,
+    NamedConceptRemoveError,
 };
 
 #[doc(hidden)]
 pub mod details {
+    use buddy_allocator::BuddyAllocator;
     use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
     use pool_allocator::PoolAllocator;
 
@@ -137,6 +139,8 @@ pub mod details {
     > {
         name: FileName,
         size: usize,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
         config: Configuration<Allocator, Storage>,
         timeout: Duration,
         has_ownership: bool,
@@ -150,6 +154,8 @@ pub mod details {
                 name: *name,
                 config: Configuration::default(),
                 size: 0,
+                page_size: PageSize::Default,
+                memory_residency: MemoryResidency::OnDemand,
                 timeout: Duration::ZERO,
                 has_ownership: true,
             }
@@ -211,6 +217,16 @@ pub mod details {
             self
         }
 
+        fn page_size(mut self, value: PageSize) -> Self {
+            self.page_size = value;
+            self
+        }
+
+        fn memory_residency(mut self, value: MemoryResidency) -> Self {
+            self.memory_residency = value;
+            self
+        }
+
         fn timeout(mut self, value: Duration) -> Self {
             self.timeout = value;
             self
@@ -232,6 +248,7 @@ pub mod details {
             let storage = match Storage::Builder::new(&self.name)
                 .config(&self.config.dynamic_storage_config)
                 .supplementary_size(self.size + allocator_mgmt_size)
+                .page_size(self.page_size)
                 .has_ownership(self.has_ownership)
                 .initializer(|details, init_allocator| -> bool {
                     self.initialize(allocator_config, details, init_allocator)
@@ -252,6 +269,10 @@ pub mod details {
                     fail!(from self, with SharedMemoryCreateError::InsufficientPermissions,
                         "{} due to insufficient permissions.", msg);
                 }
+                Err(DynamicStorageCreateError::HugePagesUnavailable) => {
+                    fail!(from self, with SharedMemoryCreateError::HugePagesUnavailable,
+                        "{} since huge pages of the type {:?} are not available.", msg, self.page_size);
+                }
                 Err(DynamicStorageCreateError::InitializationFailed) => {
                     fail!(from self, with SharedMemoryCreateError::InternalError,
                         "{} since the initialization failed.", msg);
@@ -262,6 +283,12 @@ pub mod details {
                 }
             };
 
+            if let Err(e) = storage.apply_memory_residency(self.memory_residency) {
+                fail!(from self, with SharedMemoryCreateError::InternalError,
+                    "{} since the memory residency {:?} could not be applied ({:?}).",
+                    msg, self.memory_residency, e);
+            }
+
             Ok(Memory::<Allocator, Storage> {
                 payload_start_address: get_payload_start_address(&storage),
                 storage,
@@ -276,6 +303,7 @@ pub mod details {
             let storage = match Storage::Builder::new(&self.name)
                 .config(&self.config.dynamic_storage_config)
                 .has_ownership(false)
+                .page_size(self.page_size)
                 .timeout(self.timeout)
                 .open()
             {
@@ -311,6 +339,12 @@ pub mod details {
                     msg, self.size, payload_size);
             }
 
+            if let Err(e) = storage.apply_memory_residency(self.memory_residency) {
+                fail!(from self, with SharedMemoryOpenError::InternalError,
+                    "{} since the memory residency {:?} could not be applied ({:?}).",
+                    msg, self.memory_residency, e);
+            }
+
             Ok(Memory::<Allocator, Storage> {
                 payload_start_address: get_payload_start_address(&storage),
                 name: self.name,
@@ -402,6 +436,18 @@ pub mod details {
             Storage::does_support_persistency()
         }
 
+        unsafe fn remove_with_page_size_cfg(
+            name: &FileName,
+            cfg: &Self::Configuration,
+            page_size: PageSize,
+        ) -> Result<bool, NamedConceptRemoveError> {
+            Ok(
+                fail!(from "shared_memory::posix::remove_with_page_size_cfg()",
+            when Storage::remove_with_page_size_cfg(name, &cfg.dynamic_storage_config, page_size),
+            "Unable to remove shared memory concept \"{}\" with the page size {:?}.", name, page_size),
+            )
+        }
+
         fn has_ownership(&self) -> bool {
             self.storage.has_ownership()
         }
@@ -422,6 +468,10 @@ pub mod details {
             unsafe { self.storage.get().allocator.assume_init_ref() }.max_alignment()
         }
 
+        fn page_size(&self) -> PageSize {
+            self.storage.page_size()
+        }
+
         fn allocate(&self, layout: core::alloc::Layout) -> Result<ShmPointer, ShmAllocationError> {
             let offset = fail!(from self, when unsafe { self.storage.get().allocator.assume_init_ref().allocate(layout) },
             "Failed to allocate shared memory due to an internal allocator failure.");
@@ -460,4 +510,36 @@ pub mod details {
             unsafe { self.storage.get().allocator.assume_init_ref().bucket_size() }
         }
     }
+
+    impl<Storage: DynamicStorage<AllocatorDetails<BuddyAllocator>>> SharedMemoryForBuddyAllocator
+        for Memory<BuddyAllocator, Storage>
+    {
+        unsafe fn deallocate_block(&self, offset: PointerOffset) {
+            self.storage
+                .get()
+                .allocator
+                .assume_init_ref()
+                .deallocate_block(offset);
+        }
+
+        fn min_block_size(&self) -> usize {
+            unsafe {
+                self.storage
+                    .get()
+                    .allocator
+                    .assume_init_ref()
+                    .min_block_size()
+            }
+        }
+
+        fn number_of_min_blocks(&self) -> usize {
+            unsafe {
+                self.storage
+                    .get()
+                    .allocator
+                    .assume_init_ref()
+                    .number_of_min_blocks()
+            }
+        }
+    }
 }
@@ -60,8 +60,12 @@ pub mod process_local;
 
 use core::{fmt::Debug, time::Duration};
 
+pub use crate::dynamic_storage::{MemoryResidency, PageSize};
 pub use crate::shm_allocator::*;
-use crate::static_storage::file::{NamedConcept, NamedConceptBuilder, NamedConceptMgmt};
+use crate::static_storage::file::{
+    NamedConcept, NamedConceptBuilder, NamedConceptMgmt, NamedConceptRemoveError,
+};
+use buddy_allocator::BuddyAllocator;
 use iceoryx2_bb_system_types::file_name::*;
 use pool_allocator::PoolAllocator;
 
@@ -71,6 +75,7 @@ pub enum SharedMemoryCreateError {
     AlreadyExists,
     SizeIsZero,
     InsufficientPermissions,
+    HugePagesUnavailable,
     InternalError,
 }
 
@@ -117,6 +122,15 @@ pub trait SharedMemoryBuilder<Allocator: ShmAllocator, Shm: SharedMemory<Allocat
     /// space.
     fn size(self, value: usize) -> Self;
 
+    /// Defines the [`PageSize`] of the pages that back the [`SharedMemory`]. It is applied when
+    /// the [`SharedMemory`] is created or opened, a [`SharedMemory`] that is backed by huge
+    /// pages can only be opened with the [`PageSize`] it was created with.
+    fn page_size(self, value: PageSize) -> Self;
+
+    /// Defines the [`MemoryResidency`] of the [`SharedMemory`]. It is applied whenever the
+    /// [`SharedMemory`] is created or opened.
+    fn memory_residency(self, value: MemoryResidency) -> Self;
+
     /// The timeout defines how long the [`SharedMemoryBuilder`] should wait for
     /// [`SharedMemoryBuilder::create()`] to finialize
     /// the initialization. This is required when the [`SharedMemory`] is created and initialized
@@ -148,6 +162,9 @@ pub trait SharedMemory<Allocator: ShmAllocator>:
     /// Returns the max supported alignment.
     fn max_alignment(&self) -> usize;
 
+    /// Returns the [`PageSize`] of the pages that back the [`SharedMemory`].
+    fn page_size(&self) -> PageSize;
+
     /// Returns the start address of the shared memory. Used by the [`ShmPointer`] to calculate
     /// the actual memory position.
     fn payload_start_address(&self) -> usize;
@@ -169,6 +186,21 @@ pub trait SharedMemory<Allocator: ShmAllocator>:
     /// resource remain even when every [`SharedMemory`] instance in every process was removed.
     fn does_support_persistency() -> bool;
 
+    /// Removes the [`SharedMemory`] that is backed by pages of the provided [`PageSize`].
+    /// [`NamedConceptMgmt::remove_cfg()`] removes only [`SharedMemory`]s that are backed by
+    /// pages of the default size.
+    ///
+    /// # Safety
+    ///
+    ///  * see [`NamedConceptMgmt::remove_cfg()`]
+    unsafe fn remove_with_page_size_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+        _page_size: PageSize,
+    ) -> Result<bool, NamedConceptRemoveError> {
+        Self::remove_cfg(name, cfg)
+    }
+
     /// Returns true if the [`SharedMemory`] holds the ownership, otherwise false
     fn has_ownership(&self) -> bool;
 
@@ -198,3 +230,19 @@ pub trait SharedMemoryForPoolAllocator: SharedMemory<PoolAllocator> {
     /// Returns the bucket size of the [`PoolAllocator`]
     fn bucket_size(&self) -> usize;
 }
+
+pub trait SharedMemoryForBuddyAllocator: SharedMemory<BuddyAllocator> {
+    /// Release previously allocated memory
+    ///
+    /// # Safety
+    ///
+    ///  * the offset must be acquired with [`SharedMemory::allocate()`] - extracted from the
+    ///    [`ShmPointer`]
+    unsafe fn deallocate_block(&self, offset: PointerOffset);
+
+    /// Returns the size of the smallest block of the [`BuddyAllocator`]
+    fn min_block_size(&self) -> usize;
+
+    /// Returns the number of smallest blocks the [`BuddyAllocator`] manages
+    fn number_of_min_blocks(&self) -> usize;
+}
@@ -0,0 +1,372 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A [`ShmAllocator`] that manages the memory in power of two size classes. Every allocation
+//! is rounded up to the next power of two multiple of the minimum block size and served from
+//! a free block of exactly that size. Larger free blocks are split into two buddies on demand
+//! and buddies are merged again when both are released. In contrast to the
+//! [`PoolAllocator`](crate::shm_allocator::pool_allocator::PoolAllocator), small allocations
+//! do not occupy a bucket that is sized for the largest allocation.
+
+use core::{alloc::Layout, hint::spin_loop, ptr::NonNull, sync::atomic::Ordering};
+
+use crate::shm_allocator::{ShmAllocator, ShmAllocatorConfig};
+use iceoryx2_bb_container::vec::RelocatableVec;
+use iceoryx2_bb_elementary::{
+    allocator::BaseAllocator, math::align, relocatable_container::RelocatableContainer,
+};
+use iceoryx2_bb_log::{fail, fatal_panic};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU8, IoxAtomicUsize};
+
+use super::{
+    AllocationError, AllocationStrategy, PointerOffset, SharedMemorySetupHint, ShmAllocationError,
+    ShmAllocatorInitError,
+};
+
+/// The number of size classes [`BuddyAllocator::initial_setup_hint()`] provides below and
+/// including the maximum chunk size.
+pub const NUMBER_OF_SIZE_CLASSES: usize = 8;
+
+#[derive(Clone, Copy, Debug)]
+pub struct Config {
+    /// The layout of the smallest block. The size is rounded up to the next power of two.
+    pub min_block_layout: Layout,
+}
+
+impl Default for Config {
+    fn default() -> Self {
+        Self {
+            min_block_layout: unsafe { Layout::from_size_align_unchecked(64, 8) },
+        }
+    }
+}
+
+impl ShmAllocatorConfig for Config {}
+
+#[derive(Debug)]
+pub struct BuddyAllocator {
+    // Every node stores the order + 1 of the largest free block in its subtree, 0 when
+    // nothing is free. The leaves are the minimum blocks.
+    tree: RelocatableVec<IoxAtomicU8>,
+    tree_height: u32,
+    // is even with absolut base address relocatable since every process acquire and return
+    // the same relative offset which map then to the same absolut base address
+    base_address: usize,
+    start_address: usize,
+    min_block_size: usize,
+    min_block_alignment: usize,
+    number_of_blocks: usize,
+    max_supported_alignment_by_memory: usize,
+    number_of_used_blocks: IoxAtomicUsize,
+    lock: IoxAtomicBool,
+}
+
+impl BuddyAllocator {
+    fn min_block_size_of(config: &Config) -> usize {
+        config
+            .min_block_layout
+            .size()
+            .max(config.min_block_layout.align())
+            .next_power_of_two()
+    }
+
+    fn number_of_leaves(number_of_blocks: usize) -> usize {
+        number_of_blocks.max(1).next_power_of_two()
+    }
+
+    /// Returns the size of the smallest block. Every offset returned by
+    /// [`ShmAllocator::allocate()`] is a multiple of it.
+    pub fn min_block_size(&self) -> usize {
+        self.min_block_size
+    }
+
+    /// Returns the number of minimum blocks that are managed by the allocator.
+    pub fn number_of_min_blocks(&self) -> usize {
+        self.number_of_blocks
+    }
+
+    /// Returns the size of the largest block that can be currently allocated.
+    pub fn max_free_block_size(&self) -> usize {
+        match self.node(0).load(Ordering::Relaxed) {
+            0 => 0,
+            v => self.min_block_size << (v - 1),
+        }
+    }
+
+    /// # Safety
+    ///
+    ///  * provided [`PointerOffset`] must be allocated with [`BuddyAllocator::allocate()`]
+    pub unsafe fn deallocate_block(&self, offset: PointerOffset) {
+        let leaf = offset.offset() / self.min_block_size;
+        if leaf >= self.number_of_blocks {
+            fatal_panic!(from self,
+                "Unable to deallocate the block at {:?} since it is not managed by the allocator.",
+                offset);
+        }
+
+        self.acquire_lock();
+        let mut index = Self::number_of_leaves(self.number_of_blocks) - 1 + leaf;
+        let mut order = 0;
+        while self.node(index).load(Ordering::Relaxed) != 0 {
+            if index == 0 {
+                self.release_lock();
+                fatal_panic!(from self,
+                    "Unable to deallocate the block at {:?} since it was never allocated.", offset);
+            }
+            index = (index - 1) / 2;
+            order += 1;
+        }
+
+        self.node(index).store(order as u8 + 1, Ordering::Relaxed);
+        self.update_parents(index, order);
+        self.release_lock();
+
+        self.number_of_used_blocks
+            .fetch_sub(1 << order, Ordering::Relaxed);
+    }
+
+    fn node(&self, index: usize) -> &IoxAtomicU8 {
+        unsafe { &self.tree.as_slice()[index] }
+    }
+
+    fn acquire_lock(&self) {
+        while self
+            .lock
+            .compare_exchange_weak(false, true, Ordering::Acquire, Ordering::Relaxed)
+            .is_err()
+        {
+            spin_loop();
+        }
+    }
+
+    fn release_lock(&self) {
+        self.lock.store(false, Ordering::Release);
+    }
+
+    fn value_from_children(&self, index: usize, order: u32) -> u8 {
+        let left = self.node(2 * index + 1).load(Ordering::Relaxed);
+        let right = self.node(2 * index + 2).load(Ordering::Relaxed);
+
+        // both children are completely free, they merge into one block
+        if left as u32 == order && right as u32 == order {
+            order as u8 + 1
+        } else {
+            left.max(right)
+        }
+    }
+
+    fn update_parents(&self, mut index: usize, mut order: u32) {
+        while index != 0 {
+            index = (index - 1) / 2;
+            order += 1;
+            self.node(index)
+                .store(self.value_from_children(index, order), Ordering::Relaxed);
+        }
+    }
+
+    fn required_order(&self, size: usize) -> u32 {
+        size.max(1)
+            .div_ceil(self.min_block_size)
+            .next_power_of_two()
+            .trailing_zeros()
+    }
+}
+
+impl ShmAllocator for BuddyAllocator {
+    type Configuration = Config;
+
+    fn resize_hint(
+        &self,
+        layout: Layout,
+        strategy: AllocationStrategy,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        let current_payload_size = self.number_of_blocks * self.min_block_size;
+        let config = Config {
+            min_block_layout: unsafe {
+                Layout::from_size_align_unchecked(
+                    self.min_block_size,
+                    self.min_block_alignment.max(layout.align()),
+                )
+            },
+        };
+
+        let required_block_size = self.min_block_size << self.required_order(layout.size());
+        if required_block_size <= self.max_free_block_size()
+            && layout.align() <= self.min_block_alignment
+        {
+            return SharedMemorySetupHint {
+                payload_size: current_payload_size,
+                config,
+            };
+        }
+
+        let payload_size = match strategy {
+            AllocationStrategy::BestFit => current_payload_size + required_block_size,
+            AllocationStrategy::PowerOfTwo => {
+                (current_payload_size + required_block_size).next_power_of_two()
+            }
+            AllocationStrategy::Static => current_payload_size,
+        };
+
+        SharedMemorySetupHint {
+            payload_size,
+            config,
+        }
+    }
+
+    fn initial_setup_hint(
+        max_chunk_layout: Layout,
+        max_number_of_chunks: usize,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        let max_block_size = max_chunk_layout
+            .size()
+            .max(max_chunk_layout.align())
+            .next_power_of_two();
+        let min_block_size =
+            (max_block_size >> (NUMBER_OF_SIZE_CLASSES - 1)).max(max_chunk_layout.align());
+
+        SharedMemorySetupHint {
+            payload_size: max_block_size * max_number_of_chunks,
+            config: Self::Configuration {
+                min_block_layout: unsafe {
+                    Layout::from_size_align_unchecked(min_block_size, max_chunk_layout.align())
+                },
+            },
+        }
+    }
+
+    fn management_size(memory_size: usize, config: &Self::Configuration) -> usize {
+        let number_of_leaves =
+            Self::number_of_leaves(memory_size / Self::min_block_size_of(config));
+        RelocatableVec::<IoxAtomicU8>::const_memory_size(2 * number_of_leaves - 1)
+    }
+
+    fn relative_start_address(&self) -> usize {
+        self.start_address - self.base_address
+    }
+
+    unsafe fn new_uninit(
+        max_supported_alignment_by_memory: usize,
+        managed_memory: NonNull<[u8]>,
+        config: &Self::Configuration,
+    ) -> Self {
+        let base_address = (managed_memory.as_ptr() as *mut u8) as usize;
+        let end_address = base_address + managed_memory.len();
+        let min_block_size = Self::min_block_size_of(config);
+        let start_address = align(base_address, config.min_block_layout.align());
+        let number_of_blocks = end_address.saturating_sub(start_address) / min_block_size;
+        let number_of_leaves = Self::number_of_leaves(number_of_blocks);
+
+        Self {
+            tree: RelocatableVec::new_uninit(2 * number_of_leaves - 1),
+            tree_height: number_of_leaves.trailing_zeros(),
+            base_address,
+            start_address,
+            min_block_size,
+            min_block_alignment: config.min_block_layout.align(),
+            number_of_blocks,
+            max_supported_alignment_by_memory,
+            number_of_used_blocks: IoxAtomicUsize::new(0),
+            lock: IoxAtomicBool::new(false),
+        }
+    }
+
+    fn max_alignment(&self) -> usize {
+        self.min_block_alignment
+    }
+
+    unsafe fn init<Allocator: BaseAllocator>(
+        &mut self,
+        mgmt_allocator: &Allocator,
+    ) -> Result<(), ShmAllocatorInitError> {
+        let msg = "Unable to initialize allocator";
+        if self.max_supported_alignment_by_memory < self.max_alignment() {
+            fail!(from self, with ShmAllocatorInitError::MaxSupportedMemoryAlignmentInsufficient,
+                "{} since the required alignment {} exceeds the maximum supported alignment {} of the memory.",
+                msg, self.max_alignment(), self.max_supported_alignment_by_memory);
+        }
+
+        fail!(from self, when self.tree.init(mgmt_allocator),
+            with ShmAllocatorInitError::AllocationFailed,
+            "{} since the allocation of the allocator managment memory failed.", msg);
+
+        self.tree.fill_with(|| IoxAtomicU8::new(0));
+        let number_of_leaves = Self::number_of_leaves(self.number_of_blocks);
+        for leaf in 0..self.number_of_blocks {
+            self.node(number_of_leaves - 1 + leaf)
+                .store(1, Ordering::Relaxed);
+        }
+
+        for index in (0..number_of_leaves - 1).rev() {
+            let order = self.tree_height - (usize::BITS - 1 - (index + 1).leading_zeros());
+            self.node(index)
+                .store(self.value_from_children(index, order), Ordering::Relaxed);
+        }
+
+        Ok(())
+    }
+
+    fn unique_id() -> u8 {
+        2
+    }
+
+    unsafe fn allocate(&self, layout: Layout) -> Result<PointerOffset, ShmAllocationError> {
+        let msg = "Unable to allocate memory";
+        if layout.align() > self.max_alignment() {
+            fail!(from self, with ShmAllocationError::ExceedsMaxSupportedAlignment,
+                "{} since an alignment of {} exceeds the maximum supported alignment of {}.",
+                msg, layout.align(), self.max_alignment());
+        }
+
+        let required_order = self.required_order(layout.size());
+        if required_order > self.tree_height {
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                "{} since the size of {} exceeds the managed memory.", msg, layout.size());
+        }
+
+        self.acquire_lock();
+        if (self.node(0).load(Ordering::Relaxed) as u32) < required_order + 1 {
+            self.release_lock();
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                "{} since no free block of size {} is available.",
+                msg, self.min_block_size << required_order);
+        }
+
+        let mut index = 0;
+        let mut order = self.tree_height;
+        while order != required_order {
+            let left = 2 * index + 1;
+            index = if self.node(left).load(Ordering::Relaxed) as u32 > required_order {
+                left
+            } else {
+                left + 1
+            };
+            order -= 1;
+        }
+
+        self.node(index).store(0, Ordering::Relaxed);
+        self.update_parents(index, order);
+        self.release_lock();
+
+        self.number_of_used_blocks
+            .fetch_add(1 << order, Ordering::Relaxed);
+
+        let first_index_on_level = (1 << (self.tree_height - order)) - 1;
+        Ok(PointerOffset::new(
+            (index - first_index_on_level) * (self.min_block_size << order),
+        ))
+    }
+
+    unsafe fn deallocate(&self, offset: PointerOffset, _layout: Layout) {
+        self.deallocate_block(offset);
+    }
+}
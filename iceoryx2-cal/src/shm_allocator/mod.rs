@@ -10,6 +10,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub mod buddy_allocator;
 pub mod bump_allocator;
 pub mod pointer_offset;
 pub mod pool_allocator;
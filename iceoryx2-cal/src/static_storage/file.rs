@@ -50,11 +50,27 @@ pub use crate::static_storage::*;
 use iceoryx2_bb_log::{fail, trace, warn};
 use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
 use iceoryx2_bb_posix::{
-    directory::*, file::*, file_descriptor::FileDescriptorManagement, file_type::FileType,
+    directory::*,
+    file::*,
+    file_descriptor::{FileDescriptor, FileDescriptorManagement},
+    file_type::FileType,
 };
+#[cfg(target_os = "linux")]
+use iceoryx2_bb_posix::{file_descriptor::FileDescriptorBased, inotify::*};
 
 const FINAL_PERMISSIONS: Permission = Permission::OWNER_READ;
 
+// a storage becomes readable when its permissions are set to FINAL_PERMISSIONS, therefore
+// attribute changes are watched as well
+#[cfg(target_os = "linux")]
+const WATCHED_EVENTS: InotifyEvents = InotifyEvents::ENTRY_CREATED
+    .union(InotifyEvents::ENTRY_DELETED)
+    .union(InotifyEvents::ENTRY_MOVED_IN)
+    .union(InotifyEvents::ENTRY_MOVED_OUT)
+    .union(InotifyEvents::ATTRIBUTES_CHANGED)
+    .union(InotifyEvents::SELF_DELETED)
+    .union(InotifyEvents::SELF_MOVED);
+
 /// The custom configuration of the [`Storage`].
 #[derive(Clone, Debug)]
 pub struct Configuration {
@@ -302,9 +318,87 @@ impl crate::named_concept::NamedConceptMgmt for Storage {
     }
 }
 
+/// Detects changes of the [`Storage`]s in the directory of a [`Configuration`]. On Linux the
+/// directory is watched with inotify, on all other platforms every call of
+/// [`StaticStorageWatcher::has_changed()`] reports a change.
+#[derive(Debug)]
+pub struct Watcher {
+    #[cfg(target_os = "linux")]
+    inotify: Inotify,
+}
+
+#[cfg(target_os = "linux")]
+impl StaticStorageWatcher for Watcher {
+    fn has_changed(&mut self) -> Result<bool, StaticStorageWatchError> {
+        let msg = "Unable to detect changes of the static storages";
+        let mut is_directory_gone = false;
+        let result = self.inotify.try_read(|event| {
+            is_directory_gone |= event.events().intersects(
+                InotifyEvents::WATCH_REMOVED
+                    .union(InotifyEvents::SELF_DELETED)
+                    .union(InotifyEvents::SELF_MOVED),
+            );
+        });
+
+        if is_directory_gone {
+            fail!(from self, with StaticStorageWatchError::DoesNotExist,
+                "{} since the watched directory was removed or moved.", msg);
+        }
+
+        match result {
+            Ok(number_of_events) => Ok(number_of_events != 0),
+            // the remaining events are read with the next call
+            Err(InotifyReadError::Interrupt) => Ok(true),
+            Err(e) => {
+                fail!(from self, with StaticStorageWatchError::InternalError,
+                    "{} since the changes could not be read ({:?}).", msg, e);
+            }
+        }
+    }
+
+    fn file_descriptor(&self) -> Option<&FileDescriptor> {
+        Some(self.inotify.file_descriptor())
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+impl StaticStorageWatcher for Watcher {
+    fn has_changed(&mut self) -> Result<bool, StaticStorageWatchError> {
+        Ok(true)
+    }
+
+    fn file_descriptor(&self) -> Option<&FileDescriptor> {
+        None
+    }
+}
+
 impl crate::static_storage::StaticStorage for Storage {
     type Builder = Builder;
     type Locked = Locked;
+    type Watcher = Watcher;
+
+    #[cfg(target_os = "linux")]
+    fn watch_cfg(config: &Self::Configuration) -> Result<Self::Watcher, StaticStorageWatchError> {
+        let msg = "Unable to watch the static storages";
+        let origin = "static_storage::file::Storage::watch_cfg";
+        let inotify = fail!(from origin, when InotifyBuilder::new().create(),
+            with StaticStorageWatchError::InternalError,
+            "{} since the underlying inotify could not be created.", msg);
+
+        fail!(from origin, when inotify.add_watch(&config.path, WATCHED_EVENTS),
+            map InotifyWatchError::DoesNotExist => StaticStorageWatchError::DoesNotExist;
+                InotifyWatchError::NotADirectory => StaticStorageWatchError::DoesNotExist;
+                InotifyWatchError::InsufficientPermissions => StaticStorageWatchError::InsufficientPermissions,
+            unmatched StaticStorageWatchError::InternalError,
+            "{} in \"{}\" since the directory could not be watched.", msg, config.path);
+
+        Ok(Watcher { inotify })
+    }
+
+    #[cfg(not(target_os = "linux"))]
+    fn watch_cfg(_config: &Self::Configuration) -> Result<Self::Watcher, StaticStorageWatchError> {
+        Ok(Watcher {})
+    }
 
     fn release_ownership(&mut self) {
         self.has_ownership = false
@@ -19,6 +19,7 @@ pub mod process_local;
 use core::{fmt::Debug, time::Duration};
 
 use iceoryx2_bb_log::fail;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_bb_system_types::file_name::*;
 
 use crate::named_concept::{
@@ -57,6 +58,13 @@ pub enum StaticStorageUnlockError {
     InternalError,
 }
 
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum StaticStorageWatchError {
+    InsufficientPermissions,
+    DoesNotExist,
+    InternalError,
+}
+
 /// A custom configuration which can be used by the [`StaticStorageBuilder`] to create a
 /// [`StaticStorage`] with implementation specific settings.
 pub trait StaticStorageConfiguration: Clone + Default + NamedConceptConfiguration {}
@@ -99,11 +107,33 @@ pub trait StaticStorageLocked<T: StaticStorage>: Sized + NamedConcept {
     fn unlock(self, contents: &[u8]) -> Result<T, StaticStorageUnlockError>;
 }
 
+/// Detects whether [`StaticStorage`]s of a configuration were created, unlocked or removed
+/// without listing them.
+pub trait StaticStorageWatcher: Debug + Sized + Send {
+    /// Returns true when a [`StaticStorage`] might have been created, unlocked or removed
+    /// since the previous call or since the [`StaticStorageWatcher`] was created. A change is
+    /// never missed but a change can be reported even though none happened. When the
+    /// [`StaticStorageWatcher`] can no longer detect changes, for instance since the
+    /// underlying directory was removed, it returns an error and must be recreated with
+    /// [`StaticStorage::watch_cfg()`].
+    fn has_changed(&mut self) -> Result<bool, StaticStorageWatchError>;
+
+    /// Returns the [`FileDescriptor`] that becomes readable when a change happened. Returns
+    /// [`None`] when the implementation does not provide one, then
+    /// [`StaticStorageWatcher::has_changed()`] must be polled.
+    fn file_descriptor(&self) -> Option<&FileDescriptor>;
+}
+
 /// A static storage which owns its underlying resources. When it goes out of scope those resources
 /// shall be removed.
 pub trait StaticStorage: Debug + Sized + NamedConceptMgmt + NamedConcept {
     type Builder: StaticStorageBuilder<Self> + NamedConceptBuilder<Self>;
     type Locked: StaticStorageLocked<Self>;
+    type Watcher: StaticStorageWatcher;
+
+    /// Creates a [`StaticStorageWatcher`] that detects the creation and removal of all
+    /// [`StaticStorage`]s with the provided configuration.
+    fn watch_cfg(config: &Self::Configuration) -> Result<Self::Watcher, StaticStorageWatchError>;
 
     /// Returns the length of the content. Required to provide a buffer in
     /// [`StaticStorage::read()`] which is large enough.
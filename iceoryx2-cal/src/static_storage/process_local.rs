@@ -41,7 +41,9 @@ pub use crate::named_concept::*;
 pub use crate::static_storage::*;
 use iceoryx2_bb_log::{fail, fatal_panic};
 use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_bb_posix::mutex::*;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
 use once_cell::sync::Lazy;
 use std::collections::HashMap;
 
@@ -72,6 +74,13 @@ static PROCESS_LOCAL_STORAGE: Lazy<Mutex<HashMap<FilePath, StorageEntry>>> = Laz
 
     result.unwrap()
 });
+// incremented with every creation, unlock and removal of a storage while the storage lock is
+// held, the watchers compare it with the last value they have seen
+static PROCESS_LOCAL_GENERATION: IoxAtomicU64 = IoxAtomicU64::new(0);
+
+fn increment_generation() {
+    PROCESS_LOCAL_GENERATION.fetch_add(1, core::sync::atomic::Ordering::Relaxed);
+}
 
 #[derive(Clone, Debug)]
 pub struct Configuration {
@@ -156,6 +165,7 @@ impl StaticStorageLocked<Storage> for Locked {
                 }),
             },
         );
+        increment_generation();
 
         Ok(self.storage)
     }
@@ -193,10 +203,15 @@ impl NamedConceptMgmt for Storage {
                 "{} \"{}\" since the lock could not be acquired.", msg, storage_name);
         }
 
-        Ok(guard
+        let has_removed = guard
             .unwrap()
             .remove(&config.path_for(storage_name))
-            .is_some())
+            .is_some();
+        if has_removed {
+            increment_generation();
+        }
+
+        Ok(has_removed)
     }
 
     fn list_cfg(config: &Self::Configuration) -> Result<Vec<FileName>, NamedConceptListError> {
@@ -243,9 +258,36 @@ impl NamedConcept for Storage {
     }
 }
 
+/// Detects changes of all process local [`Storage`]s with a counter that is incremented on
+/// every creation, unlock and removal. Does not provide a [`FileDescriptor`].
+#[derive(Debug)]
+pub struct Watcher {
+    generation: u64,
+}
+
+impl StaticStorageWatcher for Watcher {
+    fn has_changed(&mut self) -> Result<bool, StaticStorageWatchError> {
+        let generation = PROCESS_LOCAL_GENERATION.load(core::sync::atomic::Ordering::Relaxed);
+        let has_changed = generation != self.generation;
+        self.generation = generation;
+        Ok(has_changed)
+    }
+
+    fn file_descriptor(&self) -> Option<&FileDescriptor> {
+        None
+    }
+}
+
 impl StaticStorage for Storage {
     type Builder = Builder;
     type Locked = Locked;
+    type Watcher = Watcher;
+
+    fn watch_cfg(_config: &Self::Configuration) -> Result<Self::Watcher, StaticStorageWatchError> {
+        Ok(Watcher {
+            generation: PROCESS_LOCAL_GENERATION.load(core::sync::atomic::Ordering::Relaxed),
+        })
+    }
 
     fn len(&self) -> u64 {
         self.content.value.len() as u64
@@ -372,6 +414,7 @@ impl StaticStorageBuilder<Storage> for Builder {
                 content: content.clone(),
             },
         );
+        increment_generation();
 
         Ok(Locked {
             storage: Storage {
@@ -15,10 +15,10 @@ pub mod details {
     use core::cell::UnsafeCell;
     use core::fmt::Debug;
     use core::marker::PhantomData;
-    use core::sync::atomic::Ordering;
+    use core::sync::atomic::{fence, Ordering};
     use iceoryx2_bb_elementary::allocator::{AllocationError, BaseAllocator};
     use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
-    use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicU8, IoxAtomicUsize};
+    use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU8, IoxAtomicUsize};
 
     use crate::dynamic_storage::{
         DynamicStorage, DynamicStorageBuilder, DynamicStorageCreateError, DynamicStorageOpenError,
@@ -33,8 +33,15 @@ pub mod details {
         index_queue::RelocatableIndexQueue,
         safely_overflowing_index_queue::RelocatableSafelyOverflowingIndexQueue,
     };
-    use iceoryx2_bb_log::{fail, fatal_panic};
-    use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
+    use iceoryx2_bb_log::{fail, fatal_panic, warn};
+    use iceoryx2_bb_posix::{
+        clock::Time,
+        mutex::{Handle, IpcCapable},
+        semaphore::{
+            SemaphoreInterface, SemaphoreTimedWaitError, SemaphoreWaitError, UnnamedSemaphore,
+            UnnamedSemaphoreBuilder, UnnamedSemaphoreHandle,
+        },
+    };
 
     use self::used_chunk_list::RelocatableUsedChunkList;
 
@@ -152,11 +159,24 @@ pub mod details {
         }
     }
 
+    // Handshake of a channel whose sender checks with
+    // `ZeroCopySender::is_receiver_activated_by_last_send()` whether the buffer was empty
+    // before its last send. Only then the receiver pays for the fence on an empty receive.
+    // Until the receiver has acknowledged the request, every send counts as activating.
+    const NOTIFY_ON_ACTIVATION_DISABLED: u8 = 0;
+    const NOTIFY_ON_ACTIVATION_REQUESTED: u8 = 1;
+    const NOTIFY_ON_ACTIVATION_ACKNOWLEDGED: u8 = 2;
+
     #[derive(Debug)]
     #[repr(C)]
     struct Channel {
         submission_queue: RelocatableSafelyOverflowingIndexQueue,
         completion_queue: RelocatableIndexQueue,
+        sender_waits_for_space: IoxAtomicBool,
+        notify_on_activation: IoxAtomicU8,
+        space_available: UnnamedSemaphoreHandle,
+        submission_queue_high_water_mark: IoxAtomicUsize,
+        completion_queue_high_water_mark: IoxAtomicUsize,
     }
 
     impl Channel {
@@ -168,6 +188,77 @@ pub mod details {
                 completion_queue: unsafe {
                     RelocatableIndexQueue::new_uninit(completion_queue_capacity)
                 },
+                sender_waits_for_space: IoxAtomicBool::new(false),
+                notify_on_activation: IoxAtomicU8::new(NOTIFY_ON_ACTIVATION_DISABLED),
+                space_available: UnnamedSemaphoreHandle::new(),
+                submission_queue_high_water_mark: IoxAtomicUsize::new(0),
+                completion_queue_high_water_mark: IoxAtomicUsize::new(0),
+            }
+        }
+
+        fn space_available(&self) -> UnnamedSemaphore<'_> {
+            unsafe { UnnamedSemaphore::from_ipc_handle(&self.space_available) }
+        }
+
+        /// Wakes up a sender that is blocked in [`Sender::wait_for_free_space()`]. The
+        /// semaphore is only posted when a sender announced that it is waiting. The flag is
+        /// read before it is swapped so that the receive hot path does not write the shared
+        /// cache line when no sender waits.
+        fn wake_up_waiting_sender(&self) {
+            if !self.sender_waits_for_space.load(Ordering::Relaxed) {
+                return;
+            }
+
+            if self.sender_waits_for_space.swap(false, Ordering::SeqCst) {
+                if let Err(e) = self.space_available().post() {
+                    warn!(from self,
+                        "Unable to wake up the waiting sender ({:?}). The sender will recover when its timeout is hit.", e);
+                }
+            }
+        }
+
+        // Every queue has a single producer, therefore the high water mark is only written
+        // when it grows instead of with a read-modify-write on every push.
+        fn update_submission_queue_high_water_mark(&self) {
+            let len = self.submission_queue.len();
+            if self
+                .submission_queue_high_water_mark
+                .load(Ordering::Relaxed)
+                < len
+            {
+                self.submission_queue_high_water_mark
+                    .store(len, Ordering::Relaxed);
+            }
+        }
+
+        fn update_completion_queue_high_water_mark(&self) {
+            let len = self.completion_queue.len();
+            if self
+                .completion_queue_high_water_mark
+                .load(Ordering::Relaxed)
+                < len
+            {
+                self.completion_queue_high_water_mark
+                    .store(len, Ordering::Relaxed);
+            }
+        }
+
+        fn fill_level(&self) -> ChannelFillLevel {
+            ChannelFillLevel {
+                submission_queue: QueueFillLevel {
+                    len: self.submission_queue.len(),
+                    capacity: self.submission_queue.capacity(),
+                    high_water_mark: self
+                        .submission_queue_high_water_mark
+                        .load(Ordering::Relaxed),
+                },
+                completion_queue: QueueFillLevel {
+                    len: self.completion_queue.len(),
+                    capacity: self.completion_queue.capacity(),
+                    high_water_mark: self
+                        .completion_queue_high_water_mark
+                        .load(Ordering::Relaxed),
+                },
             }
         }
 
@@ -187,6 +278,11 @@ pub mod details {
                         "{} since the submission queue allocation failed. - This is an implementation bug!", msg);
             fatal_panic!(from self, when unsafe { self.completion_queue.init(allocator) },
                         "{} since the completion queue allocation failed. - This is an implementation bug!", msg);
+            fatal_panic!(from self, when UnnamedSemaphoreBuilder::new()
+                            .is_interprocess_capable(true)
+                            .initial_value(0)
+                            .create(&self.space_available),
+                        "{} since the semaphore to signal free space could not be created.", msg);
         }
     }
 
@@ -362,6 +458,7 @@ pub mod details {
         number_of_segments: u8,
         number_of_channels: usize,
         timeout: Duration,
+        memory_residency: MemoryResidency,
         config: Configuration<Storage>,
     }
 
@@ -434,6 +531,12 @@ pub mod details {
                 }
             };
 
+            if let Err(e) = storage.apply_memory_residency(self.memory_residency) {
+                fail!(from self, with ZeroCopyCreationError::InternalError,
+                    "{} since the memory residency {:?} could not be applied ({:?}).",
+                    msg, self.memory_residency, e);
+            }
+
             storage.get().reserve_port(port_to_register.value(), msg)?;
 
             if storage.has_ownership() {
@@ -507,6 +610,7 @@ pub mod details {
                 number_of_channels: DEFAULT_NUMBER_OF_CHANNELS,
                 config: Configuration::default(),
                 timeout: Duration::ZERO,
+                memory_residency: MemoryResidency::OnDemand,
             }
         }
 
@@ -534,6 +638,11 @@ pub mod details {
             self
         }
 
+        fn memory_residency(mut self, value: MemoryResidency) -> Self {
+            self.memory_residency = value;
+            self
+        }
+
         fn enable_safe_overflow(mut self, value: bool) -> Self {
             self.enable_safe_overflow = value;
             self
@@ -602,6 +711,74 @@ pub mod details {
         }
     }
 
+    impl<Storage: DynamicStorage<SharedManagementData>> Sender<Storage> {
+        /// Blocks until the submission queue of the channel has space again, the receiver
+        /// disconnected or the optional timeout has passed. Instead of polling the queue, the
+        /// sender announces that it waits and sleeps on the channels semaphore which is
+        /// posted by the receiver as soon as it has consumed a sample.
+        fn wait_for_free_space(&self, channel_id: ChannelId, timeout: Option<Duration>) {
+            let msg = "Unable to wait for free space in the receive buffer";
+            let storage = self.storage.get();
+            let channel = &storage.channels[channel_id.value()];
+            let has_space = || !channel.submission_queue.is_full() || !storage.is_connected();
+            let start = Time::now();
+
+            loop {
+                if has_space() {
+                    return;
+                }
+
+                let remaining_time = match timeout {
+                    None => None,
+                    Some(timeout) => {
+                        let elapsed = match start {
+                            Ok(ref start) => start.elapsed().unwrap_or(timeout),
+                            Err(_) => timeout,
+                        };
+
+                        if elapsed >= timeout {
+                            channel
+                                .sender_waits_for_space
+                                .store(false, Ordering::SeqCst);
+                            return;
+                        }
+
+                        Some(timeout - elapsed)
+                    }
+                };
+
+                channel.sender_waits_for_space.store(true, Ordering::SeqCst);
+                // the receiver may have consumed a sample before it was able to see the flag
+                if has_space() {
+                    channel
+                        .sender_waits_for_space
+                        .store(false, Ordering::SeqCst);
+                    return;
+                }
+
+                match remaining_time {
+                    None => match channel.space_available().blocking_wait() {
+                        Ok(()) | Err(SemaphoreWaitError::Interrupt) => (),
+                        Err(e) => {
+                            warn!(from self, "{} since the semaphore wait failed ({:?}). Retrying.", msg, e);
+                        }
+                    },
+                    Some(remaining_time) => {
+                        match channel.space_available().timed_wait(remaining_time) {
+                            Ok(_)
+                            | Err(SemaphoreTimedWaitError::SemaphoreWaitError(
+                                SemaphoreWaitError::Interrupt,
+                            )) => (),
+                            Err(e) => {
+                                warn!(from self, "{} since the semaphore wait failed ({:?}). Retrying.", msg, e);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     impl<Storage: DynamicStorage<SharedManagementData>> NamedConcept for Sender<Storage> {
         fn name(&self) -> &FileName {
             &self.name
@@ -664,11 +841,11 @@ pub mod details {
             let did_not_send_same_offset_twice = segment_details.used_chunk_list.insert(index);
             debug_assert!(did_not_send_same_offset_twice);
 
-            match unsafe {
-                storage.channels[channel_id.value()]
-                    .submission_queue
-                    .push(ptr.as_value())
-            } {
+            let channel = &storage.channels[channel_id.value()];
+            let overflow = unsafe { channel.submission_queue.push(ptr.as_value()) };
+            channel.update_submission_queue_high_water_mark();
+
+            match overflow {
                 Some(v) => {
                     let pointer_offset = PointerOffset::from_value(v);
                     let segment_id = pointer_offset.segment_id().value() as usize;
@@ -703,15 +880,23 @@ pub mod details {
             debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
 
             if !self.storage.get().enable_safe_overflow {
-                AdaptiveWaitBuilder::new()
-                    .create()
-                    .unwrap()
-                    .wait_while(|| {
-                        self.storage.get().channels[channel_id.value()]
-                            .submission_queue
-                            .is_full()
-                    })
-                    .unwrap();
+                self.wait_for_free_space(channel_id, None);
+            }
+
+            self.try_send(ptr, sample_size, channel_id)
+        }
+
+        fn timed_send(
+            &self,
+            ptr: PointerOffset,
+            sample_size: usize,
+            channel_id: ChannelId,
+            timeout: Duration,
+        ) -> Result<Option<PointerOffset>, ZeroCopySendError> {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+
+            if !self.storage.get().enable_safe_overflow {
+                self.wait_for_free_space(channel_id, Some(timeout));
             }
 
             self.try_send(ptr, sample_size, channel_id)
@@ -760,6 +945,37 @@ pub mod details {
             }
         }
 
+        fn number_of_pending_samples(&self, channel_id: ChannelId) -> usize {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+            self.storage.get().channels[channel_id.value()]
+                .submission_queue
+                .len()
+        }
+
+        fn is_receiver_activated_by_last_send(&self, channel_id: ChannelId) -> bool {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+            let channel = &self.storage.get().channels[channel_id.value()];
+
+            // pairs with the fence of the receiver on an empty receive: either the sender
+            // sees the drained buffer or the receiver sees the new sample
+            fence(Ordering::SeqCst);
+            match channel.notify_on_activation.load(Ordering::Acquire) {
+                NOTIFY_ON_ACTIVATION_ACKNOWLEDGED => channel.submission_queue.len() == 1,
+                NOTIFY_ON_ACTIVATION_DISABLED => {
+                    channel
+                        .notify_on_activation
+                        .store(NOTIFY_ON_ACTIVATION_REQUESTED, Ordering::Relaxed);
+                    true
+                }
+                _ => true,
+            }
+        }
+
+        fn fill_level(&self, channel_id: ChannelId) -> ChannelFillLevel {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+            self.storage.get().channels[channel_id.value()].fill_level()
+        }
+
         unsafe fn acquire_used_offsets<F: FnMut(PointerOffset)>(&self, mut callback: F) {
             for (n, segment_details) in self.storage.get().segment_details.iter().enumerate() {
                 segment_details.used_chunk_list.remove_all(|index| {
@@ -782,6 +998,11 @@ pub mod details {
     impl<Storage: DynamicStorage<SharedManagementData>> Drop for Receiver<Storage> {
         fn drop(&mut self) {
             cleanup_shared_memory(&self.storage, State::Receiver);
+            // a blocked sender must recognize that the receiver is gone, the underlying memory
+            // stays mapped until the storage itself goes out of scope
+            for channel in self.storage.get().channels.iter() {
+                channel.wake_up_waiting_sender();
+            }
         }
     }
 
@@ -844,19 +1065,42 @@ pub mod details {
                     self.borrow_counter(channel_id), self.max_borrowed_samples());
             }
 
-            match unsafe {
-                self.storage.get().channels[channel_id.value()]
-                    .submission_queue
-                    .pop()
-            } {
+            let channel = &self.storage.get().channels[channel_id.value()];
+            let mut value = unsafe { channel.submission_queue.pop() };
+            if value.is_none() {
+                match channel.notify_on_activation.load(Ordering::Relaxed) {
+                    NOTIFY_ON_ACTIVATION_DISABLED => (),
+                    notify_on_activation => {
+                        if notify_on_activation == NOTIFY_ON_ACTIVATION_REQUESTED {
+                            channel
+                                .notify_on_activation
+                                .store(NOTIFY_ON_ACTIVATION_ACKNOWLEDGED, Ordering::Release);
+                        }
+                        // pairs with the fence in
+                        // `ZeroCopySender::is_receiver_activated_by_last_send()`
+                        fence(Ordering::SeqCst);
+                        value = unsafe { channel.submission_queue.pop() };
+                    }
+                }
+            }
+
+            match value {
                 None => Ok(None),
                 Some(v) => {
                     *self.borrow_counter(channel_id) += 1;
+                    self.storage.get().channels[channel_id.value()].wake_up_waiting_sender();
                     Ok(Some(PointerOffset::from_value(v)))
                 }
             }
         }
 
+        fn peek(&self, channel_id: ChannelId) -> Option<PointerOffset> {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+
+            let channel = &self.storage.get().channels[channel_id.value()];
+            unsafe { channel.submission_queue.peek() }.map(PointerOffset::from_value)
+        }
+
         fn release(
             &self,
             ptr: PointerOffset,
@@ -864,12 +1108,10 @@ pub mod details {
         ) -> Result<(), ZeroCopyReleaseError> {
             debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
 
-            match unsafe {
-                self.storage.get().channels[channel_id.value()]
-                    .completion_queue
-                    .push(ptr.as_value())
-            } {
+            let channel = &self.storage.get().channels[channel_id.value()];
+            match unsafe { channel.completion_queue.push(ptr.as_value()) } {
                 true => {
+                    channel.update_completion_queue_high_water_mark();
                     *self.borrow_counter(channel_id) -= 1;
                     Ok(())
                 }
@@ -982,6 +1224,22 @@ pub mod details {
             Ok(())
         }
 
+        fn fill_level(
+            name: &FileName,
+            config: &Self::Configuration,
+            channel_id: ChannelId,
+        ) -> Result<ChannelFillLevel, ZeroCopyFillLevelError> {
+            let msg = "Unable to acquire the fill level of the Zero Copy Connection";
+            let storage = Self::open_storage(name, config, msg)?;
+            let channels = &storage.get().channels;
+            if channels.capacity() <= channel_id.value() {
+                fail!(from "Connection::fill_level()", with ZeroCopyFillLevelError::ChannelDoesNotExist,
+                    "{msg} since the channel {:?} does not exist.", channel_id);
+            }
+
+            Ok(channels[channel_id.value()].fill_level())
+        }
+
         fn does_support_safe_overflow() -> bool {
             true
         }
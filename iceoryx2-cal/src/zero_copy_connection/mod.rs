@@ -18,7 +18,7 @@ pub mod used_chunk_list;
 use core::fmt::Debug;
 use core::time::Duration;
 
-pub use crate::shared_memory::PointerOffset;
+pub use crate::shared_memory::{MemoryResidency, PointerOffset};
 use crate::static_storage::file::{NamedConcept, NamedConceptBuilder, NamedConceptMgmt};
 pub use iceoryx2_bb_system_types::file_name::*;
 pub use iceoryx2_bb_system_types::path::Path;
@@ -31,6 +31,37 @@ pub enum ZeroCopyPortRemoveError {
     DoesNotExist,
 }
 
+/// Failures of [`ZeroCopyConnection::fill_level()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum ZeroCopyFillLevelError {
+    InternalError,
+    VersionMismatch,
+    InsufficientPermissions,
+    DoesNotExist,
+    ChannelDoesNotExist,
+}
+
+impl From<ZeroCopyPortRemoveError> for ZeroCopyFillLevelError {
+    fn from(value: ZeroCopyPortRemoveError) -> Self {
+        match value {
+            ZeroCopyPortRemoveError::InternalError => ZeroCopyFillLevelError::InternalError,
+            ZeroCopyPortRemoveError::VersionMismatch => ZeroCopyFillLevelError::VersionMismatch,
+            ZeroCopyPortRemoveError::InsufficientPermissions => {
+                ZeroCopyFillLevelError::InsufficientPermissions
+            }
+            ZeroCopyPortRemoveError::DoesNotExist => ZeroCopyFillLevelError::DoesNotExist,
+        }
+    }
+}
+
+impl core::fmt::Display for ZeroCopyFillLevelError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        std::write!(f, "{}::{:?}", std::stringify!(Self), self)
+    }
+}
+
+impl core::error::Error for ZeroCopyFillLevelError {}
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum ZeroCopyCreationError {
     InternalError,
@@ -124,6 +155,26 @@ impl ChannelId {
     }
 }
 
+/// The fill level of a queue of a [`ZeroCopyConnection`] channel.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct QueueFillLevel {
+    /// The number of elements that are currently stored in the queue.
+    pub len: usize,
+    /// The maximum number of elements the queue can store.
+    pub capacity: usize,
+    /// The highest number of elements the queue stored since the connection was created.
+    pub high_water_mark: usize,
+}
+
+/// The fill levels of the queues of a [`ZeroCopyConnection`] channel. The submission queue
+/// contains the samples the receiver did not yet receive, the completion queue the samples
+/// the receiver released but the sender did not yet reclaim.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct ChannelFillLevel {
+    pub submission_queue: QueueFillLevel,
+    pub completion_queue: QueueFillLevel,
+}
+
 pub const DEFAULT_BUFFER_SIZE: usize = 4;
 pub const DEFAULT_ENABLE_SAFE_OVERFLOW: bool = false;
 pub const DEFAULT_MAX_BORROWED_SAMPLES_PER_CHANNEL: usize = 4;
@@ -144,6 +195,9 @@ pub trait ZeroCopyConnectionBuilder<C: ZeroCopyConnection>: NamedConceptBuilder<
     /// [`ZeroCopyConnectionBuilder::create_receiver()`] call to finalize its initialization.
     /// By default it is set to [`Duration::ZERO`] for no timeout.
     fn timeout(self, value: Duration) -> Self;
+    /// Defines the [`MemoryResidency`] of the management data of the connection. It is applied
+    /// when the sender or receiver is created.
+    fn memory_residency(self, value: MemoryResidency) -> Self;
 
     fn create_sender(self) -> Result<C::Sender, ZeroCopyCreationError>;
     fn create_receiver(self) -> Result<C::Receiver, ZeroCopyCreationError>;
@@ -172,15 +226,44 @@ pub trait ZeroCopySender: Debug + ZeroCopyPortDetails + NamedConcept {
         channel_id: ChannelId,
     ) -> Result<Option<PointerOffset>, ZeroCopySendError>;
 
+    /// Like [`ZeroCopySender::blocking_send()`] but waits at most for the provided timeout
+    /// until the receive buffer has space again. When the buffer is still full after the
+    /// timeout has passed, [`ZeroCopySendError::ReceiveBufferFull`] is returned.
+    fn timed_send(
+        &self,
+        ptr: PointerOffset,
+        sample_size: usize,
+        channel_id: ChannelId,
+        timeout: Duration,
+    ) -> Result<Option<PointerOffset>, ZeroCopySendError>;
+
     fn reclaim(&self, channel_id: ChannelId)
         -> Result<Option<PointerOffset>, ZeroCopyReclaimError>;
 
+    /// Returns the number of samples in the receive buffer of the channel that were not yet
+    /// received. The information can be out-of-date as soon as it is acquired since the
+    /// receiver may consume samples concurrently.
+    fn number_of_pending_samples(&self, channel_id: ChannelId) -> usize;
+
+    /// Must be called after a successful send. Returns true when the receive buffer of the
+    /// channel was empty before the send, so that a receiver that waits for data must be
+    /// notified. The first call requests that the receiver re-checks an empty buffer after a
+    /// memory fence; until the receiver has acknowledged this, the call always returns
+    /// true. Receivers of channels whose sender never calls this method do not pay for
+    /// the fence.
+    fn is_receiver_activated_by_last_send(&self, channel_id: ChannelId) -> bool;
+
+    /// Returns the [`ChannelFillLevel`] of the channel. Like
+    /// [`ZeroCopySender::number_of_pending_samples()`] the information can be out-of-date as
+    /// soon as it is acquired.
+    fn fill_level(&self, channel_id: ChannelId) -> ChannelFillLevel;
+
     /// # Safety
     ///
     /// * must ensure that no receiver is still holding data, otherwise data races may occur on
     ///   receiver side
-    /// * must ensure that [`ZeroCopySender::try_send()`] and [`ZeroCopySender::blocking_send()`]
-    ///   are not called after using this method
+    /// * must ensure that [`ZeroCopySender::try_send()`], [`ZeroCopySender::blocking_send()`]
+    ///   and [`ZeroCopySender::timed_send()`] are not called after using this method
     unsafe fn acquire_used_offsets<F: FnMut(PointerOffset)>(&self, callback: F);
 }
 
@@ -188,6 +271,9 @@ pub trait ZeroCopyReceiver: Debug + ZeroCopyPortDetails + NamedConcept {
     fn has_data(&self, channel_id: ChannelId) -> bool;
     fn receive(&self, channel_id: ChannelId)
         -> Result<Option<PointerOffset>, ZeroCopyReceiveError>;
+    /// Returns the [`PointerOffset`] that the next [`ZeroCopyReceiver::receive()`] would
+    /// acquire without removing it from the channel. Returns [`None`] when the channel is empty.
+    fn peek(&self, channel_id: ChannelId) -> Option<PointerOffset>;
     fn release(
         &self,
         ptr: PointerOffset,
@@ -224,6 +310,15 @@ pub trait ZeroCopyConnection: Debug + Sized + NamedConceptMgmt {
         config: &Self::Configuration,
     ) -> Result<(), ZeroCopyPortRemoveError>;
 
+    /// Returns the [`ChannelFillLevel`] of the channel of an existing [`ZeroCopyConnection`]
+    /// without connecting to it as [`ZeroCopySender`] or [`ZeroCopyReceiver`]. Intended for
+    /// introspection tools that observe the connections of other processes.
+    fn fill_level(
+        name: &FileName,
+        config: &Self::Configuration,
+        channel_id: ChannelId,
+    ) -> Result<ChannelFillLevel, ZeroCopyFillLevelError>;
+
     /// Returns true if the connection supports safe overflow
     fn does_support_safe_overflow() -> bool {
         false
@@ -0,0 +1,176 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(target_os = "linux")]
+mod event_futex_bitset_posix_shared_memory {
+    use core::time::Duration;
+    use iceoryx2_bb_container::semantic_string::SemanticString;
+    use iceoryx2_bb_posix::unix_datagram_socket::UnixDatagramSenderBuilder;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_cal::event::futex_bitset_posix_shared_memory::{
+        EventImpl, ListenerBuilder, NotifierBuilder,
+    };
+    use iceoryx2_cal::event::{
+        Listener as _, ListenerBuilder as _, Notifier as _, NotifierBuilder as _, TriggerId,
+    };
+    use iceoryx2_cal::named_concept::*;
+    use iceoryx2_cal::reactor::{Reactor as _, ReactorBuilder as _};
+    use iceoryx2_cal::testing::*;
+
+    type Sut = EventImpl;
+    type SutReactor = iceoryx2_cal::reactor::epoll::Reactor;
+
+    const TIMEOUT: Duration = Duration::from_millis(10);
+
+    fn number_of_reactor_wakeups(reactor: &SutReactor) -> usize {
+        let mut counter = 0;
+        reactor.timed_wait(|_| counter += 1, TIMEOUT).unwrap();
+        counter
+    }
+
+    #[test]
+    fn listener_becomes_readable_on_notify() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = ListenerBuilder::new(&name)
+            .config(&config)
+            .create()
+            .unwrap();
+        let sut_notifier = NotifierBuilder::new(&name).config(&config).open().unwrap();
+
+        let reactor = <SutReactor as iceoryx2_cal::reactor::Reactor>::Builder::new()
+            .create()
+            .unwrap();
+        let _guard = reactor.attach(&sut_listener).unwrap();
+
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 0);
+        sut_notifier.notify(TriggerId::new(7)).unwrap();
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 1);
+
+        let mut ids = vec![];
+        sut_listener.try_wait_all(|id| ids.push(id)).unwrap();
+        assert_that!(ids, eq vec![TriggerId::new(7)]);
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 0);
+    }
+
+    #[test]
+    fn listener_stays_readable_until_all_notifications_are_collected() {
+        const NUMBER_OF_NOTIFICATIONS: usize = 4;
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = ListenerBuilder::new(&name)
+            .config(&config)
+            .create()
+            .unwrap();
+        let sut_notifier = NotifierBuilder::new(&name).config(&config).open().unwrap();
+
+        let reactor = <SutReactor as iceoryx2_cal::reactor::Reactor>::Builder::new()
+            .create()
+            .unwrap();
+        let _guard = reactor.attach(&sut_listener).unwrap();
+
+        for i in 0..NUMBER_OF_NOTIFICATIONS {
+            sut_notifier.notify(TriggerId::new(i)).unwrap();
+        }
+
+        for _ in 0..NUMBER_OF_NOTIFICATIONS {
+            assert_that!(number_of_reactor_wakeups(&reactor), eq 1);
+            assert_that!(sut_listener.try_wait_one().unwrap(), is_some);
+        }
+
+        assert_that!(sut_listener.try_wait_one().unwrap(), is_none);
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 0);
+
+        sut_notifier.notify(TriggerId::new(0)).unwrap();
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 1);
+    }
+
+    #[test]
+    fn late_bridge_datagram_of_collected_notification_is_drained_on_rearm() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = ListenerBuilder::new(&name)
+            .config(&config)
+            .create()
+            .unwrap();
+        let sut_notifier = NotifierBuilder::new(&name).config(&config).open().unwrap();
+
+        let mut bridge_path = config.path_for(&name);
+        bridge_path.push_bytes(b".bridge").unwrap();
+        let late_notifier = UnixDatagramSenderBuilder::new(&bridge_path)
+            .create()
+            .unwrap();
+
+        let reactor = <SutReactor as iceoryx2_cal::reactor::Reactor>::Builder::new()
+            .create()
+            .unwrap();
+        let _guard = reactor.attach(&sut_listener).unwrap();
+
+        // a notifier disarms the bridge, the listener collects the notification and re-arms
+        // the bridge before the notifier sends its datagram
+        sut_notifier.notify(TriggerId::new(5)).unwrap();
+        let mut ids = vec![];
+        sut_listener.try_wait_all(|id| ids.push(id)).unwrap();
+        assert_that!(ids, eq vec![TriggerId::new(5)]);
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 0);
+
+        assert_that!(late_notifier.try_send(&[0u8]), eq Ok(true));
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 1);
+
+        // the armed listener has nothing to collect but must empty the bridge anyway
+        ids.clear();
+        sut_listener.try_wait_all(|id| ids.push(id)).unwrap();
+        assert_that!(ids, is_empty);
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 0);
+
+        sut_notifier.notify(TriggerId::new(6)).unwrap();
+        assert_that!(number_of_reactor_wakeups(&reactor), eq 1);
+        assert_that!(sut_listener.try_wait_one().unwrap(), eq Some(TriggerId::new(6)));
+    }
+
+    #[test]
+    fn listener_without_file_descriptor_bridge_receives_notifications() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = ListenerBuilder::new(&name)
+            .file_descriptor_bridge(false)
+            .config(&config)
+            .create()
+            .unwrap();
+        let sut_notifier = NotifierBuilder::new(&name).config(&config).open().unwrap();
+
+        sut_notifier.notify(TriggerId::new(3)).unwrap();
+        assert_that!(sut_listener.timed_wait_one(TIMEOUT).unwrap(), eq Some(TriggerId::new(3)));
+        assert_that!(sut_listener.try_wait_one().unwrap(), is_none);
+    }
+
+    #[test]
+    fn listener_can_be_recreated_after_stale_event_was_removed() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = ListenerBuilder::new(&name)
+            .config(&config)
+            .create()
+            .unwrap();
+        core::mem::forget(sut_listener);
+
+        assert_that!(unsafe { <Sut as NamedConceptMgmt>::remove_cfg(&name, &config) }, eq Ok(true));
+
+        let sut_listener = ListenerBuilder::new(&name).config(&config).create();
+        assert_that!(sut_listener, is_ok);
+    }
+}
@@ -747,4 +747,8 @@ mod event {
     #[cfg(not(any(target_os = "macos", target_os = "windows")))]
     #[instantiate_tests(<iceoryx2_cal::event::sem_bitset_posix_shared_memory::Event>)]
     mod sem_bitset_posix_shared_memory {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2_cal::event::futex_bitset_posix_shared_memory::EventImpl>)]
+    mod futex_bitset_posix_shared_memory {}
 }
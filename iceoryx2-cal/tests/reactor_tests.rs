@@ -100,6 +100,43 @@ mod reactor {
         assert_that!(result.err(), eq Some(ReactorAttachError::AlreadyAttached));
     }
 
+    #[test]
+    fn suspended_attachment_does_not_wake_up_until_it_is_resumed<Sut: Reactor>() {
+        let sut = <<Sut as Reactor>::Builder>::new().create().unwrap();
+
+        let attachment = NotifierListenerPair::new();
+        let _guard = sut.attach(&attachment.listener).unwrap();
+        assert_that!(sut.suspend(attachment.listener.file_descriptor()), is_ok);
+        assert_that!(sut.len(), eq 1);
+
+        attachment.notifier.notify(TriggerId::new(123)).unwrap();
+
+        let mut triggered_fds = vec![];
+        assert_that!(
+            sut.timed_wait(|fd| triggered_fds.push(unsafe { fd.native_handle() }), TIMEOUT),
+            eq Ok(0)
+        );
+        assert_that!(triggered_fds, len 0);
+
+        assert_that!(sut.resume(attachment.listener.file_descriptor()), is_ok);
+        assert_that!(
+            sut.timed_wait(|fd| triggered_fds.push(unsafe { fd.native_handle() }), TIMEOUT),
+            eq Ok(1)
+        );
+        assert_that!(triggered_fds, len 1);
+        assert_that!(triggered_fds[0], eq unsafe { attachment.listener.file_descriptor().native_handle() });
+    }
+
+    #[test]
+    fn suspend_of_not_attached_attachment_fails<Sut: Reactor>() {
+        let sut = <<Sut as Reactor>::Builder>::new().create().unwrap();
+
+        let attachment = NotifierListenerPair::new();
+        let result = sut.suspend(attachment.listener.file_descriptor());
+
+        assert_that!(result.err(), eq Some(ReactorModifyError::NotAttached));
+    }
+
     #[test]
     fn try_wait_does_not_block_when_triggered_single<Sut: Reactor>() {
         let sut = <<Sut as Reactor>::Builder>::new().create().unwrap();
@@ -573,4 +610,12 @@ mod reactor {
 
     #[instantiate_tests(<iceoryx2_cal::reactor::posix_select::Reactor>)]
     mod posix_select {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2_cal::reactor::epoll::Reactor>)]
+    mod epoll {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2_cal::reactor::io_uring::Reactor>)]
+    mod io_uring {}
 }
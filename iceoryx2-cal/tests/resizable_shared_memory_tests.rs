@@ -860,6 +860,45 @@ mod resizable_shared_memory {
         assert_that!(unsafe { *(tr_chunk_4 as *mut u64) }, eq value_4);
     }
 
+    #[test]
+    fn translate_offset_in_view_does_not_map_segments<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let config = generate_isolated_config::<Sut>();
+        let storage_name = generate_name();
+        let value = 456789012345;
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::BestFit)
+            .create()
+            .unwrap();
+
+        let _chunk_1 = sut.allocate(Layout::new::<u8>()).unwrap();
+        let chunk_2 = sut.allocate(Layout::new::<u64>()).unwrap();
+        unsafe { (chunk_2.data_ptr as *mut u64).write(value) };
+
+        let sut_viewer = Sut::ViewBuilder::new(&storage_name)
+            .config(&config)
+            .open()
+            .unwrap();
+
+        let number_of_active_segments = sut_viewer.number_of_active_segments();
+        assert_that!(sut_viewer.translate_offset(chunk_2.offset), is_none);
+        assert_that!(sut_viewer.number_of_active_segments(), eq number_of_active_segments);
+
+        let tr_chunk_2 = unsafe {
+            sut_viewer
+                .register_and_translate_offset(chunk_2.offset)
+                .unwrap()
+        };
+        assert_that!(sut_viewer.translate_offset(chunk_2.offset), eq Some(tr_chunk_2));
+        assert_that!(unsafe { *(tr_chunk_2 as *mut u64) }, eq value);
+    }
+
     #[test]
     fn unregister_offset_in_view_releases_unused_segments<
         Shm: SharedMemory<DefaultAllocator>,
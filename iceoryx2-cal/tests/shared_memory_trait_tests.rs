@@ -73,6 +73,38 @@ mod shared_memory {
         assert_that!(sut_open.size(), ge DEFAULT_SIZE);
     }
 
+    #[test]
+    fn huge_pages_are_used_or_reported_as_unavailable<Sut: SharedMemory<DefaultAllocator>>() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut = Sut::Builder::new(&name)
+            .size(DEFAULT_SIZE)
+            .page_size(PageSize::Huge2MiB)
+            .config(&config)
+            .create(&SHM_CONFIG);
+
+        match sut {
+            Ok(sut) => {
+                assert_that!(sut.size(), ge DEFAULT_SIZE);
+
+                let sut_open = Sut::Builder::new(&name)
+                    .page_size(PageSize::Huge2MiB)
+                    .config(&config)
+                    .open();
+                assert_that!(sut_open, is_ok);
+                drop(sut_open);
+
+                sut.release_ownership();
+                assert_that!(unsafe { Sut::remove_with_page_size_cfg(&name, &config, PageSize::Huge2MiB) }, eq Ok(true));
+            }
+            Err(e) => {
+                assert_that!(e, eq SharedMemoryCreateError::HugePagesUnavailable);
+                assert_that!(<Sut as NamedConceptMgmt>::does_exist_cfg(&name, &config), eq Ok(false));
+            }
+        }
+    }
+
     #[test]
     fn create_after_drop_works<Sut: SharedMemory<DefaultAllocator>>() {
         let name = generate_name();
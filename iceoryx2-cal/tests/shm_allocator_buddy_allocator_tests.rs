@@ -0,0 +1,232 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+mod shm_allocator_buddy_allocator {
+    use core::{alloc::Layout, ptr::NonNull};
+    use std::collections::HashSet;
+
+    use iceoryx2_bb_elementary::allocator::AllocationError;
+    use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_cal::{
+        shm_allocator::{buddy_allocator::*, AllocationStrategy, ShmAllocationError, ShmAllocator},
+        zero_copy_connection::PointerOffset,
+    };
+
+    const MAX_SUPPORTED_ALIGNMENT: usize = 4096;
+    const MIN_BLOCK_CONFIG: Layout = unsafe { Layout::from_size_align_unchecked(32, 4) };
+    const MEM_SIZE: usize = 16384 * 10;
+    const PAYLOAD_SIZE: usize = 8192;
+
+    struct TestContext {
+        _payload_memory: Box<[u8; MEM_SIZE]>,
+        _base_address: NonNull<[u8]>,
+        sut: Box<BuddyAllocator>,
+    }
+
+    impl TestContext {
+        fn new(min_block_layout: Layout) -> Self {
+            Self::new_with_payload_size(min_block_layout, PAYLOAD_SIZE)
+        }
+
+        fn new_with_payload_size(min_block_layout: Layout, payload_size: usize) -> Self {
+            let mut payload_memory = Box::new([0u8; MEM_SIZE]);
+            let base_address =
+                unsafe { NonNull::<[u8]>::new_unchecked(&mut payload_memory[0..payload_size]) };
+            let allocator = BumpAllocator::new(
+                unsafe { NonNull::new_unchecked(payload_memory[PAYLOAD_SIZE..].as_mut_ptr()) },
+                MEM_SIZE,
+            );
+            let config = &Config { min_block_layout };
+            let mut sut = Box::new(unsafe {
+                BuddyAllocator::new_uninit(MAX_SUPPORTED_ALIGNMENT, base_address, config)
+            });
+
+            unsafe { sut.init(&allocator).unwrap() };
+
+            Self {
+                _payload_memory: payload_memory,
+                _base_address: base_address,
+                sut,
+            }
+        }
+    }
+
+    fn layout(size: usize) -> Layout {
+        Layout::from_size_align(size, MIN_BLOCK_CONFIG.align()).unwrap()
+    }
+
+    #[test]
+    fn is_setup_correctly() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        assert_that!(test_context.sut.min_block_size(), eq MIN_BLOCK_CONFIG.size());
+        assert_that!(test_context.sut.number_of_min_blocks(), eq PAYLOAD_SIZE / MIN_BLOCK_CONFIG.size());
+        assert_that!(test_context.sut.max_free_block_size(), eq PAYLOAD_SIZE);
+        assert_that!(test_context.sut.max_alignment(), eq MIN_BLOCK_CONFIG.align());
+        assert_that!(test_context.sut.relative_start_address(), eq 0);
+    }
+
+    #[test]
+    fn min_block_size_is_rounded_up_to_power_of_two() {
+        let test_context = TestContext::new(Layout::from_size_align(48, 8).unwrap());
+
+        assert_that!(test_context.sut.min_block_size(), eq 64);
+        assert_that!(test_context.sut.number_of_min_blocks(), eq PAYLOAD_SIZE / 64);
+    }
+
+    #[test]
+    fn initial_setup_hint_provides_size_classes_up_to_max_chunk_size() {
+        let max_chunk_layout = Layout::from_size_align(1000, 8).unwrap();
+        let max_number_of_chunks = 12;
+        let hint = BuddyAllocator::initial_setup_hint(max_chunk_layout, max_number_of_chunks);
+
+        assert_that!(hint.payload_size, eq 1024 * max_number_of_chunks);
+        assert_that!(hint.config.min_block_layout.size(), eq 1024 >> (NUMBER_OF_SIZE_CLASSES - 1));
+        assert_that!(hint.config.min_block_layout.align(), eq max_chunk_layout.align());
+    }
+
+    #[test]
+    fn allocation_is_rounded_up_to_next_power_of_two_of_min_blocks() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        let memory_1 = unsafe { test_context.sut.allocate(layout(33)).unwrap() };
+        let memory_2 = unsafe { test_context.sut.allocate(layout(1)).unwrap() };
+        let memory_3 = unsafe { test_context.sut.allocate(layout(100)).unwrap() };
+
+        assert_that!(memory_1.offset(), eq 0);
+        assert_that!(memory_2.offset(), eq 64);
+        assert_that!(memory_3.offset(), eq 128);
+        assert_that!(test_context.sut.max_free_block_size(), eq PAYLOAD_SIZE / 2);
+    }
+
+    #[test]
+    fn allocate_and_release_all_min_blocks_works() {
+        const REPETITIONS: usize = 10;
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        for _ in 0..REPETITIONS {
+            let mut mem_set = HashSet::new();
+            for _ in 0..test_context.sut.number_of_min_blocks() {
+                let memory = unsafe { test_context.sut.allocate(MIN_BLOCK_CONFIG).unwrap() };
+                // the returned offset must be a multiple of the min block size
+                assert_that!(memory.offset() % MIN_BLOCK_CONFIG.size(), eq 0);
+                assert_that!(mem_set.insert(memory.offset()), eq true);
+            }
+
+            assert_that!(unsafe { test_context.sut.allocate(MIN_BLOCK_CONFIG) }, eq Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
+
+            for memory in mem_set {
+                unsafe {
+                    test_context
+                        .sut
+                        .deallocate(PointerOffset::new(memory), MIN_BLOCK_CONFIG)
+                }
+            }
+
+            // all buddies are merged again
+            assert_that!(test_context.sut.max_free_block_size(), eq PAYLOAD_SIZE);
+        }
+    }
+
+    #[test]
+    fn allocate_whole_memory_after_releasing_mixed_sizes_works() {
+        const REPETITIONS: usize = 10;
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        for _ in 0..REPETITIONS {
+            let mut allocations = vec![];
+            let mut size = 1;
+            while let Ok(memory) = unsafe { test_context.sut.allocate(layout(size)) } {
+                allocations.push(memory);
+                size = (size * 3) % 2000 + 1;
+            }
+
+            assert_that!(allocations.len(), ge 2);
+
+            for memory in allocations.iter().rev() {
+                unsafe { test_context.sut.deallocate(*memory, MIN_BLOCK_CONFIG) };
+            }
+
+            let memory = unsafe { test_context.sut.allocate(layout(PAYLOAD_SIZE)).unwrap() };
+            assert_that!(memory.offset(), eq 0);
+            unsafe { test_context.sut.deallocate(memory, MIN_BLOCK_CONFIG) };
+        }
+    }
+
+    #[test]
+    fn allocations_do_not_overlap() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        let mut allocations = vec![];
+        let mut size = 7;
+        while let Ok(memory) = unsafe { test_context.sut.allocate(layout(size)) } {
+            allocations.push((memory.offset(), size.next_power_of_two().max(32)));
+            size = (size * 5) % 1500 + 1;
+        }
+
+        allocations.sort();
+        for pair in allocations.windows(2) {
+            assert_that!(pair[0].0 + pair[0].1, le pair[1].0);
+        }
+    }
+
+    #[test]
+    fn non_power_of_two_number_of_min_blocks_is_fully_usable() {
+        let test_context = TestContext::new_with_payload_size(MIN_BLOCK_CONFIG, 3 * 32);
+
+        assert_that!(test_context.sut.number_of_min_blocks(), eq 3);
+        assert_that!(unsafe { test_context.sut.allocate(layout(128)) }, eq Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
+
+        let memory_1 = unsafe { test_context.sut.allocate(layout(64)).unwrap() };
+        let memory_2 = unsafe { test_context.sut.allocate(layout(32)).unwrap() };
+        assert_that!(memory_1.offset(), eq 0);
+        assert_that!(memory_2.offset(), eq 64);
+        assert_that!(unsafe { test_context.sut.allocate(layout(32)) }, eq Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
+    }
+
+    #[test]
+    fn allocate_more_than_managed_memory_fails_with_out_of_memory() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+
+        assert_that!(unsafe { test_context.sut.allocate(layout(PAYLOAD_SIZE + 1)) }, eq Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
+    }
+
+    #[test]
+    fn no_new_resize_hint_when_block_is_available() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+        let hint = test_context
+            .sut
+            .resize_hint(layout(1000), AllocationStrategy::PowerOfTwo);
+
+        assert_that!(hint.payload_size, eq PAYLOAD_SIZE);
+        assert_that!(hint.config.min_block_layout, eq MIN_BLOCK_CONFIG);
+    }
+
+    #[test]
+    fn new_resize_hint_with_power_of_two_when_block_is_unavailable() {
+        let test_context = TestContext::new(MIN_BLOCK_CONFIG);
+        let hint = test_context
+            .sut
+            .resize_hint(layout(PAYLOAD_SIZE + 1), AllocationStrategy::PowerOfTwo);
+
+        assert_that!(hint.payload_size, eq(3 * PAYLOAD_SIZE).next_power_of_two());
+        assert_that!(hint.config.min_block_layout, eq MIN_BLOCK_CONFIG);
+    }
+
+    #[test]
+    fn allocate_with_unsupported_alignment_fails() {
+        let test_context =
+            TestContext::new(Layout::from_size_align(MIN_BLOCK_CONFIG.size(), 1).unwrap());
+        assert_that!(unsafe { test_context.sut.allocate(MIN_BLOCK_CONFIG) }, eq Err(ShmAllocationError::ExceedsMaxSupportedAlignment));
+    }
+}
@@ -184,4 +184,7 @@ mod shm_allocator {
 
     #[instantiate_tests(<iceoryx2_cal::shm_allocator::bump_allocator::BumpAllocator>)]
     mod bump_allocator {}
+
+    #[instantiate_tests(<iceoryx2_cal::shm_allocator::buddy_allocator::BuddyAllocator>)]
+    mod buddy_allocator {}
 }
@@ -15,8 +15,11 @@ mod static_storage {
     use core::sync::atomic::{AtomicU64, Ordering};
     use core::time::Duration;
     use iceoryx2_bb_container::semantic_string::*;
+    use iceoryx2_bb_posix::config::test_directory;
+    use iceoryx2_bb_posix::testing::create_test_directory;
     use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
     use iceoryx2_bb_system_types::file_name::FileName;
+    use iceoryx2_bb_system_types::path::Path;
     use iceoryx2_bb_testing::assert_that;
     use iceoryx2_bb_testing::watchdog::Watchdog;
     use iceoryx2_cal::named_concept::*;
@@ -42,6 +45,13 @@ mod static_storage {
         file
     }
 
+    fn generate_path_hint() -> Path {
+        create_test_directory();
+        let mut path = test_directory();
+        path.add_path_entry(&generate_name().into()).unwrap();
+        path
+    }
+
     #[test]
     fn create_and_read_works<Sut: StaticStorage>() {
         let _test_guard = TEST_MUTEX.lock();
@@ -533,6 +543,68 @@ mod static_storage {
         assert_that!(unsafe{<Sut as NamedConceptMgmt>::remove_cfg(&storage_name, &config_2)}, eq Ok(false));
     }
 
+    #[test]
+    fn watcher_detects_creation_and_removal<Sut: StaticStorage>() {
+        let _test_guard = TEST_MUTEX.lock();
+        let path_hint = generate_path_hint();
+        let config = <Sut as NamedConceptMgmt>::Configuration::default().path_hint(&path_hint);
+
+        // the first storage creates the directory that is watched
+        let storage_guard = Sut::Builder::new(&generate_name())
+            .config(&config)
+            .create(b"")
+            .unwrap();
+        let mut sut = Sut::watch_cfg(&config).unwrap();
+
+        let other_storage_guard = Sut::Builder::new(&generate_name())
+            .config(&config)
+            .create(b"")
+            .unwrap();
+        assert_that!(sut.has_changed(), eq Ok(true));
+
+        drop(other_storage_guard);
+        assert_that!(sut.has_changed(), eq Ok(true));
+
+        drop(storage_guard);
+        assert_that!(
+            <Sut as NamedConceptMgmt>::remove_path_hint(&path_hint),
+            is_ok
+        );
+    }
+
+    // without inotify the file based watcher reports a change on every call
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn watcher_reports_no_change_when_nothing_changed<Sut: StaticStorage>() {
+        let _test_guard = TEST_MUTEX.lock();
+        let path_hint = generate_path_hint();
+        let config = <Sut as NamedConceptMgmt>::Configuration::default().path_hint(&path_hint);
+
+        let storage_guard = Sut::Builder::new(&generate_name())
+            .config(&config)
+            .create(b"")
+            .unwrap();
+        let mut sut = Sut::watch_cfg(&config).unwrap();
+        assert_that!(sut.has_changed(), eq Ok(false));
+
+        let other_storage_guard = Sut::Builder::new(&generate_name())
+            .config(&config)
+            .create(b"")
+            .unwrap();
+        assert_that!(sut.has_changed(), eq Ok(true));
+        assert_that!(sut.has_changed(), eq Ok(false));
+
+        drop(storage_guard);
+        assert_that!(sut.has_changed(), eq Ok(true));
+        assert_that!(sut.has_changed(), eq Ok(false));
+
+        drop(other_storage_guard);
+        assert_that!(
+            <Sut as NamedConceptMgmt>::remove_path_hint(&path_hint),
+            is_ok
+        );
+    }
+
     #[test]
     fn defaults_for_configuration_are_set_correctly<Sut: StaticStorage>() {
         let config = <Sut as NamedConceptMgmt>::Configuration::default();
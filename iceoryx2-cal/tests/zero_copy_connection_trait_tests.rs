@@ -386,6 +386,176 @@ mod zero_copy_connection {
         assert_that!(retrieval, is_none);
     }
 
+    #[test]
+    fn number_of_pending_samples_follows_send_and_receive<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(4)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(4)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_sender.number_of_pending_samples(id), eq 0);
+
+        for n in 0..3 {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * n), SAMPLE_SIZE, id),
+                is_ok
+            );
+            assert_that!(sut_sender.number_of_pending_samples(id), eq n + 1);
+        }
+
+        for n in 0..3 {
+            let sample = sut_receiver.receive(id).unwrap();
+            assert_that!(sample, is_some);
+            assert_that!(sut_sender.number_of_pending_samples(id), eq 2 - n);
+        }
+    }
+
+    #[test]
+    fn receiver_is_activated_only_by_send_into_empty_buffer_after_handshake<
+        Sut: ZeroCopyConnection,
+    >() {
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(4)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(4)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        // the receiver has not yet acknowledged the handshake
+        for n in 0..2 {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * n), SAMPLE_SIZE, id),
+                is_ok
+            );
+            assert_that!(sut_sender.is_receiver_activated_by_last_send(id), eq true);
+        }
+
+        for _ in 0..2 {
+            let sample = sut_receiver.receive(id).unwrap();
+            assert_that!(sample, is_some);
+            assert_that!(sut_receiver.release(sample.unwrap(), id), is_ok);
+        }
+        assert_that!(sut_receiver.receive(id).unwrap(), is_none);
+        while let Ok(Some(_)) = sut_sender.reclaim(id) {}
+
+        assert_that!(
+            sut_sender.try_send(PointerOffset::new(0), SAMPLE_SIZE, id),
+            is_ok
+        );
+        assert_that!(sut_sender.is_receiver_activated_by_last_send(id), eq true);
+        assert_that!(
+            sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE), SAMPLE_SIZE, id),
+            is_ok
+        );
+        assert_that!(sut_sender.is_receiver_activated_by_last_send(id), eq false);
+    }
+
+    #[test]
+    fn fill_level_reports_len_and_high_water_mark<Sut: ZeroCopyConnection>() {
+        const BUFFER_SIZE: usize = 4;
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(BUFFER_SIZE)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(BUFFER_SIZE)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        let fill_level = sut_sender.fill_level(id);
+        assert_that!(fill_level.submission_queue.len, eq 0);
+        assert_that!(fill_level.submission_queue.capacity, eq BUFFER_SIZE);
+        assert_that!(fill_level.submission_queue.high_water_mark, eq 0);
+        assert_that!(fill_level.completion_queue.len, eq 0);
+        assert_that!(fill_level.completion_queue.high_water_mark, eq 0);
+
+        for n in 0..3 {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * n), SAMPLE_SIZE, id),
+                is_ok
+            );
+        }
+
+        for _ in 0..2 {
+            let sample = sut_receiver.receive(id).unwrap().unwrap();
+            assert_that!(sut_receiver.release(sample, id), is_ok);
+        }
+
+        let fill_level = sut_sender.fill_level(id);
+        assert_that!(fill_level.submission_queue.len, eq 1);
+        assert_that!(fill_level.submission_queue.high_water_mark, eq 3);
+        assert_that!(fill_level.completion_queue.len, eq 2);
+        assert_that!(fill_level.completion_queue.high_water_mark, eq 2);
+
+        while sut_sender.reclaim(id).unwrap().is_some() {}
+
+        let fill_level = sut_sender.fill_level(id);
+        assert_that!(fill_level.completion_queue.len, eq 0);
+        assert_that!(fill_level.completion_queue.high_water_mark, eq 2);
+    }
+
+    #[test]
+    fn fill_level_can_be_read_without_connecting<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let result = Sut::fill_level(&name, &config, id);
+        assert_that!(result.err(), eq Some(ZeroCopyFillLevelError::DoesNotExist));
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let _sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(
+            sut_sender.try_send(PointerOffset::new(0), SAMPLE_SIZE, id),
+            is_ok
+        );
+
+        let fill_level = Sut::fill_level(&name, &config, id).unwrap();
+        assert_that!(fill_level, eq sut_sender.fill_level(id));
+        assert_that!(fill_level.submission_queue.len, eq 1);
+        let result = Sut::fill_level(&name, &config, ChannelId::new(1));
+        assert_that!(result.err(), eq Some(ZeroCopyFillLevelError::ChannelDoesNotExist));
+    }
+
     #[test]
     fn send_receive_and_retrieval_works_for_multiple_channels<Sut: ZeroCopyConnection>() {
         const NUMBER_OF_CHANNELS: usize = 7;
@@ -520,6 +690,38 @@ mod zero_copy_connection {
         assert_that!(sut_receiver.has_data(id), eq true);
     }
 
+    #[test]
+    fn peek_returns_next_offset_without_receiving_it<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_receiver.peek(id), is_none);
+
+        let first_offset = PointerOffset::new(SAMPLE_SIZE * 2);
+        let second_offset = PointerOffset::new(SAMPLE_SIZE * 3);
+        assert_that!(sut_sender.try_send(first_offset, SAMPLE_SIZE, id), is_ok);
+        assert_that!(sut_sender.try_send(second_offset, SAMPLE_SIZE, id), is_ok);
+
+        assert_that!(sut_receiver.peek(id), eq Some(first_offset));
+        assert_that!(sut_receiver.peek(id), eq Some(first_offset));
+        assert_that!(sut_receiver.receive(id).unwrap(), eq Some(first_offset));
+        assert_that!(sut_receiver.peek(id), eq Some(second_offset));
+        assert_that!(sut_receiver.receive(id).unwrap(), eq Some(second_offset));
+        assert_that!(sut_receiver.peek(id), is_none);
+    }
+
     #[test]
     fn data_can_be_received_only_via_the_same_channel<Sut: ZeroCopyConnection>() {
         const ITERATIONS: usize = 8;
@@ -814,6 +1016,99 @@ mod zero_copy_connection {
         });
     }
 
+    #[test]
+    fn timed_send_fails_after_timeout_when_buffer_stays_full<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let _watchdog = Watchdog::new();
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(1)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let _sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(1)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(
+            sut_sender.timed_send(PointerOffset::new(0), SAMPLE_SIZE, id, TIMEOUT),
+            is_ok
+        );
+
+        let now = Instant::now();
+        let result =
+            sut_sender.timed_send(PointerOffset::new(SAMPLE_SIZE), SAMPLE_SIZE, id, TIMEOUT);
+        assert_that!(now.elapsed(), time_at_least TIMEOUT);
+        assert_that!(result, is_err);
+        assert_that!(result.err().unwrap(), eq ZeroCopySendError::ReceiveBufferFull);
+    }
+
+    #[test]
+    fn timed_send_wakes_up_when_receiver_consumes_sample<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let _watchdog = Watchdog::new();
+        let name = generate_name();
+        let config = Mutex::new(generate_isolated_config::<Sut>());
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(1)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config.lock().unwrap())
+            .create_sender()
+            .unwrap();
+
+        let handle = BarrierHandle::new();
+        let barrier = BarrierBuilder::new(2).create(&handle).unwrap();
+
+        let sample_offset_1 = SAMPLE_SIZE * 12;
+        let sample_offset_2 = SAMPLE_SIZE * 234;
+
+        std::thread::scope(|s| {
+            s.spawn(|| {
+                let sut_receiver = Sut::Builder::new(&name)
+                    .buffer_size(1)
+                    .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+                    .config(&config.lock().unwrap())
+                    .create_receiver()
+                    .unwrap();
+
+                barrier.wait();
+                std::thread::sleep(TIMEOUT);
+                let sample_1 = sut_receiver.receive(id).unwrap();
+                assert_that!(sample_1, is_some);
+                assert_that!(sample_1.unwrap().offset(), eq sample_offset_1);
+                barrier.wait();
+            });
+
+            barrier.wait();
+            assert_that!(
+                sut_sender.timed_send(
+                    PointerOffset::new(sample_offset_1),
+                    SAMPLE_SIZE,
+                    id,
+                    TIMEOUT
+                ),
+                is_ok
+            );
+            assert_that!(
+                sut_sender.timed_send(
+                    PointerOffset::new(sample_offset_2),
+                    SAMPLE_SIZE,
+                    id,
+                    Duration::from_secs(3600)
+                ),
+                is_ok
+            );
+            barrier.wait();
+        });
+    }
+
     #[test]
     fn sent_samples_can_be_acquired<Sut: ZeroCopyConnection>() {
         const NUMBER_OF_CHANNELS: usize = 6;
@@ -53,6 +53,12 @@ pub struct DetailsOptions {
     #[clap(help = "Name of the service e.g. \"My Service\"")]
     pub service: String,
 
+    #[clap(
+        long,
+        help = "Show the queue fill levels of every publisher-subscriber connection"
+    )]
+    pub connections: bool,
+
     #[command(flatten)]
     pub filter: OutputFilter,
 }
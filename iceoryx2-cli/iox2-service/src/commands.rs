@@ -13,6 +13,7 @@
 use anyhow::{Context, Error, Result};
 use iceoryx2::prelude::*;
 use iceoryx2_cli::filter::Filter;
+use iceoryx2_cli::output::ConnectionDescription;
 use iceoryx2_cli::output::ServiceDescription;
 use iceoryx2_cli::output::ServiceDescriptor;
 use iceoryx2_cli::Format;
@@ -41,12 +42,34 @@ pub fn list(filter: OutputFilter, format: Format) -> Result<()> {
     Ok(())
 }
 
-pub fn details(service_name: String, filter: OutputFilter, format: Format) -> Result<()> {
+pub fn details(
+    service_name: String,
+    connections: bool,
+    filter: OutputFilter,
+    format: Format,
+) -> Result<()> {
     let mut error: Option<Error> = None;
 
     ipc::Service::list(Config::global_config(), |service| {
         if service_name == service.static_details.name().to_string() && filter.matches(&service) {
-            match format.as_string(&ServiceDescription::from(&service)) {
+            let mut description = ServiceDescription::from(&service);
+            if connections {
+                let mut list = Vec::new();
+                if let Err(e) = ipc::Service::list_connection_stats(
+                    &service.static_details,
+                    Config::global_config(),
+                    |connection| {
+                        list.push(ConnectionDescription::from(&connection));
+                        CallbackProgression::Continue
+                    },
+                ) {
+                    error = Some(Error::new(e).context("failed to retrieve connections"));
+                    return CallbackProgression::Stop;
+                }
+                description.connections = Some(list);
+            }
+
+            match format.as_string(&description) {
                 Ok(output) => {
                     print!("{}", output);
                     CallbackProgression::Continue
@@ -51,7 +51,12 @@ fn main() -> Result<()> {
                 }
             }
             Action::Details(options) => {
-                if let Err(e) = commands::details(options.service, options.filter, cli.format) {
+                if let Err(e) = commands::details(
+                    options.service,
+                    options.connections,
+                    options.filter,
+                    cli.format,
+                ) {
                     eprintln!("Failed to retrieve service details: {}", e);
                 }
             }
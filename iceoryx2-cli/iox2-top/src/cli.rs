@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use clap::Parser;
+use clap::ValueEnum;
+
+#[derive(Clone, Copy, ValueEnum)]
+#[value(rename_all = "UPPERCASE")]
+pub enum OutputFormat {
+    Table,
+    Jsonl,
+}
+
+#[derive(Parser)]
+#[command(
+    name = "iox2-top",
+    about = "Monitor the load of iceoryx2 publish-subscribe services",
+    long_about = None,
+    version = env!("CARGO_PKG_VERSION"),
+)]
+pub struct Cli {
+    #[clap(
+        long,
+        short = 'i',
+        default_value_t = 1000,
+        help = "Refresh interval in milliseconds"
+    )]
+    pub interval: u64,
+
+    #[clap(
+        long,
+        short = 'n',
+        help = "Number of refreshes after which the monitor exits, runs until interrupted when not set"
+    )]
+    pub iterations: Option<u64>,
+
+    #[clap(long, help = "Show every port below its service")]
+    pub ports: bool,
+
+    #[clap(long, short = 'f', value_enum, default_value_t = OutputFormat::Table)]
+    pub format: OutputFormat,
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use std::io::{IsTerminal, Write};
+use std::time::Duration;
+
+use anyhow::{Context, Result};
+
+use crate::cli::{Cli, OutputFormat};
+use crate::monitor::{Monitor, PortKind, ServiceLoad};
+
+const CLEAR_SCREEN: &str = "\x1B[2J\x1B[H";
+
+pub fn run(cli: &Cli) -> Result<()> {
+    let interval = Duration::from_millis(cli.interval.max(1));
+    let mut monitor = Monitor::new()?;
+    let mut iteration = 0;
+
+    loop {
+        std::thread::sleep(interval);
+        let services = monitor.sample()?;
+
+        let output = match cli.format {
+            OutputFormat::Table => as_table(&services, cli.ports),
+            OutputFormat::Jsonl => as_json_lines(&services)?,
+        };
+
+        let mut stdout = std::io::stdout().lock();
+        if matches!(cli.format, OutputFormat::Table) && stdout.is_terminal() {
+            write!(stdout, "{}", CLEAR_SCREEN)?;
+        }
+        write!(stdout, "{}", output)?;
+        stdout.flush()?;
+
+        iteration += 1;
+        if cli
+            .iterations
+            .is_some_and(|iterations| iterations <= iteration)
+        {
+            return Ok(());
+        }
+    }
+}
+
+fn as_json_lines(services: &[ServiceLoad]) -> Result<String> {
+    let mut output = String::new();
+    for service in services {
+        output.push_str(
+            &serde_json::to_string(service).context("failed to serialize to JSON format")?,
+        );
+        output.push('\n');
+    }
+    Ok(output)
+}
+
+fn human_readable(value: f64) -> String {
+    const UNITS: [&str; 5] = ["", "k", "M", "G", "T"];
+    let mut value = value;
+    let mut unit = 0;
+    while 1000.0 <= value && unit < UNITS.len() - 1 {
+        value /= 1000.0;
+        unit += 1;
+    }
+    format!("{:.1}{}", value, UNITS[unit])
+}
+
+fn as_table(services: &[ServiceLoad], show_ports: bool) -> String {
+    let mut output = format!(
+        "{:<40} {:>5} {:>4} {:>4} {:>9} {:>9} {:>9} {:>9} {:>11} {:>9}\n",
+        "SERVICE",
+        "NODES",
+        "PUB",
+        "SUB",
+        "MSGS/S",
+        "BYTES/S",
+        "RECV/S",
+        "DROPS/S",
+        "LOAN FAIL/S",
+        "QUEUE"
+    );
+
+    for service in services {
+        output.push_str(&format!(
+            "{:<40} {:>5} {:>4} {:>4} {:>9} {:>9} {:>9} {:>9} {:>11} {:>9}\n",
+            service.service_name,
+            service.nodes,
+            service.publishers,
+            service.subscribers,
+            human_readable(service.messages_per_second),
+            human_readable(service.bytes_per_second),
+            human_readable(service.received_per_second),
+            human_readable(service.drops_per_second),
+            human_readable(service.failed_loans_per_second),
+            format!("{}/{}", service.max_queue_depth, service.queue_capacity),
+        ));
+
+        if show_ports {
+            for port in &service.ports {
+                let (kind, recv) = match port.kind {
+                    PortKind::Publisher => ("pub", String::new()),
+                    PortKind::Subscriber => ("sub", human_readable(port.messages_per_second)),
+                };
+                let sent = match port.kind {
+                    PortKind::Publisher => human_readable(port.messages_per_second),
+                    PortKind::Subscriber => String::new(),
+                };
+                output.push_str(&format!(
+                    "  {} {:<34} {:>5} {:>4} {:>4} {:>9} {:>9} {:>9} {:>9} {:>11} {:>9}\n",
+                    kind,
+                    port.id,
+                    "",
+                    "",
+                    "",
+                    sent,
+                    human_readable(port.bytes_per_second),
+                    recv,
+                    human_readable(port.drops_per_second),
+                    human_readable(port.failed_loans_per_second),
+                    port.queue_depth,
+                ));
+            }
+        }
+    }
+
+    output
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(not(debug_assertions))]
+use human_panic::setup_panic;
+#[cfg(debug_assertions)]
+extern crate better_panic;
+
+mod cli;
+mod commands;
+mod monitor;
+
+use anyhow::{anyhow, Result};
+use clap::Parser;
+use cli::Cli;
+use iceoryx2_bb_log::{set_log_level_from_env_or, LogLevel};
+
+fn main() -> Result<()> {
+    #[cfg(not(debug_assertions))]
+    {
+        setup_panic!();
+    }
+    #[cfg(debug_assertions)]
+    {
+        better_panic::Settings::debug()
+            .most_recent_first(false)
+            .lineno_suffix(true)
+            .verbosity(better_panic::Verbosity::Full)
+            .install();
+    }
+
+    set_log_level_from_env_or(LogLevel::Warn);
+
+    let cli = Cli::try_parse().map_err(|e| anyhow!("{}", e))?;
+    if let Err(e) = commands::run(&cli) {
+        eprintln!("Failed to monitor services: {}", e);
+    }
+
+    Ok(())
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use std::collections::HashMap;
+use std::time::{Instant, SystemTime, UNIX_EPOCH};
+
+use anyhow::{Context, Result};
+use iceoryx2::prelude::*;
+use iceoryx2::service::static_config::messaging_pattern::MessagingPattern as IceoryxMessagingPattern;
+use iceoryx2::service::static_config::StaticConfig;
+use iceoryx2::service::PublishSubscribeStatistics;
+
+#[derive(Clone, Copy, PartialEq, Eq, serde::Serialize)]
+#[serde(rename_all = "snake_case")]
+pub enum PortKind {
+    Publisher,
+    Subscriber,
+}
+
+/// The load of a single port during the last refresh interval. For a publisher the
+/// messages are the sent samples and the failed loans the loans that exceeded the maximum,
+/// for a subscriber the messages are the received samples and the failed loans the
+/// receive calls that exceeded the maximum number of borrowed samples.
+#[derive(serde::Serialize)]
+pub struct PortLoad {
+    pub kind: PortKind,
+    pub id: String,
+    pub messages_per_second: f64,
+    pub bytes_per_second: f64,
+    pub drops_per_second: f64,
+    pub failed_loans_per_second: f64,
+    pub queue_depth: usize,
+}
+
+/// The load of a publish-subscribe service during the last refresh interval. The bytes
+/// are derived from the payload type size, for slices this is the size of one element.
+#[derive(serde::Serialize)]
+pub struct ServiceLoad {
+    pub timestamp_ms: u128,
+    pub service_name: String,
+    pub service_id: String,
+    pub nodes: usize,
+    pub publishers: usize,
+    pub subscribers: usize,
+    pub messages_per_second: f64,
+    pub bytes_per_second: f64,
+    pub received_per_second: f64,
+    pub drops_per_second: f64,
+    pub failed_loans_per_second: f64,
+    pub max_queue_depth: usize,
+    pub queue_capacity: usize,
+    pub ports: Vec<PortLoad>,
+}
+
+#[derive(Clone, Copy, Default)]
+struct PortCounters {
+    messages: u64,
+    drops: u64,
+    failed_loans: u64,
+}
+
+impl PortCounters {
+    fn delta(&self, previous: Option<&PortCounters>) -> PortCounters {
+        // a port that was not seen before started its counters at zero
+        let previous = previous.copied().unwrap_or_default();
+        PortCounters {
+            messages: self.messages.saturating_sub(previous.messages),
+            drops: self.drops.saturating_sub(previous.drops),
+            failed_loans: self.failed_loans.saturating_sub(previous.failed_loans),
+        }
+    }
+}
+
+/// Samples the shared statistics counters of all publish-subscribe services and derives
+/// the rates from the difference to the previous sample. Every sample maps the dynamic
+/// config of a service once.
+pub struct Monitor {
+    previous_counters: HashMap<u128, PortCounters>,
+    previous_sample: Instant,
+}
+
+impl Monitor {
+    pub fn new() -> Result<Self> {
+        let mut monitor = Self {
+            previous_counters: HashMap::new(),
+            previous_sample: Instant::now(),
+        };
+        // establishes the baseline for the first rates
+        monitor.sample()?;
+        Ok(monitor)
+    }
+
+    pub fn sample(&mut self) -> Result<Vec<ServiceLoad>> {
+        let now = Instant::now();
+        let elapsed = now
+            .duration_since(self.previous_sample)
+            .as_secs_f64()
+            .max(f64::EPSILON);
+        let timestamp_ms = SystemTime::now()
+            .duration_since(UNIX_EPOCH)
+            .map(|t| t.as_millis())
+            .unwrap_or(0);
+
+        let mut counters = HashMap::new();
+        let mut services = Vec::new();
+
+        ipc::Service::list_publish_subscribe_statistics(
+            Config::global_config(),
+            |static_details, statistics| {
+                if let Some(load) = self.sample_service(
+                    static_details,
+                    statistics,
+                    elapsed,
+                    timestamp_ms,
+                    &mut counters,
+                ) {
+                    services.push(load);
+                }
+                CallbackProgression::Continue
+            },
+        )
+        .context("failed to retrieve the service statistics")?;
+
+        self.previous_counters = counters;
+        self.previous_sample = now;
+
+        services.sort_by(|lhs, rhs| {
+            rhs.messages_per_second
+                .total_cmp(&lhs.messages_per_second)
+                .then(rhs.bytes_per_second.total_cmp(&lhs.bytes_per_second))
+                .then_with(|| lhs.service_name.cmp(&rhs.service_name))
+        });
+
+        Ok(services)
+    }
+
+    fn sample_service(
+        &self,
+        static_details: &StaticConfig,
+        statistics: PublishSubscribeStatistics,
+        elapsed: f64,
+        timestamp_ms: u128,
+        counters: &mut HashMap<u128, PortCounters>,
+    ) -> Option<ServiceLoad> {
+        let payload_size = match static_details.messaging_pattern() {
+            IceoryxMessagingPattern::PublishSubscribe(static_config) => {
+                static_config.message_type_details().payload.size as f64
+            }
+            _ => return None,
+        };
+
+        let mut queue_depths = HashMap::<u128, usize>::new();
+        let mut max_queue_depth = 0;
+        let mut queue_capacity = 0;
+        for connection in &statistics.connections {
+            let depth = connection.submission_queue.len;
+            for id in [
+                connection.publisher_id.value(),
+                connection.subscriber_id.value(),
+            ] {
+                let entry = queue_depths.entry(id).or_default();
+                *entry = (*entry).max(depth);
+            }
+            if max_queue_depth <= depth {
+                max_queue_depth = depth;
+                queue_capacity = connection.submission_queue.capacity;
+            }
+        }
+
+        let mut ports = Vec::new();
+        let mut add_port = |kind: PortKind, id: u128, current: PortCounters| {
+            let delta = current.delta(self.previous_counters.get(&id));
+            counters.insert(id, current);
+            let messages_per_second = delta.messages as f64 / elapsed;
+            ports.push(PortLoad {
+                kind,
+                id: format!("{:032x}", id),
+                messages_per_second,
+                bytes_per_second: messages_per_second * payload_size,
+                drops_per_second: delta.drops as f64 / elapsed,
+                failed_loans_per_second: delta.failed_loans as f64 / elapsed,
+                queue_depth: queue_depths.get(&id).copied().unwrap_or(0),
+            });
+        };
+
+        for (id, stats) in &statistics.publishers {
+            add_port(
+                PortKind::Publisher,
+                id.value(),
+                PortCounters {
+                    messages: stats.sent_samples,
+                    drops: stats.failed_deliveries + stats.overflowed_samples,
+                    failed_loans: stats.exceeded_max_loans,
+                },
+            );
+        }
+
+        for (id, stats) in &statistics.subscribers {
+            add_port(
+                PortKind::Subscriber,
+                id.value(),
+                PortCounters {
+                    messages: stats.received_samples,
+                    drops: 0,
+                    failed_loans: stats.exceeded_max_borrows,
+                },
+            );
+        }
+
+        let sum = |kind: PortKind, value: fn(&PortLoad) -> f64| -> f64 {
+            ports.iter().filter(|p| p.kind == kind).map(value).sum()
+        };
+
+        Some(ServiceLoad {
+            timestamp_ms,
+            service_name: static_details.name().to_string(),
+            service_id: static_details.service_id().as_str().to_string(),
+            nodes: statistics.number_of_nodes,
+            publishers: ports
+                .iter()
+                .filter(|p| p.kind == PortKind::Publisher)
+                .count(),
+            subscribers: ports
+                .iter()
+                .filter(|p| p.kind == PortKind::Subscriber)
+                .count(),
+            messages_per_second: sum(PortKind::Publisher, |p| p.messages_per_second),
+            bytes_per_second: sum(PortKind::Publisher, |p| p.bytes_per_second),
+            received_per_second: sum(PortKind::Subscriber, |p| p.messages_per_second),
+            drops_per_second: sum(PortKind::Publisher, |p| p.drops_per_second),
+            failed_loans_per_second: sum(PortKind::Publisher, |p| p.failed_loans_per_second)
+                + sum(PortKind::Subscriber, |p| p.failed_loans_per_second),
+            max_queue_depth,
+            queue_capacity,
+            ports,
+        })
+    }
+}
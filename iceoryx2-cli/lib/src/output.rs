@@ -16,6 +16,8 @@ use iceoryx2::node::NodeDetails as IceoryxNodeDetails;
 use iceoryx2::node::NodeId as IceoryxNodeId;
 use iceoryx2::node::NodeState as IceoryxNodeState;
 use iceoryx2::node::NodeView as IceoryxNodeView;
+use iceoryx2::port::publisher::ConnectionStatistics as IceoryxConnectionStatistics;
+use iceoryx2::port::publisher::QueueFillLevel as IceoryxQueueFillLevel;
 use iceoryx2::service::attribute::AttributeSet as IceoryxAttributeSet;
 use iceoryx2::service::static_config::messaging_pattern::MessagingPattern as IceoryxMessagingPattern;
 use iceoryx2::service::Service as IceoryxService;
@@ -54,6 +56,8 @@ pub struct ServiceDescription {
     pub attributes: IceoryxAttributeSet,
     pub pattern: IceoryxMessagingPattern,
     pub nodes: Option<NodeList>,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    pub connections: Option<Vec<ConnectionDescription>>,
 }
 
 impl<T> From<&IceoryxServiceDetails<T>> for ServiceDescription
@@ -69,6 +73,43 @@ where
             attributes: config.attributes().clone(),
             pattern: config.messaging_pattern().clone(),
             nodes: service.dynamic_details.as_ref().map(NodeList::from),
+            connections: None,
+        }
+    }
+}
+
+#[derive(serde::Serialize)]
+pub struct QueueDescription {
+    pub len: usize,
+    pub capacity: usize,
+    pub high_water_mark: usize,
+}
+
+impl From<&IceoryxQueueFillLevel> for QueueDescription {
+    fn from(fill_level: &IceoryxQueueFillLevel) -> Self {
+        QueueDescription {
+            len: fill_level.len,
+            capacity: fill_level.capacity,
+            high_water_mark: fill_level.high_water_mark,
+        }
+    }
+}
+
+#[derive(serde::Serialize)]
+pub struct ConnectionDescription {
+    pub publisher_id: String,
+    pub subscriber_id: String,
+    pub submission_queue: QueueDescription,
+    pub completion_queue: QueueDescription,
+}
+
+impl From<&IceoryxConnectionStatistics> for ConnectionDescription {
+    fn from(connection: &IceoryxConnectionStatistics) -> Self {
+        ConnectionDescription {
+            publisher_id: format!("{:032x}", connection.publisher_id.value()),
+            subscriber_id: format!("{:032x}", connection.subscriber_id.value()),
+            submission_queue: QueueDescription::from(&connection.submission_queue),
+            completion_queue: QueueDescription::from(&connection.completion_queue),
         }
     }
 }
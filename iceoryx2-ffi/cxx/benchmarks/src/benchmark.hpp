@@ -0,0 +1,316 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CXX_BENCHMARKS_BENCHMARK_HPP
+#define IOX2_CXX_BENCHMARKS_BENCHMARK_HPP
+
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "iox2/service_type.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace iox2_benchmark {
+constexpr uint64_t DEFAULT_ITERATIONS = 1000000;
+constexpr uint64_t DEFAULT_THROUGHPUT_BUFFER_SIZE = 128;
+
+/// Defines how the results of a benchmark are printed, see `OutputFormat` of the
+/// Rust `benchmark-common` crate.
+enum class OutputFormat : uint8_t {
+    /// Human readable single line per benchmark
+    Text,
+    /// Comma separated values, the header is printed once before the first benchmark
+    Csv,
+    /// One JSON object per line and benchmark
+    Json,
+};
+
+struct Args {
+    uint64_t iterations { DEFAULT_ITERATIONS };
+    uint64_t throughput_buffer_size { DEFAULT_THROUGHPUT_BUFFER_SIZE };
+    bool bench_ipc { false };
+    bool bench_local { false };
+    bool debug_mode { false };
+    OutputFormat output_format { OutputFormat::Text };
+};
+
+/// Releases the participants of a benchmark at the same time, all participants
+/// busy wait so that the wake up latency does not distort the measurement.
+class StartBarrier {
+  public:
+    explicit StartBarrier(uint32_t number_of_participants)
+        : m_waiting { number_of_participants } {
+    }
+
+    void wait() {
+        m_waiting.fetch_sub(1, std::memory_order_acq_rel);
+        while (m_waiting.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    std::atomic<uint32_t> m_waiting;
+};
+
+using Clock = std::chrono::steady_clock;
+
+/// The percentiles that are reported for every benchmark.
+constexpr std::array<double, 4> PERCENTILES = { 50.0, 90.0, 99.0, 99.9 };
+
+/// Log-linear histogram with the same bucket layout as the `LatencyHistogram` of the
+/// Rust `benchmark-common` crate. Values below 128 are recorded exactly, larger values
+/// with a relative error of less than 1.6%. Recording a value does not allocate.
+class LatencyHistogram {
+  public:
+    LatencyHistogram()
+        : m_counts(NUMBER_OF_BUCKETS, 0) {
+    }
+
+    /// Records a single value
+    void record(uint64_t value) {
+        ++m_counts[bucket_index(value)];
+        ++m_count;
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+        m_sum += static_cast<long double>(value);
+        m_sum_of_squares += static_cast<long double>(value) * static_cast<long double>(value);
+    }
+
+    /// Records the provided duration in nanoseconds
+    void record_duration(Clock::duration value) {
+        const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(value).count();
+        record(static_cast<uint64_t>(std::max<int64_t>(nanoseconds, 0)));
+    }
+
+    /// Returns the number of recorded values
+    auto len() const -> uint64_t {
+        return m_count;
+    }
+
+    /// Returns true when no value was recorded
+    auto is_empty() const -> bool {
+        return m_count == 0;
+    }
+
+    /// Returns the smallest recorded value
+    auto min() const -> uint64_t {
+        return is_empty() ? 0 : m_min;
+    }
+
+    /// Returns the largest recorded value
+    auto max() const -> uint64_t {
+        return m_max;
+    }
+
+    /// Returns the arithmetic mean of all recorded values
+    auto mean() const -> double {
+        if (is_empty()) {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_sum / static_cast<long double>(m_count));
+    }
+
+    /// Returns the jitter, the standard deviation of all recorded values
+    auto jitter() const -> double {
+        if (is_empty()) {
+            return 0.0;
+        }
+
+        const auto mean_value = mean();
+        const auto variance =
+            static_cast<double>(m_sum_of_squares / static_cast<long double>(m_count)) - mean_value * mean_value;
+        return std::sqrt(std::max(variance, 0.0));
+    }
+
+    /// Returns the value below or equal to which `percentile` percent of all recorded
+    /// values are. The value is exact up to the resolution of the histogram.
+    auto percentile(double percentile) const -> uint64_t {
+        if (is_empty()) {
+            return 0;
+        }
+
+        const auto rank = std::clamp<uint64_t>(
+            static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count))), 1, m_count);
+        uint64_t accumulated = 0;
+        for (size_t index = 0; index < m_counts.size(); ++index) {
+            accumulated += m_counts[index];
+            if (accumulated >= rank) {
+                return std::min(highest_value_of_bucket(index), m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+  private:
+    // every power of two range is divided into this number of linear sub buckets
+    static constexpr uint32_t SUB_BUCKET_BITS = 7;
+    static constexpr size_t SUB_BUCKET_COUNT = size_t { 1 } << SUB_BUCKET_BITS;
+    static constexpr size_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+    static constexpr size_t NUMBER_OF_BUCKETS = (64 - SUB_BUCKET_BITS) * SUB_BUCKET_HALF_COUNT + SUB_BUCKET_COUNT;
+
+    static auto bit_width(uint64_t value) -> uint32_t {
+        uint32_t width = 0;
+        while (value != 0) {
+            value >>= 1U;
+            ++width;
+        }
+        return width;
+    }
+
+    static auto bucket_index(uint64_t value) -> size_t {
+        const auto width = bit_width(value);
+        const auto shift = width > SUB_BUCKET_BITS ? width - SUB_BUCKET_BITS : 0;
+        return shift * SUB_BUCKET_HALF_COUNT + static_cast<size_t>(value >> shift);
+    }
+
+    static auto highest_value_of_bucket(size_t index) -> uint64_t {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+
+        const auto shift = (index - SUB_BUCKET_HALF_COUNT) / SUB_BUCKET_HALF_COUNT;
+        const auto sub_bucket = static_cast<uint64_t>(index - shift * SUB_BUCKET_HALF_COUNT);
+        return (sub_bucket << shift) + ((uint64_t { 1 } << shift) - 1);
+    }
+
+    std::vector<uint64_t> m_counts;
+    uint64_t m_count { 0 };
+    uint64_t m_min { std::numeric_limits<uint64_t>::max() };
+    uint64_t m_max { 0 };
+    long double m_sum { 0 };
+    long double m_sum_of_squares { 0 };
+};
+
+/// Returns the name of the service type that is used in the setup of a report, it
+/// corresponds to the service type name in the setup of the Rust benchmarks.
+inline auto to_string(iox2::ServiceType service_type) -> const char* {
+    switch (service_type) {
+    case iox2::ServiceType::Ipc:
+        return "iox2::ServiceType::Ipc";
+    case iox2::ServiceType::Local:
+        return "iox2::ServiceType::Local";
+    }
+
+    return "unknown";
+}
+
+/// Creates a service name that is unique for the provided [`Node`] so that
+/// benchmarks running at the same time do not share their services.
+template <iox2::ServiceType S>
+auto unique_service_name(const iox2::Node<S>& node, const char* name) -> iox2::ServiceName {
+    const auto node_id = node.id();
+    std::stringstream service_name;
+    service_name << "benchmark/" << std::hex << std::setfill('0') << std::setw(16) << node_id.value_high()
+                 << std::setw(16) << node_id.value_low() << "/" << name;
+    return iox2::ServiceName::create(service_name.str().c_str()).expect("valid service name");
+}
+
+/// The result of a single benchmark run, printed in the format of the `LatencyReport` of
+/// the Rust `benchmark-common` crate so that the C++ and Rust numbers can be compared
+/// side by side.
+struct LatencyReport {
+    /// Name of the benchmark, e.g. `publish-subscribe`
+    const char* benchmark;
+    /// Describes the benchmarked setup, e.g. the service type
+    std::string setup;
+    /// The number of iterations of the benchmark
+    uint64_t iterations;
+    /// The overall runtime of the benchmark
+    Clock::duration time;
+    /// The per transfer latencies in nanoseconds
+    const LatencyHistogram& histogram;
+    /// The number of transfers per iteration, 2 for a round trip. The average latency is
+    /// the runtime divided by the number of transfers.
+    uint64_t transfers_per_iteration { 2 };
+
+    /// Prints the header of the [`OutputFormat`] if it has one. Must be called once
+    /// before the first [`LatencyReport::print()`].
+    static void print_header(OutputFormat format) {
+        if (format == OutputFormat::Csv) {
+            std::cout << "benchmark,setup,iterations,time_s,latency_ns,min_ns,p50_ns,p90_ns,p99_ns,p99_9_ns,max_ns,"
+                         "jitter_ns"
+                      << std::endl;
+        }
+    }
+
+    /// Returns the average latency, derived from the overall runtime of the benchmark
+    auto latency() const -> uint64_t {
+        const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+        return static_cast<uint64_t>(nanoseconds)
+               / (std::max<uint64_t>(iterations, 1) * std::max<uint64_t>(transfers_per_iteration, 1));
+    }
+
+    /// Prints the report in the provided [`OutputFormat`]
+    void print(OutputFormat format) const {
+        const auto seconds = std::chrono::duration<double>(time).count();
+        std::array<uint64_t, PERCENTILES.size()> p {};
+        for (size_t i = 0; i < PERCENTILES.size(); ++i) {
+            p[i] = histogram.percentile(PERCENTILES[i]);
+        }
+
+        std::stringstream jitter;
+        jitter << std::fixed << std::setprecision(1) << histogram.jitter();
+
+        switch (format) {
+        case OutputFormat::Text:
+            std::cout << setup << " ::: Iterations: " << iterations << ", Time: " << seconds
+                      << " s, Latency: " << latency() << " ns, Min: " << histogram.min() << " ns, P50: " << p[0]
+                      << " ns, P90: " << p[1] << " ns, P99: " << p[2] << " ns, P99.9: " << p[3]
+                      << " ns, Max: " << histogram.max() << " ns, Jitter: " << jitter.str() << " ns" << std::endl;
+            break;
+        case OutputFormat::Csv:
+            std::cout << benchmark << ",\"" << escape(setup, '"', "\"\"") << "\"," << iterations << "," << seconds
+                      << "," << latency() << "," << histogram.min() << "," << p[0] << "," << p[1] << "," << p[2]
+                      << "," << p[3] << "," << histogram.max() << "," << jitter.str() << std::endl;
+            break;
+        case OutputFormat::Json:
+            std::cout << R"({"benchmark":")" << benchmark << R"(","setup":")"
+                      << escape(escape(setup, '\\', "\\\\"), '"', "\\\"") << R"(","iterations":)" << iterations
+                      << R"(,"time_s":)" << seconds << R"(,"latency_ns":)" << latency() << R"(,"min_ns":)"
+                      << histogram.min() << R"(,"p50_ns":)" << p[0] << R"(,"p90_ns":)" << p[1] << R"(,"p99_ns":)"
+                      << p[2] << R"(,"p99_9_ns":)" << p[3] << R"(,"max_ns":)" << histogram.max()
+                      << R"(,"jitter_ns":)" << jitter.str() << "}" << std::endl;
+            break;
+        }
+    }
+
+  private:
+    static auto escape(const std::string& value, char character, const char* replacement) -> std::string {
+        std::string result;
+        for (const auto c : value) {
+            if (c == character) {
+                result += replacement;
+            } else {
+                result += c;
+            }
+        }
+        return result;
+    }
+};
+} // namespace iox2_benchmark
+
+#endif
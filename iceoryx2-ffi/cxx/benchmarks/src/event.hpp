@@ -0,0 +1,161 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CXX_BENCHMARKS_EVENT_HPP
+#define IOX2_CXX_BENCHMARKS_EVENT_HPP
+
+#include "benchmark.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/waitset.hpp"
+
+#include <thread>
+
+namespace iox2_benchmark {
+namespace internal {
+template <iox2::ServiceType S>
+auto create_event_service(iox2::Node<S>& node, const char* name) {
+    return node.service_builder(unique_service_name(node, name))
+        .event()
+        .max_notifiers(1)
+        .max_listeners(1)
+        .create()
+        .expect("successful service creation");
+}
+} // namespace internal
+
+/// Measures the latency between a [`Notifier`] sending a notification and a
+/// [`Listener`] waking up from a blocking wait and responding to it.
+template <iox2::ServiceType S>
+void event_notify_wait(const Args& args) {
+    using namespace iox2;
+
+    auto node = NodeBuilder().create<S>().expect("successful node creation");
+    auto service_a2b = internal::create_event_service(node, "event/a2b");
+    auto service_b2a = internal::create_event_service(node, "event/b2a");
+
+    StartBarrier startup_barrier(3);
+    StartBarrier start_benchmark_barrier(3);
+    LatencyHistogram histogram;
+
+    std::thread participant_1([&] {
+        auto notifier = service_a2b.notifier_builder().create().expect("successful notifier creation");
+        auto listener = service_b2a.listener_builder().create().expect("successful listener creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            const auto round_trip_start = Clock::now();
+            notifier.notify().expect("notification sent");
+            while (!listener.blocking_wait_one().expect("wait successful").has_value()) { }
+            histogram.record_duration((Clock::now() - round_trip_start) / 2);
+        }
+    });
+
+    std::thread participant_2([&] {
+        auto notifier = service_b2a.notifier_builder().create().expect("successful notifier creation");
+        auto listener = service_a2b.listener_builder().create().expect("successful listener creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            while (!listener.blocking_wait_one().expect("wait successful").has_value()) { }
+            notifier.notify().expect("notification sent");
+        }
+    });
+
+    startup_barrier.wait();
+    const auto start = Clock::now();
+    start_benchmark_barrier.wait();
+
+    participant_1.join();
+    participant_2.join();
+
+    const auto time = Clock::now() - start;
+    LatencyReport { "event", to_string(S), args.iterations, time, histogram }.print(args.output_format);
+}
+
+/// Like [`event_notify_wait()`] but participant 1 waits on a [`WaitSet`] and handles
+/// the notification in the [`WaitSet`] callback. The difference to
+/// [`event_notify_wait()`] is the overhead of the [`WaitSet`] dispatch.
+template <iox2::ServiceType S>
+void waitset_dispatch(const Args& args) {
+    using namespace iox2;
+
+    auto node = NodeBuilder().create<S>().expect("successful node creation");
+    auto service_a2b = internal::create_event_service(node, "waitset/a2b");
+    auto service_b2a = internal::create_event_service(node, "waitset/b2a");
+
+    StartBarrier startup_barrier(3);
+    StartBarrier start_benchmark_barrier(3);
+    LatencyHistogram histogram;
+
+    std::thread participant_1([&] {
+        auto notifier = service_a2b.notifier_builder().create().expect("successful notifier creation");
+        auto listener = service_b2a.listener_builder().create().expect("successful listener creation");
+        auto waitset = WaitSetBuilder().create<S>().expect("successful waitset creation");
+        auto guard = waitset.attach_notification(listener).expect("successful attachment");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        bool has_received_response = false;
+        auto on_event = [&](WaitSetAttachmentId<S> attachment_id) -> CallbackProgression {
+            if (attachment_id.has_event_from(guard)) {
+                listener.try_wait_all([](auto) { }).expect("wait successful");
+                has_received_response = true;
+            }
+            return CallbackProgression::Continue;
+        };
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            const auto round_trip_start = Clock::now();
+            notifier.notify().expect("notification sent");
+
+            has_received_response = false;
+            while (!has_received_response) {
+                waitset.wait_and_process_once(on_event).expect("wait successful");
+            }
+            histogram.record_duration((Clock::now() - round_trip_start) / 2);
+        }
+    });
+
+    std::thread participant_2([&] {
+        auto notifier = service_b2a.notifier_builder().create().expect("successful notifier creation");
+        auto listener = service_a2b.listener_builder().create().expect("successful listener creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            while (!listener.blocking_wait_one().expect("wait successful").has_value()) { }
+            notifier.notify().expect("notification sent");
+        }
+    });
+
+    startup_barrier.wait();
+    const auto start = Clock::now();
+    start_benchmark_barrier.wait();
+
+    participant_1.join();
+    participant_2.join();
+
+    const auto time = Clock::now() - start;
+    LatencyReport { "waitset-dispatch", to_string(S), args.iterations, time, histogram }.print(args.output_format);
+}
+} // namespace iox2_benchmark
+
+#endif
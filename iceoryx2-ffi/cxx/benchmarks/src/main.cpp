@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "benchmark.hpp"
+#include "event.hpp"
+#include "iox2/log.hpp"
+#include "iox2/service_type.hpp"
+#include "publish_subscribe.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+using namespace iox2_benchmark;
+
+void print_help() {
+    std::cout << "Usage: iceoryx2-cxx-benchmarks [OPTIONS]\n\n"
+              << "Options:\n"
+              << "  -i, --iterations <N>              Number of iterations [default: " << DEFAULT_ITERATIONS
+              << "]\n"
+              << "      --throughput-buffer-size <N>  Subscriber buffer size of the throughput benchmark [default: "
+              << DEFAULT_THROUGHPUT_BUFFER_SIZE << "]\n"
+              << "  -b, --bench-all                   Run benchmark for every service setup\n"
+              << "      --bench-ipc                   Run benchmark for the IPC zero copy setup\n"
+              << "      --bench-local                 Run benchmark for the process local setup\n"
+              << "  -d, --debug-mode                  Activate full log output\n"
+              << "      --output-format <FORMAT>      The format in which the results are printed [default: text]\n"
+              << "                                    [possible values: text, csv, json]\n"
+              << "  -h, --help                        Print help" << std::endl;
+}
+
+auto parse_number(int argc, char** argv, int& idx) -> uint64_t {
+    if (idx + 1 >= argc) {
+        std::cerr << "Missing value for '" << argv[idx] << "'" << std::endl; // NOLINT
+        std::exit(EXIT_FAILURE);                                             // NOLINT(concurrency-mt-unsafe)
+    }
+
+    ++idx;
+    return std::stoull(argv[idx]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+auto parse_output_format(int argc, char** argv, int& idx) -> OutputFormat {
+    if (idx + 1 >= argc) {
+        std::cerr << "Missing value for '" << argv[idx] << "'" << std::endl; // NOLINT
+        std::exit(EXIT_FAILURE);                                             // NOLINT(concurrency-mt-unsafe)
+    }
+
+    ++idx;
+    const std::string value = argv[idx]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (value == "text") {
+        return OutputFormat::Text;
+    }
+    if (value == "csv") {
+        return OutputFormat::Csv;
+    }
+    if (value == "json") {
+        return OutputFormat::Json;
+    }
+
+    std::cerr << "Invalid output format '" << value << "'\n\n";
+    print_help();
+    std::exit(EXIT_FAILURE); // NOLINT(concurrency-mt-unsafe)
+}
+
+auto parse_args(int argc, char** argv) -> Args {
+    Args args;
+    for (int idx = 1; idx < argc; ++idx) {
+        const std::string arg = argv[idx]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (arg == "-i" || arg == "--iterations") {
+            args.iterations = parse_number(argc, argv, idx);
+        } else if (arg == "--throughput-buffer-size") {
+            args.throughput_buffer_size = parse_number(argc, argv, idx);
+        } else if (arg == "-b" || arg == "--bench-all") {
+            args.bench_ipc = true;
+            args.bench_local = true;
+        } else if (arg == "--bench-ipc") {
+            args.bench_ipc = true;
+        } else if (arg == "--bench-local") {
+            args.bench_local = true;
+        } else if (arg == "-d" || arg == "--debug-mode") {
+            args.debug_mode = true;
+        } else if (arg == "--output-format") {
+            args.output_format = parse_output_format(argc, argv, idx);
+        } else if (arg == "-h" || arg == "--help") {
+            print_help();
+            std::exit(EXIT_SUCCESS); // NOLINT(concurrency-mt-unsafe)
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'\n\n";
+            print_help();
+            std::exit(EXIT_FAILURE); // NOLINT(concurrency-mt-unsafe)
+        }
+    }
+
+    return args;
+}
+
+template <iox2::ServiceType S>
+void perform_benchmarks(const Args& args) {
+    publish_subscribe_ping_pong<S>(args);
+    publish_subscribe_throughput<S>(args);
+    event_notify_wait<S>(args);
+    waitset_dispatch<S>(args);
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    const auto args = parse_args(argc, argv);
+
+    if (args.debug_mode) {
+        iox2::set_log_level(iox2::LogLevel::Trace);
+    } else {
+        iox2::set_log_level(iox2::LogLevel::Error);
+    }
+
+    LatencyReport::print_header(args.output_format);
+
+    if (args.bench_ipc) {
+        perform_benchmarks<iox2::ServiceType::Ipc>(args);
+    }
+
+    if (args.bench_local) {
+        perform_benchmarks<iox2::ServiceType::Local>(args);
+    }
+
+    if (!args.bench_ipc && !args.bench_local) {
+        std::cout << "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+                  << std::endl;
+    }
+
+    return 0;
+}
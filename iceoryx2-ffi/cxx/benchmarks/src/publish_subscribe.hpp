@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CXX_BENCHMARKS_PUBLISH_SUBSCRIBE_HPP
+#define IOX2_CXX_BENCHMARKS_PUBLISH_SUBSCRIBE_HPP
+
+#include "benchmark.hpp"
+#include "iox2/node.hpp"
+#include "iox2/sample_mut.hpp"
+#include "iox2/service_name.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/unable_to_deliver_strategy.hpp"
+
+#include <thread>
+
+namespace iox2_benchmark {
+/// Measures the latency between a [`Publisher`] sending a sample and a [`Subscriber`]
+/// receiving it. Participant 1 sends a sample to participant 2 which responds with a
+/// sample as soon as it was received.
+template <iox2::ServiceType S>
+void publish_subscribe_ping_pong(const Args& args) {
+    using namespace iox2;
+
+    auto node = NodeBuilder().create<S>().expect("successful node creation");
+    auto create_service = [&](const char* name) {
+        return node.service_builder(unique_service_name(node, name))
+            .template publish_subscribe<uint64_t>()
+            .max_publishers(1)
+            .max_subscribers(1)
+            .history_size(0)
+            .subscriber_max_buffer_size(1)
+            .enable_safe_overflow(true)
+            .create()
+            .expect("successful service creation");
+    };
+    auto service_a2b = create_service("publish_subscribe/a2b");
+    auto service_b2a = create_service("publish_subscribe/b2a");
+
+    StartBarrier startup_barrier(3);
+    StartBarrier start_benchmark_barrier(3);
+    LatencyHistogram histogram;
+
+    std::thread participant_1([&] {
+        auto publisher = service_a2b.publisher_builder().create().expect("successful publisher creation");
+        auto subscriber = service_b2a.subscriber_builder().create().expect("successful subscriber creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            const auto round_trip_start = Clock::now();
+            auto sample = publisher.loan_uninit().expect("acquire sample");
+            sample.write_payload(uint64_t { iteration });
+            send(assume_init(std::move(sample))).expect("send successful");
+
+            while (!subscriber.receive().expect("receive successful").has_value()) { }
+            histogram.record_duration((Clock::now() - round_trip_start) / 2);
+        }
+    });
+
+    std::thread participant_2([&] {
+        auto publisher = service_b2a.publisher_builder().create().expect("successful publisher creation");
+        auto subscriber = service_a2b.subscriber_builder().create().expect("successful subscriber creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            auto sample = publisher.loan_uninit().expect("acquire sample");
+            sample.write_payload(uint64_t { iteration });
+            auto initialized_sample = assume_init(std::move(sample));
+
+            while (!subscriber.receive().expect("receive successful").has_value()) { }
+
+            send(std::move(initialized_sample)).expect("send successful");
+        }
+    });
+
+    startup_barrier.wait();
+    const auto start = Clock::now();
+    start_benchmark_barrier.wait();
+
+    participant_1.join();
+    participant_2.join();
+
+    const auto time = Clock::now() - start;
+    LatencyReport { "publish-subscribe",
+                    std::string(to_string(S)) + ", Sample Size: " + std::to_string(sizeof(uint64_t)),
+                    args.iterations,
+                    time,
+                    histogram }
+        .print(args.output_format);
+}
+
+/// Measures how many samples a [`Publisher`] can deliver to a [`Subscriber`] that
+/// continuously receives in another thread. The [`Publisher`] blocks when the buffer
+/// of the [`Subscriber`] is full so that no sample is lost. Every sample carries its send
+/// time, the histogram contains the one-way latency under load and the reported average
+/// latency is the time per sample, the inverse of the throughput.
+template <iox2::ServiceType S>
+void publish_subscribe_throughput(const Args& args) {
+    using namespace iox2;
+
+    auto node = NodeBuilder().create<S>().expect("successful node creation");
+    auto service = node.service_builder(unique_service_name(node, "publish_subscribe/throughput"))
+                       .template publish_subscribe<uint64_t>()
+                       .max_publishers(1)
+                       .max_subscribers(1)
+                       .history_size(0)
+                       .subscriber_max_buffer_size(args.throughput_buffer_size)
+                       .enable_safe_overflow(false)
+                       .create()
+                       .expect("successful service creation");
+
+    StartBarrier startup_barrier(3);
+    StartBarrier start_benchmark_barrier(3);
+    LatencyHistogram histogram;
+
+    std::thread sender([&] {
+        auto publisher = service.publisher_builder()
+                             .unable_to_deliver_strategy(UnableToDeliverStrategy::Block)
+                             .create()
+                             .expect("successful publisher creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t iteration = 0; iteration < args.iterations; ++iteration) {
+            auto sample = publisher.loan_uninit().expect("acquire sample");
+            sample.write_payload(static_cast<uint64_t>(Clock::now().time_since_epoch().count()));
+            send(assume_init(std::move(sample))).expect("send successful");
+        }
+    });
+
+    std::thread receiver([&] {
+        auto subscriber = service.subscriber_builder()
+                              .buffer_size(args.throughput_buffer_size)
+                              .create()
+                              .expect("successful subscriber creation");
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        uint64_t number_of_received_samples = 0;
+        while (number_of_received_samples < args.iterations) {
+            auto sample = subscriber.receive().expect("receive successful");
+            if (sample.has_value()) {
+                const auto send_time = Clock::time_point(Clock::duration(sample->payload()));
+                histogram.record_duration(Clock::now() - send_time);
+                ++number_of_received_samples;
+            }
+        }
+    });
+
+    startup_barrier.wait();
+    const auto start = Clock::now();
+    start_benchmark_barrier.wait();
+
+    sender.join();
+    receiver.join();
+
+    const auto time = Clock::now() - start;
+    LatencyReport { "publish-subscribe-throughput",
+                    std::string(to_string(S)) + ", Sample Size: " + std::to_string(sizeof(uint64_t))
+                        + ", Buffer Size: " + std::to_string(args.throughput_buffer_size),
+                    args.iterations,
+                    time,
+                    histogram,
+                    1 }
+        .print(args.output_format);
+}
+} // namespace iox2_benchmark
+
+#endif
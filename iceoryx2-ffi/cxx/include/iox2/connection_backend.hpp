@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CONNECTION_BACKEND_HPP
+#define IOX2_CONNECTION_BACKEND_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines how a [`Publisher`] delivers its [`Sample`]s to the connected
+/// [`Subscriber`]s.
+enum class ConnectionBackend : uint8_t {
+    /// Every [`Subscriber`] has its own queue to every [`Publisher`]. Sending
+    /// a [`Sample`] costs one queue operation per [`Subscriber`] but every
+    /// [`Subscriber`] can be served independently.
+    SubscriberQueues,
+    /// Every [`Publisher`] writes into a single ring buffer that is shared
+    /// with all [`Subscriber`]s. Every [`Subscriber`] only keeps a read
+    /// cursor, so the cost of sending does not grow with the number of
+    /// [`Subscriber`]s. Without safe overflow the slowest [`Subscriber`] holds
+    /// back the [`Publisher`] for all [`Subscriber`]s.
+    BroadcastRing
+};
+} // namespace iox2
+
+#endif
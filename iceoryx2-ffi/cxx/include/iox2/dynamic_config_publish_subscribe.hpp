@@ -13,19 +13,65 @@
 #ifndef IOX2_DYNAMIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 #define IOX2_DYNAMIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 
-#include "iox/assertions_addendum.hpp"
+#include "iox/function.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/unique_port_id.hpp"
 
 #include <cstdint>
 
 namespace iox2 {
+/// Snapshot of the statistics counters of a [`Publisher`]. The counters start at zero
+/// when the [`Publisher`] is created.
+struct PublisherStatistics {
+    /// The number of samples that were sent.
+    uint64_t sent_samples { 0 };
+    /// The number of deliveries that failed since the buffer of a [`Subscriber`] was full.
+    uint64_t failed_deliveries { 0 };
+    /// The number of samples that were removed from the buffer of a [`Subscriber`] to make
+    /// room for a newer sample.
+    uint64_t overflowed_samples { 0 };
+    /// The number of loans that failed with [`LoanError::ExceedsMaxLoans`].
+    uint64_t exceeded_max_loans { 0 };
+};
+
+/// Snapshot of the statistics counters of a [`Subscriber`]. The counters start at zero
+/// when the [`Subscriber`] is created.
+struct SubscriberStatistics {
+    /// The number of samples that were received.
+    uint64_t received_samples { 0 };
+    /// The number of receive calls that failed with [`ReceiveError::ExceedsMaxBorrows`].
+    uint64_t exceeded_max_borrows { 0 };
+};
+
+/// The dynamic configuration of an [`MessagingPattern::PublishSubscribe`]
+/// based service. Contains dynamic parameters like the connected endpoints etc..
 class DynamicConfigPublishSubscribe {
   public:
-    auto number_of_publishers() const -> uint64_t {
-        IOX_TODO();
-    }
-    auto number_of_subscribers() const -> uint64_t {
-        IOX_TODO();
-    }
+    /// Returns how many [`Publisher`] ports are currently connected.
+    auto number_of_publishers() const -> uint64_t;
+
+    /// Returns how many [`Subscriber`] ports are currently connected.
+    auto number_of_subscribers() const -> uint64_t;
+
+    /// Calls the provided callback with the [`UniquePublisherId::bytes()`] and the
+    /// [`PublisherStatistics`] of every [`Publisher`] that is currently connected.
+    void list_publisher_statistics(
+        const iox::function<CallbackProgression(const RawIdType&, const PublisherStatistics&)>& callback) const;
+
+    /// Calls the provided callback with the [`UniqueSubscriberId::bytes()`] and the
+    /// [`SubscriberStatistics`] of every [`Subscriber`] that is currently connected.
+    void list_subscriber_statistics(
+        const iox::function<CallbackProgression(const RawIdType&, const SubscriberStatistics&)>& callback) const;
+
+  private:
+    template <ServiceType, typename, typename>
+    friend class PortFactoryPublishSubscribe;
+
+    explicit DynamicConfigPublishSubscribe(iox2_port_factory_pub_sub_h handle);
+
+    iox2_port_factory_pub_sub_h m_handle = nullptr;
 };
 } // namespace iox2
 
@@ -18,16 +18,21 @@
 #include "iox2/allocation_strategy.hpp"
 #include "iox2/callback_progression.hpp"
 #include "iox2/config_creation_error.hpp"
+#include "iox2/connection_backend.hpp"
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/listener_error.hpp"
 #include "iox2/log_level.hpp"
+#include "iox2/memory_residency.hpp"
 #include "iox2/messaging_pattern.hpp"
 #include "iox2/node_failure_enums.hpp"
 #include "iox2/node_wait_failure.hpp"
 #include "iox2/notifier_error.hpp"
+#include "iox2/page_size.hpp"
+#include "iox2/payload_allocator.hpp"
 #include "iox2/port_error.hpp"
 #include "iox2/publisher_error.hpp"
+#include "iox2/receive_policy.hpp"
 #include "iox2/semantic_string.hpp"
 #include "iox2/service_builder_event_error.hpp"
 #include "iox2/service_builder_publish_subscribe_error.hpp"
@@ -561,6 +566,10 @@ constexpr auto from<int, iox2::PublishSubscribeOpenOrCreateError>(const int valu
         return iox2::PublishSubscribeOpenOrCreateError::OpenDoesNotSupportRequestedAmountOfNodes;
     case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR:
         return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleOverflowBehavior;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_SEND_TRACKING_SETTING:
+        return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleSendTrackingSetting;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_CONNECTION_BACKEND:
+        return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleConnectionBackend;
     case iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS:
         return iox2::PublishSubscribeOpenOrCreateError::OpenInsufficientPermissions;
     case iox2_pub_sub_open_or_create_error_e_O_SERVICE_IN_CORRUPTED_STATE:
@@ -623,6 +632,10 @@ constexpr auto from<int, iox2::PublishSubscribeOpenError>(const int value) noexc
         return iox2::PublishSubscribeOpenError::DoesNotSupportRequestedAmountOfNodes;
     case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR:
         return iox2::PublishSubscribeOpenError::IncompatibleOverflowBehavior;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_SEND_TRACKING_SETTING:
+        return iox2::PublishSubscribeOpenError::IncompatibleSendTrackingSetting;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_CONNECTION_BACKEND:
+        return iox2::PublishSubscribeOpenError::IncompatibleConnectionBackend;
     case iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS:
         return iox2::PublishSubscribeOpenError::InsufficientPermissions;
     case iox2_pub_sub_open_or_create_error_e_O_SERVICE_IN_CORRUPTED_STATE:
@@ -666,6 +679,10 @@ constexpr auto from<iox2::PublishSubscribeOpenError, iox2_pub_sub_open_or_create
         return iox2_pub_sub_open_or_create_error_e_O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES;
     case iox2::PublishSubscribeOpenError::IncompatibleOverflowBehavior:
         return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR;
+    case iox2::PublishSubscribeOpenError::IncompatibleSendTrackingSetting:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_SEND_TRACKING_SETTING;
+    case iox2::PublishSubscribeOpenError::IncompatibleConnectionBackend:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_CONNECTION_BACKEND;
     case iox2::PublishSubscribeOpenError::InsufficientPermissions:
         return iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS;
     case iox2::PublishSubscribeOpenError::ServiceInCorruptedState:
@@ -768,6 +785,10 @@ constexpr auto from<iox2::PublishSubscribeOpenOrCreateError, iox2_pub_sub_open_o
         return iox2_pub_sub_open_or_create_error_e_O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES;
     case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleOverflowBehavior:
         return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR;
+    case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleSendTrackingSetting:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_SEND_TRACKING_SETTING;
+    case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleConnectionBackend:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_CONNECTION_BACKEND;
     case iox2::PublishSubscribeOpenOrCreateError::OpenInsufficientPermissions:
         return iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS;
     case iox2::PublishSubscribeOpenOrCreateError::OpenServiceInCorruptedState:
@@ -948,6 +969,8 @@ constexpr auto from<int, iox2::PublisherCreateError>(const int value) noexcept -
         return iox2::PublisherCreateError::ExceedsMaxSupportedPublishers;
     case iox2_publisher_create_error_e_UNABLE_TO_CREATE_DATA_SEGMENT:
         return iox2::PublisherCreateError::UnableToCreateDataSegment;
+    case iox2_publisher_create_error_e_UNABLE_TO_APPLY_MEMORY_RESIDENCY:
+        return iox2::PublisherCreateError::UnableToApplyMemoryResidency;
     }
 
     IOX_UNREACHABLE();
@@ -962,6 +985,8 @@ from<iox2::PublisherCreateError, iox2_publisher_create_error_e>(const iox2::Publ
         return iox2_publisher_create_error_e_EXCEEDS_MAX_SUPPORTED_PUBLISHERS;
     case iox2::PublisherCreateError::UnableToCreateDataSegment:
         return iox2_publisher_create_error_e_UNABLE_TO_CREATE_DATA_SEGMENT;
+    case iox2::PublisherCreateError::UnableToApplyMemoryResidency:
+        return iox2_publisher_create_error_e_UNABLE_TO_APPLY_MEMORY_RESIDENCY;
     }
 
     IOX_UNREACHABLE();
@@ -981,6 +1006,8 @@ constexpr auto from<int, iox2::SubscriberCreateError>(const int value) noexcept
         return iox2::SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService;
     case iox2_subscriber_create_error_e_EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS:
         return iox2::SubscriberCreateError::ExceedsMaxSupportedSubscribers;
+    case iox2_subscriber_create_error_e_UNABLE_TO_APPLY_MEMORY_RESIDENCY:
+        return iox2::SubscriberCreateError::UnableToApplyMemoryResidency;
     }
 
     IOX_UNREACHABLE();
@@ -995,6 +1022,8 @@ from<iox2::SubscriberCreateError, iox2_subscriber_create_error_e>(const iox2::Su
         return iox2_subscriber_create_error_e_BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE;
     case iox2::SubscriberCreateError::ExceedsMaxSupportedSubscribers:
         return iox2_subscriber_create_error_e_EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS;
+    case iox2::SubscriberCreateError::UnableToApplyMemoryResidency:
+        return iox2_subscriber_create_error_e_UNABLE_TO_APPLY_MEMORY_RESIDENCY;
     }
 
     IOX_UNREACHABLE();
@@ -1211,6 +1240,60 @@ constexpr auto from<iox2::UnableToDeliverStrategy, int>(const iox2::UnableToDeli
     IOX_UNREACHABLE();
 }
 
+template <>
+constexpr auto from<int, iox2::ReceivePolicy>(const int value) noexcept -> iox2::ReceivePolicy {
+    const auto variant = static_cast<iox2_receive_policy_e>(value);
+    switch (variant) {
+    case iox2_receive_policy_e_SEQUENTIAL:
+        return iox2::ReceivePolicy::Sequential;
+    case iox2_receive_policy_e_ROUND_ROBIN:
+        return iox2::ReceivePolicy::RoundRobin;
+    case iox2_receive_policy_e_OLDEST_FIRST:
+        return iox2::ReceivePolicy::OldestFirst;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::ReceivePolicy, int>(const iox2::ReceivePolicy value) noexcept -> int {
+    switch (value) {
+    case iox2::ReceivePolicy::Sequential:
+        return iox2_receive_policy_e_SEQUENTIAL;
+    case iox2::ReceivePolicy::RoundRobin:
+        return iox2_receive_policy_e_ROUND_ROBIN;
+    case iox2::ReceivePolicy::OldestFirst:
+        return iox2_receive_policy_e_OLDEST_FIRST;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<int, iox2::ConnectionBackend>(const int value) noexcept -> iox2::ConnectionBackend {
+    const auto variant = static_cast<iox2_connection_backend_e>(value);
+    switch (variant) {
+    case iox2_connection_backend_e_SUBSCRIBER_QUEUES:
+        return iox2::ConnectionBackend::SubscriberQueues;
+    case iox2_connection_backend_e_BROADCAST_RING:
+        return iox2::ConnectionBackend::BroadcastRing;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::ConnectionBackend, int>(const iox2::ConnectionBackend value) noexcept -> int {
+    switch (value) {
+    case iox2::ConnectionBackend::SubscriberQueues:
+        return iox2_connection_backend_e_SUBSCRIBER_QUEUES;
+    case iox2::ConnectionBackend::BroadcastRing:
+        return iox2_connection_backend_e_BROADCAST_RING;
+    }
+
+    IOX_UNREACHABLE();
+}
+
 template <>
 constexpr auto from<int, iox2::ConnectionFailure>(const int value) noexcept -> iox2::ConnectionFailure {
     const auto variant = static_cast<iox2_connection_failure_e>(value);
@@ -1515,6 +1598,62 @@ constexpr auto from<iox2::AllocationStrategy, iox2_allocation_strategy_e>(const
     IOX_UNREACHABLE();
 }
 
+template <>
+constexpr auto from<iox2::PayloadAllocator, iox2_payload_allocator_e>(const iox2::PayloadAllocator value) noexcept
+    -> iox2_payload_allocator_e {
+    switch (value) {
+    case iox2::PayloadAllocator::Pool:
+        return iox2_payload_allocator_e_POOL;
+    case iox2::PayloadAllocator::Buddy:
+        return iox2_payload_allocator_e_BUDDY;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<int, iox2::PageSize>(const int value) noexcept -> iox2::PageSize {
+    const auto variant = static_cast<iox2_page_size_e>(value);
+    switch (variant) {
+    case iox2_page_size_e_DEFAULT:
+        return iox2::PageSize::Default;
+    case iox2_page_size_e_HUGE_2_MIB:
+        return iox2::PageSize::Huge2MiB;
+    case iox2_page_size_e_HUGE_1_GIB:
+        return iox2::PageSize::Huge1GiB;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::PageSize, int>(const iox2::PageSize value) noexcept -> int {
+    switch (value) {
+    case iox2::PageSize::Default:
+        return iox2_page_size_e_DEFAULT;
+    case iox2::PageSize::Huge2MiB:
+        return iox2_page_size_e_HUGE_2_MIB;
+    case iox2::PageSize::Huge1GiB:
+        return iox2_page_size_e_HUGE_1_GIB;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::MemoryResidency, int>(const iox2::MemoryResidency value) noexcept -> int {
+    switch (value) {
+    case iox2::MemoryResidency::OnDemand:
+        return iox2_memory_residency_e_ON_DEMAND;
+    case iox2::MemoryResidency::PreFaulted:
+        return iox2_memory_residency_e_PRE_FAULTED;
+    case iox2::MemoryResidency::Locked:
+        return iox2_memory_residency_e_LOCKED;
+    }
+
+    IOX_UNREACHABLE();
+}
+
 template <>
 constexpr auto from<int, iox2::NodeCleanupFailure>(const int value) noexcept -> iox2::NodeCleanupFailure {
     const auto variant = static_cast<iox2_node_cleanup_failure_e>(value);
@@ -13,7 +13,9 @@
 #ifndef IOX2_HEADER_PUBLISH_SUBSCRIBE_HPP
 #define IOX2_HEADER_PUBLISH_SUBSCRIBE_HPP
 
+#include "iox/duration.hpp"
 #include "iox/layout.hpp"
+#include "iox/optional.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "unique_port_id.hpp"
 
@@ -33,6 +35,15 @@ class HeaderPublishSubscribe {
     /// Returns the number of [`Payload`] elements in the received [`Sample`].
     auto number_of_elements() const -> uint64_t;
 
+    /// Returns the sequence number the source [`Publisher`] assigned when the [`Sample`] was
+    /// sent. A gap in the sequence numbers indicates that [`Sample`]s were lost, e.g. due to safe
+    /// overflow. Returns [`iox::nullopt`] when the [`Service`] was created without send tracking.
+    auto sequence_number() const -> iox::optional<uint64_t>;
+
+    /// Returns the time of the monotonic system clock at which the [`Sample`] was sent. Returns
+    /// [`iox::nullopt`] when the [`Service`] was created without send tracking.
+    auto send_timestamp() const -> iox::optional<iox::units::Duration>;
+
   private:
     template <ServiceType, typename, typename>
     friend class Sample;
@@ -23,6 +23,7 @@
 #include "iox2/listener_error.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/unique_port_id.hpp"
+#include "iox2/wait_policy.hpp"
 
 namespace iox2 {
 /// Represents the receiving endpoint of an event based communication.
@@ -87,6 +88,10 @@ class Listener : public FileDescriptorBased {
     /// Returns the deadline of the corresponding [`Service`].
     auto deadline() const -> iox::optional<iox::units::Duration>;
 
+    /// Returns how often a wait of the [`Listener`] was resolved while spinning, yielding or
+    /// blocking.
+    auto wait_statistics() const -> WaitStatistics;
+
   private:
     template <ServiceType>
     friend class PortFactoryListener;
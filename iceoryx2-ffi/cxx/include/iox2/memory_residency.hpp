@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_MEMORY_RESIDENCY_HPP
+#define IOX2_MEMORY_RESIDENCY_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines when the pages of the data segments, the connections and the dynamic
+/// service config of a port are mapped into the process space.
+enum class MemoryResidency : uint8_t {
+    /// The pages are mapped on first access. The first access of every page
+    /// causes a page fault.
+    OnDemand,
+    /// All pages are touched once when the port is created or a connection is
+    /// established so that no page fault occurs on the hot path.
+    PreFaulted,
+    /// All pages are mapped and locked into the physical memory so that they are
+    /// never swapped out. Is limited by the lockable memory limit of the process
+    /// (`RLIMIT_MEMLOCK`).
+    Locked
+};
+} // namespace iox2
+
+#endif
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_NODE_TRACKER_HPP
+#define IOX2_NODE_TRACKER_HPP
+
+#include "iox/expected.hpp"
+#include "iox/function.hpp"
+#include "iox/optional.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/config.hpp"
+#include "iox2/file_descriptor.hpp"
+#include "iox2/internal/callback_context.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/node_failure_enums.hpp"
+#include "iox2/node_state.hpp"
+#include "iox2/service_type.hpp"
+
+namespace iox2 {
+/// Keeps the [`NodeState`] of every [`Node`] in an in-process cache and updates it
+/// incrementally with [`NodeTracker::sync()`]. The details of a [`Node`] are read once when
+/// it is discovered, afterwards only its liveness is checked. The [`Node`]s are listed only
+/// when one was created or removed.
+template <ServiceType S>
+class NodeTracker {
+  public:
+    /// Creates a new [`NodeTracker`] with an empty cache. The first [`NodeTracker::sync()`]
+    /// reports all existing [`Node`]s as added.
+    explicit NodeTracker(ConfigView config);
+    NodeTracker(const NodeTracker&) = delete;
+    NodeTracker(NodeTracker&& rhs) noexcept;
+    ~NodeTracker();
+
+    auto operator=(const NodeTracker&) -> NodeTracker& = delete;
+    auto operator=(NodeTracker&& rhs) noexcept -> NodeTracker&;
+
+    /// Updates the cache and calls `on_added` for every [`Node`] that was created,
+    /// `on_changed` for every [`Node`] whose [`NodeState`] changed, for instance a [`Node`]
+    /// that died, and `on_removed` for every [`Node`] that was removed since the previous call.
+    auto sync(const iox::function<void(NodeState<S>)>& on_added,
+              const iox::function<void(NodeState<S>)>& on_changed,
+              const iox::function<void(NodeState<S>)>& on_removed) -> iox::expected<void, NodeListFailure>;
+
+    /// Calls the provided callback for every cached [`Node`] without accessing the system.
+    void list(const iox::function<CallbackProgression(NodeState<S>)>& callback) const;
+
+    /// Returns the number of cached [`Node`]s.
+    auto len() const -> uint64_t;
+
+    /// Returns true when no [`Node`] is cached.
+    auto is_empty() const -> bool;
+
+    /// Returns the [`FileDescriptorView`] that becomes readable when a [`Node`] was created
+    /// or removed. Attach it to a [`WaitSet`] to call [`NodeTracker::sync()`] when something
+    /// changed. The death of a [`Node`] does not make it readable, therefore
+    /// [`NodeTracker::sync()`] must also be called periodically when dead [`Node`]s shall be
+    /// detected. Returns [`iox::nullopt`] when no change notifications are available, for
+    /// instance for [`ServiceType::Local`]. The file descriptor can change with
+    /// [`NodeTracker::sync()`], therefore it must be reacquired after every sync.
+    auto file_descriptor() const -> iox::optional<FileDescriptorView>;
+
+  private:
+    using ListCallbackContext = internal::CallbackContext<iox::function<CallbackProgression(NodeState<S>)>>;
+
+    // the C API provides one context for all sync callbacks
+    struct SyncContext {
+        ListCallbackContext* on_added;
+        ListCallbackContext* on_changed;
+        ListCallbackContext* on_removed;
+    };
+
+    static auto on_added_callback(iox2_node_state_e node_state,
+                                  iox2_node_id_ptr node_id,
+                                  const char* executable,
+                                  iox2_node_name_ptr node_name,
+                                  iox2_config_ptr config,
+                                  iox2_callback_context ctx) -> iox2_callback_progression_e;
+    static auto on_changed_callback(iox2_node_state_e node_state,
+                                    iox2_node_id_ptr node_id,
+                                    const char* executable,
+                                    iox2_node_name_ptr node_name,
+                                    iox2_config_ptr config,
+                                    iox2_callback_context ctx) -> iox2_callback_progression_e;
+    static auto on_removed_callback(iox2_node_state_e node_state,
+                                    iox2_node_id_ptr node_id,
+                                    const char* executable,
+                                    iox2_node_name_ptr node_name,
+                                    iox2_config_ptr config,
+                                    iox2_callback_context ctx) -> iox2_callback_progression_e;
+    void drop();
+
+    iox2_node_tracker_h m_handle = nullptr;
+};
+} // namespace iox2
+
+#endif
@@ -18,10 +18,14 @@
 #include "iox2/event_id.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/notifier_error.hpp"
+#include "iox2/publisher_error.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/unique_port_id.hpp"
 
 namespace iox2 {
+template <ServiceType, typename, typename>
+class SampleMut;
+
 /// Represents the sending endpoint of an event based communication.
 template <ServiceType S>
 class Notifier {
@@ -56,6 +60,9 @@ class Notifier {
   private:
     template <ServiceType>
     friend class PortFactoryNotifier;
+    template <ServiceType ST, typename PayloadT, typename UserHeaderT>
+    friend auto send_and_notify(SampleMut<ST, PayloadT, UserHeaderT>&& sample, const Notifier<ST>& notifier)
+        -> iox::expected<size_t, SendError>;
 
     explicit Notifier(iox2_notifier_h handle);
     void drop();
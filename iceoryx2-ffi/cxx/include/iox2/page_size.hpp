@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_PAGE_SIZE_HPP
+#define IOX2_PAGE_SIZE_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines the size of the pages that back the data segment of a [`Publisher`].
+/// Huge pages must be reserved by the system administrator and a hugetlbfs must
+/// be mounted at `/dev/hugepages` (2 MiB) or `/dev/hugepages1G` (1 GiB).
+enum class PageSize : uint8_t {
+    /// The default page size of the system.
+    Default,
+    /// 2 MiB huge pages, provided by the hugetlbfs mounted at `/dev/hugepages`.
+    Huge2MiB,
+    /// 1 GiB huge pages, provided by the hugetlbfs mounted at `/dev/hugepages1G`.
+    Huge1GiB
+};
+} // namespace iox2
+
+#endif
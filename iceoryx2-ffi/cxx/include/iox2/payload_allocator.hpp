@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_PAYLOAD_ALLOCATOR_HPP
+#define IOX2_PAYLOAD_ALLOCATOR_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines how the data segment of a [`Publisher`] manages the memory of the
+/// loaned [`SampleMut`]s.
+enum class PayloadAllocator : uint8_t {
+    /// Every [`SampleMut`] occupies a bucket that is sized for the largest
+    /// slice, independent of the actually loaned slice length.
+    Pool,
+    /// Every [`SampleMut`] occupies a block that is rounded up to the next
+    /// power of two of its size. Small slices use only a fraction of the memory
+    /// a bucket of the [`PayloadAllocator::Pool`] would occupy. The data
+    /// segment is never resized, the [`AllocationStrategy`] is ignored.
+    Buddy
+};
+} // namespace iox2
+
+#endif
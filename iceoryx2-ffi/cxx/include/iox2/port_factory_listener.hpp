@@ -13,10 +13,12 @@
 #ifndef IOX2_PORTFACTORY_LISTENER_HPP
 #define IOX2_PORTFACTORY_LISTENER_HPP
 
+#include "iox/builder_addendum.hpp"
 #include "iox/expected.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/listener.hpp"
 #include "iox2/service_type.hpp"
+#include "iox2/wait_policy.hpp"
 
 namespace iox2 {
 /// Factory to create a new [`Listener`] port/endpoint for
@@ -24,6 +26,10 @@ namespace iox2 {
 /// communication.
 template <ServiceType S>
 class PortFactoryListener {
+    /// Defines the [`WaitPolicy`] of the blocking and timed waits of the [`Listener`].
+    /// By default the [`Listener`] blocks immediately.
+    IOX_BUILDER_OPTIONAL(WaitPolicy, wait_policy);
+
   public:
     PortFactoryListener(PortFactoryListener&&) noexcept = default;
     auto operator=(PortFactoryListener&&) noexcept -> PortFactoryListener& = default;
@@ -17,6 +17,9 @@
 #include "iox/expected.hpp"
 #include "iox2/allocation_strategy.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/memory_residency.hpp"
+#include "iox2/page_size.hpp"
+#include "iox2/payload_allocator.hpp"
 #include "iox2/publisher.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/unable_to_deliver_strategy.hpp"
@@ -35,6 +38,18 @@ class PortFactoryPublisher {
     /// [`Publisher::loan()`] or [`Publisher::loan_uninit()`] in parallel.
     IOX_BUILDER_OPTIONAL(uint64_t, max_loaned_samples);
 
+    /// Defines the [`PageSize`] of the pages that back the data segment of the
+    /// [`Publisher`]. If the system has no huge pages of the requested type
+    /// reserved, the [`Publisher`] falls back to [`PageSize::Default`]. The
+    /// actually used [`PageSize`] is returned by [`Publisher::page_size()`].
+    IOX_BUILDER_OPTIONAL(PageSize, page_size);
+
+    /// Defines the [`MemoryResidency`] of the data segment, the connections and
+    /// the dynamic service config of the [`Publisher`]. With
+    /// [`MemoryResidency::PreFaulted`] or [`MemoryResidency::Locked`] all pages
+    /// are mapped when the [`Publisher`] is created.
+    IOX_BUILDER_OPTIONAL(MemoryResidency, memory_residency);
+
   public:
     PortFactoryPublisher(const PortFactoryPublisher&) = delete;
     PortFactoryPublisher(PortFactoryPublisher&&) = default;
@@ -54,6 +69,13 @@ class PortFactoryPublisher {
     template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
     auto allocation_strategy(AllocationStrategy value) && -> PortFactoryPublisher&&;
 
+    /// Defines the [`PayloadAllocator`] of the data segment. With
+    /// [`PayloadAllocator::Buddy`] slices of varying length occupy only the
+    /// memory they require, rounded up to the next power of two, instead of a
+    /// bucket sized for the largest slice.
+    template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
+    auto payload_allocator(PayloadAllocator value) && -> PortFactoryPublisher&&;
+
     /// Creates a new [`Publisher`] or returns a [`PublisherCreateError`] on failure.
     auto create() && -> iox::expected<Publisher<S, Payload, UserHeader>, PublisherCreateError>;
 
@@ -66,6 +88,7 @@ class PortFactoryPublisher {
     iox2_port_factory_publisher_builder_h m_handle = nullptr;
     iox::optional<uint64_t> m_max_slice_len;
     iox::optional<AllocationStrategy> m_allocation_strategy;
+    iox::optional<PayloadAllocator> m_payload_allocator;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -89,6 +112,14 @@ inline auto PortFactoryPublisher<S, Payload, UserHeader>::allocation_strategy(
     return std::move(*this);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename T, typename>
+inline auto PortFactoryPublisher<S, Payload, UserHeader>::payload_allocator(
+    PayloadAllocator value) && -> PortFactoryPublisher&& {
+    m_payload_allocator.emplace(value);
+    return std::move(*this);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto
 PortFactoryPublisher<S, Payload, UserHeader>::create() && -> iox::expected<Publisher<S, Payload, UserHeader>,
@@ -102,10 +133,22 @@ PortFactoryPublisher<S, Payload, UserHeader>::create() && -> iox::expected<Publi
         .or_else([&]() { iox2_port_factory_publisher_builder_set_initial_max_slice_len(&m_handle, 1); });
     m_max_loaned_samples.and_then(
         [&](auto value) { iox2_port_factory_publisher_builder_set_max_loaned_samples(&m_handle, value); });
+    m_page_size.and_then([&](auto value) {
+        iox2_port_factory_publisher_builder_set_page_size(&m_handle,
+                                                          static_cast<iox2_page_size_e>(iox::into<int>(value)));
+    });
+    m_memory_residency.and_then([&](auto value) {
+        iox2_port_factory_publisher_builder_set_memory_residency(
+            &m_handle, static_cast<iox2_memory_residency_e>(iox::into<int>(value)));
+    });
     m_allocation_strategy.and_then([&](auto value) {
         iox2_port_factory_publisher_builder_set_allocation_strategy(&m_handle,
                                                                     iox::into<iox2_allocation_strategy_e>(value));
     });
+    m_payload_allocator.and_then([&](auto value) {
+        iox2_port_factory_publisher_builder_set_payload_allocator(&m_handle,
+                                                                  iox::into<iox2_payload_allocator_e>(value));
+    });
 
     iox2_publisher_h pub_handle {};
 
@@ -16,6 +16,8 @@
 #include "iox/builder_addendum.hpp"
 #include "iox/expected.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/memory_residency.hpp"
+#include "iox2/receive_policy.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/subscriber.hpp"
 
@@ -30,6 +32,18 @@ class PortFactorySubscriber {
     /// Defines the required buffer size of the [`Subscriber`]. Smallest possible value is `1`.
     IOX_BUILDER_OPTIONAL(uint64_t, buffer_size);
 
+    /// Defines the order in which the [`Subscriber`] receives the [`Sample`]s of
+    /// multiple connected [`Publisher`]s. If not set [`ReceivePolicy::Sequential`]
+    /// is used.
+    IOX_BUILDER_OPTIONAL(ReceivePolicy, receive_policy);
+
+    /// Defines the [`MemoryResidency`] of the connections, the mapped data
+    /// segments of the connected [`Publisher`]s and the dynamic service config of
+    /// the [`Subscriber`]. With [`MemoryResidency::PreFaulted`] or
+    /// [`MemoryResidency::Locked`] all pages are mapped when a connection is
+    /// established.
+    IOX_BUILDER_OPTIONAL(MemoryResidency, memory_residency);
+
   public:
     PortFactorySubscriber(const PortFactorySubscriber&) = delete;
     PortFactorySubscriber(PortFactorySubscriber&&) = default;
@@ -60,6 +74,14 @@ inline auto
 PortFactorySubscriber<S, Payload, UserHeader>::create() && -> iox::expected<Subscriber<S, Payload, UserHeader>,
                                                                             SubscriberCreateError> {
     m_buffer_size.and_then([&](auto value) { iox2_port_factory_subscriber_builder_set_buffer_size(&m_handle, value); });
+    m_receive_policy.and_then([&](auto value) {
+        iox2_port_factory_subscriber_builder_set_receive_policy(
+            &m_handle, static_cast<iox2_receive_policy_e>(iox::into<int>(value)));
+    });
+    m_memory_residency.and_then([&](auto value) {
+        iox2_port_factory_subscriber_builder_set_memory_residency(
+            &m_handle, static_cast<iox2_memory_residency_e>(iox::into<int>(value)));
+    });
 
     iox2_subscriber_h sub_handle {};
     auto result = iox2_port_factory_subscriber_builder_create(m_handle, nullptr, &sub_handle);
@@ -13,11 +13,13 @@
 #ifndef IOX2_PUBLISHER_HPP
 #define IOX2_PUBLISHER_HPP
 
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/slice.hpp"
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/page_size.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/sample_mut.hpp"
 #include "iox2/sample_mut_uninit.hpp"
@@ -52,12 +54,24 @@ class Publisher {
     template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
     auto initial_max_slice_len() const -> uint64_t;
 
+    /// Returns the [`PageSize`] of the pages that back the data segment of the
+    /// [`Publisher`]. When the requested huge pages were not available it is
+    /// [`PageSize::Default`].
+    auto page_size() const -> PageSize;
+
     /// Copies the input `value` into a [`SampleMut`] and delivers it.
     /// On success it returns the number of [`Subscriber`]s that received
     /// the data, otherwise a [`SendError`] describing the failure.
     template <typename T = Payload, typename = std::enable_if_t<!iox::IsSlice<T>::VALUE, void>>
     auto send_copy(const Payload& payload) const -> iox::expected<size_t, SendError>;
 
+    /// Copies the input `value` into a [`SampleMut`] and delivers it like
+    /// [`Publisher::send_copy()`] but waits at most `timeout` in total for [`Subscriber`]s
+    /// with a full buffer, see [`send_with_timeout()`].
+    template <typename T = Payload, typename = std::enable_if_t<!iox::IsSlice<T>::VALUE, void>>
+    auto send_copy_with_timeout(const Payload& payload, const iox::units::Duration& timeout) const
+        -> iox::expected<size_t, SendError>;
+
     template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
     auto send_slice_copy(iox::ImmutableSlice<ValueType>& payload) const -> iox::expected<size_t, SendError>;
 
@@ -156,6 +170,11 @@ inline auto Publisher<S, Payload, UserHeader>::initial_max_slice_len() const ->
     return iox2_publisher_initial_max_slice_len(&m_handle);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Publisher<S, Payload, UserHeader>::page_size() const -> PageSize {
+    return iox::into<PageSize>(static_cast<int>(iox2_publisher_page_size(&m_handle)));
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Publisher<S, Payload, UserHeader>::id() const -> UniquePublisherId {
     iox2_unique_publisher_id_h id_handle = nullptr;
@@ -181,6 +200,29 @@ inline auto Publisher<S, Payload, UserHeader>::send_copy(const Payload& payload)
     return iox::err(iox::into<SendError>(result));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename T, typename>
+inline auto Publisher<S, Payload, UserHeader>::send_copy_with_timeout(const Payload& payload,
+                                                                     const iox::units::Duration& timeout) const
+    -> iox::expected<size_t, SendError> {
+    static_assert(std::is_trivially_copyable_v<Payload>);
+
+    size_t number_of_recipients = 0;
+    auto timespec_timeout = timeout.timespec();
+    auto result = iox2_publisher_send_copy_with_timeout(&m_handle,
+                                                        static_cast<const void*>(&payload),
+                                                        sizeof(Payload),
+                                                        timespec_timeout.tv_sec,
+                                                        timespec_timeout.tv_nsec,
+                                                        &number_of_recipients);
+
+    if (result == IOX2_OK) {
+        return iox::ok(number_of_recipients);
+    }
+
+    return iox::err(iox::into<SendError>(result));
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto Publisher<S, Payload, UserHeader>::send_slice_copy(iox::ImmutableSlice<ValueType>& payload) const
@@ -29,6 +29,10 @@ enum class PublisherCreateError : uint8_t {
     /// The datasegment in which the payload of the [`Publisher`] is stored,
     /// could not be created.
     UnableToCreateDataSegment,
+    /// The requested [`MemoryResidency`] could not be applied to the dynamic
+    /// service config, for instance because the lockable memory limit of the
+    /// process is exceeded.
+    UnableToApplyMemoryResidency,
 };
 } // namespace iox2
 
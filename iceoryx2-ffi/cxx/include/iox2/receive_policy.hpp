@@ -0,0 +1,40 @@
+// Copyright (c) 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_RECEIVE_POLICY_HPP
+#define IOX2_RECEIVE_POLICY_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines the order in which a [`Subscriber`] acquires the [`Sample`]s of
+/// multiple connected [`Publisher`]s.
+enum class ReceivePolicy : uint8_t {
+    /// Every receive call starts with the first connected [`Publisher`] and
+    /// moves on to the next one only when the buffer of the current one is
+    /// empty.
+    Sequential,
+    /// Every receive call continues with the [`Publisher`] that follows the
+    /// one from which the last [`Sample`] was received. Every connected
+    /// [`Publisher`] is served fairly, one [`Sample`] at a time. With
+    /// [`Subscriber::set_publisher_weight()`] a [`Publisher`] can be served
+    /// with up to `weight` consecutive [`Sample`]s.
+    RoundRobin,
+    /// Every receive call acquires the [`Sample`] with the oldest send
+    /// timestamp of all the next [`Sample`]s of the connected [`Publisher`]s.
+    /// Requires a [`Service`] with send tracking, otherwise it behaves like
+    /// [`ReceivePolicy::Sequential`].
+    OldestFirst
+};
+} // namespace iox2
+
+#endif
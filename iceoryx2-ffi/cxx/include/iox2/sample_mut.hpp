@@ -13,11 +13,13 @@
 #ifndef IOX2_SAMPLE_MUT_HPP
 #define IOX2_SAMPLE_MUT_HPP
 
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/slice.hpp"
 #include "iox2/header_publish_subscribe.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/notifier.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/service_type.hpp"
@@ -100,6 +102,12 @@ class SampleMut {
 
     template <ServiceType ST, typename PayloadT, typename UserHeaderT>
     friend auto send(SampleMut<ST, PayloadT, UserHeaderT>&& sample) -> iox::expected<size_t, SendError>;
+    template <ServiceType ST, typename PayloadT, typename UserHeaderT>
+    friend auto send_with_timeout(SampleMut<ST, PayloadT, UserHeaderT>&& sample, const iox::units::Duration& timeout)
+        -> iox::expected<size_t, SendError>;
+    template <ServiceType ST, typename PayloadT, typename UserHeaderT>
+    friend auto send_and_notify(SampleMut<ST, PayloadT, UserHeaderT>&& sample, const Notifier<ST>& notifier)
+        -> iox::expected<size_t, SendError>;
 
     // The sample is defaulted since both members are initialized in Publisher::loan() or
     // Publisher::loan_slice()
@@ -251,6 +259,47 @@ inline auto send(SampleMut<S, Payload, UserHeader>&& sample) -> iox::expected<si
     return iox::err(iox::into<SendError>(result));
 }
 
+/// Sends the [`SampleMut`] like [`send()`] but waits at most `timeout` in total for
+/// [`Subscriber`]s whose buffer is full and that do not allow safe overflow, independent of the
+/// configured [`UnableToDeliverStrategy`]. [`Subscriber`]s that still have no space left after
+/// the timeout do not receive the sample.
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto send_with_timeout(SampleMut<S, Payload, UserHeader>&& sample, const iox::units::Duration& timeout)
+    -> iox::expected<size_t, SendError> {
+    size_t number_of_recipients = 0;
+    auto timespec_timeout = timeout.timespec();
+    auto result = iox2_sample_mut_send_with_timeout(
+        sample.m_handle, timespec_timeout.tv_sec, timespec_timeout.tv_nsec, &number_of_recipients);
+    sample.m_handle = nullptr;
+
+    if (result == IOX2_OK) {
+        return iox::ok(number_of_recipients);
+    }
+
+    return iox::err(iox::into<SendError>(result));
+}
+
+/// Sends the [`SampleMut`] like [`send()`] and notifies the [`Listener`]s of the provided
+/// [`Notifier`]s service in the same call. Only the [`Listener`]s of the [`Node`]s whose
+/// [`Subscriber`]s had no unconsumed sample before this sample arrived are notified, so that
+/// a busy [`Subscriber`] is not woken up for a sample it will find anyway. Until a
+/// [`Subscriber`] has received from its empty buffer once after the first call, its [`Node`]
+/// is notified with every call. The notification is sent with the default [`EventId`] of
+/// the [`Notifier`].
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto send_and_notify(SampleMut<S, Payload, UserHeader>&& sample, const Notifier<S>& notifier)
+    -> iox::expected<size_t, SendError> {
+    size_t number_of_recipients = 0;
+    auto result = iox2_sample_mut_send_and_notify(sample.m_handle, &notifier.m_handle, &number_of_recipients);
+    sample.m_handle = nullptr;
+
+    if (result == IOX2_OK) {
+        return iox::ok(number_of_recipients);
+    }
+
+    return iox::err(iox::into<SendError>(result));
+}
+
 } // namespace iox2
 
 #endif
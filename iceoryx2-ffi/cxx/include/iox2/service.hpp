@@ -40,7 +40,8 @@ class Service {
     static auto details(const ServiceName& service_name, ConfigView config, MessagingPattern messaging_pattern)
         -> iox::expected<iox::optional<ServiceDetails<S>>, ServiceDetailsError>;
 
-    /// Returns a list of all services created under a given [`config::Config`].
+    /// Returns a list of all services created under a given [`config::Config`]. Every call
+    /// reads all services, use the [`ServiceTracker`] to observe the services repeatedly.
     static auto list(ConfigView config, const iox::function<CallbackProgression(ServiceDetails<S>)>& callback)
         -> iox::expected<void, ServiceListError>;
 };
@@ -17,6 +17,7 @@
 #include "iox/expected.hpp"
 #include "iox2/attribute_specifier.hpp"
 #include "iox2/attribute_verifier.hpp"
+#include "iox2/connection_backend.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/internal/service_builder_publish_subscribe_internal.hpp"
 #include "iox2/payload_info.hpp"
@@ -40,6 +41,16 @@ class ServiceBuilderPublishSubscribe {
     /// [`Service`] is opened it requires the service to have the defined overflow behavior.
     IOX_BUILDER_OPTIONAL(bool, enable_safe_overflow);
 
+    /// If the [`Service`] is created, defines if every [`Sample`] carries a sequence number and a
+    /// send timestamp in its [`HeaderPublishSubscribe`]. If an existing [`Service`] is opened it
+    /// requires the service to have the defined setting.
+    IOX_BUILDER_OPTIONAL(bool, enable_send_tracking);
+
+    /// If the [`Service`] is created, defines the [`ConnectionBackend`] that is used to deliver
+    /// the [`Sample`]s from the [`Publisher`]s to the [`Subscriber`]s. If an existing [`Service`]
+    /// is opened it requires the service to use the defined [`ConnectionBackend`].
+    IOX_BUILDER_OPTIONAL(ConnectionBackend, connection_backend);
+
     /// If the [`Service`] is created it defines how many [`crate::sample::Sample`] a
     /// [`crate::port::subscriber::Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -224,6 +235,12 @@ template <typename Payload, typename UserHeader, ServiceType S>
 inline void ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::set_parameters() {
     m_enable_safe_overflow.and_then(
         [&](auto value) { iox2_service_builder_pub_sub_set_enable_safe_overflow(&m_handle, value); });
+    m_enable_send_tracking.and_then(
+        [&](auto value) { iox2_service_builder_pub_sub_set_enable_send_tracking(&m_handle, value); });
+    m_connection_backend.and_then([&](auto value) {
+        iox2_service_builder_pub_sub_set_connection_backend(
+            &m_handle, static_cast<iox2_connection_backend_e>(iox::into<int>(value)));
+    });
     m_subscriber_max_borrowed_samples.and_then(
         [&](auto value) { iox2_service_builder_pub_sub_set_subscriber_max_borrowed_samples(&m_handle, value); });
     m_history_size.and_then([&](auto value) { iox2_service_builder_pub_sub_set_history_size(&m_handle, value); });
@@ -49,6 +49,10 @@ enum class PublishSubscribeOpenError : uint8_t {
     DoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     IncompatibleOverflowBehavior,
+    /// The [`Service`] required send tracking setting is not compatible.
+    IncompatibleSendTrackingSetting,
+    /// The [`Service`] required connection backend is not compatible.
+    IncompatibleConnectionBackend,
     /// The process has not enough permissions to open the [`Service`]
     InsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing,
@@ -127,6 +131,10 @@ enum class PublishSubscribeOpenOrCreateError : uint8_t {
     OpenDoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     OpenIncompatibleOverflowBehavior,
+    /// The [`Service`] required send tracking setting is not compatible.
+    OpenIncompatibleSendTrackingSetting,
+    /// The [`Service`] required connection backend is not compatible.
+    OpenIncompatibleConnectionBackend,
     /// The process has not enough permissions to open the [`Service`]
     OpenInsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing,
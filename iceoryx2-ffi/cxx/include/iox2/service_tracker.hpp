@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_SERVICE_TRACKER_HPP
+#define IOX2_SERVICE_TRACKER_HPP
+
+#include "iox/expected.hpp"
+#include "iox/function.hpp"
+#include "iox/optional.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/config.hpp"
+#include "iox2/file_descriptor.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/service_error_enums.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/static_config.hpp"
+
+namespace iox2 {
+/// Keeps the [`StaticConfig`] of every [`Service`] in an in-process cache and updates it
+/// incrementally with [`ServiceTracker::sync()`]. In contrast to [`Service::list()`] only the
+/// [`Service`]s that were added since the previous sync are read and the [`Service`]s are
+/// listed only when one was created or removed.
+template <ServiceType S>
+class ServiceTracker {
+  public:
+    /// Creates a new [`ServiceTracker`] with an empty cache. The first [`ServiceTracker::sync()`]
+    /// reports all existing [`Service`]s as added.
+    explicit ServiceTracker(ConfigView config);
+    ServiceTracker(const ServiceTracker&) = delete;
+    ServiceTracker(ServiceTracker&& rhs) noexcept;
+    ~ServiceTracker();
+
+    auto operator=(const ServiceTracker&) -> ServiceTracker& = delete;
+    auto operator=(ServiceTracker&& rhs) noexcept -> ServiceTracker&;
+
+    /// Updates the cache and calls `on_added` for every [`Service`] that was created and
+    /// `on_removed` for every [`Service`] that was removed since the previous call.
+    auto sync(const iox::function<void(StaticConfig)>& on_added, const iox::function<void(StaticConfig)>& on_removed)
+        -> iox::expected<void, ServiceListError>;
+
+    /// Calls the provided callback for every cached [`Service`] without accessing the system.
+    void list(const iox::function<CallbackProgression(StaticConfig)>& callback) const;
+
+    /// Returns the number of cached [`Service`]s.
+    auto len() const -> uint64_t;
+
+    /// Returns true when no [`Service`] is cached.
+    auto is_empty() const -> bool;
+
+    /// Returns the [`FileDescriptorView`] that becomes readable when a [`Service`] was created
+    /// or removed. Attach it to a [`WaitSet`] to call [`ServiceTracker::sync()`] only when
+    /// something changed. Returns [`iox::nullopt`] when no change notifications are available,
+    /// for instance for [`ServiceType::Local`]. The file descriptor can change with
+    /// [`ServiceTracker::sync()`], therefore it must be reacquired after every sync.
+    auto file_descriptor() const -> iox::optional<FileDescriptorView>;
+
+  private:
+    // the C API provides one context for both sync callbacks
+    struct SyncContext {
+        iox::function<void(StaticConfig)>* on_added;
+        iox::function<void(StaticConfig)>* on_removed;
+    };
+
+    static void on_added_callback(const iox2_static_config_t* static_config, void* ctx);
+    static void on_removed_callback(const iox2_static_config_t* static_config, void* ctx);
+    static auto list_callback(const iox2_static_config_t* static_config, void* ctx) -> iox2_callback_progression_e;
+    void drop();
+
+    iox2_service_tracker_h m_handle = nullptr;
+};
+} // namespace iox2
+
+#endif
@@ -35,6 +35,8 @@ class StaticConfig {
   private:
     template <ServiceType>
     friend auto list_callback(const iox2_static_config_t*, void*) -> iox2_callback_progression_e;
+    template <ServiceType>
+    friend class ServiceTracker;
     explicit StaticConfig(iox2_static_config_t value);
 
     iox2_static_config_t m_value;
@@ -13,6 +13,7 @@
 #ifndef IOX2_STATIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 #define IOX2_STATIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 
+#include "iox2/connection_backend.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/message_type_details.hpp"
 
@@ -48,6 +49,14 @@ class StaticConfigPublishSubscribe {
     /// [`Sample`] from the [`Subscriber`] when its buffer is full.
     auto has_safe_overflow() const -> bool;
 
+    /// Returns true if every [`Sample`] of the [`Service`] carries a sequence number and a send
+    /// timestamp in its [`HeaderPublishSubscribe`], otherwise false.
+    auto has_send_tracking() const -> bool;
+
+    /// Returns the [`ConnectionBackend`] that is used to deliver the [`Sample`]s from the
+    /// [`Publisher`]s to the [`Subscriber`]s.
+    auto connection_backend() const -> ConnectionBackend;
+
     /// Returns the type details of the [`Service`].
     auto message_type_details() const -> MessageTypeDetails;
 
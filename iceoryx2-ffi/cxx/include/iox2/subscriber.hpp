@@ -15,9 +15,12 @@
 
 #include "iox/assertions_addendum.hpp"
 #include "iox/expected.hpp"
+#include "iox/function.hpp"
 #include "iox/optional.hpp"
+#include "iox2/callback_progression.hpp"
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
+#include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/sample.hpp"
 #include "iox2/service_type.hpp"
@@ -42,10 +45,29 @@ class Subscriber {
     /// Returns the internal buffer size of the [`Subscriber`].
     auto buffer_size() const -> uint64_t;
 
+    /// Defines how many consecutive [`Sample`]s are received from the [`Publisher`] with the
+    /// given [`UniquePublisherId`] before the next one is visited when the [`Subscriber`] uses
+    /// [`ReceivePolicy::RoundRobin`]. Every [`Publisher`] has the weight 1 by default, a weight
+    /// of 0 is treated as 1. The weight can be set before the [`Publisher`] is connected.
+    void set_publisher_weight(const UniquePublisherId& publisher_id, uint64_t weight) const;
+
+    /// Returns the weight of the [`Publisher`] with the given [`UniquePublisherId`], see
+    /// [`Subscriber::set_publisher_weight()`].
+    auto publisher_weight(const UniquePublisherId& publisher_id) const -> uint64_t;
+
     /// Receives a [`Sample`] from [`Publisher`]. If no sample could be
     /// received [`None`] is returned. If a failure occurs [`ReceiveError`] is returned.
     auto receive() const -> iox::expected<iox::optional<Sample<S, Payload, UserHeader>>, ReceiveError>;
 
+    /// Receives up to `max_number_of_samples` [`Sample`]s from all connected [`Publisher`]s
+    /// with a single call and calls the provided callback for every one of them. The
+    /// iteration can be stopped early by returning [`CallbackProgression::Stop`].
+    /// On success the number of received [`Sample`]s is returned, if a failure occurs
+    /// [`ReceiveError`] is returned.
+    auto receive_batch(uint64_t max_number_of_samples,
+                       const iox::function<CallbackProgression(Sample<S, Payload, UserHeader>)>& callback) const
+        -> iox::expected<uint64_t, ReceiveError>;
+
     /// Explicitly updates all connections to the [`Subscriber`]s. This is
     /// required to be called whenever a new [`Subscriber`] connected to
     /// the service. It is done implicitly whenever [`SampleMut::send()`] or
@@ -65,6 +87,10 @@ class Subscriber {
     explicit Subscriber(iox2_subscriber_h handle);
     void drop();
 
+    static auto receive_batch_callback(iox2_sample_t* sample_struct_ptr,
+                                       iox2_sample_h sample_handle,
+                                       iox2_callback_context context) -> iox2_callback_progression_e;
+
     iox2_subscriber_h m_handle = nullptr;
 };
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -126,6 +152,18 @@ inline auto Subscriber<S, Payload, UserHeader>::buffer_size() const -> uint64_t
     IOX_TODO();
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline void Subscriber<S, Payload, UserHeader>::set_publisher_weight(const UniquePublisherId& publisher_id,
+                                                                     const uint64_t weight) const {
+    iox2_subscriber_set_publisher_weight(&m_handle, &publisher_id.m_handle, weight);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::publisher_weight(const UniquePublisherId& publisher_id) const
+    -> uint64_t {
+    return iox2_subscriber_publisher_weight(&m_handle, &publisher_id.m_handle);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::receive() const
     -> iox::expected<iox::optional<Sample<S, Payload, UserHeader>>, ReceiveError> {
@@ -142,6 +180,40 @@ inline auto Subscriber<S, Payload, UserHeader>::receive() const
     return iox::err(iox::into<ReceiveError>(result));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::receive_batch_callback(iox2_sample_t* sample_struct_ptr,
+                                                                       iox2_sample_h sample_handle [[maybe_unused]],
+                                                                       iox2_callback_context context)
+    -> iox2_callback_progression_e {
+    Sample<S, Payload, UserHeader> sample;
+    internal::iox2_sample_move(sample_struct_ptr, &sample.m_sample, &sample.m_handle);
+
+    auto* callback =
+        internal::ctx_cast<iox::function<CallbackProgression(Sample<S, Payload, UserHeader>)>>(context);
+    return iox::into<iox2_callback_progression_e>(callback->value()(std::move(sample)));
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::receive_batch(
+    uint64_t max_number_of_samples,
+    const iox::function<CallbackProgression(Sample<S, Payload, UserHeader>)>& callback) const
+    -> iox::expected<uint64_t, ReceiveError> {
+    auto ctx = internal::ctx(callback);
+    size_t number_of_received_samples = 0;
+
+    auto result = iox2_subscriber_receive_batch(&m_handle,
+                                                max_number_of_samples,
+                                                receive_batch_callback,
+                                                static_cast<void*>(&ctx),
+                                                &number_of_received_samples);
+
+    if (result == IOX2_OK) {
+        return iox::ok(static_cast<uint64_t>(number_of_received_samples));
+    }
+
+    return iox::err(iox::into<ReceiveError>(result));
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::update_connections() const -> iox::expected<void, ConnectionFailure> {
     auto result = iox2_subscriber_update_connections(&m_handle);
@@ -28,6 +28,11 @@ enum class SubscriberCreateError : uint8_t {
     /// When the [`Subscriber`] requires a larger buffer size than the
     /// [`Service`] offers the creation will fail.
     BufferSizeExceedsMaxSupportedBufferSizeOfService,
+
+    /// The requested [`MemoryResidency`] could not be applied to the dynamic
+    /// service config, for instance because the lockable memory limit of the
+    /// process is exceeded.
+    UnableToApplyMemoryResidency,
 };
 
 } // namespace iox2
@@ -36,6 +36,8 @@ class UniquePublisherId {
   private:
     template <ServiceType, typename, typename>
     friend class Publisher;
+    template <ServiceType, typename, typename>
+    friend class Subscriber;
     friend class HeaderPublishSubscribe;
     friend auto operator==(const UniquePublisherId&, const UniquePublisherId&) -> bool;
     friend auto operator<(const UniquePublisherId&, const UniquePublisherId&) -> bool;
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_WAIT_POLICY_HPP
+#define IOX2_WAIT_POLICY_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines how a blocking wait of a [`Listener`] or a [`WaitSet`] is performed. The wait
+/// busy polls for [`WaitPolicy::spin_duration()`], then yields the CPU for
+/// [`WaitPolicy::yield_duration()`] and finally blocks in the operating system.
+///
+/// The default policy blocks immediately.
+class WaitPolicy {
+  public:
+    /// Creates a [`WaitPolicy`] that blocks immediately.
+    WaitPolicy() = default;
+
+    /// Creates a new [`WaitPolicy`] that spins for `spin_duration`, then yields for
+    /// `yield_duration` and then blocks.
+    WaitPolicy(iox::units::Duration spin_duration, iox::units::Duration yield_duration);
+
+    /// Returns how long the wait busy polls before it starts to yield.
+    auto spin_duration() const -> iox::units::Duration;
+
+    /// Returns how long the wait yields after spinning before it blocks.
+    auto yield_duration() const -> iox::units::Duration;
+
+  private:
+    iox::units::Duration m_spin_duration = iox::units::Duration::zero();
+    iox::units::Duration m_yield_duration = iox::units::Duration::zero();
+};
+
+/// Reports how often a wait with a [`WaitPolicy`] was resolved in which phase. Waits that
+/// ended with a timeout or a sporadic wakeup are not counted and neither are waits with a
+/// blocking [`WaitPolicy`].
+struct WaitStatistics {
+    /// The number of waits that were resolved while spinning.
+    uint64_t resolved_by_spinning = 0;
+    /// The number of waits that were resolved while yielding.
+    uint64_t resolved_by_yielding = 0;
+    /// The number of waits that were resolved while blocking.
+    uint64_t resolved_by_blocking = 0;
+};
+} // namespace iox2
+
+#endif
@@ -16,17 +16,21 @@
 #include "iox/builder_addendum.hpp"
 #include "iox/duration.hpp"
 #include "iox/expected.hpp"
+#include "iox/vector.hpp"
 #include "iox2/callback_progression.hpp"
 #include "iox2/file_descriptor.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/listener.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/signal_handling_mode.hpp"
+#include "iox2/subscriber.hpp"
+#include "iox2/wait_policy.hpp"
 #include "iox2/waitset_enums.hpp"
 
 namespace iox2 {
-/// The [`WaitSetGuard`] is returned by [`WaitSet::attach_deadline()`], [`WaitSet::attach_notification()`]
-/// or [`WaitSet::attach_interval()`]. As soon as it goes out-of-scope it detaches the attachment.
+/// The [`WaitSetGuard`] is returned by [`WaitSet::attach_deadline()`], [`WaitSet::attach_notification()`],
+/// [`WaitSet::attach_interval()`] or [`WaitSet::attach_polling()`]. As soon as it goes out-of-scope it detaches
+/// the attachment.
 /// It can also be used to determine the origin of an event in [`WaitSet::wait_and_process()`] or
 /// [`WaitSet::try_wait_and_process()`] via [`WaitSetAttachmentId::has_event_from()`] or
 /// [`WaitSetAttachmentId::has_missed_deadline()`].
@@ -64,8 +68,8 @@ class WaitSetAttachmentId {
     ~WaitSetAttachmentId();
 
     /// Creates an [`WaitSetAttachmentId`] from a [`WaitSetGuard`] that was returned via
-    /// [`WaitSet::attach_interval()`], [`WaitSet::attach_notification()`] or
-    /// [`WaitSet::attach_deadline()`].
+    /// [`WaitSet::attach_interval()`], [`WaitSet::attach_notification()`],
+    /// [`WaitSet::attach_deadline()`] or [`WaitSet::attach_polling()`].
     static auto from_guard(const WaitSetGuard<S>& guard) -> WaitSetAttachmentId;
 
     /// Returns true if an event was emitted from a notification or deadline attachment
@@ -243,13 +247,54 @@ class WaitSet {
     /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
     auto attach_interval(iox::units::Duration deadline) -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
 
+    /// Attaches a predicate that is polled by the [`WaitSet`]. It is meant for objects without
+    /// a file descriptor so that no additional event service and notification is required.
+    /// Whenever the predicate returns true, the [`WaitSet`] informs the user in
+    /// [`WaitSet::wait_and_process()`]. The predicate is evaluated in every spin and yield
+    /// iteration of the [`WaitPolicy`] and at least once per poll interval while the
+    /// [`WaitSet`] blocks. It must be cheap, must not block and must not attach to or detach
+    /// from the [`WaitSet`].
+    ///
+    /// # Safety
+    ///
+    /// * The predicate must life at least as long as the returned [`WaitSetGuard`].
+    /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
+    auto attach_polling(const iox::function<bool()>& predicate)
+        -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
+
+    /// Attaches a [`Subscriber`] that is polled with [`Subscriber::has_samples()`] by the
+    /// [`WaitSet`]. Whenever the [`Subscriber`] has samples, the [`WaitSet`] informs the user
+    /// in [`WaitSet::wait_and_process()`] without requiring an additional notification.
+    ///
+    /// # Safety
+    ///
+    /// * The [`Subscriber`] must life at least as long as the returned [`WaitSetGuard`].
+    /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
+    template <typename Payload, typename UserHeader>
+    auto attach_polling(const Subscriber<S, Payload, UserHeader>& subscriber)
+        -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
+
     /// Returns the [`SignalHandlingMode`] with which the [`WaitSet`] was created.
     auto signal_handling_mode() const -> SignalHandlingMode;
 
+    /// Returns the timer slack with which the [`WaitSet`] was created.
+    auto timer_slack() const -> iox::units::Duration;
+
+    /// Returns the poll interval with which the [`WaitSet`] was created.
+    auto poll_interval() const -> iox::units::Duration;
+
+    /// Returns how often a wait of the [`WaitSet`] was resolved while spinning, yielding or
+    /// blocking.
+    auto wait_statistics() const -> WaitStatistics;
+
   private:
     friend class WaitSetBuilder;
+    template <ServiceType>
+    friend class WaitSetExecutor;
     explicit WaitSet(iox2_waitset_h handle);
     void drop();
+    auto attach_polling(iox2_waitset_polling_callback callback, const void* context)
+        -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
 
     iox2_waitset_h m_handle = nullptr;
 };
@@ -261,6 +306,21 @@ class WaitSetBuilder {
     /// that returns any received [`Signal`] via its [`WaitSetRunResult`] return value.
     IOX_BUILDER_OPTIONAL(SignalHandlingMode, signal_handling_mode);
 
+    /// Defines the timer slack of the [`WaitSet`]. Deadlines and intervals are delayed up
+    /// to the next multiple of the timer slack so that timeouts which are close to each
+    /// other are handled together with one wakeup.
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, timer_slack);
+
+    /// Defines the [`WaitPolicy`] of the [`WaitSet`]. A wait busy polls and yields the CPU
+    /// before it blocks so that wakeups with a low latency do not pay the scheduler.
+    /// By default the [`WaitSet`] blocks immediately.
+    IOX_BUILDER_OPTIONAL(WaitPolicy, wait_policy);
+
+    /// Defines how often a blocking [`WaitSet`] evaluates the attachments of
+    /// [`WaitSet::attach_polling()`]. A shorter interval reduces their latency but causes more
+    /// wakeups. By default it is one millisecond.
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, poll_interval);
+
   public:
     WaitSetBuilder();
     ~WaitSetBuilder() = default;
@@ -277,5 +337,89 @@ class WaitSetBuilder {
   private:
     iox2_waitset_builder_h m_handle = nullptr;
 };
+
+/// The maximum number of CPU cores that can be defined with
+/// [`WaitSetExecutorBuilder::cpu_affinity()`].
+constexpr uint64_t WAITSET_EXECUTOR_MAX_CPU_AFFINITY = 64;
+
+/// The CPU cores on which the worker threads of the [`WaitSetExecutor`] run.
+using WaitSetExecutorCpuAffinity = iox::vector<size_t, WAITSET_EXECUTOR_MAX_CPU_AFFINITY>;
+
+/// Waits on a [`WaitSet`] in the calling thread and dispatches every event to a pool of worker
+/// threads. A slow callback of one attachment therefore does not delay the handling of the other
+/// attachments. The events of one attachment are never processed concurrently.
+///
+/// Can be created via the [`WaitSetExecutorBuilder`].
+template <ServiceType S>
+class WaitSetExecutor {
+  public:
+    /// Waits on the [`WaitSet`] until the user explicitly requests to stop by returning
+    /// [`CallbackProgression::Stop`] or a signal was received, like [`WaitSet::wait_and_process()`].
+    /// Every event is handed to one of the worker threads which calls `fn_call` with the
+    /// corresponding [`WaitSetAttachmentId`]. Therefore, `fn_call` must be thread-safe.
+    ///
+    /// When the callback returns [`CallbackProgression::Stop`] all events that were not yet
+    /// handled are lost and the call returns [`WaitSetRunResult::StopRequest`] after all
+    /// callbacks that are currently running have returned.
+    auto run(const iox::function<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+        -> iox::expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Returns the number of worker threads.
+    auto number_of_threads() const -> uint64_t;
+
+  private:
+    friend class WaitSetExecutorBuilder;
+    WaitSetExecutor(WaitSet<S>& waitset,
+                    uint64_t number_of_threads,
+                    const iox::optional<WaitSetExecutorCpuAffinity>& cpu_affinity,
+                    const iox::optional<uint8_t>& priority);
+
+    WaitSet<S>* m_waitset = nullptr;
+    uint64_t m_number_of_threads = 1;
+    iox::optional<WaitSetExecutorCpuAffinity> m_cpu_affinity;
+    iox::optional<uint8_t> m_priority;
+};
+
+/// The builder for the [`WaitSetExecutor`].
+class WaitSetExecutorBuilder {
+    /// Defines the number of worker threads that call the callback. At least one worker is used.
+    IOX_BUILDER_PARAMETER(uint64_t, number_of_threads, 1);
+
+    /// Defines the CPU cores on which the worker threads run. The worker `n` is pinned to the
+    /// CPU core `cpu_affinity[n % cpu_affinity.size()]`. By default the workers can run on every
+    /// core.
+    IOX_BUILDER_OPTIONAL(WaitSetExecutorCpuAffinity, cpu_affinity);
+
+    /// Defines the priority of the worker threads whereby `0` represents the lowest and `255` the
+    /// highest priority. By default the workers inherit the scheduling attributes of the thread
+    /// that calls [`WaitSetExecutor::run()`].
+    IOX_BUILDER_OPTIONAL(uint8_t, priority);
+
+  public:
+    WaitSetExecutorBuilder() = default;
+    ~WaitSetExecutorBuilder() = default;
+
+    WaitSetExecutorBuilder(const WaitSetExecutorBuilder&) = delete;
+    WaitSetExecutorBuilder(WaitSetExecutorBuilder&&) = default;
+    auto operator=(const WaitSetExecutorBuilder&) -> WaitSetExecutorBuilder& = delete;
+    auto operator=(WaitSetExecutorBuilder&&) -> WaitSetExecutorBuilder& = default;
+
+    /// Creates the [`WaitSetExecutor`] for the provided [`WaitSet`]. The [`WaitSet`] must
+    /// outlive the [`WaitSetExecutor`].
+    template <ServiceType S>
+    auto create(WaitSet<S>& waitset) const&& -> WaitSetExecutor<S>;
+};
+
+template <ServiceType S>
+template <typename Payload, typename UserHeader>
+inline auto WaitSet<S>::attach_polling(const Subscriber<S, Payload, UserHeader>& subscriber)
+    -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
+    return attach_polling(
+        [](iox2_callback_context context) -> bool {
+            auto has_samples = static_cast<const Subscriber<S, Payload, UserHeader>*>(context)->has_samples();
+            return has_samples.has_value() && has_samples.value();
+        },
+        &subscriber);
+}
 } // namespace iox2
 #endif
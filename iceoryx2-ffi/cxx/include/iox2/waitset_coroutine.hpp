@@ -0,0 +1,642 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_WAITSET_COROUTINE_HPP
+#define IOX2_WAITSET_COROUTINE_HPP
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "iox2/waitset_coroutine.hpp requires a compiler with C++20 coroutine support"
+#endif
+
+#include "iox/assertions.hpp"
+#include "iox/expected.hpp"
+#include "iox/optional.hpp"
+#include "iox2/event_id.hpp"
+#include "iox2/listener.hpp"
+#include "iox2/sample.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/subscriber.hpp"
+#include "iox2/waitset.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace iox2 {
+template <ServiceType>
+class WaitSetScheduler;
+
+/// The coroutine type that can be driven by the [`WaitSetScheduler`]. The coroutine frame is
+/// allocated once when the coroutine is called, awaiting an [`AsyncListener`] or an
+/// [`AsyncSubscriber`] does not allocate.
+///
+/// The [`WaitSetTask`] owns the coroutine and must not be destroyed while the coroutine is
+/// suspended on an awaitable of a [`WaitSetScheduler`].
+class WaitSetTask {
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming), required by the coroutine machinery
+    class promise_type {
+      public:
+        auto get_return_object() -> WaitSetTask {
+            return WaitSetTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        static auto initial_suspend() noexcept -> std::suspend_always {
+            return {};
+        }
+
+        static auto final_suspend() noexcept -> std::suspend_always {
+            return {};
+        }
+
+        void return_void() noexcept {
+        }
+
+        [[noreturn]] static void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+
+    WaitSetTask(WaitSetTask&& rhs) noexcept
+        : m_handle { std::exchange(rhs.m_handle, {}) }
+        , m_is_started { rhs.m_is_started } {
+    }
+
+    auto operator=(WaitSetTask&& rhs) noexcept -> WaitSetTask& {
+        if (this != &rhs) {
+            drop();
+            m_handle = std::exchange(rhs.m_handle, {});
+            m_is_started = rhs.m_is_started;
+        }
+        return *this;
+    }
+
+    ~WaitSetTask() {
+        drop();
+    }
+
+    WaitSetTask(const WaitSetTask&) = delete;
+    auto operator=(const WaitSetTask&) -> WaitSetTask& = delete;
+
+    /// Returns true when the coroutine has run to completion, otherwise false.
+    auto is_done() const -> bool {
+        return !m_handle || m_handle.done();
+    }
+
+  private:
+    template <ServiceType>
+    friend class WaitSetScheduler;
+
+    explicit WaitSetTask(std::coroutine_handle<promise_type> handle)
+        : m_handle { handle } {
+    }
+
+    void drop() {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+    bool m_is_started = false;
+};
+
+namespace internal {
+/// Base of every object that can be awaited with the [`WaitSetScheduler`]. It owns the
+/// [`WaitSetGuard`] of the attachment and stores the coroutine that waits on it.
+template <ServiceType S>
+class WaitSetSchedulerSource {
+  public:
+    WaitSetSchedulerSource(const WaitSetSchedulerSource&) = delete;
+    auto operator=(const WaitSetSchedulerSource&) -> WaitSetSchedulerSource& = delete;
+    auto operator=(WaitSetSchedulerSource&&) -> WaitSetSchedulerSource& = delete;
+    virtual ~WaitSetSchedulerSource();
+
+  protected:
+    WaitSetSchedulerSource(WaitSetScheduler<S>& scheduler, WaitSetGuard<S>&& guard);
+    WaitSetSchedulerSource(WaitSetSchedulerSource&& rhs) noexcept;
+
+    /// Called by the [`WaitSetScheduler`] whenever the attachment was triggered. Returns true
+    /// when the waiting coroutine can be resumed.
+    virtual auto try_complete() -> bool = 0;
+
+    /// Registers the coroutine that waits on the source. Only one coroutine can wait at a time.
+    void suspend(std::coroutine_handle<> handle);
+
+  private:
+    friend class WaitSetScheduler<S>;
+
+    WaitSetScheduler<S>* m_scheduler = nullptr;
+    WaitSetGuard<S> m_guard;
+    std::coroutine_handle<> m_waiting;
+    WaitSetSchedulerSource* m_prev = nullptr;
+    WaitSetSchedulerSource* m_next = nullptr;
+    WaitSetSchedulerSource* m_next_triggered = nullptr;
+    bool m_is_triggered = false;
+};
+} // namespace internal
+
+/// A [`Listener`] attached to a [`WaitSetScheduler`] that can be awaited in a [`WaitSetTask`]
+/// with `co_await async_listener.next_event()`.
+///
+/// Events that arrive while no coroutine awaits the [`AsyncListener`] keep the [`WaitSet`]
+/// awake, therefore it should be awaited continuously by one coroutine.
+template <ServiceType S>
+class AsyncListener : public internal::WaitSetSchedulerSource<S> {
+  public:
+    /// The awaitable returned by [`AsyncListener::next_event()`]. It is stored in the frame of
+    /// the awaiting coroutine.
+    class NextEvent {
+      public:
+        auto await_ready() -> bool {
+            return m_source->poll(*this);
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            m_source->m_awaiter = this;
+            m_source->suspend(handle);
+        }
+
+        auto await_resume() -> iox::expected<EventId, ListenerWaitError> {
+            return std::move(m_result.value());
+        }
+
+      private:
+        friend class AsyncListener;
+        explicit NextEvent(AsyncListener& source)
+            : m_source { &source } {
+        }
+
+        AsyncListener* m_source = nullptr;
+        iox::optional<iox::expected<EventId, ListenerWaitError>> m_result;
+    };
+
+    AsyncListener(AsyncListener&& rhs) noexcept;
+    auto operator=(AsyncListener&&) -> AsyncListener& = delete;
+    ~AsyncListener() override = default;
+
+    AsyncListener(const AsyncListener&) = delete;
+    auto operator=(const AsyncListener&) -> AsyncListener& = delete;
+
+    /// Returns an awaitable that resumes the coroutine as soon as the [`Listener`] has received
+    /// an [`EventId`].
+    auto next_event() -> NextEvent {
+        return NextEvent(*this);
+    }
+
+  private:
+    friend class WaitSetScheduler<S>;
+    AsyncListener(WaitSetScheduler<S>& scheduler, WaitSetGuard<S>&& guard, Listener<S>& listener);
+
+    auto try_complete() -> bool override;
+    auto poll(NextEvent& awaiter) -> bool;
+
+    Listener<S>* m_listener = nullptr;
+    NextEvent* m_awaiter = nullptr;
+};
+
+/// A [`Subscriber`] attached to a [`WaitSetScheduler`] that can be awaited in a [`WaitSetTask`]
+/// with `co_await async_subscriber.next_sample()`. Since a [`Subscriber`] cannot be attached to
+/// a [`WaitSet`] directly, the [`Listener`] of the event service which is notified by the
+/// publisher side is attached instead.
+template <ServiceType S, typename Payload, typename UserHeader>
+class AsyncSubscriber : public internal::WaitSetSchedulerSource<S> {
+  public:
+    /// The awaitable returned by [`AsyncSubscriber::next_sample()`]. It is stored in the frame of
+    /// the awaiting coroutine.
+    class NextSample {
+      public:
+        auto await_ready() -> bool {
+            return m_source->poll(*this);
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            m_source->m_awaiter = this;
+            m_source->suspend(handle);
+        }
+
+        auto await_resume() -> iox::expected<Sample<S, Payload, UserHeader>, ReceiveError> {
+            return std::move(m_result.value());
+        }
+
+      private:
+        friend class AsyncSubscriber;
+        explicit NextSample(AsyncSubscriber& source)
+            : m_source { &source } {
+        }
+
+        AsyncSubscriber* m_source = nullptr;
+        iox::optional<iox::expected<Sample<S, Payload, UserHeader>, ReceiveError>> m_result;
+    };
+
+    AsyncSubscriber(AsyncSubscriber&& rhs) noexcept;
+    auto operator=(AsyncSubscriber&&) -> AsyncSubscriber& = delete;
+    ~AsyncSubscriber() override = default;
+
+    AsyncSubscriber(const AsyncSubscriber&) = delete;
+    auto operator=(const AsyncSubscriber&) -> AsyncSubscriber& = delete;
+
+    /// Returns an awaitable that resumes the coroutine as soon as the [`Subscriber`] has
+    /// received a [`Sample`].
+    auto next_sample() -> NextSample {
+        return NextSample(*this);
+    }
+
+  private:
+    friend class WaitSetScheduler<S>;
+    AsyncSubscriber(WaitSetScheduler<S>& scheduler,
+                    WaitSetGuard<S>&& guard,
+                    const Subscriber<S, Payload, UserHeader>& subscriber,
+                    Listener<S>& listener);
+
+    auto try_complete() -> bool override;
+    auto poll(NextSample& awaiter) -> bool;
+
+    const Subscriber<S, Payload, UserHeader>* m_subscriber = nullptr;
+    Listener<S>* m_listener = nullptr;
+    NextSample* m_awaiter = nullptr;
+};
+
+/// Event loop that drives [`WaitSetTask`] coroutines with a [`WaitSet`]. A coroutine that awaits
+/// an [`AsyncListener`] or an [`AsyncSubscriber`] is suspended and resumed directly by the
+/// [`WaitSetScheduler`] in the thread that calls [`WaitSetScheduler::run()`] as soon as the
+/// corresponding attachment is ready.
+///
+/// The [`WaitSet`] must outlive the [`WaitSetScheduler`] and the [`WaitSetScheduler`] must
+/// outlive all [`AsyncListener`]s and [`AsyncSubscriber`]s that were attached to it.
+template <ServiceType S>
+class WaitSetScheduler {
+  public:
+    explicit WaitSetScheduler(WaitSet<S>& waitset);
+    ~WaitSetScheduler();
+
+    WaitSetScheduler(const WaitSetScheduler&) = delete;
+    WaitSetScheduler(WaitSetScheduler&&) = delete;
+    auto operator=(const WaitSetScheduler&) -> WaitSetScheduler& = delete;
+    auto operator=(WaitSetScheduler&&) -> WaitSetScheduler& = delete;
+
+    /// Attaches the [`Listener`] to the underlying [`WaitSet`] so that it can be awaited.
+    /// The [`Listener`] must outlive the returned [`AsyncListener`].
+    auto attach(Listener<S>& listener) -> iox::expected<AsyncListener<S>, WaitSetAttachmentError>;
+
+    /// Attaches the [`Listener`] that is notified whenever a [`Sample`] was sent to the
+    /// [`Subscriber`] to the underlying [`WaitSet`] so that the [`Subscriber`] can be awaited.
+    /// The [`Subscriber`] and the [`Listener`] must outlive the returned [`AsyncSubscriber`].
+    template <typename Payload, typename UserHeader>
+    auto attach(const Subscriber<S, Payload, UserHeader>& subscriber, Listener<S>& listener)
+        -> iox::expected<AsyncSubscriber<S, Payload, UserHeader>, WaitSetAttachmentError>;
+
+    /// Starts the [`WaitSetTask`]. The coroutine runs in the calling thread until it awaits
+    /// an attachment for the first time.
+    void spawn(WaitSetTask& task);
+
+    /// Waits until at least one attachment is ready and resumes all coroutines that wait on
+    /// a ready attachment. Returns the result of [`WaitSet::wait_and_process_once()`].
+    auto run_once() -> iox::expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Calls [`WaitSetScheduler::run_once()`] until no coroutine waits anymore, a signal was
+    /// received or an error occurred.
+    auto run() -> iox::expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Returns the number of coroutines that are currently suspended on an attachment.
+    auto number_of_waiting_coroutines() const -> uint64_t;
+
+  private:
+    friend class internal::WaitSetSchedulerSource<S>;
+    using Source = internal::WaitSetSchedulerSource<S>;
+
+    void link(Source* source);
+    void unlink(Source* source);
+    void replace(Source* old_source, Source* new_source);
+    void resume_triggered();
+
+    WaitSet<S>* m_waitset = nullptr;
+    Source* m_sources = nullptr;
+    Source* m_triggered = nullptr;
+    uint64_t m_number_of_waiting = 0;
+};
+
+////////////////////////////
+// BEGIN: WaitSetSchedulerSource
+////////////////////////////
+namespace internal {
+template <ServiceType S>
+inline WaitSetSchedulerSource<S>::WaitSetSchedulerSource(WaitSetScheduler<S>& scheduler, WaitSetGuard<S>&& guard)
+    : m_scheduler { &scheduler }
+    , m_guard { std::move(guard) } {
+    m_scheduler->link(this);
+}
+
+template <ServiceType S>
+inline WaitSetSchedulerSource<S>::WaitSetSchedulerSource(WaitSetSchedulerSource&& rhs) noexcept
+    : m_scheduler { std::exchange(rhs.m_scheduler, nullptr) }
+    , m_guard { std::move(rhs.m_guard) }
+    , m_waiting { std::exchange(rhs.m_waiting, {}) }
+    , m_is_triggered { std::exchange(rhs.m_is_triggered, false) } {
+    if (m_scheduler != nullptr) {
+        m_scheduler->replace(&rhs, this);
+    }
+}
+
+template <ServiceType S>
+inline WaitSetSchedulerSource<S>::~WaitSetSchedulerSource() {
+    if (m_scheduler != nullptr) {
+        m_scheduler->unlink(this);
+    }
+}
+
+template <ServiceType S>
+inline void WaitSetSchedulerSource<S>::suspend(std::coroutine_handle<> handle) {
+    IOX_ENFORCE(!m_waiting, "Only one coroutine can wait on a WaitSetScheduler attachment at a time.");
+    m_waiting = handle;
+    ++m_scheduler->m_number_of_waiting;
+}
+} // namespace internal
+////////////////////////////
+// END: WaitSetSchedulerSource
+////////////////////////////
+
+////////////////////////////
+// BEGIN: AsyncListener
+////////////////////////////
+template <ServiceType S>
+inline AsyncListener<S>::AsyncListener(WaitSetScheduler<S>& scheduler,
+                                       WaitSetGuard<S>&& guard,
+                                       Listener<S>& listener)
+    : internal::WaitSetSchedulerSource<S>(scheduler, std::move(guard))
+    , m_listener { &listener } {
+}
+
+template <ServiceType S>
+inline AsyncListener<S>::AsyncListener(AsyncListener&& rhs) noexcept
+    : internal::WaitSetSchedulerSource<S>(std::move(rhs))
+    , m_listener { rhs.m_listener }
+    , m_awaiter { std::exchange(rhs.m_awaiter, nullptr) } {
+    if (m_awaiter != nullptr) {
+        m_awaiter->m_source = this;
+    }
+}
+
+template <ServiceType S>
+inline auto AsyncListener<S>::try_complete() -> bool {
+    if (m_awaiter == nullptr || !poll(*m_awaiter)) {
+        return false;
+    }
+
+    m_awaiter = nullptr;
+    return true;
+}
+
+template <ServiceType S>
+inline auto AsyncListener<S>::poll(NextEvent& awaiter) -> bool {
+    auto result = m_listener->try_wait_one();
+    if (result.has_error()) {
+        awaiter.m_result.emplace(iox::err(result.error()));
+        return true;
+    }
+
+    if (result.value().has_value()) {
+        awaiter.m_result.emplace(iox::ok(result.value().value()));
+        return true;
+    }
+
+    return false;
+}
+////////////////////////////
+// END: AsyncListener
+////////////////////////////
+
+////////////////////////////
+// BEGIN: AsyncSubscriber
+////////////////////////////
+template <ServiceType S, typename Payload, typename UserHeader>
+inline AsyncSubscriber<S, Payload, UserHeader>::AsyncSubscriber(
+    WaitSetScheduler<S>& scheduler,
+    WaitSetGuard<S>&& guard,
+    const Subscriber<S, Payload, UserHeader>& subscriber,
+    Listener<S>& listener)
+    : internal::WaitSetSchedulerSource<S>(scheduler, std::move(guard))
+    , m_subscriber { &subscriber }
+    , m_listener { &listener } {
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline AsyncSubscriber<S, Payload, UserHeader>::AsyncSubscriber(AsyncSubscriber&& rhs) noexcept
+    : internal::WaitSetSchedulerSource<S>(std::move(rhs))
+    , m_subscriber { rhs.m_subscriber }
+    , m_listener { rhs.m_listener }
+    , m_awaiter { std::exchange(rhs.m_awaiter, nullptr) } {
+    if (m_awaiter != nullptr) {
+        m_awaiter->m_source = this;
+    }
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto AsyncSubscriber<S, Payload, UserHeader>::try_complete() -> bool {
+    // the samples remain in the subscriber, therefore the notifications can always be consumed
+    // so that they do not wake up the waitset again
+    auto drain_result = m_listener->try_wait_all([](EventId) {});
+    static_cast<void>(drain_result);
+
+    if (m_awaiter == nullptr || !poll(*m_awaiter)) {
+        return false;
+    }
+
+    m_awaiter = nullptr;
+    return true;
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto AsyncSubscriber<S, Payload, UserHeader>::poll(NextSample& awaiter) -> bool {
+    auto result = m_subscriber->receive();
+    if (result.has_error()) {
+        awaiter.m_result.emplace(iox::err(result.error()));
+        return true;
+    }
+
+    if (result.value().has_value()) {
+        awaiter.m_result.emplace(iox::ok(std::move(result.value().value())));
+        return true;
+    }
+
+    return false;
+}
+////////////////////////////
+// END: AsyncSubscriber
+////////////////////////////
+
+////////////////////////////
+// BEGIN: WaitSetScheduler
+////////////////////////////
+template <ServiceType S>
+inline WaitSetScheduler<S>::WaitSetScheduler(WaitSet<S>& waitset)
+    : m_waitset { &waitset } {
+}
+
+template <ServiceType S>
+inline WaitSetScheduler<S>::~WaitSetScheduler() {
+    for (auto* source = m_sources; source != nullptr; source = source->m_next) {
+        source->m_scheduler = nullptr;
+    }
+}
+
+template <ServiceType S>
+inline auto WaitSetScheduler<S>::attach(Listener<S>& listener)
+    -> iox::expected<AsyncListener<S>, WaitSetAttachmentError> {
+    auto guard = m_waitset->attach_notification(listener);
+    if (guard.has_error()) {
+        return iox::err(guard.error());
+    }
+
+    return iox::ok(AsyncListener<S>(*this, std::move(guard.value()), listener));
+}
+
+template <ServiceType S>
+template <typename Payload, typename UserHeader>
+inline auto WaitSetScheduler<S>::attach(const Subscriber<S, Payload, UserHeader>& subscriber, Listener<S>& listener)
+    -> iox::expected<AsyncSubscriber<S, Payload, UserHeader>, WaitSetAttachmentError> {
+    auto guard = m_waitset->attach_notification(listener);
+    if (guard.has_error()) {
+        return iox::err(guard.error());
+    }
+
+    return iox::ok(AsyncSubscriber<S, Payload, UserHeader>(*this, std::move(guard.value()), subscriber, listener));
+}
+
+template <ServiceType S>
+inline void WaitSetScheduler<S>::spawn(WaitSetTask& task) {
+    if (!task.m_is_started && !task.is_done()) {
+        task.m_is_started = true;
+        task.m_handle.resume();
+    }
+}
+
+template <ServiceType S>
+inline auto WaitSetScheduler<S>::run_once() -> iox::expected<WaitSetRunResult, WaitSetRunError> {
+    // the coroutines are resumed after the waitset returned so that they are free to attach
+    // or detach sources
+    auto result = m_waitset->wait_and_process_once([this](WaitSetAttachmentId<S> attachment_id) -> CallbackProgression {
+        for (auto* source = m_sources; source != nullptr; source = source->m_next) {
+            if (!source->m_is_triggered && attachment_id.has_event_from(source->m_guard)) {
+                source->m_is_triggered = true;
+                source->m_next_triggered = m_triggered;
+                m_triggered = source;
+                break;
+            }
+        }
+        return CallbackProgression::Continue;
+    });
+
+    resume_triggered();
+    return result;
+}
+
+template <ServiceType S>
+inline auto WaitSetScheduler<S>::run() -> iox::expected<WaitSetRunResult, WaitSetRunError> {
+    while (m_number_of_waiting > 0) {
+        auto result = run_once();
+        if (result.has_error() || result.value() != WaitSetRunResult::AllEventsHandled) {
+            return result;
+        }
+    }
+
+    return iox::ok(WaitSetRunResult::AllEventsHandled);
+}
+
+template <ServiceType S>
+inline auto WaitSetScheduler<S>::number_of_waiting_coroutines() const -> uint64_t {
+    return m_number_of_waiting;
+}
+
+template <ServiceType S>
+inline void WaitSetScheduler<S>::resume_triggered() {
+    while (m_triggered != nullptr) {
+        auto* source = m_triggered;
+        m_triggered = source->m_next_triggered;
+        source->m_next_triggered = nullptr;
+        source->m_is_triggered = false;
+
+        if (source->try_complete() && source->m_waiting) {
+            auto handle = std::exchange(source->m_waiting, {});
+            --m_number_of_waiting;
+            handle.resume();
+        }
+    }
+}
+
+template <ServiceType S>
+inline void WaitSetScheduler<S>::link(Source* source) {
+    source->m_prev = nullptr;
+    source->m_next = m_sources;
+    if (m_sources != nullptr) {
+        m_sources->m_prev = source;
+    }
+    m_sources = source;
+}
+
+template <ServiceType S>
+inline void WaitSetScheduler<S>::unlink(Source* source) {
+    if (source->m_prev != nullptr) {
+        source->m_prev->m_next = source->m_next;
+    } else {
+        m_sources = source->m_next;
+    }
+    if (source->m_next != nullptr) {
+        source->m_next->m_prev = source->m_prev;
+    }
+
+    if (source->m_is_triggered) {
+        for (auto** entry = &m_triggered; *entry != nullptr; entry = &(*entry)->m_next_triggered) {
+            if (*entry == source) {
+                *entry = source->m_next_triggered;
+                break;
+            }
+        }
+    }
+
+    // the coroutine that waits on the source will never be resumed
+    if (source->m_waiting) {
+        --m_number_of_waiting;
+    }
+}
+
+template <ServiceType S>
+inline void WaitSetScheduler<S>::replace(Source* old_source, Source* new_source) {
+    new_source->m_prev = std::exchange(old_source->m_prev, nullptr);
+    new_source->m_next = std::exchange(old_source->m_next, nullptr);
+    new_source->m_next_triggered = std::exchange(old_source->m_next_triggered, nullptr);
+
+    if (new_source->m_prev != nullptr) {
+        new_source->m_prev->m_next = new_source;
+    } else {
+        m_sources = new_source;
+    }
+    if (new_source->m_next != nullptr) {
+        new_source->m_next->m_prev = new_source;
+    }
+
+    if (new_source->m_is_triggered) {
+        for (auto** entry = &m_triggered; *entry != nullptr; entry = &(*entry)->m_next_triggered) {
+            if (*entry == old_source) {
+                *entry = new_source;
+                break;
+            }
+        }
+    }
+}
+////////////////////////////
+// END: WaitSetScheduler
+////////////////////////////
+} // namespace iox2
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/dynamic_config_publish_subscribe.hpp"
+#include "iox2/enum_translation.hpp"
+#include "iox2/internal/callback_context.hpp"
+
+namespace iox2 {
+namespace {
+using PublisherStatisticsCallback = iox::function<CallbackProgression(const RawIdType&, const PublisherStatistics&)>;
+using SubscriberStatisticsCallback =
+    iox::function<CallbackProgression(const RawIdType&, const SubscriberStatistics&)>;
+
+auto to_raw_id(const uint8_t* id, const size_t id_length) -> RawIdType {
+    RawIdType raw_id;
+    for (size_t i = 0; i < id_length && i < UNIQUE_PORT_ID_LENGTH; ++i) {
+        raw_id.push_back(id[i]);
+    }
+    return raw_id;
+}
+
+auto list_publisher_statistics_callback(const uint8_t* id,
+                                        const size_t id_length,
+                                        const iox2_publisher_statistics_t* statistics,
+                                        iox2_callback_context context) -> iox2_callback_progression_e {
+    auto* callback = internal::ctx_cast<PublisherStatisticsCallback>(context);
+    const PublisherStatistics typed_statistics { statistics->sent_samples,
+                                                 statistics->failed_deliveries,
+                                                 statistics->overflowed_samples,
+                                                 statistics->exceeded_max_loans };
+    return iox::into<iox2_callback_progression_e>(callback->value()(to_raw_id(id, id_length), typed_statistics));
+}
+
+auto list_subscriber_statistics_callback(const uint8_t* id,
+                                         const size_t id_length,
+                                         const iox2_subscriber_statistics_t* statistics,
+                                         iox2_callback_context context) -> iox2_callback_progression_e {
+    auto* callback = internal::ctx_cast<SubscriberStatisticsCallback>(context);
+    const SubscriberStatistics typed_statistics { statistics->received_samples, statistics->exceeded_max_borrows };
+    return iox::into<iox2_callback_progression_e>(callback->value()(to_raw_id(id, id_length), typed_statistics));
+}
+} // namespace
+
+DynamicConfigPublishSubscribe::DynamicConfigPublishSubscribe(iox2_port_factory_pub_sub_h handle)
+    : m_handle { handle } {
+}
+
+auto DynamicConfigPublishSubscribe::number_of_publishers() const -> uint64_t {
+    return iox2_port_factory_pub_sub_dynamic_config_number_of_publishers(&m_handle);
+}
+
+auto DynamicConfigPublishSubscribe::number_of_subscribers() const -> uint64_t {
+    return iox2_port_factory_pub_sub_dynamic_config_number_of_subscribers(&m_handle);
+}
+
+void DynamicConfigPublishSubscribe::list_publisher_statistics(
+    const iox::function<CallbackProgression(const RawIdType&, const PublisherStatistics&)>& callback) const {
+    auto ctx = internal::ctx(callback);
+    iox2_port_factory_pub_sub_dynamic_config_list_publisher_statistics(
+        &m_handle, list_publisher_statistics_callback, static_cast<void*>(&ctx));
+}
+
+void DynamicConfigPublishSubscribe::list_subscriber_statistics(
+    const iox::function<CallbackProgression(const RawIdType&, const SubscriberStatistics&)>& callback) const {
+    auto ctx = internal::ctx(callback);
+    iox2_port_factory_pub_sub_dynamic_config_list_subscriber_statistics(
+        &m_handle, list_subscriber_statistics_callback, static_cast<void*>(&ctx));
+}
+} // namespace iox2
@@ -53,4 +53,23 @@ auto HeaderPublishSubscribe::publisher_id() const -> UniquePublisherId {
 auto HeaderPublishSubscribe::number_of_elements() const -> uint64_t {
     return iox2_publish_subscribe_header_number_of_elements(&m_handle);
 }
+
+auto HeaderPublishSubscribe::sequence_number() const -> iox::optional<uint64_t> {
+    uint64_t sequence_number = 0;
+    if (iox2_publish_subscribe_header_sequence_number(&m_handle, &sequence_number)) {
+        return sequence_number;
+    }
+
+    return iox::nullopt;
+}
+
+auto HeaderPublishSubscribe::send_timestamp() const -> iox::optional<iox::units::Duration> {
+    uint64_t seconds = 0;
+    uint32_t nanoseconds = 0;
+    if (iox2_publish_subscribe_header_send_timestamp(&m_handle, &seconds, &nanoseconds)) {
+        return iox::units::Duration::fromSeconds(seconds) + iox::units::Duration::fromNanoseconds(nanoseconds);
+    }
+
+    return iox::nullopt;
+}
 } // namespace iox2
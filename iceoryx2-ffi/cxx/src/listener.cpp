@@ -73,6 +73,16 @@ auto Listener<S>::deadline() const -> iox::optional<iox::units::Duration> {
     return iox::nullopt;
 }
 
+template <ServiceType S>
+auto Listener<S>::wait_statistics() const -> WaitStatistics {
+    WaitStatistics statistics;
+    iox2_listener_wait_statistics(&m_handle,
+                                  &statistics.resolved_by_spinning,
+                                  &statistics.resolved_by_yielding,
+                                  &statistics.resolved_by_blocking);
+    return statistics;
+}
+
 void wait_callback(const iox2_event_id_t* event_id, iox2_callback_context context) {
     auto* callback = internal::ctx_cast<iox::function<void(EventId)>>(context);
     callback->value()(EventId(*event_id));
@@ -183,6 +183,19 @@ auto NodeBuilder::create() const&& -> iox::expected<Node<T>, NodeCreationFailure
 template class Node<ServiceType::Ipc>;
 template class Node<ServiceType::Local>;
 
+template auto list_callback<ServiceType::Ipc>(iox2_node_state_e,
+                                              iox2_node_id_ptr,
+                                              const char*,
+                                              iox2_node_name_ptr,
+                                              iox2_config_ptr,
+                                              iox2_callback_context) -> iox2_callback_progression_e;
+template auto list_callback<ServiceType::Local>(iox2_node_state_e,
+                                                iox2_node_id_ptr,
+                                                const char*,
+                                                iox2_node_name_ptr,
+                                                iox2_config_ptr,
+                                                iox2_callback_context) -> iox2_callback_progression_e;
+
 template auto NodeBuilder::create() const&& -> iox::expected<Node<ServiceType::Ipc>, NodeCreationFailure>;
 template auto NodeBuilder::create() const&& -> iox::expected<Node<ServiceType::Local>, NodeCreationFailure>;
 
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/node_tracker.hpp"
+#include "iox/into.hpp"
+#include "iox2/enum_translation.hpp"
+#include "iox2/iceoryx2.h"
+
+namespace iox2 {
+// defined in node.cpp, creates the NodeState that is passed to the callback in the context
+template <ServiceType T>
+auto list_callback(iox2_node_state_e node_state,
+                   iox2_node_id_ptr node_id_ptr,
+                   const char* executable,
+                   iox2_node_name_ptr node_name,
+                   iox2_config_ptr config,
+                   iox2_callback_context context) -> iox2_callback_progression_e;
+
+template <ServiceType S>
+NodeTracker<S>::NodeTracker(const ConfigView config) {
+    iox2_node_tracker_new(iox::into<iox2_service_type_e>(S), config.m_ptr, nullptr, &m_handle);
+}
+
+template <ServiceType S>
+NodeTracker<S>::NodeTracker(NodeTracker&& rhs) noexcept {
+    *this = std::move(rhs);
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::operator=(NodeTracker&& rhs) noexcept -> NodeTracker& {
+    if (this != &rhs) {
+        drop();
+        m_handle = std::move(rhs.m_handle);
+        rhs.m_handle = nullptr;
+    }
+
+    return *this;
+}
+
+template <ServiceType S>
+NodeTracker<S>::~NodeTracker() {
+    drop();
+}
+
+template <ServiceType S>
+void NodeTracker<S>::drop() {
+    if (m_handle != nullptr) {
+        iox2_node_tracker_drop(m_handle);
+        m_handle = nullptr;
+    }
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::on_added_callback(iox2_node_state_e node_state,
+                                       iox2_node_id_ptr node_id,
+                                       const char* executable,
+                                       iox2_node_name_ptr node_name,
+                                       iox2_config_ptr config,
+                                       iox2_callback_context ctx) -> iox2_callback_progression_e {
+    auto context = static_cast<SyncContext*>(ctx);
+    return list_callback<S>(node_state, node_id, executable, node_name, config, context->on_added);
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::on_changed_callback(iox2_node_state_e node_state,
+                                         iox2_node_id_ptr node_id,
+                                         const char* executable,
+                                         iox2_node_name_ptr node_name,
+                                         iox2_config_ptr config,
+                                         iox2_callback_context ctx) -> iox2_callback_progression_e {
+    auto context = static_cast<SyncContext*>(ctx);
+    return list_callback<S>(node_state, node_id, executable, node_name, config, context->on_changed);
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::on_removed_callback(iox2_node_state_e node_state,
+                                         iox2_node_id_ptr node_id,
+                                         const char* executable,
+                                         iox2_node_name_ptr node_name,
+                                         iox2_config_ptr config,
+                                         iox2_callback_context ctx) -> iox2_callback_progression_e {
+    auto context = static_cast<SyncContext*>(ctx);
+    return list_callback<S>(node_state, node_id, executable, node_name, config, context->on_removed);
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::sync(const iox::function<void(NodeState<S>)>& on_added,
+                          const iox::function<void(NodeState<S>)>& on_changed,
+                          const iox::function<void(NodeState<S>)>& on_removed)
+    -> iox::expected<void, NodeListFailure> {
+    auto mutable_on_added = on_added;
+    auto mutable_on_changed = on_changed;
+    auto mutable_on_removed = on_removed;
+
+    const iox::function<CallbackProgression(NodeState<S>)> added = [&](NodeState<S> node_state) {
+        mutable_on_added(node_state);
+        return CallbackProgression::Continue;
+    };
+    const iox::function<CallbackProgression(NodeState<S>)> changed = [&](NodeState<S> node_state) {
+        mutable_on_changed(node_state);
+        return CallbackProgression::Continue;
+    };
+    const iox::function<CallbackProgression(NodeState<S>)> removed = [&](NodeState<S> node_state) {
+        mutable_on_removed(node_state);
+        return CallbackProgression::Continue;
+    };
+
+    auto added_ctx = internal::ctx(added);
+    auto changed_ctx = internal::ctx(changed);
+    auto removed_ctx = internal::ctx(removed);
+    SyncContext context { &added_ctx, &changed_ctx, &removed_ctx };
+
+    auto result = iox2_node_tracker_sync(
+        &m_handle, on_added_callback, on_changed_callback, on_removed_callback, static_cast<void*>(&context));
+
+    if (result == IOX2_OK) {
+        return iox::ok();
+    }
+
+    return iox::err(iox::into<NodeListFailure>(result));
+}
+
+template <ServiceType S>
+void NodeTracker<S>::list(const iox::function<CallbackProgression(NodeState<S>)>& callback) const {
+    auto ctx = internal::ctx(callback);
+    iox2_node_tracker_list(&m_handle, list_callback<S>, static_cast<void*>(&ctx));
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::len() const -> uint64_t {
+    return iox2_node_tracker_len(&m_handle);
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::is_empty() const -> bool {
+    return len() == 0;
+}
+
+template <ServiceType S>
+auto NodeTracker<S>::file_descriptor() const -> iox::optional<FileDescriptorView> {
+    auto* file_descriptor = iox2_node_tracker_file_descriptor(&m_handle);
+    if (file_descriptor == nullptr) {
+        return iox::nullopt;
+    }
+
+    return FileDescriptorView(file_descriptor);
+}
+
+template class NodeTracker<ServiceType::Ipc>;
+template class NodeTracker<ServiceType::Local>;
+} // namespace iox2
@@ -20,6 +20,13 @@ PortFactoryListener<S>::PortFactoryListener(iox2_port_factory_listener_builder_h
 
 template <ServiceType S>
 auto PortFactoryListener<S>::create() && -> iox::expected<Listener<S>, ListenerCreateError> {
+    if (m_wait_policy.has_value()) {
+        auto spin_duration = m_wait_policy.value().spin_duration().timespec();
+        auto yield_duration = m_wait_policy.value().yield_duration().timespec();
+        iox2_port_factory_listener_builder_set_wait_policy(
+            &m_handle, spin_duration.tv_sec, spin_duration.tv_nsec, yield_duration.tv_sec, yield_duration.tv_nsec);
+    }
+
     iox2_listener_h listener_handle { nullptr };
     auto result = iox2_port_factory_listener_builder_create(m_handle, nullptr, &listener_handle);
 
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/service_tracker.hpp"
+#include "iox2/iceoryx2.h"
+
+namespace iox2 {
+template <ServiceType S>
+ServiceTracker<S>::ServiceTracker(const ConfigView config) {
+    iox2_service_tracker_new(iox::into<iox2_service_type_e>(S), config.m_ptr, nullptr, &m_handle);
+}
+
+template <ServiceType S>
+ServiceTracker<S>::ServiceTracker(ServiceTracker&& rhs) noexcept {
+    *this = std::move(rhs);
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::operator=(ServiceTracker&& rhs) noexcept -> ServiceTracker& {
+    if (this != &rhs) {
+        drop();
+        m_handle = std::move(rhs.m_handle);
+        rhs.m_handle = nullptr;
+    }
+
+    return *this;
+}
+
+template <ServiceType S>
+ServiceTracker<S>::~ServiceTracker() {
+    drop();
+}
+
+template <ServiceType S>
+void ServiceTracker<S>::drop() {
+    if (m_handle != nullptr) {
+        iox2_service_tracker_drop(m_handle);
+        m_handle = nullptr;
+    }
+}
+
+template <ServiceType S>
+void ServiceTracker<S>::on_added_callback(const iox2_static_config_t* const static_config, void* ctx) {
+    auto context = static_cast<SyncContext*>(ctx);
+    (*context->on_added)(StaticConfig(*static_config));
+}
+
+template <ServiceType S>
+void ServiceTracker<S>::on_removed_callback(const iox2_static_config_t* const static_config, void* ctx) {
+    auto context = static_cast<SyncContext*>(ctx);
+    (*context->on_removed)(StaticConfig(*static_config));
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::list_callback(const iox2_static_config_t* const static_config, void* ctx)
+    -> iox2_callback_progression_e {
+    auto callback = static_cast<iox::function<CallbackProgression(StaticConfig)>*>(ctx);
+    auto result = (*callback)(StaticConfig(*static_config));
+    return iox::into<iox2_callback_progression_e>(result);
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::sync(const iox::function<void(StaticConfig)>& on_added,
+                             const iox::function<void(StaticConfig)>& on_removed)
+    -> iox::expected<void, ServiceListError> {
+    auto mutable_on_added = on_added;
+    auto mutable_on_removed = on_removed;
+    SyncContext context { &mutable_on_added, &mutable_on_removed };
+
+    auto result = iox2_service_tracker_sync(&m_handle, on_added_callback, on_removed_callback, &context);
+
+    if (result == IOX2_OK) {
+        return iox::ok();
+    }
+
+    return iox::err(iox::into<ServiceListError>(result));
+}
+
+template <ServiceType S>
+void ServiceTracker<S>::list(const iox::function<CallbackProgression(StaticConfig)>& callback) const {
+    auto mutable_callback = callback;
+    iox2_service_tracker_list(&m_handle, list_callback, &mutable_callback);
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::len() const -> uint64_t {
+    return iox2_service_tracker_len(&m_handle);
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::is_empty() const -> bool {
+    return len() == 0;
+}
+
+template <ServiceType S>
+auto ServiceTracker<S>::file_descriptor() const -> iox::optional<FileDescriptorView> {
+    auto* file_descriptor = iox2_service_tracker_file_descriptor(&m_handle);
+    if (file_descriptor == nullptr) {
+        return iox::nullopt;
+    }
+
+    return FileDescriptorView(file_descriptor);
+}
+
+template class ServiceTracker<ServiceType::Ipc>;
+template class ServiceTracker<ServiceType::Local>;
+} // namespace iox2
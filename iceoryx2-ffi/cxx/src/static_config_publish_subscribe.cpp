@@ -45,6 +45,14 @@ auto StaticConfigPublishSubscribe::has_safe_overflow() const -> bool {
     return m_value.enable_safe_overflow;
 }
 
+auto StaticConfigPublishSubscribe::has_send_tracking() const -> bool {
+    return m_value.enable_send_tracking;
+}
+
+auto StaticConfigPublishSubscribe::connection_backend() const -> ConnectionBackend {
+    return iox::into<ConnectionBackend>(static_cast<int>(m_value.connection_backend));
+}
+
 auto StaticConfigPublishSubscribe::message_type_details() const -> MessageTypeDetails {
     return MessageTypeDetails(m_value.message_type_details);
 }
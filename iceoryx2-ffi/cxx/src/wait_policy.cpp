@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/wait_policy.hpp"
+
+namespace iox2 {
+WaitPolicy::WaitPolicy(iox::units::Duration spin_duration, iox::units::Duration yield_duration)
+    : m_spin_duration { spin_duration }
+    , m_yield_duration { yield_duration } {
+}
+
+auto WaitPolicy::spin_duration() const -> iox::units::Duration {
+    return m_spin_duration;
+}
+
+auto WaitPolicy::yield_duration() const -> iox::units::Duration {
+    return m_yield_duration;
+}
+} // namespace iox2
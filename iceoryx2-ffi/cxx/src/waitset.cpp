@@ -14,6 +14,9 @@
 #include "iox/into.hpp"
 #include "iox2/internal/callback_context.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace iox2 {
 ////////////////////////////
 // BEGIN: WaitSetAttachmentId
@@ -159,6 +162,23 @@ auto WaitSetBuilder::create() const&& -> iox::expected<WaitSet<S>, WaitSetCreate
             &m_handle, iox::into<iox2_signal_handling_mode_e>(m_signal_handling_mode.value()));
     }
 
+    if (m_timer_slack.has_value()) {
+        auto timer_slack = m_timer_slack.value().timespec();
+        iox2_waitset_builder_set_timer_slack(&m_handle, timer_slack.tv_sec, timer_slack.tv_nsec);
+    }
+
+    if (m_wait_policy.has_value()) {
+        auto spin_duration = m_wait_policy.value().spin_duration().timespec();
+        auto yield_duration = m_wait_policy.value().yield_duration().timespec();
+        iox2_waitset_builder_set_wait_policy(
+            &m_handle, spin_duration.tv_sec, spin_duration.tv_nsec, yield_duration.tv_sec, yield_duration.tv_nsec);
+    }
+
+    if (m_poll_interval.has_value()) {
+        auto poll_interval = m_poll_interval.value().timespec();
+        iox2_waitset_builder_set_poll_interval(&m_handle, poll_interval.tv_sec, poll_interval.tv_nsec);
+    }
+
     iox2_waitset_h waitset_handle {};
     auto result = iox2_waitset_builder_create(m_handle, iox::into<iox2_service_type_e>(S), nullptr, &waitset_handle);
 
@@ -214,6 +234,34 @@ auto WaitSet<S>::signal_handling_mode() const -> SignalHandlingMode {
     return iox::into<SignalHandlingMode>(static_cast<int>(iox2_waitset_signal_handling_mode(&m_handle)));
 }
 
+template <ServiceType S>
+auto WaitSet<S>::timer_slack() const -> iox::units::Duration {
+    uint64_t secs = 0;
+    uint32_t nsecs = 0;
+    iox2_waitset_timer_slack(&m_handle, &secs, &nsecs);
+
+    return iox::units::Duration::fromSeconds(secs) + iox::units::Duration::fromNanoseconds(nsecs);
+}
+
+template <ServiceType S>
+auto WaitSet<S>::poll_interval() const -> iox::units::Duration {
+    uint64_t secs = 0;
+    uint32_t nsecs = 0;
+    iox2_waitset_poll_interval(&m_handle, &secs, &nsecs);
+
+    return iox::units::Duration::fromSeconds(secs) + iox::units::Duration::fromNanoseconds(nsecs);
+}
+
+template <ServiceType S>
+auto WaitSet<S>::wait_statistics() const -> WaitStatistics {
+    WaitStatistics statistics;
+    iox2_waitset_wait_statistics(&m_handle,
+                                 &statistics.resolved_by_spinning,
+                                 &statistics.resolved_by_yielding,
+                                 &statistics.resolved_by_blocking);
+    return statistics;
+}
+
 template <ServiceType S>
 auto WaitSet<S>::capacity() const -> uint64_t {
     return iox2_waitset_capacity(&m_handle);
@@ -247,6 +295,31 @@ auto WaitSet<S>::attach_interval(const iox::units::Duration deadline)
     return iox::err(iox::into<WaitSetAttachmentError>(result));
 }
 
+template <ServiceType S>
+auto WaitSet<S>::attach_polling(const iox::function<bool()>& predicate)
+    -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
+    return attach_polling(
+        [](iox2_callback_context context) -> bool {
+            return (*static_cast<const iox::function<bool()>*>(context))();
+        },
+        &predicate);
+}
+
+template <ServiceType S>
+auto WaitSet<S>::attach_polling(iox2_waitset_polling_callback callback, const void* context)
+    -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
+    iox2_waitset_guard_h guard_handle {};
+    // the context is only read by the callback
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto result = iox2_waitset_attach_polling(&m_handle, callback, const_cast<void*>(context), nullptr, &guard_handle);
+
+    if (result == IOX2_OK) {
+        return iox::ok(WaitSetGuard<S>(guard_handle));
+    }
+
+    return iox::err(iox::into<WaitSetAttachmentError>(result));
+}
+
 template <ServiceType S>
 auto WaitSet<S>::attach_deadline(const FileDescriptorBased& attachment, const iox::units::Duration deadline)
     -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
@@ -348,15 +421,80 @@ auto WaitSet<S>::wait_and_process_once_with_timeout(
 // END: WaitSet
 ////////////////////////////
 
+////////////////////////////
+// BEGIN: WaitSetExecutor
+////////////////////////////
+template <ServiceType S>
+WaitSetExecutor<S>::WaitSetExecutor(WaitSet<S>& waitset,
+                                    const uint64_t number_of_threads,
+                                    const iox::optional<WaitSetExecutorCpuAffinity>& cpu_affinity,
+                                    const iox::optional<uint8_t>& priority)
+    : m_waitset { &waitset }
+    , m_number_of_threads { std::max<uint64_t>(number_of_threads, 1) }
+    , m_cpu_affinity { cpu_affinity }
+    , m_priority { priority } {
+}
+
+template <ServiceType S>
+auto WaitSetExecutor<S>::number_of_threads() const -> uint64_t {
+    return m_number_of_threads;
+}
+
+template <ServiceType S>
+auto WaitSetExecutor<S>::run(const iox::function<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+    -> iox::expected<WaitSetRunResult, WaitSetRunError> {
+    std::array<size_t, WAITSET_EXECUTOR_MAX_CPU_AFFINITY> cpu_affinity {};
+    size_t cpu_affinity_len = 0;
+    if (m_cpu_affinity.has_value()) {
+        for (const auto core : m_cpu_affinity.value()) {
+            cpu_affinity.at(cpu_affinity_len) = core;
+            ++cpu_affinity_len;
+        }
+    }
+
+    const uint8_t* priority = m_priority.has_value() ? &m_priority.value() : nullptr;
+
+    iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
+    auto ctx = internal::ctx(fn_call);
+    auto result = iox2_waitset_executor_run(&m_waitset->m_handle,
+                                            m_number_of_threads,
+                                            cpu_affinity_len == 0 ? nullptr : cpu_affinity.data(),
+                                            cpu_affinity_len,
+                                            priority,
+                                            run_callback<S>,
+                                            static_cast<void*>(&ctx),
+                                            &run_result);
+
+    if (result == IOX2_OK) {
+        return iox::ok(iox::into<WaitSetRunResult>(static_cast<int>(run_result)));
+    }
+
+    return iox::err(iox::into<WaitSetRunError>(result));
+}
+
+template <ServiceType S>
+auto WaitSetExecutorBuilder::create(WaitSet<S>& waitset) const&& -> WaitSetExecutor<S> {
+    return WaitSetExecutor<S>(waitset, m_number_of_threads, m_cpu_affinity, m_priority);
+}
+////////////////////////////
+// END: WaitSetExecutor
+////////////////////////////
+
 template class WaitSetAttachmentId<ServiceType::Ipc>;
 template class WaitSetAttachmentId<ServiceType::Local>;
 template class WaitSetGuard<ServiceType::Ipc>;
 template class WaitSetGuard<ServiceType::Local>;
 template class WaitSet<ServiceType::Ipc>;
 template class WaitSet<ServiceType::Local>;
+template class WaitSetExecutor<ServiceType::Ipc>;
+template class WaitSetExecutor<ServiceType::Local>;
 
 template auto WaitSetBuilder::create() const&& -> iox::expected<WaitSet<ServiceType::Ipc>, WaitSetCreateError>;
 template auto WaitSetBuilder::create() const&& -> iox::expected<WaitSet<ServiceType::Local>, WaitSetCreateError>;
+template auto WaitSetExecutorBuilder::create(WaitSet<ServiceType::Ipc>& waitset) const&&
+    -> WaitSetExecutor<ServiceType::Ipc>;
+template auto WaitSetExecutorBuilder::create(WaitSet<ServiceType::Local>& waitset) const&&
+    -> WaitSetExecutor<ServiceType::Local>;
 
 template auto operator==(const WaitSetAttachmentId<ServiceType::Ipc>& lhs,
                          const WaitSetAttachmentId<ServiceType::Ipc>& rhs) -> bool;
@@ -88,6 +88,7 @@ TEST(EnumConversionTest, publisher_create_into_c_str) {
     using Sut = iox2::PublisherCreateError;
     ASSERT_GT(strlen(iox::into<const char*>(Sut::ExceedsMaxSupportedPublishers)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::UnableToCreateDataSegment)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::UnableToApplyMemoryResidency)), 1U);
 }
 
 TEST(EnumConversionTest, publisher_loan_into_c_str) {
@@ -175,6 +176,8 @@ TEST(EnumConversionTest, publish_subscribe_open_into_c_str) {
     ASSERT_GT(strlen(iox::into<const char*>(Sut::DoesNotSupportRequestedAmountOfSubscribers)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::DoesNotSupportRequestedAmountOfNodes)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::IncompatibleOverflowBehavior)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::IncompatibleSendTrackingSetting)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::IncompatibleConnectionBackend)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::InsufficientPermissions)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::ServiceInCorruptedState)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::HangsInCreation)), 1U);
@@ -207,6 +210,8 @@ TEST(EnumConversionTest, publish_subscribe_open_or_create_into_c_str) {
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenDoesNotSupportRequestedAmountOfSubscribers)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenDoesNotSupportRequestedAmountOfNodes)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenIncompatibleOverflowBehavior)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenIncompatibleSendTrackingSetting)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenIncompatibleConnectionBackend)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenInsufficientPermissions)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenServiceInCorruptedState)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::OpenHangsInCreation)), 1U);
@@ -250,6 +255,7 @@ TEST(EnumConversionTest, subscriber_create_into_c_str) {
     using Sut = iox2::SubscriberCreateError;
     ASSERT_GT(strlen(iox::into<const char*>(Sut::ExceedsMaxSupportedSubscribers)), 1U);
     ASSERT_GT(strlen(iox::into<const char*>(Sut::BufferSizeExceedsMaxSupportedBufferSizeOfService)), 1U);
+    ASSERT_GT(strlen(iox::into<const char*>(Sut::UnableToApplyMemoryResidency)), 1U);
 }
 
 TEST(EnumConversionTest, waitset_create_into_c_str) {
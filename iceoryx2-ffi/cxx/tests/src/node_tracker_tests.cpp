@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/node.hpp"
+#include "iox2/node_tracker.hpp"
+#include "iox2/waitset.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+using namespace iox2;
+
+constexpr iox::units::Duration TIMEOUT = iox::units::Duration::fromMilliseconds(100);
+
+template <typename T>
+struct NodeTrackerTest : public ::testing::Test {
+    static constexpr ServiceType TYPE = T::TYPE;
+};
+
+TYPED_TEST_SUITE(NodeTrackerTest, iox2_testing::ServiceTypes, );
+
+template <ServiceType S>
+auto node_id_of(NodeState<S>& node_state) -> iox::optional<NodeId> {
+    iox::optional<NodeId> node_id;
+    node_state.alive([&](auto& view) { node_id.emplace(view.id()); })
+        .dead([&](auto& view) { node_id.emplace(view.id()); })
+        .inaccessible([&](auto& id) { node_id.emplace(id); })
+        .undefined([&](auto& id) { node_id.emplace(id); });
+    return node_id;
+}
+
+auto contains(const std::vector<NodeId>& node_ids, const NodeId& node_id) -> bool {
+    return std::find(node_ids.begin(), node_ids.end(), node_id) != node_ids.end();
+}
+
+TYPED_TEST(NodeTrackerTest, sync_reports_added_and_removed_nodes) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    auto sut = NodeTracker<SERVICE_TYPE>(Config::global_config());
+
+    std::vector<NodeId> added;
+    std::vector<NodeId> changed;
+    std::vector<NodeId> removed;
+    auto on_added = [&](auto node_state) { added.push_back(node_id_of(node_state).value()); };
+    auto on_changed = [&](auto node_state) { changed.push_back(node_id_of(node_state).value()); };
+    auto on_removed = [&](auto node_state) { removed.push_back(node_id_of(node_state).value()); };
+
+    auto node = iox::optional<Node<SERVICE_TYPE>>(NodeBuilder().create<SERVICE_TYPE>().expect(""));
+    const auto node_id = node->id();
+
+    ASSERT_FALSE(sut.sync(on_added, on_changed, on_removed).has_error());
+    ASSERT_TRUE(contains(added, node_id));
+    ASSERT_FALSE(contains(changed, node_id));
+    ASSERT_FALSE(contains(removed, node_id));
+    ASSERT_FALSE(sut.is_empty());
+
+    auto is_listed = false;
+    sut.list([&](auto node_state) {
+        if (node_id_of(node_state).value() == node_id) {
+            is_listed = true;
+        }
+        return CallbackProgression::Continue;
+    });
+    ASSERT_TRUE(is_listed);
+
+    added.clear();
+    ASSERT_FALSE(sut.sync(on_added, on_changed, on_removed).has_error());
+    ASSERT_FALSE(contains(added, node_id));
+    ASSERT_FALSE(contains(removed, node_id));
+
+    node.reset();
+
+    ASSERT_FALSE(sut.sync(on_added, on_changed, on_removed).has_error());
+    ASSERT_FALSE(contains(added, node_id));
+    ASSERT_TRUE(contains(removed, node_id));
+}
+
+TYPED_TEST(NodeTrackerTest, file_descriptor_signals_created_nodes) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    // the node directory that is watched exists after the first node was created
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto sut = NodeTracker<SERVICE_TYPE>(Config::global_config());
+    ASSERT_FALSE(sut.sync([](auto) {}, [](auto) {}, [](auto) {}).has_error());
+
+    auto file_descriptor = sut.file_descriptor();
+    if (!file_descriptor.has_value()) {
+        // the service variant or the platform provides no change notifications
+        return;
+    }
+
+    auto waitset = WaitSetBuilder().create<SERVICE_TYPE>().expect("");
+    auto guard = waitset.attach_notification(file_descriptor.value()).expect("");
+
+    auto other_node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+
+    auto has_triggered = false;
+    waitset
+        .wait_and_process_once_with_timeout(
+            [&](auto attachment_id) {
+                if (attachment_id.has_event_from(guard)) {
+                    has_triggered = true;
+                }
+                return CallbackProgression::Continue;
+            },
+            TIMEOUT)
+        .expect("");
+    ASSERT_TRUE(has_triggered);
+
+    std::vector<NodeId> added;
+    ASSERT_FALSE(
+        sut.sync([&](auto node_state) { added.push_back(node_id_of(node_state).value()); }, [](auto) {}, [](auto) {})
+            .has_error());
+    ASSERT_TRUE(contains(added, other_node.id()));
+}
+} // namespace
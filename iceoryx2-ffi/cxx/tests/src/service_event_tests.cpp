@@ -570,4 +570,26 @@ TYPED_TEST(ServiceEventTest, when_deadline_is_not_missed_notification_works) {
     ASSERT_THAT(result.has_value(), Eq(true));
     ASSERT_THAT(listener.try_wait_one().expect("").has_value(), Eq(true));
 }
+
+TYPED_TEST(ServiceEventTest, listener_wait_resolved_while_spinning_is_counted) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+
+    auto service = node.service_builder(service_name).event().create().expect("");
+    auto listener = service.listener_builder()
+                        .wait_policy(WaitPolicy(iox::units::Duration::fromSeconds(10),
+                                                iox::units::Duration::fromMilliseconds(0)))
+                        .create()
+                        .expect("");
+    auto notifier = service.notifier_builder().create().expect("");
+
+    notifier.notify().expect("");
+    ASSERT_THAT(listener.blocking_wait_one().expect("").has_value(), Eq(true));
+
+    auto statistics = listener.wait_statistics();
+    ASSERT_THAT(statistics.resolved_by_spinning, Eq(1));
+    ASSERT_THAT(statistics.resolved_by_yielding, Eq(0));
+    ASSERT_THAT(statistics.resolved_by_blocking, Eq(0));
+}
 } // namespace
@@ -16,6 +16,9 @@
 
 #include "test.hpp"
 #include <array>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 namespace {
 using namespace iox2;
@@ -595,6 +598,229 @@ TYPED_TEST(ServicePublishSubscribeTest, publisher_applies_unable_to_deliver_stra
     ASSERT_THAT(sut_pub_2.unable_to_deliver_strategy(), Eq(UnableToDeliverStrategy::DiscardSample));
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, publisher_with_huge_pages_delivers_samples_or_falls_back) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 8127;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto sut = service.publisher_builder().page_size(PageSize::Huge2MiB).create().expect("");
+    auto subscriber = service.subscriber_builder().create().expect("");
+
+    ASSERT_THAT(sut.page_size() == PageSize::Default || sut.page_size() == PageSize::Huge2MiB, Eq(true));
+
+    sut.send_copy(PAYLOAD).expect("");
+    auto sample = subscriber.receive().expect("");
+    ASSERT_THAT(sample.has_value(), Eq(true));
+    ASSERT_THAT(sample->payload(), Eq(PAYLOAD));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, pre_faulted_ports_deliver_samples) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 4412;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder().memory_residency(MemoryResidency::PreFaulted).create().expect("");
+    auto sut_subscriber =
+        service.subscriber_builder().memory_residency(MemoryResidency::PreFaulted).create().expect("");
+
+    sut_publisher.send_copy(PAYLOAD).expect("");
+    auto sample = sut_subscriber.receive().expect("");
+    ASSERT_THAT(sample.has_value(), Eq(true));
+    ASSERT_THAT(sample->payload(), Eq(PAYLOAD));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_and_notify_notifies_only_when_buffer_was_empty) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto pubsub = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+    auto event = node.service_builder(service_name).event().create().expect("");
+
+    auto sut_publisher = pubsub.publisher_builder().create().expect("");
+    auto sut_subscriber = pubsub.subscriber_builder().create().expect("");
+    auto listener = event.listener_builder().create().expect("");
+    auto notifier = event.notifier_builder().create().expect("");
+
+    // every send notifies until the subscriber acknowledged the handshake with an empty receive
+    auto sample_1 = sut_publisher.loan().expect("");
+    *sample_1 = 1;
+    auto number_of_recipients = send_and_notify(std::move(sample_1), notifier);
+    ASSERT_THAT(number_of_recipients.has_value(), Eq(true));
+    ASSERT_THAT(*number_of_recipients, Eq(1));
+    ASSERT_TRUE(listener.try_wait_one().expect("").has_value());
+
+    ASSERT_THAT(**sut_subscriber.receive().expect(""), Eq(1));
+    ASSERT_FALSE(sut_subscriber.receive().expect("").has_value());
+
+    auto sample_2 = sut_publisher.loan().expect("");
+    *sample_2 = 2;
+    send_and_notify(std::move(sample_2), notifier).expect("");
+    ASSERT_TRUE(listener.try_wait_one().expect("").has_value());
+
+    auto sample_3 = sut_publisher.loan().expect("");
+    *sample_3 = 3;
+    send_and_notify(std::move(sample_3), notifier).expect("");
+    ASSERT_FALSE(listener.try_wait_one().expect("").has_value());
+
+    ASSERT_THAT(**sut_subscriber.receive().expect(""), Eq(2));
+    ASSERT_THAT(**sut_subscriber.receive().expect(""), Eq(3));
+    ASSERT_FALSE(sut_subscriber.receive().expect("").has_value());
+
+    auto sample_4 = sut_publisher.loan().expect("");
+    *sample_4 = 4;
+    send_and_notify(std::move(sample_4), notifier).expect("");
+    ASSERT_TRUE(listener.try_wait_one().expect("").has_value());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_with_timeout_skips_subscriber_with_full_buffer) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t BUFFER_SIZE = 2;
+    const auto timeout = iox::units::Duration::fromMilliseconds(10);
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .enable_safe_overflow(false)
+                       .subscriber_max_buffer_size(BUFFER_SIZE)
+                       .create()
+                       .expect("");
+
+    auto sut_publisher =
+        service.publisher_builder().unable_to_deliver_strategy(UnableToDeliverStrategy::Block).create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t i = 0; i < BUFFER_SIZE; ++i) {
+        auto number_of_recipients = sut_publisher.send_copy_with_timeout(i, timeout);
+        ASSERT_THAT(number_of_recipients.has_value(), Eq(true));
+        ASSERT_THAT(*number_of_recipients, Eq(1));
+    }
+
+    auto number_of_recipients = sut_publisher.send_copy_with_timeout(123, timeout);
+    ASSERT_THAT(number_of_recipients.has_value(), Eq(true));
+    ASSERT_THAT(*number_of_recipients, Eq(0));
+
+    auto sample = sut_publisher.loan().expect("");
+    *sample = 456;
+    number_of_recipients = send_with_timeout(std::move(sample), timeout);
+    ASSERT_THAT(number_of_recipients.has_value(), Eq(true));
+    ASSERT_THAT(*number_of_recipients, Eq(0));
+
+    for (uint64_t i = 0; i < BUFFER_SIZE; ++i) {
+        auto recv_sample = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(recv_sample.has_value());
+        ASSERT_THAT(**recv_sample, Eq(i));
+    }
+    ASSERT_FALSE(sut_subscriber.receive().expect("").has_value());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, header_contains_no_sequence_number_by_default) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+    ASSERT_FALSE(service.static_config().has_send_tracking());
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    ASSERT_FALSE(sut_publisher.send_copy(123).has_error());
+    auto recv_sample = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(recv_sample.has_value());
+    ASSERT_FALSE(recv_sample->header().sequence_number().has_value());
+    ASSERT_FALSE(recv_sample->header().send_timestamp().has_value());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_tracking_adds_sequence_number_and_timestamp_to_header) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .enable_send_tracking(true)
+                       .create()
+                       .expect("");
+    ASSERT_TRUE(service.static_config().has_send_tracking());
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+        ASSERT_FALSE(sut_publisher.send_copy(i).has_error());
+    }
+
+    auto previous_timestamp = iox::units::Duration::zero();
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+        auto recv_sample = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(recv_sample.has_value());
+
+        auto sequence_number = recv_sample->header().sequence_number();
+        ASSERT_TRUE(sequence_number.has_value());
+        ASSERT_THAT(*sequence_number, Eq(i));
+
+        auto timestamp = recv_sample->header().send_timestamp();
+        ASSERT_TRUE(timestamp.has_value());
+        ASSERT_TRUE(*timestamp >= previous_timestamp);
+        previous_timestamp = *timestamp;
+    }
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, broadcast_ring_delivers_samples_to_all_subscribers) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .connection_backend(ConnectionBackend::BroadcastRing)
+                       .create()
+                       .expect("");
+    ASSERT_THAT(service.static_config().connection_backend(), Eq(ConnectionBackend::BroadcastRing));
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber_1 = service.subscriber_builder().create().expect("");
+    auto sut_subscriber_2 = service.subscriber_builder().create().expect("");
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+        auto number_of_recipients = sut_publisher.send_copy(i);
+        ASSERT_FALSE(number_of_recipients.has_error());
+        ASSERT_THAT(number_of_recipients.value(), Eq(2U));
+    }
+
+    for (auto* sut_subscriber : { &sut_subscriber_1, &sut_subscriber_2 }) {
+        for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+            auto recv_sample = sut_subscriber->receive().expect("");
+            ASSERT_TRUE(recv_sample.has_value());
+            ASSERT_THAT(**recv_sample, Eq(i));
+        }
+        ASSERT_FALSE(sut_subscriber->receive().expect("").has_value());
+    }
+
+    auto sut_open = node.service_builder(service_name)
+                        .template publish_subscribe<uint64_t>()
+                        .connection_backend(ConnectionBackend::SubscriberQueues)
+                        .open();
+    ASSERT_TRUE(sut_open.has_error());
+    ASSERT_THAT(sut_open.error(), Eq(PublishSubscribeOpenError::IncompatibleConnectionBackend));
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, publisher_applies_max_slice_len) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
     constexpr uint64_t DESIRED_MAX_SLICE_LEN = 10;
@@ -648,6 +874,196 @@ TYPED_TEST(ServicePublishSubscribeTest, send_receive_with_user_header_works) {
     }
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, receive_batch_receives_all_samples) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 5;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .create()
+                       .expect("");
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        sut_publisher.send_copy(idx).expect("");
+    }
+
+    std::vector<uint64_t> received;
+    auto result = sut_subscriber.receive_batch(NUMBER_OF_SAMPLES, [&](auto sample) {
+        received.push_back(*sample);
+        return CallbackProgression::Continue;
+    });
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(received.size(), Eq(NUMBER_OF_SAMPLES));
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        ASSERT_THAT(received[idx], Eq(idx));
+    }
+    ASSERT_FALSE(*sut_subscriber.has_samples());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, receive_batch_respects_max_number_of_samples_and_stop) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 6;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .create()
+                       .expect("");
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        sut_publisher.send_copy(idx).expect("");
+    }
+
+    auto result = sut_subscriber.receive_batch(2, [](auto) { return CallbackProgression::Continue; });
+    ASSERT_THAT(result.value(), Eq(2));
+
+    uint64_t counter = 0;
+    result = sut_subscriber.receive_batch(NUMBER_OF_SAMPLES, [&](auto sample) {
+        EXPECT_THAT(*sample, Eq(2));
+        counter++;
+        return CallbackProgression::Stop;
+    });
+    ASSERT_THAT(result.value(), Eq(1));
+    ASSERT_THAT(counter, Eq(1));
+
+    auto sample = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(sample.has_value());
+    ASSERT_THAT(**sample, Eq(3));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, round_robin_receive_policy_alternates_between_publishers) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .max_publishers(2)
+                       .create()
+                       .expect("");
+
+    auto sut_subscriber = service.subscriber_builder().receive_policy(ReceivePolicy::RoundRobin).create().expect("");
+    auto publisher_1 = service.publisher_builder().create().expect("");
+    auto publisher_2 = service.publisher_builder().create().expect("");
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        publisher_1.send_copy(idx).expect("");
+        publisher_2.send_copy(idx + NUMBER_OF_SAMPLES).expect("");
+    }
+
+    iox::optional<bool> last_origin_was_first_publisher;
+    for (uint64_t idx = 0; idx < 2 * NUMBER_OF_SAMPLES; ++idx) {
+        auto sample = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(sample.has_value());
+        const bool origin_is_first_publisher = **sample < NUMBER_OF_SAMPLES;
+        if (last_origin_was_first_publisher.has_value()) {
+            ASSERT_THAT(origin_is_first_publisher, Ne(*last_origin_was_first_publisher));
+        }
+        last_origin_was_first_publisher = origin_is_first_publisher;
+    }
+
+    ASSERT_FALSE(*sut_subscriber.has_samples());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, round_robin_receive_policy_serves_publishers_by_weight) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 4;
+    constexpr uint64_t NUMBER_OF_RECEIVED_SAMPLES = 6;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .max_publishers(2)
+                       .create()
+                       .expect("");
+
+    auto sut_subscriber = service.subscriber_builder().receive_policy(ReceivePolicy::RoundRobin).create().expect("");
+    auto publisher_1 = service.publisher_builder().create().expect("");
+    auto publisher_2 = service.publisher_builder().create().expect("");
+
+    ASSERT_THAT(sut_subscriber.publisher_weight(publisher_1.id()), Eq(1));
+    sut_subscriber.set_publisher_weight(publisher_1.id(), 2);
+    ASSERT_THAT(sut_subscriber.publisher_weight(publisher_1.id()), Eq(2));
+    ASSERT_THAT(sut_subscriber.publisher_weight(publisher_2.id()), Eq(1));
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        publisher_1.send_copy(idx).expect("");
+        publisher_2.send_copy(idx + NUMBER_OF_SAMPLES).expect("");
+    }
+
+    // independent of the publisher that is served first, three rounds deliver two samples of
+    // the first and one sample of the second publisher each
+    uint64_t number_of_samples_from_first_publisher = 0;
+    for (uint64_t idx = 0; idx < NUMBER_OF_RECEIVED_SAMPLES; ++idx) {
+        auto sample = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(sample.has_value());
+        if (**sample < NUMBER_OF_SAMPLES) {
+            ++number_of_samples_from_first_publisher;
+        }
+    }
+    ASSERT_THAT(number_of_samples_from_first_publisher, Eq(4));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, oldest_first_receive_policy_receives_in_send_order) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .max_publishers(2)
+                       .enable_send_tracking(true)
+                       .create()
+                       .expect("");
+
+    auto sut_subscriber = service.subscriber_builder().receive_policy(ReceivePolicy::OldestFirst).create().expect("");
+    auto publisher_1 = service.publisher_builder().create().expect("");
+    auto publisher_2 = service.publisher_builder().create().expect("");
+
+    const std::array<bool, 2 * NUMBER_OF_SAMPLES> send_with_first_publisher { false, true, true, false, false, true };
+    for (uint64_t idx = 0; idx < send_with_first_publisher.size(); ++idx) {
+        if (send_with_first_publisher[idx]) {
+            publisher_1.send_copy(idx).expect("");
+        } else {
+            publisher_2.send_copy(idx).expect("");
+        }
+        // distinct send timestamps also on platforms with a coarse clock
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (uint64_t idx = 0; idx < send_with_first_publisher.size(); ++idx) {
+        auto sample = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(sample.has_value());
+        ASSERT_THAT(**sample, Eq(idx));
+    }
+
+    ASSERT_FALSE(*sut_subscriber.has_samples());
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, has_sample_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
@@ -758,6 +1174,39 @@ TYPED_TEST(ServicePublishSubscribeTest, service_can_be_opened_when_there_is_a_su
     }
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, publisher_with_buddy_allocator_delivers_slices_of_varying_length) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    using ValueType = uint8_t;
+    constexpr uint64_t MAX_SLICE_LEN = 1024;
+    constexpr ValueType PAYLOAD = 193;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service =
+        node.service_builder(service_name).template publish_subscribe<iox::Slice<ValueType>>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder()
+                             .initial_max_slice_len(MAX_SLICE_LEN)
+                             .payload_allocator(PayloadAllocator::Buddy)
+                             .create()
+                             .expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t slice_len = 1; slice_len <= MAX_SLICE_LEN; slice_len *= 4) {
+        auto send_sample = sut_publisher.loan_slice_uninit(slice_len).expect("");
+        send_sample.write_from_fn([](auto) { return PAYLOAD; });
+        send(assume_init(std::move(send_sample))).expect("");
+
+        auto recv_result = sut_subscriber.receive().expect("");
+        ASSERT_TRUE(recv_result.has_value());
+        auto recv_sample = std::move(recv_result.value());
+        ASSERT_THAT(recv_sample.payload().number_of_elements(), Eq(slice_len));
+        for (const auto& item : recv_sample.payload()) {
+            ASSERT_THAT(item, Eq(PAYLOAD));
+        }
+    }
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, publisher_reallocates_memory_when_allocation_strategy_is_set) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
     using ValueType = uint8_t;
@@ -876,6 +1325,78 @@ TYPED_TEST(ServicePublishSubscribeTest, open_fails_when_attributes_are_incompati
     ASSERT_THAT(service_open.error(), Eq(PublishSubscribeOpenError::IncompatibleAttributes));
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, dynamic_config_provides_number_of_ports) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    ASSERT_THAT(service.dynamic_config().number_of_publishers(), Eq(0));
+    ASSERT_THAT(service.dynamic_config().number_of_subscribers(), Eq(0));
+
+    {
+        auto sut_publisher = service.publisher_builder().create().expect("");
+        auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+        ASSERT_THAT(service.dynamic_config().number_of_publishers(), Eq(1));
+        ASSERT_THAT(service.dynamic_config().number_of_subscribers(), Eq(1));
+    }
+
+    ASSERT_THAT(service.dynamic_config().number_of_publishers(), Eq(0));
+    ASSERT_THAT(service.dynamic_config().number_of_subscribers(), Eq(0));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, dynamic_config_provides_port_statistics) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .enable_safe_overflow(true)
+                       .subscriber_max_buffer_size(1)
+                       .create()
+                       .expect("");
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    for (uint64_t n = 0; n < NUMBER_OF_SAMPLES; ++n) {
+        sut_publisher.send_copy(n).expect("");
+    }
+    ASSERT_TRUE(sut_subscriber.receive().expect("").has_value());
+
+    std::vector<PublisherStatistics> publisher_statistics;
+    service.dynamic_config().list_publisher_statistics(
+        [&](const RawIdType& id, const PublisherStatistics& statistics) -> CallbackProgression {
+            EXPECT_THAT(id, Eq(*sut_publisher.id().bytes()));
+            publisher_statistics.push_back(statistics);
+            return CallbackProgression::Continue;
+        });
+
+    std::vector<SubscriberStatistics> subscriber_statistics;
+    service.dynamic_config().list_subscriber_statistics(
+        [&](const RawIdType& id, const SubscriberStatistics& statistics) -> CallbackProgression {
+            EXPECT_THAT(id, Eq(*sut_subscriber.id().bytes()));
+            subscriber_statistics.push_back(statistics);
+            return CallbackProgression::Continue;
+        });
+
+    ASSERT_THAT(publisher_statistics.size(), Eq(1));
+    ASSERT_THAT(publisher_statistics[0].sent_samples, Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(publisher_statistics[0].overflowed_samples, Eq(NUMBER_OF_SAMPLES - 1));
+    ASSERT_THAT(publisher_statistics[0].failed_deliveries, Eq(0));
+    ASSERT_THAT(publisher_statistics[0].exceeded_max_loans, Eq(0));
+
+    ASSERT_THAT(subscriber_statistics.size(), Eq(1));
+    ASSERT_THAT(subscriber_statistics[0].received_samples, Eq(1));
+    ASSERT_THAT(subscriber_statistics[0].exceeded_max_borrows, Eq(0));
+}
+
 // BEGIN tests for customizable payload and user header type name
 constexpr uint8_t CAPACITY = 100;
 constexpr uint8_t ALIGNMENT = 16;
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/node.hpp"
+#include "iox2/service_tracker.hpp"
+#include "iox2/waitset.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace iox2;
+
+constexpr iox::units::Duration TIMEOUT = iox::units::Duration::fromMilliseconds(100);
+
+template <typename T>
+struct ServiceTrackerTest : public ::testing::Test {
+    static constexpr ServiceType TYPE = T::TYPE;
+
+    ServiceTrackerTest()
+        : node { NodeBuilder().create<TYPE>().expect("") } {
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes), required for tests
+    Node<TYPE> node;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(ServiceTrackerTest, iox2_testing::ServiceTypes, );
+
+auto contains(const std::vector<std::string>& names, const ServiceName& service_name) -> bool {
+    return std::find(names.begin(), names.end(), std::string(service_name.to_string().c_str())) != names.end();
+}
+
+TYPED_TEST(ServiceTrackerTest, sync_reports_added_and_removed_services) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto sut = ServiceTracker<SERVICE_TYPE>(Config::global_config());
+
+    std::vector<std::string> added;
+    std::vector<std::string> removed;
+    auto on_added = [&](auto static_config) { added.emplace_back(static_config.name()); };
+    auto on_removed = [&](auto static_config) { removed.emplace_back(static_config.name()); };
+
+    {
+        auto service = this->node.service_builder(service_name).event().create().expect("");
+
+        ASSERT_FALSE(sut.sync(on_added, on_removed).has_error());
+        ASSERT_TRUE(contains(added, service_name));
+        ASSERT_FALSE(contains(removed, service_name));
+        ASSERT_FALSE(sut.is_empty());
+
+        auto is_listed = false;
+        sut.list([&](auto static_config) {
+            if (std::strcmp(static_config.name(), service_name.to_string().c_str()) == 0) {
+                is_listed = true;
+            }
+            return CallbackProgression::Continue;
+        });
+        ASSERT_TRUE(is_listed);
+    }
+
+    added.clear();
+    ASSERT_FALSE(sut.sync(on_added, on_removed).has_error());
+    ASSERT_FALSE(contains(added, service_name));
+    ASSERT_TRUE(contains(removed, service_name));
+}
+
+TYPED_TEST(ServiceTrackerTest, file_descriptor_signals_created_services) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    auto sut = ServiceTracker<SERVICE_TYPE>(Config::global_config());
+    ASSERT_FALSE(sut.sync([](auto) {}, [](auto) {}).has_error());
+
+    auto file_descriptor = sut.file_descriptor();
+    if (!file_descriptor.has_value()) {
+        // the service variant or the platform provides no change notifications
+        return;
+    }
+
+    auto waitset = WaitSetBuilder().create<SERVICE_TYPE>().expect("");
+    auto guard = waitset.attach_notification(file_descriptor.value()).expect("");
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto service = this->node.service_builder(service_name).event().create().expect("");
+
+    auto has_triggered = false;
+    waitset
+        .wait_and_process_once_with_timeout(
+            [&](auto attachment_id) {
+                if (attachment_id.has_event_from(guard)) {
+                    has_triggered = true;
+                }
+                return CallbackProgression::Continue;
+            },
+            TIMEOUT)
+        .expect("");
+    ASSERT_TRUE(has_triggered);
+
+    std::vector<std::string> added;
+    ASSERT_FALSE(sut.sync([&](auto static_config) { added.emplace_back(static_config.name()); }, [](auto) {})
+                     .has_error());
+    ASSERT_TRUE(contains(added, service_name));
+}
+} // namespace
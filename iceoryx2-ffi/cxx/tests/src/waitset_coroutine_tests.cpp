@@ -0,0 +1,167 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/node.hpp"
+#include "iox2/service_name.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/waitset.hpp"
+#include "iox2/waitset_coroutine.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+using namespace iox2;
+
+auto generate_name() -> ServiceName {
+    static std::atomic<uint64_t> COUNTER = 0;
+    return ServiceName::create(
+               (std::string("waitset_coroutine_tests_") + std::to_string(COUNTER.fetch_add(1))).c_str())
+        .expect("");
+}
+
+template <typename T>
+struct WaitSetCoroutineTest : public ::testing::Test {
+    static constexpr ServiceType TYPE = T::TYPE;
+
+    WaitSetCoroutineTest()
+        : node { NodeBuilder().create<TYPE>().expect("") }
+        , event { node.service_builder(generate_name()).event().create().expect("") }
+        , waitset { WaitSetBuilder().create<TYPE>().expect("") } {
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes), come on, its a test
+    Node<TYPE> node;
+    PortFactoryEvent<TYPE> event;
+    WaitSet<TYPE> waitset;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+};
+
+template <ServiceType S>
+auto collect_events(AsyncListener<S>& listener, std::vector<size_t>& events, uint64_t number_of_events)
+    -> WaitSetTask {
+    for (uint64_t i = 0; i < number_of_events; ++i) {
+        auto event_id = co_await listener.next_event();
+        events.push_back(event_id.expect("").as_value());
+    }
+}
+
+template <ServiceType S>
+auto collect_samples(AsyncSubscriber<S, uint64_t, void>& subscriber,
+                     std::vector<uint64_t>& samples,
+                     uint64_t number_of_samples) -> WaitSetTask {
+    for (uint64_t i = 0; i < number_of_samples; ++i) {
+        auto sample = co_await subscriber.next_sample();
+        samples.push_back(sample.expect("").payload());
+    }
+}
+
+TYPED_TEST_SUITE(WaitSetCoroutineTest, iox2_testing::ServiceTypes, );
+
+TYPED_TEST(WaitSetCoroutineTest, spawned_task_waits_for_listener_event) {
+    auto listener = this->event.listener_builder().create().expect("");
+    auto notifier = this->event.notifier_builder().create().expect("");
+    WaitSetScheduler<TestFixture::TYPE> sut(this->waitset);
+    auto async_listener = sut.attach(listener).expect("");
+
+    std::vector<size_t> events;
+    auto task = collect_events(async_listener, events, 1);
+    sut.spawn(task);
+
+    ASSERT_THAT(sut.number_of_waiting_coroutines(), Eq(1));
+    ASSERT_THAT(events.size(), Eq(0));
+
+    notifier.notify_with_custom_event_id(EventId(42)).expect("");
+    auto result = sut.run().expect("");
+
+    ASSERT_THAT(result, Eq(WaitSetRunResult::AllEventsHandled));
+    ASSERT_THAT(task.is_done(), Eq(true));
+    ASSERT_THAT(sut.number_of_waiting_coroutines(), Eq(0));
+    ASSERT_THAT(events.size(), Eq(1));
+    ASSERT_THAT(events[0], Eq(42));
+}
+
+TYPED_TEST(WaitSetCoroutineTest, awaiting_a_ready_listener_does_not_suspend) {
+    auto listener = this->event.listener_builder().create().expect("");
+    auto notifier = this->event.notifier_builder().create().expect("");
+    WaitSetScheduler<TestFixture::TYPE> sut(this->waitset);
+    auto async_listener = sut.attach(listener).expect("");
+
+    notifier.notify_with_custom_event_id(EventId(7)).expect("");
+
+    std::vector<size_t> events;
+    auto task = collect_events(async_listener, events, 1);
+    sut.spawn(task);
+
+    ASSERT_THAT(task.is_done(), Eq(true));
+    ASSERT_THAT(sut.number_of_waiting_coroutines(), Eq(0));
+    ASSERT_THAT(events.size(), Eq(1));
+    ASSERT_THAT(events[0], Eq(7));
+}
+
+TYPED_TEST(WaitSetCoroutineTest, multiple_tasks_are_resumed_by_one_scheduler) {
+    auto listener_1 = this->event.listener_builder().create().expect("");
+    auto listener_2 = this->event.listener_builder().create().expect("");
+    auto notifier = this->event.notifier_builder().create().expect("");
+    WaitSetScheduler<TestFixture::TYPE> sut(this->waitset);
+    auto async_listener_1 = sut.attach(listener_1).expect("");
+    auto async_listener_2 = sut.attach(listener_2).expect("");
+
+    std::vector<size_t> events_1;
+    std::vector<size_t> events_2;
+    auto task_1 = collect_events(async_listener_1, events_1, 1);
+    auto task_2 = collect_events(async_listener_2, events_2, 1);
+    sut.spawn(task_1);
+    sut.spawn(task_2);
+
+    ASSERT_THAT(sut.number_of_waiting_coroutines(), Eq(2));
+
+    notifier.notify_with_custom_event_id(EventId(3)).expect("");
+    sut.run().expect("");
+
+    ASSERT_THAT(task_1.is_done(), Eq(true));
+    ASSERT_THAT(task_2.is_done(), Eq(true));
+    ASSERT_THAT(events_1.size(), Eq(1));
+    ASSERT_THAT(events_2.size(), Eq(1));
+}
+
+TYPED_TEST(WaitSetCoroutineTest, spawned_task_receives_samples_from_subscriber) {
+    constexpr uint64_t NUMBER_OF_SAMPLES = 3;
+    auto pubsub =
+        this->node.service_builder(generate_name()).template publish_subscribe<uint64_t>().create().expect("");
+    auto publisher = pubsub.publisher_builder().create().expect("");
+    auto subscriber = pubsub.subscriber_builder().create().expect("");
+    auto listener = this->event.listener_builder().create().expect("");
+    auto notifier = this->event.notifier_builder().create().expect("");
+    WaitSetScheduler<TestFixture::TYPE> sut(this->waitset);
+    auto async_subscriber = sut.attach(subscriber, listener).expect("");
+
+    std::vector<uint64_t> samples;
+    auto task = collect_samples(async_subscriber, samples, NUMBER_OF_SAMPLES);
+    sut.spawn(task);
+
+    ASSERT_THAT(sut.number_of_waiting_coroutines(), Eq(1));
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+        publisher.send_copy(i * 3).expect("");
+    }
+    notifier.notify().expect("");
+    sut.run().expect("");
+
+    ASSERT_THAT(task.is_done(), Eq(true));
+    ASSERT_THAT(samples.size(), Eq(NUMBER_OF_SAMPLES));
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i) {
+        ASSERT_THAT(samples[i], Eq(i * 3));
+    }
+}
+} // namespace
@@ -16,7 +16,9 @@
 #include "iox2/waitset.hpp"
 #include "test.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -339,4 +341,164 @@ TYPED_TEST(WaitSetTest, signal_handling_mode_can_be_set) {
     ASSERT_THAT(sut_1.signal_handling_mode(), Eq(SignalHandlingMode::Disabled));
     ASSERT_THAT(sut_2.signal_handling_mode(), Eq(SignalHandlingMode::HandleTerminationRequests));
 }
+
+TYPED_TEST(WaitSetTest, timer_slack_can_be_set) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t TIMER_SLACK_MS = 25;
+
+    auto sut_1 = WaitSetBuilder().create<SERVICE_TYPE>().expect("");
+    auto sut_2 = WaitSetBuilder()
+                     .timer_slack(iox::units::Duration::fromMilliseconds(TIMER_SLACK_MS))
+                     .create<SERVICE_TYPE>()
+                     .expect("");
+
+    ASSERT_THAT(sut_1.timer_slack(), Eq(iox::units::Duration::fromMilliseconds(0)));
+    ASSERT_THAT(sut_2.timer_slack(), Eq(iox::units::Duration::fromMilliseconds(TIMER_SLACK_MS)));
+}
+
+TYPED_TEST(WaitSetTest, wait_resolved_while_spinning_is_counted) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    auto sut = WaitSetBuilder()
+                   .wait_policy(WaitPolicy(Duration::fromSeconds(10), Duration::fromMilliseconds(0)))
+                   .create<SERVICE_TYPE>()
+                   .expect("");
+    auto listener = this->create_listener();
+    auto notifier = this->create_notifier();
+    auto guard = sut.attach_notification(listener).expect("");
+
+    notifier.notify().expect("");
+    sut.wait_and_process_once([](auto) { return CallbackProgression::Continue; }).expect("");
+
+    auto statistics = sut.wait_statistics();
+    ASSERT_THAT(statistics.resolved_by_spinning, Eq(1));
+    ASSERT_THAT(statistics.resolved_by_yielding, Eq(0));
+    ASSERT_THAT(statistics.resolved_by_blocking, Eq(0));
+}
+
+TYPED_TEST(WaitSetTest, poll_interval_can_be_set) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t POLL_INTERVAL_US = 250;
+
+    auto sut_1 = WaitSetBuilder().create<SERVICE_TYPE>().expect("");
+    auto sut_2 = WaitSetBuilder()
+                     .poll_interval(iox::units::Duration::fromMicroseconds(POLL_INTERVAL_US))
+                     .create<SERVICE_TYPE>()
+                     .expect("");
+
+    ASSERT_THAT(sut_1.poll_interval(), Eq(iox::units::Duration::fromMilliseconds(1)));
+    ASSERT_THAT(sut_2.poll_interval(), Eq(iox::units::Duration::fromMicroseconds(POLL_INTERVAL_US)));
+}
+
+TYPED_TEST(WaitSetTest, run_lists_ready_polling_attachments) {
+    auto sut = this->create_sut();
+
+    iox::function<bool()> ready_predicate = [] { return true; };
+    iox::function<bool()> idle_predicate = [] { return false; };
+    auto ready_guard = sut.attach_polling(ready_predicate).expect("");
+    auto idle_guard = sut.attach_polling(idle_predicate).expect("");
+    ASSERT_THAT(sut.len(), Eq(2));
+
+    auto ready_triggered = false;
+    auto idle_triggered = false;
+    sut.wait_and_process_once([&](auto attachment_id) -> CallbackProgression {
+           ready_triggered |= attachment_id.has_event_from(ready_guard);
+           idle_triggered |= attachment_id.has_event_from(idle_guard);
+           return CallbackProgression::Continue;
+       })
+        .expect("");
+
+    ASSERT_THAT(ready_triggered, Eq(true));
+    ASSERT_THAT(idle_triggered, Eq(false));
+}
+
+TYPED_TEST(WaitSetTest, polled_subscriber_is_reported_when_it_has_samples) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 1234;
+    auto service =
+        this->node.service_builder(generate_name()).template publish_subscribe<uint64_t>().create().expect("");
+    auto publisher = service.publisher_builder().create().expect("");
+    auto subscriber = service.subscriber_builder().create().expect("");
+
+    auto sut = WaitSetBuilder().poll_interval(Duration::fromMilliseconds(5)).create<SERVICE_TYPE>().expect("");
+    auto guard = sut.attach_polling(subscriber).expect("");
+
+    auto subscriber_triggered = false;
+    sut.wait_and_process_once_with_timeout(
+           [&](auto attachment_id) -> CallbackProgression {
+               subscriber_triggered |= attachment_id.has_event_from(guard);
+               return CallbackProgression::Continue;
+           },
+           TIMEOUT)
+        .expect("");
+    ASSERT_THAT(subscriber_triggered, Eq(false));
+
+    publisher.send_copy(PAYLOAD).expect("");
+
+    sut.wait_and_process_once([&](auto attachment_id) -> CallbackProgression {
+           subscriber_triggered |= attachment_id.has_event_from(guard);
+           return CallbackProgression::Continue;
+       })
+        .expect("");
+    ASSERT_THAT(subscriber_triggered, Eq(true));
+
+    auto sample = subscriber.receive().expect("");
+    ASSERT_TRUE(sample.has_value());
+    ASSERT_THAT(**sample, Eq(PAYLOAD));
+}
+
+TYPED_TEST(WaitSetTest, executor_number_of_threads_is_at_least_one) {
+    auto sut = this->create_sut();
+
+    ASSERT_THAT(WaitSetExecutorBuilder().number_of_threads(0).create(sut).number_of_threads(), Eq(1));
+    ASSERT_THAT(WaitSetExecutorBuilder().number_of_threads(4).create(sut).number_of_threads(), Eq(4));
+}
+
+TYPED_TEST(WaitSetTest, executor_calls_callback_from_worker_threads) {
+    constexpr uint64_t NUMBER_OF_CALLS = 3;
+    auto sut = this->create_sut();
+    auto guard = sut.attach_interval(Duration::fromMilliseconds(10)).expect("");
+    const auto main_thread = std::this_thread::get_id();
+
+    std::atomic<uint64_t> counter { 0 };
+    std::atomic<bool> called_from_main_thread { false };
+    auto executor = WaitSetExecutorBuilder().number_of_threads(2).create(sut);
+    auto result = executor.run([&](auto attachment_id) -> CallbackProgression {
+        EXPECT_THAT(attachment_id.has_event_from(guard), Eq(true));
+        if (std::this_thread::get_id() == main_thread) {
+            called_from_main_thread.store(true);
+        }
+
+        return counter.fetch_add(1) + 1 == NUMBER_OF_CALLS ? CallbackProgression::Stop
+                                                           : CallbackProgression::Continue;
+    });
+
+    ASSERT_THAT(result.has_value(), Eq(true));
+    ASSERT_THAT(result.value(), Eq(WaitSetRunResult::StopRequest));
+    ASSERT_THAT(counter.load(), Ge(NUMBER_OF_CALLS));
+    ASSERT_THAT(called_from_main_thread.load(), Eq(false));
+}
+
+TYPED_TEST(WaitSetTest, executor_never_processes_an_attachment_concurrently) {
+    constexpr uint64_t NUMBER_OF_CALLS = 10;
+    auto sut = this->create_sut();
+    auto guard = sut.attach_interval(Duration::fromMilliseconds(1)).expect("");
+
+    std::atomic<bool> is_processed { false };
+    std::atomic<bool> has_concurrent_processing { false };
+    std::atomic<uint64_t> counter { 0 };
+    auto executor = WaitSetExecutorBuilder().number_of_threads(4).create(sut);
+    auto result = executor.run([&](auto) -> CallbackProgression {
+        if (is_processed.exchange(true)) {
+            has_concurrent_processing.store(true);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        is_processed.store(false);
+
+        return counter.fetch_add(1) + 1 == NUMBER_OF_CALLS ? CallbackProgression::Stop
+                                                           : CallbackProgression::Continue;
+    });
+
+    ASSERT_THAT(result.has_value(), Eq(true));
+    ASSERT_THAT(has_concurrent_processing.load(), Eq(false));
+}
 } // namespace
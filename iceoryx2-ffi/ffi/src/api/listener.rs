@@ -72,7 +72,7 @@ impl ListenerUnion {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<ListenerUnion>
 pub struct iox2_listener_storage_t {
-    internal: [u8; 1656], // magic number obtained with size_of::<Option<ListenerUnion>>()
+    internal: [u8; 1712], // magic number obtained with size_of::<Option<ListenerUnion>>()
 }
 
 #[repr(C)]
@@ -378,6 +378,38 @@ pub unsafe extern "C" fn iox2_listener_deadline(
         .is_some()
 }
 
+/// Returns how often a wait of the listener was resolved while spinning, yielding or blocking.
+///
+/// # Safety
+///
+/// * `listener_handle` is valid, non-null and was obtained via [`iox2_port_factory_listener_builder_create`](crate::iox2_port_factory_listener_builder_create)
+/// * `resolved_by_spinning` is pointing to a valid memory location and non-null
+/// * `resolved_by_yielding` is pointing to a valid memory location and non-null
+/// * `resolved_by_blocking` is pointing to a valid memory location and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_listener_wait_statistics(
+    listener_handle: iox2_listener_h_ref,
+    resolved_by_spinning: *mut u64,
+    resolved_by_yielding: *mut u64,
+    resolved_by_blocking: *mut u64,
+) {
+    listener_handle.assert_non_null();
+    debug_assert!(!resolved_by_spinning.is_null());
+    debug_assert!(!resolved_by_yielding.is_null());
+    debug_assert!(!resolved_by_blocking.is_null());
+
+    let listener = &mut *listener_handle.as_type();
+
+    let statistics = match listener.service_type {
+        iox2_service_type_e::IPC => listener.value.as_mut().ipc.wait_statistics(),
+        iox2_service_type_e::LOCAL => listener.value.as_mut().local.wait_statistics(),
+    };
+
+    *resolved_by_spinning = statistics.resolved_by_spinning;
+    *resolved_by_yielding = statistics.resolved_by_yielding;
+    *resolved_by_blocking = statistics.resolved_by_blocking;
+}
+
 /// Blocks the listener until at least one event was received and then calls the callback for
 /// every received event providing the corresponding [`iox2_event_id_t`] pointer to the event.
 /// On error it returns [`iox2_listener_wait_error_e`].
@@ -34,6 +34,7 @@ mod node;
 mod node_builder;
 mod node_id;
 mod node_name;
+mod node_tracker;
 mod notifier;
 mod port_factory_event;
 mod port_factory_listener_builder;
@@ -51,6 +52,7 @@ mod service_builder;
 mod service_builder_event;
 mod service_builder_pub_sub;
 mod service_name;
+mod service_tracker;
 mod signal_handling_mode;
 mod static_config;
 mod static_config_event;
@@ -79,6 +81,7 @@ pub use node::*;
 pub use node_builder::*;
 pub use node_id::*;
 pub use node_name::*;
+pub use node_tracker::*;
 pub use notifier::*;
 pub use port_factory_event::*;
 pub use port_factory_listener_builder::*;
@@ -96,6 +99,7 @@ pub use service_builder::*;
 pub use service_builder_event::*;
 pub use service_builder_pub_sub::*;
 pub use service_name::*;
+pub use service_tracker::*;
 pub use signal_handling_mode::*;
 pub use static_config::*;
 pub use static_config_event::*;
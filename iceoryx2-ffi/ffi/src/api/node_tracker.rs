@@ -0,0 +1,345 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+
+use core::{ffi::c_int, mem::ManuallyDrop};
+
+use crate::{
+    c_size_t, iox2_callback_context, iox2_config_ptr, iox2_file_descriptor_ptr,
+    iox2_node_list_callback, iox2_service_type_e, IOX2_OK,
+};
+
+use super::{iox2_node_list_impl, AssertNonNullHandle, HandleToType, IntoCInt};
+use iceoryx2::{
+    node::{NodeListFailure, NodeState},
+    service::{ipc, local, Service},
+    tracker::node::Tracker,
+};
+use iceoryx2_bb_elementary::static_assert::*;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_ffi_macros::iceoryx2_ffi;
+
+// BEGIN types definition
+
+pub(crate) union NodeTrackerUnion {
+    ipc: ManuallyDrop<Tracker<ipc::Service>>,
+    local: ManuallyDrop<Tracker<local::Service>>,
+}
+
+impl NodeTrackerUnion {
+    pub(crate) fn new_ipc(tracker: Tracker<ipc::Service>) -> Self {
+        Self {
+            ipc: ManuallyDrop::new(tracker),
+        }
+    }
+
+    pub(crate) fn new_local(tracker: Tracker<local::Service>) -> Self {
+        Self {
+            local: ManuallyDrop::new(tracker),
+        }
+    }
+}
+
+#[repr(C)]
+#[repr(align(8))] // alignment of Option<NodeTrackerUnion>
+pub struct iox2_node_tracker_storage_t {
+    internal: [u8; 3840], // magic number obtained with size_of::<Option<NodeTrackerUnion>>()
+}
+
+#[repr(C)]
+#[iceoryx2_ffi(NodeTrackerUnion)]
+pub struct iox2_node_tracker_t {
+    service_type: iox2_service_type_e,
+    value: iox2_node_tracker_storage_t,
+    deleter: fn(*mut iox2_node_tracker_t),
+}
+
+impl iox2_node_tracker_t {
+    pub(super) fn init(
+        &mut self,
+        service_type: iox2_service_type_e,
+        value: NodeTrackerUnion,
+        deleter: fn(*mut iox2_node_tracker_t),
+    ) {
+        self.service_type = service_type;
+        self.value.init(value);
+        self.deleter = deleter;
+    }
+}
+
+pub struct iox2_node_tracker_h_t;
+/// The owning handle for `iox2_node_tracker_t`. Passing the handle to an function transfers the ownership.
+pub type iox2_node_tracker_h = *mut iox2_node_tracker_h_t;
+/// The non-owning handle for `iox2_node_tracker_t`. Passing the handle to an function does not transfers the ownership.
+pub type iox2_node_tracker_h_ref = *const iox2_node_tracker_h;
+
+impl AssertNonNullHandle for iox2_node_tracker_h {
+    fn assert_non_null(self) {
+        debug_assert!(!self.is_null());
+    }
+}
+
+impl AssertNonNullHandle for iox2_node_tracker_h_ref {
+    fn assert_non_null(self) {
+        debug_assert!(!self.is_null());
+        unsafe {
+            debug_assert!(!(*self).is_null());
+        }
+    }
+}
+
+impl HandleToType for iox2_node_tracker_h {
+    type Target = *mut iox2_node_tracker_t;
+
+    fn as_type(self) -> Self::Target {
+        self as *mut _ as _
+    }
+}
+
+impl HandleToType for iox2_node_tracker_h_ref {
+    type Target = *mut iox2_node_tracker_t;
+
+    fn as_type(self) -> Self::Target {
+        unsafe { *self as *mut _ as _ }
+    }
+}
+
+fn sync<S: Service>(
+    tracker: &mut Tracker<S>,
+    on_added: iox2_node_list_callback,
+    on_changed: iox2_node_list_callback,
+    on_removed: iox2_node_list_callback,
+    callback_ctx: iox2_callback_context,
+) -> Result<(), NodeListFailure> {
+    let changes = tracker.sync()?;
+
+    for node_id in &changes.added {
+        if let Some(node_state) = tracker.get(node_id) {
+            iox2_node_list_impl(node_state, on_added, callback_ctx);
+        }
+    }
+
+    for node_id in &changes.changed {
+        if let Some(node_state) = tracker.get(node_id) {
+            iox2_node_list_impl(node_state, on_changed, callback_ctx);
+        }
+    }
+
+    for node_state in &changes.removed {
+        iox2_node_list_impl(node_state, on_removed, callback_ctx);
+    }
+
+    Ok(())
+}
+// END type definition
+
+// BEGIN C API
+
+/// Creates a new [`iox2_node_tracker_t`] with an empty cache. The first
+/// [`iox2_node_tracker_sync()`] reports all existing nodes as added.
+///
+/// # Safety
+///
+///  * `config_ptr` must be valid and non-null
+///  * `struct_ptr` must be either a valid pointer to uninitialized memory or `null`
+///  * `handle_ptr` must point to a valid uninitialized memory location
+///  * The acquired handle must be cleaned up with [`iox2_node_tracker_drop()`].
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_new(
+    service_type: iox2_service_type_e,
+    config_ptr: iox2_config_ptr,
+    struct_ptr: *mut iox2_node_tracker_t,
+    handle_ptr: *mut iox2_node_tracker_h,
+) {
+    debug_assert!(!config_ptr.is_null());
+    debug_assert!(!handle_ptr.is_null());
+
+    *handle_ptr = core::ptr::null_mut();
+
+    let mut struct_ptr = struct_ptr;
+    fn no_op(_: *mut iox2_node_tracker_t) {}
+    let mut deleter: fn(*mut iox2_node_tracker_t) = no_op;
+    if struct_ptr.is_null() {
+        struct_ptr = iox2_node_tracker_t::alloc();
+        deleter = iox2_node_tracker_t::dealloc;
+    }
+    debug_assert!(!struct_ptr.is_null());
+
+    let config = &*config_ptr;
+    let value = match service_type {
+        iox2_service_type_e::IPC => NodeTrackerUnion::new_ipc(Tracker::new(config)),
+        iox2_service_type_e::LOCAL => NodeTrackerUnion::new_local(Tracker::new(config)),
+    };
+
+    (*struct_ptr).init(service_type, value, deleter);
+    *handle_ptr = (*struct_ptr).as_handle();
+}
+
+/// Drops a [`iox2_node_tracker_h`] and calls all corresponding cleanup functions.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_node_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_drop(handle: iox2_node_tracker_h) {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => {
+            ManuallyDrop::drop(&mut tracker.value.as_mut().ipc);
+        }
+        iox2_service_type_e::LOCAL => {
+            ManuallyDrop::drop(&mut tracker.value.as_mut().local);
+        }
+    }
+    (tracker.deleter)(tracker);
+}
+
+/// Updates the cache of the tracker and calls `on_added` for every node that was created,
+/// `on_changed` for every node whose state changed, for instance a node that died, and
+/// `on_removed` for every node that was removed since the previous call. The nodes are
+/// listed only when one was created or removed, the liveness of the cached nodes is checked
+/// on every call. The return value of the callbacks is ignored.
+///
+/// # Returns
+///
+///  [`IOX2_OK`] on success otherwise
+///  [`iox2_node_list_failure_e`](crate::iox2_node_list_failure_e).
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_node_tracker_new()`]
+///  * `on_added`, `on_changed` and `on_removed` must be valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_sync(
+    handle: iox2_node_tracker_h_ref,
+    on_added: iox2_node_list_callback,
+    on_changed: iox2_node_list_callback,
+    on_removed: iox2_node_list_callback,
+    callback_ctx: iox2_callback_context,
+) -> c_int {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    let result = match tracker.service_type {
+        iox2_service_type_e::IPC => sync(
+            &mut tracker.value.as_mut().ipc,
+            on_added,
+            on_changed,
+            on_removed,
+            callback_ctx,
+        ),
+        iox2_service_type_e::LOCAL => sync(
+            &mut tracker.value.as_mut().local,
+            on_added,
+            on_changed,
+            on_removed,
+            callback_ctx,
+        ),
+    };
+
+    match result {
+        Ok(()) => IOX2_OK,
+        Err(e) => e.into_c_int(),
+    }
+}
+
+/// Calls the provided callback for every cached node without accessing the system.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_node_tracker_new()`]
+///  * `callback` must be valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_list(
+    handle: iox2_node_tracker_h_ref,
+    callback: iox2_node_list_callback,
+    callback_ctx: iox2_callback_context,
+) {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => {
+            tracker
+                .value
+                .as_ref()
+                .ipc
+                .list(|node_state: &NodeState<ipc::Service>| {
+                    iox2_node_list_impl(node_state, callback, callback_ctx)
+                })
+        }
+        iox2_service_type_e::LOCAL => {
+            tracker
+                .value
+                .as_ref()
+                .local
+                .list(|node_state: &NodeState<local::Service>| {
+                    iox2_node_list_impl(node_state, callback, callback_ctx)
+                })
+        }
+    }
+}
+
+/// Returns the number of cached nodes.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_node_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_len(handle: iox2_node_tracker_h_ref) -> c_size_t {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => tracker.value.as_ref().ipc.len(),
+        iox2_service_type_e::LOCAL => tracker.value.as_ref().local.len(),
+    }
+}
+
+/// Returns the non-owning file descriptor that becomes readable when a node was created or
+/// removed. It can be attached to a waitset to call [`iox2_node_tracker_sync()`] when
+/// something changed. The death of a node does not make it readable, therefore the sync
+/// must also be called periodically when dead nodes shall be detected. Returns `null` when
+/// no change notifications are available, for instance for local nodes. The file descriptor
+/// can change with [`iox2_node_tracker_sync()`], therefore it must be reacquired after
+/// every sync.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_node_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_node_tracker_file_descriptor(
+    handle: iox2_node_tracker_h_ref,
+) -> iox2_file_descriptor_ptr {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    let fd = match tracker.service_type {
+        iox2_service_type_e::IPC => tracker.value.as_ref().ipc.file_descriptor(),
+        iox2_service_type_e::LOCAL => tracker.value.as_ref().local.file_descriptor(),
+    };
+
+    match fd {
+        Some(fd) => core::mem::transmute(fd as *const FileDescriptor),
+        None => core::ptr::null(),
+    }
+}
+
+// END C API
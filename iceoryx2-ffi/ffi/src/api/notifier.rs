@@ -52,8 +52,8 @@ impl IntoCInt for NotifierNotifyError {
 }
 
 pub(super) union NotifierUnion {
-    ipc: ManuallyDrop<Notifier<ipc::Service>>,
-    local: ManuallyDrop<Notifier<local::Service>>,
+    pub(super) ipc: ManuallyDrop<Notifier<ipc::Service>>,
+    pub(super) local: ManuallyDrop<Notifier<local::Service>>,
 }
 
 impl NotifierUnion {
@@ -78,8 +78,8 @@ pub struct iox2_notifier_storage_t {
 #[repr(C)]
 #[iceoryx2_ffi(NotifierUnion)]
 pub struct iox2_notifier_t {
-    service_type: iox2_service_type_e,
-    value: iox2_notifier_storage_t,
+    pub(super) service_type: iox2_service_type_e,
+    pub(super) value: iox2_notifier_storage_t,
     deleter: fn(*mut iox2_notifier_t),
 }
 
@@ -27,6 +27,7 @@ use iceoryx2_ffi_macros::CStrRepr;
 
 use core::ffi::{c_char, c_int};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 // BEGIN types definition
 
@@ -71,7 +72,7 @@ impl PortFactoryListenerBuilderUnion {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<PortFactoryListenerBuilderUnion>
 pub struct iox2_port_factory_listener_builder_storage_t {
-    internal: [u8; 24], // magic number obtained with size_of::<Option<PortFactoryListenerBuilderUnion>>()
+    internal: [u8; 48], // magic number obtained with size_of::<Option<PortFactoryListenerBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -243,4 +244,53 @@ pub unsafe extern "C" fn iox2_port_factory_listener_builder_create(
     IOX2_OK
 }
 
+/// Sets the wait policy for the listener. A wait busy polls for the spin duration, yields the
+/// CPU for the yield duration and blocks afterwards.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_listener_builder_h_ref`]
+///   obtained by [`iox2_port_factory_event_listener_builder`](crate::iox2_port_factory_event_listener_builder).
+/// * `spin_seconds` - the seconds of the spin duration
+/// * `spin_nanoseconds` - the nanoseconds of the spin duration
+/// * `yield_seconds` - the seconds of the yield duration
+/// * `yield_nanoseconds` - the nanoseconds of the yield duration
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_listener_builder_set_wait_policy(
+    port_factory_handle: iox2_port_factory_listener_builder_h_ref,
+    spin_seconds: u64,
+    spin_nanoseconds: u32,
+    yield_seconds: u64,
+    yield_nanoseconds: u32,
+) {
+    port_factory_handle.assert_non_null();
+
+    let wait_policy = WaitPolicy::new(
+        Duration::from_secs(spin_seconds) + Duration::from_nanos(spin_nanoseconds as u64),
+        Duration::from_secs(yield_seconds) + Duration::from_nanos(yield_nanoseconds as u64),
+    );
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryListenerBuilderUnion::new_ipc(
+                port_factory.wait_policy(wait_policy),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryListenerBuilderUnion::new_local(
+                port_factory.wait_policy(wait_policy),
+            ));
+        }
+    }
+}
+
 // END C API
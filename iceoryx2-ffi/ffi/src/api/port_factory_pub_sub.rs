@@ -13,13 +13,17 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    iox2_port_factory_publisher_builder_h, iox2_port_factory_publisher_builder_t,
-    iox2_port_factory_subscriber_builder_h, iox2_port_factory_subscriber_builder_t,
-    iox2_service_type_e, iox2_static_config_publish_subscribe_t, AssertNonNullHandle, HandleToType,
-    PayloadFfi, PortFactoryPublisherBuilderUnion, PortFactorySubscriberBuilderUnion, UserHeaderFfi,
+    iox2_callback_context, iox2_callback_progression_e, iox2_port_factory_publisher_builder_h,
+    iox2_port_factory_publisher_builder_t, iox2_port_factory_subscriber_builder_h,
+    iox2_port_factory_subscriber_builder_t, iox2_service_type_e,
+    iox2_static_config_publish_subscribe_t, AssertNonNullHandle, HandleToType, PayloadFfi,
+    PortFactoryPublisherBuilderUnion, PortFactorySubscriberBuilderUnion, UserHeaderFfi,
 };
 
 use iceoryx2::prelude::*;
+use iceoryx2::service::dynamic_config::publish_subscribe::{
+    PublisherStatistics, SubscriberStatistics,
+};
 use iceoryx2::service::port_factory::publish_subscribe::PortFactory;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
@@ -55,7 +59,7 @@ impl PortFactoryPubSubUnion {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<PortFactoryPubSubUnion>
 pub struct iox2_port_factory_pub_sub_storage_t {
-    internal: [u8; 1656], // magic number obtained with size_of::<Option<PortFactoryPubSubUnion>>()
+    internal: [u8; 1672], // magic number obtained with size_of::<Option<PortFactoryPubSubUnion>>()
 }
 
 #[repr(C)]
@@ -116,6 +120,64 @@ impl HandleToType for iox2_port_factory_pub_sub_h_ref {
     }
 }
 
+/// The statistics counters of a publisher. See
+/// [`PublisherStatistics`] for a description of the counters.
+#[derive(Clone, Copy)]
+#[repr(C)]
+pub struct iox2_publisher_statistics_t {
+    pub sent_samples: u64,
+    pub failed_deliveries: u64,
+    pub overflowed_samples: u64,
+    pub exceeded_max_loans: u64,
+}
+
+impl From<PublisherStatistics> for iox2_publisher_statistics_t {
+    fn from(s: PublisherStatistics) -> Self {
+        Self {
+            sent_samples: s.sent_samples,
+            failed_deliveries: s.failed_deliveries,
+            overflowed_samples: s.overflowed_samples,
+            exceeded_max_loans: s.exceeded_max_loans,
+        }
+    }
+}
+
+/// The statistics counters of a subscriber. See
+/// [`SubscriberStatistics`] for a description of the counters.
+#[derive(Clone, Copy)]
+#[repr(C)]
+pub struct iox2_subscriber_statistics_t {
+    pub received_samples: u64,
+    pub exceeded_max_borrows: u64,
+}
+
+impl From<SubscriberStatistics> for iox2_subscriber_statistics_t {
+    fn from(s: SubscriberStatistics) -> Self {
+        Self {
+            received_samples: s.received_samples,
+            exceeded_max_borrows: s.exceeded_max_borrows,
+        }
+    }
+}
+
+/// The callback receives the bytes of the unique publisher id, the number of bytes and the
+/// statistics of the publisher.
+pub type iox2_publisher_statistics_callback = extern "C" fn(
+    *const u8,
+    usize,
+    *const iox2_publisher_statistics_t,
+    iox2_callback_context,
+) -> iox2_callback_progression_e;
+
+/// The callback receives the bytes of the unique subscriber id, the number of bytes and the
+/// statistics of the subscriber.
+pub type iox2_subscriber_statistics_callback = extern "C" fn(
+    *const u8,
+    usize,
+    *const iox2_subscriber_statistics_t,
+    iox2_callback_context,
+) -> iox2_callback_progression_e;
+
 // END type definition
 
 // BEGIN C API
@@ -277,6 +339,130 @@ pub unsafe extern "C" fn iox2_port_factory_pub_sub_static_config(
     *static_config = config.into();
 }
 
+/// Returns how many publishers are currently connected to the service.
+///
+/// # Safety
+///
+/// * The `port_factory_handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_number_of_publishers(
+    port_factory_handle: iox2_port_factory_pub_sub_h_ref,
+) -> usize {
+    port_factory_handle.assert_non_null();
+
+    let port_factory = &mut *port_factory_handle.as_type();
+
+    use iceoryx2::prelude::PortFactory;
+    match port_factory.service_type {
+        iox2_service_type_e::IPC => port_factory
+            .value
+            .as_ref()
+            .ipc
+            .dynamic_config()
+            .number_of_publishers(),
+        iox2_service_type_e::LOCAL => port_factory
+            .value
+            .as_ref()
+            .local
+            .dynamic_config()
+            .number_of_publishers(),
+    }
+}
+
+/// Returns how many subscribers are currently connected to the service.
+///
+/// # Safety
+///
+/// * The `port_factory_handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_number_of_subscribers(
+    port_factory_handle: iox2_port_factory_pub_sub_h_ref,
+) -> usize {
+    port_factory_handle.assert_non_null();
+
+    let port_factory = &mut *port_factory_handle.as_type();
+
+    use iceoryx2::prelude::PortFactory;
+    match port_factory.service_type {
+        iox2_service_type_e::IPC => port_factory
+            .value
+            .as_ref()
+            .ipc
+            .dynamic_config()
+            .number_of_subscribers(),
+        iox2_service_type_e::LOCAL => port_factory
+            .value
+            .as_ref()
+            .local
+            .dynamic_config()
+            .number_of_subscribers(),
+    }
+}
+
+/// Calls the provided callback with the statistics of every publisher that is currently
+/// connected to the service.
+///
+/// # Safety
+///
+/// * The `port_factory_handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+/// * The id and statistics pointers provided to the `callback` are only valid during the call.
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_list_publisher_statistics(
+    port_factory_handle: iox2_port_factory_pub_sub_h_ref,
+    callback: iox2_publisher_statistics_callback,
+    callback_ctx: iox2_callback_context,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory = &mut *port_factory_handle.as_type();
+
+    use iceoryx2::prelude::PortFactory;
+    let dynamic_config = match port_factory.service_type {
+        iox2_service_type_e::IPC => port_factory.value.as_ref().ipc.dynamic_config(),
+        iox2_service_type_e::LOCAL => port_factory.value.as_ref().local.dynamic_config(),
+    };
+
+    dynamic_config.list_publisher_statistics(|id, statistics| {
+        let id = id.value().to_ne_bytes();
+        let statistics: iox2_publisher_statistics_t = statistics.into();
+        callback(id.as_ptr(), id.len(), &statistics, callback_ctx).into()
+    });
+}
+
+/// Calls the provided callback with the statistics of every subscriber that is currently
+/// connected to the service.
+///
+/// # Safety
+///
+/// * The `port_factory_handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+/// * The id and statistics pointers provided to the `callback` are only valid during the call.
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_list_subscriber_statistics(
+    port_factory_handle: iox2_port_factory_pub_sub_h_ref,
+    callback: iox2_subscriber_statistics_callback,
+    callback_ctx: iox2_callback_context,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory = &mut *port_factory_handle.as_type();
+
+    use iceoryx2::prelude::PortFactory;
+    let dynamic_config = match port_factory.service_type {
+        iox2_service_type_e::IPC => port_factory.value.as_ref().ipc.dynamic_config(),
+        iox2_service_type_e::LOCAL => port_factory.value.as_ref().local.dynamic_config(),
+    };
+
+    dynamic_config.list_subscriber_statistics(|id, statistics| {
+        let id = id.value().to_ne_bytes();
+        let statistics: iox2_subscriber_statistics_t = statistics.into();
+        callback(id.as_ptr(), id.len(), &statistics, callback_ctx).into()
+    });
+}
+
 /// This function needs to be called to destroy the port factory!
 ///
 /// # Arguments
@@ -55,11 +55,86 @@ impl From<iox2_allocation_strategy_e> for AllocationStrategy {
     }
 }
 
+/// Defines how the data segment of a publisher manages the memory of the loaned samples.
+#[repr(C)]
+#[derive(Copy, Clone, CStrRepr)]
+pub enum iox2_payload_allocator_e {
+    /// Every sample occupies a bucket that is sized for the largest slice.
+    POOL,
+    /// Every sample occupies a block that is rounded up to the next power of two of its size.
+    BUDDY,
+}
+
+impl From<iox2_payload_allocator_e> for PayloadAllocator {
+    fn from(value: iox2_payload_allocator_e) -> Self {
+        match value {
+            iox2_payload_allocator_e::POOL => PayloadAllocator::Pool,
+            iox2_payload_allocator_e::BUDDY => PayloadAllocator::Buddy,
+        }
+    }
+}
+
+/// Defines the size of the pages that back the data segment of a publisher.
+#[repr(C)]
+#[derive(Copy, Clone, CStrRepr)]
+pub enum iox2_page_size_e {
+    /// The default page size of the system.
+    DEFAULT,
+    /// 2 MiB huge pages, provided by the hugetlbfs mounted at `/dev/hugepages`.
+    HUGE_2_MIB,
+    /// 1 GiB huge pages, provided by the hugetlbfs mounted at `/dev/hugepages1G`.
+    HUGE_1_GIB,
+}
+
+impl From<iox2_page_size_e> for PageSize {
+    fn from(value: iox2_page_size_e) -> Self {
+        match value {
+            iox2_page_size_e::DEFAULT => PageSize::Default,
+            iox2_page_size_e::HUGE_2_MIB => PageSize::Huge2MiB,
+            iox2_page_size_e::HUGE_1_GIB => PageSize::Huge1GiB,
+        }
+    }
+}
+
+impl From<PageSize> for iox2_page_size_e {
+    fn from(value: PageSize) -> Self {
+        match value {
+            PageSize::Default => iox2_page_size_e::DEFAULT,
+            PageSize::Huge2MiB => iox2_page_size_e::HUGE_2_MIB,
+            PageSize::Huge1GiB => iox2_page_size_e::HUGE_1_GIB,
+        }
+    }
+}
+
+/// Defines when the pages of the data segments, the connections and the dynamic service config
+/// are mapped into the process space.
+#[repr(C)]
+#[derive(Copy, Clone, CStrRepr)]
+pub enum iox2_memory_residency_e {
+    /// The pages are mapped on first access.
+    ON_DEMAND,
+    /// All pages are touched once when the port is created or a connection is established.
+    PRE_FAULTED,
+    /// All pages are mapped and locked into the physical memory.
+    LOCKED,
+}
+
+impl From<iox2_memory_residency_e> for MemoryResidency {
+    fn from(value: iox2_memory_residency_e) -> Self {
+        match value {
+            iox2_memory_residency_e::ON_DEMAND => MemoryResidency::OnDemand,
+            iox2_memory_residency_e::PRE_FAULTED => MemoryResidency::PreFaulted,
+            iox2_memory_residency_e::LOCKED => MemoryResidency::Locked,
+        }
+    }
+}
+
 #[repr(C)]
 #[derive(Copy, Clone, CStrRepr)]
 pub enum iox2_publisher_create_error_e {
     EXCEEDS_MAX_SUPPORTED_PUBLISHERS = IOX2_OK as isize + 1,
     UNABLE_TO_CREATE_DATA_SEGMENT,
+    UNABLE_TO_APPLY_MEMORY_RESIDENCY,
 }
 
 impl IntoCInt for PublisherCreateError {
@@ -71,6 +146,9 @@ impl IntoCInt for PublisherCreateError {
             PublisherCreateError::UnableToCreateDataSegment => {
                 iox2_publisher_create_error_e::UNABLE_TO_CREATE_DATA_SEGMENT
             }
+            PublisherCreateError::UnableToApplyMemoryResidency => {
+                iox2_publisher_create_error_e::UNABLE_TO_APPLY_MEMORY_RESIDENCY
+            }
         }) as c_int
     }
 }
@@ -258,6 +336,120 @@ pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_allocation_stra
     }
 }
 
+/// Sets the [`iox2_payload_allocator_e`] that manages the data segment of the publisher.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The payload allocator of the data segment
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_payload_allocator(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: iox2_payload_allocator_e,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.payload_allocator(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.payload_allocator(value.into()),
+            ));
+        }
+    }
+}
+
+/// Sets the [`iox2_page_size_e`] of the pages that back the data segment of the publisher.
+/// When the requested huge pages are not available the publisher falls back to
+/// [`iox2_page_size_e::DEFAULT`].
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The page size that shall back the data segment
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_page_size(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: iox2_page_size_e,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.page_size(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.page_size(value.into()),
+            ));
+        }
+    }
+}
+
+/// Sets the [`iox2_memory_residency_e`] of the publisher. It defines if the pages of the data
+/// segments, the connections and the dynamic service config are mapped up front or on demand.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The memory residency of the publisher
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_memory_residency(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: iox2_memory_residency_e,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.memory_residency(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.memory_residency(value.into()),
+            ));
+        }
+    }
+}
+
 /// Sets the max slice length for the publisher
 ///
 /// # Arguments
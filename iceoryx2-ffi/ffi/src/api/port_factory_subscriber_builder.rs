@@ -13,10 +13,12 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    c_size_t, iox2_service_type_e, iox2_subscriber_h, iox2_subscriber_t, AssertNonNullHandle,
-    HandleToType, IntoCInt, PayloadFfi, SubscriberUnion, UserHeaderFfi, IOX2_OK,
+    c_size_t, iox2_memory_residency_e, iox2_service_type_e, iox2_subscriber_h, iox2_subscriber_t,
+    AssertNonNullHandle, HandleToType, IntoCInt, PayloadFfi, SubscriberUnion, UserHeaderFfi,
+    IOX2_OK,
 };
 
+use iceoryx2::port::receive_policy::ReceivePolicy;
 use iceoryx2::port::subscriber::SubscriberCreateError;
 use iceoryx2::prelude::*;
 use iceoryx2::service::port_factory::subscriber::PortFactorySubscriber;
@@ -35,6 +37,7 @@ use core::mem::ManuallyDrop;
 pub enum iox2_subscriber_create_error_e {
     EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS = IOX2_OK as isize + 1,
     BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE,
+    UNABLE_TO_APPLY_MEMORY_RESIDENCY,
 }
 
 impl IntoCInt for SubscriberCreateError {
@@ -46,10 +49,41 @@ impl IntoCInt for SubscriberCreateError {
             SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService => {
                 iox2_subscriber_create_error_e::BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE
             }
+            SubscriberCreateError::UnableToApplyMemoryResidency => {
+                iox2_subscriber_create_error_e::UNABLE_TO_APPLY_MEMORY_RESIDENCY
+            }
         }) as c_int
     }
 }
 
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub enum iox2_receive_policy_e {
+    SEQUENTIAL,
+    ROUND_ROBIN,
+    OLDEST_FIRST,
+}
+
+impl From<iox2_receive_policy_e> for ReceivePolicy {
+    fn from(value: iox2_receive_policy_e) -> Self {
+        match value {
+            iox2_receive_policy_e::SEQUENTIAL => ReceivePolicy::Sequential,
+            iox2_receive_policy_e::ROUND_ROBIN => ReceivePolicy::RoundRobin,
+            iox2_receive_policy_e::OLDEST_FIRST => ReceivePolicy::OldestFirst,
+        }
+    }
+}
+
+impl From<ReceivePolicy> for iox2_receive_policy_e {
+    fn from(value: ReceivePolicy) -> Self {
+        match value {
+            ReceivePolicy::Sequential => iox2_receive_policy_e::SEQUENTIAL,
+            ReceivePolicy::RoundRobin => iox2_receive_policy_e::ROUND_ROBIN,
+            ReceivePolicy::OldestFirst => iox2_receive_policy_e::OLDEST_FIRST,
+        }
+    }
+}
+
 pub(super) union PortFactorySubscriberBuilderUnion {
     ipc: ManuallyDrop<PortFactorySubscriber<'static, ipc::Service, PayloadFfi, UserHeaderFfi>>,
     local: ManuallyDrop<PortFactorySubscriber<'static, local::Service, PayloadFfi, UserHeaderFfi>>,
@@ -75,7 +109,7 @@ impl PortFactorySubscriberBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactorySubscriberBuilderUnion>
 pub struct iox2_port_factory_subscriber_builder_storage_t {
-    internal: [u8; 112], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
+    internal: [u8; 128], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -198,6 +232,82 @@ pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_buffer_size(
     }
 }
 
+/// Sets the receive policy for the subscriber
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `value` - The [`iox2_receive_policy_e`] that defines the order in which the samples of
+///   multiple publishers are received
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_receive_policy(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    value: iox2_receive_policy_e,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.receive_policy(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.receive_policy(value.into()),
+            ));
+        }
+    }
+}
+
+/// Sets the [`iox2_memory_residency_e`] of the subscriber. It defines if the pages of the data
+/// segments, the connections and the dynamic service config are mapped up front or on demand.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `value` - The memory residency of the subscriber
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_memory_residency(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    value: iox2_memory_residency_e,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.memory_residency(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.memory_residency(value.into()),
+            ));
+        }
+    }
+}
+
 // TODO [#210] add all the other setter methods
 
 /// Creates a subscriber and consumes the builder
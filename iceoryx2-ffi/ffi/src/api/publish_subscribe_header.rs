@@ -27,7 +27,7 @@ use crate::{
 #[repr(C)]
 #[repr(align(8))] // core::mem::align_of::<Option<Header>>()
 pub struct iox2_publish_subscribe_header_storage_t {
-    internal: [u8; 32], // core::mem::size_of::<Option<Header>>()
+    internal: [u8; 48], // core::mem::size_of::<Option<Header>>()
 }
 
 #[repr(C)]
@@ -179,4 +179,80 @@ pub unsafe extern "C" fn iox2_publish_subscribe_header_number_of_elements(
 
     header.value.as_ref().number_of_elements()
 }
+
+/// Acquires the sequence number the source publisher assigned to the sample. The sequence
+/// number is only available when the service was created with
+/// [`iox2_service_builder_pub_sub_set_enable_send_tracking()`](crate::iox2_service_builder_pub_sub_set_enable_send_tracking).
+///
+/// Returns true and stores the sequence number in `sequence_number` when it is available,
+/// otherwise false.
+///
+/// # Arguments
+///
+/// * `handle` is valid, non-null and was initialized with
+///   [`iox2_sample_header()`](crate::iox2_sample_header)
+/// * `sequence_number` - A pointer to a [`u64`] to store the sequence number.
+///
+/// # Safety
+///
+/// * `header_handle` is valid and non-null
+/// * `sequence_number` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_sequence_number(
+    header_handle: iox2_publish_subscribe_header_h_ref,
+    sequence_number: *mut u64,
+) -> bool {
+    header_handle.assert_non_null();
+    debug_assert!(!sequence_number.is_null());
+
+    let header = &mut *header_handle.as_type();
+
+    match header.value.as_ref().sequence_number() {
+        Some(value) => {
+            *sequence_number = value;
+            true
+        }
+        None => false,
+    }
+}
+
+/// Acquires the time of the monotonic system clock at which the sample was sent. The timestamp
+/// is only available when the service was created with
+/// [`iox2_service_builder_pub_sub_set_enable_send_tracking()`](crate::iox2_service_builder_pub_sub_set_enable_send_tracking).
+///
+/// Returns true and stores the timestamp in `seconds` and `nanoseconds` when it is available,
+/// otherwise false.
+///
+/// # Arguments
+///
+/// * `handle` is valid, non-null and was initialized with
+///   [`iox2_sample_header()`](crate::iox2_sample_header)
+/// * `seconds` - A pointer to a [`u64`] to store the seconds part of the timestamp.
+/// * `nanoseconds` - A pointer to a [`u32`] to store the nanoseconds part of the timestamp.
+///
+/// # Safety
+///
+/// * `header_handle` is valid and non-null
+/// * `seconds` and `nanoseconds` are valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_send_timestamp(
+    header_handle: iox2_publish_subscribe_header_h_ref,
+    seconds: *mut u64,
+    nanoseconds: *mut u32,
+) -> bool {
+    header_handle.assert_non_null();
+    debug_assert!(!seconds.is_null());
+    debug_assert!(!nanoseconds.is_null());
+
+    let header = &mut *header_handle.as_type();
+
+    match header.value.as_ref().send_timestamp() {
+        Some(value) => {
+            *seconds = value.as_secs();
+            *nanoseconds = value.subsec_nanos();
+            true
+        }
+        None => false,
+    }
+}
 // END C API
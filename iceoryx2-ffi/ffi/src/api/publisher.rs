@@ -13,9 +13,9 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    iox2_service_type_e, iox2_unable_to_deliver_strategy_e, iox2_unique_publisher_id_h,
-    iox2_unique_publisher_id_t, AssertNonNullHandle, HandleToType, PayloadFfi,
-    SampleMutUninitUnion, UserHeaderFfi, IOX2_OK,
+    iox2_page_size_e, iox2_service_type_e, iox2_unable_to_deliver_strategy_e,
+    iox2_unique_publisher_id_h, iox2_unique_publisher_id_t, AssertNonNullHandle, HandleToType,
+    PayloadFfi, SampleMutUninitUnion, UserHeaderFfi, IOX2_OK,
 };
 
 use iceoryx2::port::publisher::Publisher;
@@ -32,6 +32,7 @@ use super::{iox2_sample_mut_h, iox2_sample_mut_t, IntoCInt};
 
 use core::ffi::{c_char, c_int, c_void};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 // BEGIN types definition
 
@@ -181,6 +182,7 @@ unsafe fn send_copy<S: Service>(
     publisher: &Publisher<S, PayloadFfi, UserHeaderFfi>,
     data_ptr: *const c_void,
     size_of_element: usize,
+    timeout: Option<Duration>,
     number_of_recipients: *mut usize,
 ) -> c_int {
     // loan_slice_uninit(1) <= 1 is correct here since it defines the number of
@@ -197,7 +199,13 @@ unsafe fn send_copy<S: Service>(
 
     let sample_ptr = sample.payload_mut().as_mut_ptr();
     core::ptr::copy_nonoverlapping(data_ptr, sample_ptr.cast(), size_of_element);
-    match sample.assume_init().send() {
+    let sample = sample.assume_init();
+    let result = match timeout {
+        Some(timeout) => sample.send_with_timeout(timeout),
+        None => sample.send(),
+    };
+
+    match result {
         Ok(v) => {
             if !number_of_recipients.is_null() {
                 *number_of_recipients = v;
@@ -343,6 +351,30 @@ pub unsafe extern "C" fn iox2_publisher_initial_max_slice_len(
     }
 }
 
+/// Returns the page size of the pages that back the data segment of the publisher.
+///
+/// # Arguments
+///
+/// * `publisher_handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+///
+/// Returns [`iox2_page_size_e`].
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publisher_page_size(
+    publisher_handle: iox2_publisher_h_ref,
+) -> iox2_page_size_e {
+    publisher_handle.assert_non_null();
+
+    let publisher = &mut *publisher_handle.as_type();
+    match publisher.service_type {
+        iox2_service_type_e::IPC => publisher.value.as_mut().ipc.page_size().into(),
+        iox2_service_type_e::LOCAL => publisher.value.as_mut().local.page_size().into(),
+    }
+}
+
 /// Returns the unique port id of the publisher.
 ///
 /// # Arguments
@@ -473,12 +505,69 @@ pub unsafe extern "C" fn iox2_publisher_send_copy(
             &publisher.value.as_mut().ipc,
             data_ptr,
             data_len,
+            None,
+            number_of_recipients,
+        ),
+        iox2_service_type_e::LOCAL => send_copy(
+            &publisher.value.as_mut().local,
+            data_ptr,
+            data_len,
+            None,
+            number_of_recipients,
+        ),
+    }
+}
+
+/// Sends a copy of the provided data via the publisher like [`iox2_publisher_send_copy()`] but
+/// waits at most the provided timeout in total for subscribers with a full buffer. Subscribers
+/// that still have no space left after the timeout do not receive the data.
+///
+/// # Arguments
+///
+/// * `handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+/// * `data_ptr` pointer to the payload that shall be transmitted
+/// * `data_len` the size of the payload in bytes
+/// * `seconds` - The timeout seconds part
+/// * `nanoseconds` - The timeout nanoseconds part
+/// * `number_of_recipients` (optional) used to store the number of subscriber that received the data
+///
+/// Return [`IOX2_OK`] on success, otherwise [`iox2_send_error_e`].
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+/// * `data_ptr` non-null pointer to a valid position in memory
+/// * `data_len` the size of the payload memory
+/// * `number_of_recipients` can be null, otherwise a valid pointer to an [`usize`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publisher_send_copy_with_timeout(
+    publisher_handle: iox2_publisher_h_ref,
+    data_ptr: *const c_void,
+    data_len: usize,
+    seconds: u64,
+    nanoseconds: u32,
+    number_of_recipients: *mut usize,
+) -> c_int {
+    publisher_handle.assert_non_null();
+    debug_assert!(!data_ptr.is_null());
+    debug_assert!(data_len != 0);
+
+    let publisher = &mut *publisher_handle.as_type();
+    let timeout = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+
+    match publisher.service_type {
+        iox2_service_type_e::IPC => send_copy(
+            &publisher.value.as_mut().ipc,
+            data_ptr,
+            data_len,
+            Some(timeout),
             number_of_recipients,
         ),
         iox2_service_type_e::LOCAL => send_copy(
             &publisher.value.as_mut().local,
             data_ptr,
             data_len,
+            Some(timeout),
             number_of_recipients,
         ),
     }
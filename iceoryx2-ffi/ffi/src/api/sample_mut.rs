@@ -13,8 +13,9 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    c_size_t, iox2_publish_subscribe_header_h, iox2_publish_subscribe_header_t,
-    iox2_service_type_e, AssertNonNullHandle, HandleToType, IntoCInt, UserHeaderFfi, IOX2_OK,
+    c_size_t, iox2_notifier_h_ref, iox2_notifier_t, iox2_publish_subscribe_header_h,
+    iox2_publish_subscribe_header_t, iox2_service_type_e, AssertNonNullHandle, HandleToType,
+    IntoCInt, UserHeaderFfi, IOX2_OK,
 };
 
 use iceoryx2::prelude::*;
@@ -24,6 +25,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 
 use core::ffi::{c_int, c_void};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 use super::UninitPayloadFfi;
 
@@ -315,6 +317,76 @@ pub unsafe extern "C" fn iox2_sample_mut_payload(
 pub unsafe extern "C" fn iox2_sample_mut_send(
     sample_handle: iox2_sample_mut_h,
     number_of_recipients: *mut c_size_t,
+) -> c_int {
+    send_sample(sample_handle, None, None, number_of_recipients)
+}
+
+/// Takes the ownership of the sample and sends it. Subscribers with a full buffer are waited
+/// for at most the provided timeout in total. Subscribers that still have no space left after
+/// the timeout do not receive the sample.
+///
+/// # Arguments
+///
+/// * `sample_handle` - A valid [`iox2_sample_mut_h`]
+/// * `seconds` - The timeout seconds part
+/// * `nanoseconds` - The timeout nanoseconds part
+/// * `number_of_recipients` - (optional) used to store the number of subscribers that received
+///   the sample
+///
+/// Return [`IOX2_OK`] on success, otherwise [`iox2_send_error_e`](crate::iox2_send_error_e).
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_publisher_loan_slice_uninit()`](crate::iox2_publisher_loan_slice_uninit())
+/// * `number_of_recipients`, can be null or must point to a valid [`c_size_t`] to store the number
+///   of subscribers that received the sample
+#[no_mangle]
+pub unsafe extern "C" fn iox2_sample_mut_send_with_timeout(
+    sample_handle: iox2_sample_mut_h,
+    seconds: u64,
+    nanoseconds: u32,
+    number_of_recipients: *mut c_size_t,
+) -> c_int {
+    let timeout = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    send_sample(sample_handle, Some(timeout), None, number_of_recipients)
+}
+
+/// Takes the ownership of the sample, sends it and notifies the listeners of the nodes whose
+/// subscribers had no unconsumed sample before this sample arrived. The notification uses the
+/// default event id of the notifier.
+///
+/// # Arguments
+///
+/// * `sample_handle` - A valid [`iox2_sample_mut_h`]
+/// * `notifier_handle` - A valid [`iox2_notifier_h_ref`] of the same service type
+/// * `number_of_recipients` - (optional) used to store the number of subscribers that received
+///   the sample
+///
+/// Return [`IOX2_OK`] on success, otherwise [`iox2_send_error_e`](crate::iox2_send_error_e).
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_publisher_loan_slice_uninit()`](crate::iox2_publisher_loan_slice_uninit())
+/// * `notifier_handle` obtained by [`iox2_port_factory_notifier_builder_create()`](crate::iox2_port_factory_notifier_builder_create())
+/// * `number_of_recipients`, can be null or must point to a valid [`c_size_t`] to store the number
+///   of subscribers that received the sample
+#[no_mangle]
+pub unsafe extern "C" fn iox2_sample_mut_send_and_notify(
+    sample_handle: iox2_sample_mut_h,
+    notifier_handle: iox2_notifier_h_ref,
+    number_of_recipients: *mut c_size_t,
+) -> c_int {
+    notifier_handle.assert_non_null();
+
+    let notifier = &*notifier_handle.as_type();
+    send_sample(sample_handle, None, Some(notifier), number_of_recipients)
+}
+
+unsafe fn send_sample(
+    sample_handle: iox2_sample_mut_h,
+    timeout: Option<Duration>,
+    notifier: Option<&iox2_notifier_t>,
+    number_of_recipients: *mut c_size_t,
 ) -> c_int {
     debug_assert!(!sample_handle.is_null());
 
@@ -328,33 +400,40 @@ pub unsafe extern "C" fn iox2_sample_mut_send(
         .unwrap_or_else(|| panic!("Trying to send an already sent sample!"));
     (sample_struct.deleter)(sample_struct);
 
-    match service_type {
+    let result = match service_type {
         iox2_service_type_e::IPC => {
-            let sample = ManuallyDrop::into_inner(sample.ipc);
-            match sample.assume_init().send() {
-                Ok(v) => {
-                    if !number_of_recipients.is_null() {
-                        *number_of_recipients = v;
-                    }
-                }
-                Err(e) => {
-                    return e.into_c_int();
+            let sample = ManuallyDrop::into_inner(sample.ipc).assume_init();
+            match (notifier, timeout) {
+                (Some(notifier), _) => {
+                    debug_assert!(notifier.service_type == iox2_service_type_e::IPC);
+                    sample.send_and_notify(&notifier.value.as_ref().ipc)
                 }
+                (None, Some(timeout)) => sample.send_with_timeout(timeout),
+                (None, None) => sample.send(),
             }
         }
         iox2_service_type_e::LOCAL => {
-            let sample = ManuallyDrop::into_inner(sample.local);
-            match sample.assume_init().send() {
-                Ok(v) => {
-                    if !number_of_recipients.is_null() {
-                        *number_of_recipients = v;
-                    }
-                }
-                Err(e) => {
-                    return e.into_c_int();
+            let sample = ManuallyDrop::into_inner(sample.local).assume_init();
+            match (notifier, timeout) {
+                (Some(notifier), _) => {
+                    debug_assert!(notifier.service_type == iox2_service_type_e::LOCAL);
+                    sample.send_and_notify(&notifier.value.as_ref().local)
                 }
+                (None, Some(timeout)) => sample.send_with_timeout(timeout),
+                (None, None) => sample.send(),
             }
         }
+    };
+
+    match result {
+        Ok(v) => {
+            if !number_of_recipients.is_null() {
+                *number_of_recipients = v;
+            }
+        }
+        Err(e) => {
+            return e.into_c_int();
+        }
     }
 
     IOX2_OK
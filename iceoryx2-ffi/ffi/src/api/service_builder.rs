@@ -101,7 +101,7 @@ impl ServiceBuilderUnion {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<ServiceBuilderUnion>
 pub struct iox2_service_builder_storage_t {
-    internal: [u8; 632], // magic number obtained with size_of::<Option<ServiceBuilderUnion>>()
+    internal: [u8; 648], // magic number obtained with size_of::<Option<ServiceBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -66,6 +66,10 @@ pub enum iox2_pub_sub_open_or_create_error_e {
     O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES,
     #[CStr = "incompatible overflow behavior"]
     O_INCOMPATIBLE_OVERFLOW_BEHAVIOR,
+    #[CStr = "incompatible send tracking setting"]
+    O_INCOMPATIBLE_SEND_TRACKING_SETTING,
+    #[CStr = "incompatible connection backend"]
+    O_INCOMPATIBLE_CONNECTION_BACKEND,
     #[CStr = "insufficient permissions"]
     O_INSUFFICIENT_PERMISSIONS,
     #[CStr = "service in corrupted state"]
@@ -96,6 +100,31 @@ pub enum iox2_pub_sub_open_or_create_error_e {
     SYSTEM_IN_FLUX,
 }
 
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub enum iox2_connection_backend_e {
+    SUBSCRIBER_QUEUES,
+    BROADCAST_RING,
+}
+
+impl From<iox2_connection_backend_e> for ConnectionBackend {
+    fn from(value: iox2_connection_backend_e) -> Self {
+        match value {
+            iox2_connection_backend_e::SUBSCRIBER_QUEUES => ConnectionBackend::SubscriberQueues,
+            iox2_connection_backend_e::BROADCAST_RING => ConnectionBackend::BroadcastRing,
+        }
+    }
+}
+
+impl From<ConnectionBackend> for iox2_connection_backend_e {
+    fn from(value: ConnectionBackend) -> Self {
+        match value {
+            ConnectionBackend::SubscriberQueues => iox2_connection_backend_e::SUBSCRIBER_QUEUES,
+            ConnectionBackend::BroadcastRing => iox2_connection_backend_e::BROADCAST_RING,
+        }
+    }
+}
+
 impl IntoCInt for PublishSubscribeOpenError {
     fn into_c_int(self) -> c_int {
         (match self {
@@ -133,6 +162,12 @@ impl IntoCInt for PublishSubscribeOpenError {
          PublishSubscribeOpenError::IncompatibleOverflowBehavior => {
              iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_OVERFLOW_BEHAVIOR
          }
+         PublishSubscribeOpenError::IncompatibleSendTrackingSetting => {
+             iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_SEND_TRACKING_SETTING
+         }
+         PublishSubscribeOpenError::IncompatibleConnectionBackend => {
+             iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_CONNECTION_BACKEND
+         }
          PublishSubscribeOpenError::InsufficientPermissions => {
              iox2_pub_sub_open_or_create_error_e::O_INSUFFICIENT_PERMISSIONS
          }
@@ -747,6 +782,92 @@ pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_enable_safe_overflow(
     }
 }
 
+/// Enables/disables the sequence number and send timestamp in the header of every sample of the
+/// service
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `value` - defines if send tracking shall be enabled (true) or not (false)
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_enable_send_tracking(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    value: bool,
+) {
+    service_builder_handle.assert_non_null();
+
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.enable_send_tracking(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.enable_send_tracking(value),
+            ));
+        }
+    }
+}
+
+/// Sets the [`iox2_connection_backend_e`] that defines how the publishers deliver their samples
+/// to the subscribers of the service
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `value` - the [`iox2_connection_backend_e`] of the service
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_connection_backend(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    value: iox2_connection_backend_e,
+) {
+    service_builder_handle.assert_non_null();
+
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.connection_backend(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.connection_backend(value.into()),
+            ));
+        }
+    }
+}
+
 /// Opens a publish-subscribe service or creates the service if it does not exist and returns a port factory to create publishers and subscribers.
 ///
 /// # Arguments
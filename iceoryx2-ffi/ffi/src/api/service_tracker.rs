@@ -0,0 +1,324 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+
+use core::{ffi::c_int, mem::ManuallyDrop};
+
+use crate::{
+    c_size_t, iox2_callback_context, iox2_config_ptr, iox2_file_descriptor_ptr,
+    iox2_service_list_callback, iox2_service_type_e, iox2_static_config_t, IOX2_OK,
+};
+
+use super::{AssertNonNullHandle, HandleToType, IntoCInt};
+use iceoryx2::{
+    service::{ipc, local, static_config::StaticConfig, Service, ServiceListError},
+    tracker::service::Tracker,
+};
+use iceoryx2_bb_elementary::static_assert::*;
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_ffi_macros::iceoryx2_ffi;
+
+// BEGIN types definition
+
+pub(crate) union ServiceTrackerUnion {
+    ipc: ManuallyDrop<Tracker<ipc::Service>>,
+    local: ManuallyDrop<Tracker<local::Service>>,
+}
+
+impl ServiceTrackerUnion {
+    pub(crate) fn new_ipc(tracker: Tracker<ipc::Service>) -> Self {
+        Self {
+            ipc: ManuallyDrop::new(tracker),
+        }
+    }
+
+    pub(crate) fn new_local(tracker: Tracker<local::Service>) -> Self {
+        Self {
+            local: ManuallyDrop::new(tracker),
+        }
+    }
+}
+
+#[repr(C)]
+#[repr(align(8))] // alignment of Option<ServiceTrackerUnion>
+pub struct iox2_service_tracker_storage_t {
+    internal: [u8; 3840], // magic number obtained with size_of::<Option<ServiceTrackerUnion>>()
+}
+
+#[repr(C)]
+#[iceoryx2_ffi(ServiceTrackerUnion)]
+pub struct iox2_service_tracker_t {
+    service_type: iox2_service_type_e,
+    value: iox2_service_tracker_storage_t,
+    deleter: fn(*mut iox2_service_tracker_t),
+}
+
+impl iox2_service_tracker_t {
+    pub(super) fn init(
+        &mut self,
+        service_type: iox2_service_type_e,
+        value: ServiceTrackerUnion,
+        deleter: fn(*mut iox2_service_tracker_t),
+    ) {
+        self.service_type = service_type;
+        self.value.init(value);
+        self.deleter = deleter;
+    }
+}
+
+pub struct iox2_service_tracker_h_t;
+/// The owning handle for `iox2_service_tracker_t`. Passing the handle to an function transfers the ownership.
+pub type iox2_service_tracker_h = *mut iox2_service_tracker_h_t;
+/// The non-owning handle for `iox2_service_tracker_t`. Passing the handle to an function does not transfers the ownership.
+pub type iox2_service_tracker_h_ref = *const iox2_service_tracker_h;
+
+impl AssertNonNullHandle for iox2_service_tracker_h {
+    fn assert_non_null(self) {
+        debug_assert!(!self.is_null());
+    }
+}
+
+impl AssertNonNullHandle for iox2_service_tracker_h_ref {
+    fn assert_non_null(self) {
+        debug_assert!(!self.is_null());
+        unsafe {
+            debug_assert!(!(*self).is_null());
+        }
+    }
+}
+
+impl HandleToType for iox2_service_tracker_h {
+    type Target = *mut iox2_service_tracker_t;
+
+    fn as_type(self) -> Self::Target {
+        self as *mut _ as _
+    }
+}
+
+impl HandleToType for iox2_service_tracker_h_ref {
+    type Target = *mut iox2_service_tracker_t;
+
+    fn as_type(self) -> Self::Target {
+        unsafe { *self as *mut _ as _ }
+    }
+}
+
+/// The callback that is called by [`iox2_service_tracker_sync()`] for every added or removed
+/// service. The [`iox2_static_config_t`] is only valid during the call.
+pub type iox2_service_tracker_sync_callback =
+    extern "C" fn(*const iox2_static_config_t, iox2_callback_context);
+
+fn sync<S: Service>(
+    tracker: &mut Tracker<S>,
+    on_added: iox2_service_tracker_sync_callback,
+    on_removed: iox2_service_tracker_sync_callback,
+    callback_ctx: iox2_callback_context,
+) -> Result<(), ServiceListError> {
+    let changes = tracker.sync()?;
+
+    for service_id in &changes.added {
+        if let Some(static_config) = tracker.get(service_id) {
+            on_added(&static_config.into(), callback_ctx);
+        }
+    }
+
+    for static_config in &changes.removed {
+        on_removed(&static_config.into(), callback_ctx);
+    }
+
+    Ok(())
+}
+// END type definition
+
+// BEGIN C API
+
+/// Creates a new [`iox2_service_tracker_t`] with an empty cache. The first
+/// [`iox2_service_tracker_sync()`] reports all existing services as added.
+///
+/// # Safety
+///
+///  * `config_ptr` must be valid and non-null
+///  * `struct_ptr` must be either a valid pointer to uninitialized memory or `null`
+///  * `handle_ptr` must point to a valid uninitialized memory location
+///  * The acquired handle must be cleaned up with [`iox2_service_tracker_drop()`].
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_new(
+    service_type: iox2_service_type_e,
+    config_ptr: iox2_config_ptr,
+    struct_ptr: *mut iox2_service_tracker_t,
+    handle_ptr: *mut iox2_service_tracker_h,
+) {
+    debug_assert!(!config_ptr.is_null());
+    debug_assert!(!handle_ptr.is_null());
+
+    *handle_ptr = core::ptr::null_mut();
+
+    let mut struct_ptr = struct_ptr;
+    fn no_op(_: *mut iox2_service_tracker_t) {}
+    let mut deleter: fn(*mut iox2_service_tracker_t) = no_op;
+    if struct_ptr.is_null() {
+        struct_ptr = iox2_service_tracker_t::alloc();
+        deleter = iox2_service_tracker_t::dealloc;
+    }
+    debug_assert!(!struct_ptr.is_null());
+
+    let config = &*config_ptr;
+    let value = match service_type {
+        iox2_service_type_e::IPC => ServiceTrackerUnion::new_ipc(Tracker::new(config)),
+        iox2_service_type_e::LOCAL => ServiceTrackerUnion::new_local(Tracker::new(config)),
+    };
+
+    (*struct_ptr).init(service_type, value, deleter);
+    *handle_ptr = (*struct_ptr).as_handle();
+}
+
+/// Drops a [`iox2_service_tracker_h`] and calls all corresponding cleanup functions.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_service_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_drop(handle: iox2_service_tracker_h) {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => {
+            ManuallyDrop::drop(&mut tracker.value.as_mut().ipc);
+        }
+        iox2_service_type_e::LOCAL => {
+            ManuallyDrop::drop(&mut tracker.value.as_mut().local);
+        }
+    }
+    (tracker.deleter)(tracker);
+}
+
+/// Updates the cache of the tracker and calls `on_added` for every service that was
+/// created and `on_removed` for every service that was removed since the previous call.
+/// When no service was created or removed it returns without listing the services.
+///
+/// # Returns
+///
+///  [`IOX2_OK`] on success otherwise
+///  [`iox2_service_list_error_e`](crate::iox2_service_list_error_e).
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_service_tracker_new()`]
+///  * `on_added` and `on_removed` must be valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_sync(
+    handle: iox2_service_tracker_h_ref,
+    on_added: iox2_service_tracker_sync_callback,
+    on_removed: iox2_service_tracker_sync_callback,
+    callback_ctx: iox2_callback_context,
+) -> c_int {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    let result = match tracker.service_type {
+        iox2_service_type_e::IPC => sync(
+            &mut tracker.value.as_mut().ipc,
+            on_added,
+            on_removed,
+            callback_ctx,
+        ),
+        iox2_service_type_e::LOCAL => sync(
+            &mut tracker.value.as_mut().local,
+            on_added,
+            on_removed,
+            callback_ctx,
+        ),
+    };
+
+    match result {
+        Ok(()) => IOX2_OK,
+        Err(e) => e.into_c_int(),
+    }
+}
+
+/// Calls the provided callback for every cached service without accessing the system.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_service_tracker_new()`]
+///  * `callback` must be valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_list(
+    handle: iox2_service_tracker_h_ref,
+    callback: iox2_service_list_callback,
+    callback_ctx: iox2_callback_context,
+) {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    let call = |static_config: &StaticConfig| -> CallbackProgression {
+        callback(&static_config.into(), callback_ctx).into()
+    };
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => tracker.value.as_ref().ipc.list(call),
+        iox2_service_type_e::LOCAL => tracker.value.as_ref().local.list(call),
+    }
+}
+
+/// Returns the number of cached services.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_service_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_len(handle: iox2_service_tracker_h_ref) -> c_size_t {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    match tracker.service_type {
+        iox2_service_type_e::IPC => tracker.value.as_ref().ipc.len(),
+        iox2_service_type_e::LOCAL => tracker.value.as_ref().local.len(),
+    }
+}
+
+/// Returns the non-owning file descriptor that becomes readable when a service was created
+/// or removed. It can be attached to a waitset to call [`iox2_service_tracker_sync()`] only
+/// when something changed. Returns `null` when no change notifications are available, for
+/// instance for local services. The file descriptor can change with
+/// [`iox2_service_tracker_sync()`], therefore it must be reacquired after every sync.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with [`iox2_service_tracker_new()`]
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_tracker_file_descriptor(
+    handle: iox2_service_tracker_h_ref,
+) -> iox2_file_descriptor_ptr {
+    handle.assert_non_null();
+
+    let tracker = &mut *handle.as_type();
+
+    let fd = match tracker.service_type {
+        iox2_service_type_e::IPC => tracker.value.as_ref().ipc.file_descriptor(),
+        iox2_service_type_e::LOCAL => tracker.value.as_ref().local.file_descriptor(),
+    };
+
+    match fd {
+        Some(fd) => core::mem::transmute(fd as *const FileDescriptor),
+        None => core::ptr::null(),
+    }
+}
+
+// END C API
@@ -14,7 +14,7 @@
 
 use iceoryx2::service::static_config::publish_subscribe::StaticConfig;
 
-use crate::iox2_message_type_details_t;
+use crate::{iox2_connection_backend_e, iox2_message_type_details_t};
 
 #[derive(Clone, Copy)]
 #[repr(C)]
@@ -26,6 +26,8 @@ pub struct iox2_static_config_publish_subscribe_t {
     pub subscriber_max_buffer_size: usize,
     pub subscriber_max_borrowed_samples: usize,
     pub enable_safe_overflow: bool,
+    pub enable_send_tracking: bool,
+    pub connection_backend: iox2_connection_backend_e,
     pub message_type_details: iox2_message_type_details_t,
 }
 
@@ -39,6 +41,8 @@ impl From<&StaticConfig> for iox2_static_config_publish_subscribe_t {
             subscriber_max_buffer_size: c.subscriber_max_buffer_size(),
             subscriber_max_borrowed_samples: c.subscriber_max_borrowed_samples(),
             enable_safe_overflow: c.has_safe_overflow(),
+            enable_send_tracking: c.has_send_tracking(),
+            connection_backend: c.connection_backend().into(),
             message_type_details: c.message_type_details().into(),
         }
     }
@@ -13,7 +13,8 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    c_size_t, iox2_sample_h, iox2_sample_t, iox2_service_type_e, iox2_unique_subscriber_id_h,
+    c_size_t, iox2_callback_context, iox2_callback_progression_e, iox2_sample_h, iox2_sample_t,
+    iox2_service_type_e, iox2_unique_publisher_id_h_ref, iox2_unique_subscriber_id_h,
     iox2_unique_subscriber_id_t, AssertNonNullHandle, HandleToType, IntoCInt, PayloadFfi,
     SampleUnion, UserHeaderFfi, IOX2_OK,
 };
@@ -28,7 +29,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 use iceoryx2_ffi_macros::CStrRepr;
 
 use core::ffi::{c_char, c_int};
-use core::mem::ManuallyDrop;
+use core::mem::{ManuallyDrop, MaybeUninit};
 
 // BEGIN types definition
 
@@ -97,7 +98,7 @@ impl SubscriberUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<SubscriberUnion>
 pub struct iox2_subscriber_storage_t {
-    internal: [u8; 976], // magic number obtained with size_of::<Option<SubscriberUnion>>()
+    internal: [u8; 1040], // magic number obtained with size_of::<Option<SubscriberUnion>>()
 }
 
 #[repr(C)]
@@ -158,6 +159,17 @@ impl HandleToType for iox2_subscriber_h_ref {
     }
 }
 
+/// The callback for [`iox2_subscriber_receive_batch`]. It is called for every received sample with
+/// the samples storage, the owning sample handle and the user provided context.
+/// The callback takes the ownership of the sample and must either release it with
+/// [`iox2_sample_drop`](crate::iox2_sample_drop) before it returns or move it into a
+/// user owned [`iox2_sample_t`] since the storage is reused for the next sample.
+pub type iox2_subscriber_receive_batch_callback = extern "C" fn(
+    *mut iox2_sample_t,
+    iox2_sample_h,
+    iox2_callback_context,
+) -> iox2_callback_progression_e;
+
 // END type definition
 
 // BEGIN C API
@@ -268,6 +280,76 @@ pub unsafe extern "C" fn iox2_subscriber_id(
     *id_handle_ptr = (*storage_ptr).as_handle();
 }
 
+/// Defines how many consecutive samples are received from the publisher with the given id
+/// before the next one is visited when the subscriber uses
+/// [`iox2_receive_policy_e::ROUND_ROBIN`](crate::iox2_receive_policy_e). Every publisher has
+/// the weight 1 by default, a weight of 0 is treated as 1. The weight can be set before the
+/// publisher is connected.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `publisher_id` - A valid [`iox2_unique_publisher_id_h_ref`] of the publisher
+/// * `weight` - The number of consecutive samples per round
+///
+/// # Safety
+///
+/// * `subscriber_handle` is valid, non-null and was obtained via [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `publisher_id` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_set_publisher_weight(
+    subscriber_handle: iox2_subscriber_h_ref,
+    publisher_id: iox2_unique_publisher_id_h_ref,
+    weight: c_size_t,
+) {
+    subscriber_handle.assert_non_null();
+    publisher_id.assert_non_null();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+    let publisher_id = *(*publisher_id.as_type()).value.as_ref();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber
+            .value
+            .as_ref()
+            .ipc
+            .set_publisher_weight(publisher_id, weight),
+        iox2_service_type_e::LOCAL => subscriber
+            .value
+            .as_ref()
+            .local
+            .set_publisher_weight(publisher_id, weight),
+    }
+}
+
+/// Returns the weight of the publisher with the given id, see
+/// [`iox2_subscriber_set_publisher_weight()`].
+///
+/// # Safety
+///
+/// * `subscriber_handle` is valid, non-null and was obtained via [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `publisher_id` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_publisher_weight(
+    subscriber_handle: iox2_subscriber_h_ref,
+    publisher_id: iox2_unique_publisher_id_h_ref,
+) -> c_size_t {
+    subscriber_handle.assert_non_null();
+    publisher_id.assert_non_null();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+    let publisher_id = *(*publisher_id.as_type()).value.as_ref();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.publisher_weight(publisher_id),
+        iox2_service_type_e::LOCAL => subscriber
+            .value
+            .as_ref()
+            .local
+            .publisher_weight(publisher_id),
+    }
+}
+
 // TODO [#210] add all the other setter methods
 
 /// Takes a sample ouf of the subscriber queue.
@@ -347,6 +429,84 @@ pub unsafe extern "C" fn iox2_subscriber_receive(
     IOX2_OK
 }
 
+/// Takes up to `max_number_of_samples` samples out of the subscriber queues with a single call.
+/// All connections are updated once and every connection is drained before the next one is
+/// visited.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+/// * `max_number_of_samples` - The maximum number of samples that shall be received.
+/// * `callback` - A valid callback with [`iox2_subscriber_receive_batch_callback`] signature
+///   that is called for every received sample.
+/// * `callback_ctx` - An optional callback context [`iox2_callback_context`] to e.g. store
+///   information across callback iterations.
+/// * `number_of_received_samples_ptr` - Must be either a NULL pointer or a pointer to a
+///   [`c_size_t`] that will contain the number of received samples.
+///
+/// Returns IOX2_OK on success, an [`iox2_receive_error_e`] otherwise.
+///
+/// # Safety
+///
+/// * The `subscriber_handle` is still valid after the return of this function and can be use in another function call.
+/// * The `callback` takes the ownership of every provided sample, see [`iox2_subscriber_receive_batch_callback`].
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_receive_batch(
+    subscriber_handle: iox2_subscriber_h_ref,
+    max_number_of_samples: c_size_t,
+    callback: iox2_subscriber_receive_batch_callback,
+    callback_ctx: iox2_callback_context,
+    number_of_received_samples_ptr: *mut c_size_t,
+) -> c_int {
+    subscriber_handle.assert_non_null();
+
+    fn no_op(_: *mut iox2_sample_t) {}
+    let mut sample_storage = MaybeUninit::<iox2_sample_t>::uninit();
+    let sample_struct_ptr = sample_storage.as_mut_ptr();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+    let service_type = subscriber.service_type;
+
+    let result = match service_type {
+        iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.receive_custom_payload_batch(
+            max_number_of_samples,
+            |sample| {
+                (*sample_struct_ptr).init(service_type, SampleUnion::new_ipc(sample), no_op);
+                callback(
+                    sample_struct_ptr,
+                    (*sample_struct_ptr).as_handle(),
+                    callback_ctx,
+                )
+                .into()
+            },
+        ),
+        iox2_service_type_e::LOCAL => subscriber
+            .value
+            .as_ref()
+            .local
+            .receive_custom_payload_batch(max_number_of_samples, |sample| {
+                (*sample_struct_ptr).init(service_type, SampleUnion::new_local(sample), no_op);
+                callback(
+                    sample_struct_ptr,
+                    (*sample_struct_ptr).as_handle(),
+                    callback_ctx,
+                )
+                .into()
+            }),
+    };
+
+    match result {
+        Ok(number_of_received_samples) => {
+            if !number_of_received_samples_ptr.is_null() {
+                *number_of_received_samples_ptr = number_of_received_samples;
+            }
+            IOX2_OK
+        }
+        Err(error) => error.into_c_int(),
+    }
+}
+
 /// Returns true when the subscriber has samples that can be acquired with [`iox2_subscriber_receive`], otherwise false.
 ///
 /// # Arguments
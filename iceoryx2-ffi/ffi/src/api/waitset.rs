@@ -26,6 +26,7 @@ use iceoryx2::{
     waitset::{
         WaitSet, WaitSetAttachmentError, WaitSetCreateError, WaitSetRunError, WaitSetRunResult,
     },
+    waitset_executor::WaitSetExecutorBuilder,
 };
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_bb_elementary::AsCStr;
@@ -142,7 +143,7 @@ impl WaitSetUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<WaitSetUnion>
 pub struct iox2_waitset_storage_t {
-    internal: [u8; 784], // magic number obtained with size_of::<Option<WaitSetUnion>>()
+    internal: [u8; 2560], // magic number obtained with size_of::<Option<WaitSetUnion>>()
 }
 
 #[repr(C)]
@@ -207,6 +208,20 @@ pub type iox2_waitset_run_callback = extern "C" fn(
     iox2_waitset_attachment_id_h,
     iox2_callback_context,
 ) -> iox2_callback_progression_e;
+
+pub type iox2_waitset_polling_callback = extern "C" fn(iox2_callback_context) -> bool;
+
+// The callback context is shared with the worker threads of the executor, the user
+// guarantees in `iox2_waitset_executor_run()` that it can be accessed concurrently.
+struct SharedCallbackContext(iox2_callback_context);
+
+unsafe impl Sync for SharedCallbackContext {}
+
+impl SharedCallbackContext {
+    fn get(&self) -> iox2_callback_context {
+        self.0
+    }
+}
 // END type definition
 
 // BEGIN C API
@@ -333,6 +348,95 @@ pub unsafe extern "C" fn iox2_waitset_signal_handling_mode(
     }
 }
 
+/// Returns the timer slack with which the waitset was created.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * `seconds` is pointing to a valid memory location and non-null
+///  * `nanoseconds` is pointing to a valid memory location and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_timer_slack(
+    handle: iox2_waitset_h_ref,
+    seconds: *mut u64,
+    nanoseconds: *mut u32,
+) {
+    debug_assert!(!seconds.is_null());
+    debug_assert!(!nanoseconds.is_null());
+
+    let waitset = &mut *handle.as_type();
+
+    let timer_slack = match waitset.service_type {
+        iox2_service_type_e::IPC => waitset.value.as_ref().ipc.timer_slack(),
+        iox2_service_type_e::LOCAL => waitset.value.as_ref().local.timer_slack(),
+    };
+
+    *seconds = timer_slack.as_secs();
+    *nanoseconds = timer_slack.subsec_nanos();
+}
+
+/// Returns the poll interval of the [`iox2_waitset_h`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * `seconds` is pointing to a valid memory location and non-null
+///  * `nanoseconds` is pointing to a valid memory location and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_poll_interval(
+    handle: iox2_waitset_h_ref,
+    seconds: *mut u64,
+    nanoseconds: *mut u32,
+) {
+    debug_assert!(!seconds.is_null());
+    debug_assert!(!nanoseconds.is_null());
+
+    let waitset = &mut *handle.as_type();
+
+    let poll_interval = match waitset.service_type {
+        iox2_service_type_e::IPC => waitset.value.as_ref().ipc.poll_interval(),
+        iox2_service_type_e::LOCAL => waitset.value.as_ref().local.poll_interval(),
+    };
+
+    *seconds = poll_interval.as_secs();
+    *nanoseconds = poll_interval.subsec_nanos();
+}
+
+/// Returns how often a wait of the [`iox2_waitset_h`] was resolved while spinning, yielding
+/// or blocking.
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * `resolved_by_spinning` is pointing to a valid memory location and non-null
+///  * `resolved_by_yielding` is pointing to a valid memory location and non-null
+///  * `resolved_by_blocking` is pointing to a valid memory location and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_wait_statistics(
+    handle: iox2_waitset_h_ref,
+    resolved_by_spinning: *mut u64,
+    resolved_by_yielding: *mut u64,
+    resolved_by_blocking: *mut u64,
+) {
+    debug_assert!(!resolved_by_spinning.is_null());
+    debug_assert!(!resolved_by_yielding.is_null());
+    debug_assert!(!resolved_by_blocking.is_null());
+
+    let waitset = &mut *handle.as_type();
+
+    let statistics = match waitset.service_type {
+        iox2_service_type_e::IPC => waitset.value.as_ref().ipc.wait_statistics(),
+        iox2_service_type_e::LOCAL => waitset.value.as_ref().local.wait_statistics(),
+    };
+
+    *resolved_by_spinning = statistics.resolved_by_spinning;
+    *resolved_by_yielding = statistics.resolved_by_yielding;
+    *resolved_by_blocking = statistics.resolved_by_blocking;
+}
+
 /// Returns the number of attachments of the [`iox2_waitset_h`].
 ///
 /// # Safety
@@ -612,6 +716,89 @@ pub unsafe extern "C" fn iox2_waitset_attach_interval(
     IOX2_OK
 }
 
+/// Attaches a polling callback to the [`iox2_waitset_h`]. The callback is called with the
+/// provided context whenever the WaitSet waits and as soon as it returns true the WaitSet
+/// informs the user in [`iox2_waitset_wait_and_process()`]. It is meant for objects without
+/// a file descriptor like a subscriber that is checked with
+/// [`iox2_subscriber_has_samples()`](crate::iox2_subscriber_has_samples()).
+///
+/// With [`iox2_waitset_attachment_id_has_event_from()`](crate::iox2_waitset_attachment_id_has_event_from())
+/// the origin of the event can be determined from its corresponding
+/// [`iox2_waitset_guard_h`].
+///
+/// # Return
+///
+/// `IOX2_OK` on success, otherwise [`iox2_waitset_attachment_error_e`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * `callback_ctx` must be valid as long as the guard exists
+///  * `callback` must not block and must not attach to or detach from the [`iox2_waitset_h`]
+///  * `guard_struct_ptr` must be either pointing to a valid uninitialized memory
+///    position or `null`
+///  * `guard_handle_ptr` must be pointing to valid uninitialized memory.
+///  * `guard_handle_ptr` must be released with [`iox2_waitset_guard_drop()`](crate::iox2_waitset_guard_drop()).
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_attach_polling(
+    handle: iox2_waitset_h_ref,
+    callback: iox2_waitset_polling_callback,
+    callback_ctx: iox2_callback_context,
+    guard_struct_ptr: *mut iox2_waitset_guard_t,
+    guard_handle_ptr: *mut iox2_waitset_guard_h,
+) -> c_int {
+    handle.assert_non_null();
+    debug_assert!(!guard_handle_ptr.is_null());
+
+    let waitset = &mut *handle.as_type();
+    let predicate = move || callback(callback_ctx);
+
+    let mut guard_struct_ptr = guard_struct_ptr;
+    fn no_op(_: *mut iox2_waitset_guard_t) {}
+    let mut deleter: fn(*mut iox2_waitset_guard_t) = no_op;
+    let mut alloc_memory = || {
+        if guard_struct_ptr.is_null() {
+            guard_struct_ptr = iox2_waitset_guard_t::alloc();
+            deleter = iox2_waitset_guard_t::dealloc;
+        }
+        debug_assert!(!guard_struct_ptr.is_null());
+    };
+
+    match waitset.service_type {
+        iox2_service_type_e::IPC => match waitset.value.as_ref().ipc.attach_polling(predicate) {
+            Ok(guard) => {
+                alloc_memory();
+
+                (*guard_struct_ptr).init(waitset.service_type, GuardUnion::new_ipc(guard), deleter);
+            }
+            Err(e) => {
+                return e.into_c_int();
+            }
+        },
+        iox2_service_type_e::LOCAL => {
+            match waitset.value.as_ref().local.attach_polling(predicate) {
+                Ok(guard) => {
+                    alloc_memory();
+
+                    (*guard_struct_ptr).init(
+                        waitset.service_type,
+                        GuardUnion::new_local(guard),
+                        deleter,
+                    );
+                }
+                Err(e) => {
+                    return e.into_c_int();
+                }
+            }
+        }
+    }
+
+    *guard_handle_ptr = (*guard_struct_ptr).as_handle();
+
+    IOX2_OK
+}
+
 /// Waits until an event arrives on the [`iox2_waitset_h`], then
 /// collects all events by calling the provided `fn_call` callback with the corresponding
 /// [`iox2_waitset_attachment_id_h`] and then returns. This makes it ideal to be called in some kind
@@ -859,4 +1046,103 @@ pub unsafe extern "C" fn iox2_waitset_wait_and_process(
     }
 }
 
+/// Waits on the [`iox2_waitset_h`] in the calling thread in an infinite loop and dispatches
+/// every event to one of `number_of_threads` worker threads which call the provided `callback`
+/// with the corresponding owning [`iox2_waitset_attachment_id_h`] and the `callback_ctx`.
+/// The events of one attachment are never handled concurrently.
+/// The infinite loop is interrupted either by a `SIGINT` or `SIGTERM` signal or
+/// when the user callback returned [`iox2_callback_progression_e::STOP`].
+///
+/// # Arguments
+///
+/// * `handle` - the waitset
+/// * `number_of_threads` - the number of worker threads, at least one worker is used
+/// * `cpu_affinity` - optional array of CPU cores, the worker `n` is pinned to the core
+///   `cpu_affinity[n % cpu_affinity_len]`. When it is null the workers can run on every core.
+/// * `cpu_affinity_len` - the number of elements of `cpu_affinity`
+/// * `priority` - optional priority of the workers from 0 (lowest) to 255 (highest). When it
+///   is null the workers inherit the scheduling attributes of the calling thread.
+/// * `callback` - called from the worker threads for every event
+/// * `callback_ctx` - provided to every `callback` call
+/// * `result` - the [`iox2_waitset_run_result_e`] on success
+///
+/// # Return
+///
+/// `IOX2_OK` on success, otherwise [`iox2_waitset_run_error_e`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * `cpu_affinity` must be either null or point to an array of `cpu_affinity_len` elements
+///  * `callback` and `callback_ctx` must be safe to be used from multiple threads concurrently
+///  * the provided [`iox2_waitset_attachment_id_h`] in the callback must be released via
+///    [`iox2_waitset_attachment_id_drop()`](crate::iox2_waitset_attachment_id_drop())
+#[no_mangle]
+#[allow(clippy::too_many_arguments)]
+pub unsafe extern "C" fn iox2_waitset_executor_run(
+    handle: iox2_waitset_h_ref,
+    number_of_threads: c_size_t,
+    cpu_affinity: *const c_size_t,
+    cpu_affinity_len: c_size_t,
+    priority: *const u8,
+    callback: iox2_waitset_run_callback,
+    callback_ctx: iox2_callback_context,
+    result: *mut iox2_waitset_run_result_e,
+) -> c_int {
+    handle.assert_non_null();
+    debug_assert!(!result.is_null());
+
+    let waitset = &mut *handle.as_type();
+    let service_type = waitset.service_type;
+    let callback_ctx = SharedCallbackContext(callback_ctx);
+
+    let mut executor_builder = WaitSetExecutorBuilder::new().number_of_threads(number_of_threads);
+    if !cpu_affinity.is_null() {
+        executor_builder = executor_builder
+            .cpu_affinity(core::slice::from_raw_parts(cpu_affinity, cpu_affinity_len));
+    }
+    if !priority.is_null() {
+        executor_builder = executor_builder.priority(*priority);
+    }
+
+    let run_result =
+        match service_type {
+            iox2_service_type_e::IPC => {
+                executor_builder
+                    .create(&waitset.value.as_ref().ipc)
+                    .run(|attachment_id| {
+                        let attachment_id_ptr = iox2_waitset_attachment_id_t::alloc();
+                        (*attachment_id_ptr).init(
+                            service_type,
+                            AttachmentIdUnion::new_ipc(attachment_id),
+                            iox2_waitset_attachment_id_t::dealloc,
+                        );
+                        let attachment_id_handle_ptr = (*attachment_id_ptr).as_handle();
+                        callback(attachment_id_handle_ptr, callback_ctx.get()).into()
+                    })
+            }
+            iox2_service_type_e::LOCAL => executor_builder
+                .create(&waitset.value.as_ref().local)
+                .run(|attachment_id| {
+                    let attachment_id_ptr = iox2_waitset_attachment_id_t::alloc();
+                    (*attachment_id_ptr).init(
+                        service_type,
+                        AttachmentIdUnion::new_local(attachment_id),
+                        iox2_waitset_attachment_id_t::dealloc,
+                    );
+                    let attachment_id_handle_ptr = (*attachment_id_ptr).as_handle();
+                    callback(attachment_id_handle_ptr, callback_ctx.get()).into()
+                }),
+        };
+
+    match run_result {
+        Ok(v) => {
+            *result = v.into();
+            IOX2_OK
+        }
+        Err(e) => e.into_c_int(),
+    }
+}
+
 // END C API
@@ -12,7 +12,7 @@
 
 #![allow(non_camel_case_types)]
 
-use core::ffi::c_int;
+use core::{ffi::c_int, time::Duration};
 
 use crate::{
     api::IntoCInt, iox2_service_type_e, iox2_waitset_h, iox2_waitset_t, WaitSetUnion, IOX2_OK,
@@ -20,16 +20,16 @@ use crate::{
 
 use super::{iox2_signal_handling_mode_e, AssertNonNullHandle, HandleToType};
 use iceoryx2::{
-    prelude::WaitSetBuilder,
+    prelude::{WaitPolicy, WaitSetBuilder},
     service::{ipc, local},
 };
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
 
 #[repr(C)]
-#[repr(align(1))] // alignment of Option<WaitSetBuilder>
+#[repr(align(8))] // alignment of Option<WaitSetBuilder>
 pub struct iox2_waitset_builder_storage_t {
-    internal: [u8; 1], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
+    internal: [u8; 72], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
 }
 
 #[repr(C)]
@@ -224,4 +224,95 @@ pub unsafe extern "C" fn iox2_waitset_builder_set_signal_handling_mode(
     waitset_builder_struct.set(waitset_builder);
 }
 
+/// Sets the timer slack for the [`iox2_waitset_h`]. Deadlines and intervals that are close to
+/// each other are handled together with one wakeup.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `seconds` - the seconds of the timer slack
+/// * `nanoseconds` - the nanoseconds of the timer slack
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_timer_slack(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let timer_slack = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.timer_slack(timer_slack);
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Sets the wait policy for the [`iox2_waitset_h`]. A wait busy polls for the spin duration,
+/// yields the CPU for the yield duration and blocks afterwards.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `spin_seconds` - the seconds of the spin duration
+/// * `spin_nanoseconds` - the nanoseconds of the spin duration
+/// * `yield_seconds` - the seconds of the yield duration
+/// * `yield_nanoseconds` - the nanoseconds of the yield duration
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_wait_policy(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    spin_seconds: u64,
+    spin_nanoseconds: u32,
+    yield_seconds: u64,
+    yield_nanoseconds: u32,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let wait_policy = WaitPolicy::new(
+        Duration::from_secs(spin_seconds) + Duration::from_nanos(spin_nanoseconds as u64),
+        Duration::from_secs(yield_seconds) + Duration::from_nanos(yield_nanoseconds as u64),
+    );
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.wait_policy(wait_policy);
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Sets the poll interval for the [`iox2_waitset_h`]. A blocking wait evaluates the polling
+/// attachments at least once per poll interval.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `seconds` - the seconds of the poll interval
+/// * `nanoseconds` - the nanoseconds of the poll interval
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_poll_interval(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let poll_interval = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.poll_interval(poll_interval);
+    waitset_builder_struct.set(waitset_builder);
+}
+
 // END C API
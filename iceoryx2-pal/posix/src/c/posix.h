@@ -21,6 +21,12 @@
 #include <sys/user.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __APPLE__
 #include <libproc.h>
 #include <mach-o/dyld.h>
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::types::*;
+use crate::posix::Struct;
+
+pub const IN_ATTRIB: u32 = 0x0000_0004;
+pub const IN_MOVED_FROM: u32 = 0x0000_0040;
+pub const IN_MOVED_TO: u32 = 0x0000_0080;
+pub const IN_CREATE: u32 = 0x0000_0100;
+pub const IN_DELETE: u32 = 0x0000_0200;
+pub const IN_DELETE_SELF: u32 = 0x0000_0400;
+pub const IN_MOVE_SELF: u32 = 0x0000_0800;
+pub const IN_Q_OVERFLOW: u32 = 0x0000_4000;
+pub const IN_IGNORED: u32 = 0x0000_8000;
+pub const IN_ONLYDIR: u32 = 0x0100_0000;
+
+// the header of an event, it is followed by `len` bytes that contain the null-terminated
+// and padded name of the directory entry
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct inotify_event {
+    pub wd: int,
+    pub mask: u32,
+    pub cookie: u32,
+    pub len: u32,
+}
+impl Struct for inotify_event {}
+
+pub const IN_CLOEXEC: int = libc::IN_CLOEXEC as _;
+pub const IN_NONBLOCK: int = libc::IN_NONBLOCK as _;
+
+pub unsafe fn inotify_init1(flags: int) -> int {
+    libc::inotify_init1(flags)
+}
+
+pub unsafe fn inotify_add_watch(fd: int, pathname: *const c_char, mask: u32) -> int {
+    libc::inotify_add_watch(fd, pathname, mask)
+}
+
+pub unsafe fn inotify_rm_watch(fd: int, wd: int) -> int {
+    libc::inotify_rm_watch(fd, wd)
+}
@@ -12,9 +12,17 @@
 
 pub mod constants;
 pub mod dirent;
+#[cfg(target_os = "linux")]
+pub mod epoll;
 pub mod errno;
 pub mod fcntl;
+#[cfg(target_os = "linux")]
+pub mod futex;
 pub mod inet;
+#[cfg(target_os = "linux")]
+pub mod inotify;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod mman;
 pub mod pthread;
 pub mod pwd;
@@ -35,9 +43,17 @@ pub mod unistd;
 
 pub use crate::libc::constants::*;
 pub use crate::libc::dirent::*;
+#[cfg(target_os = "linux")]
+pub use crate::libc::epoll::*;
 pub use crate::libc::errno::*;
 pub use crate::libc::fcntl::*;
+#[cfg(target_os = "linux")]
+pub use crate::libc::futex::*;
 pub use crate::libc::inet::*;
+#[cfg(target_os = "linux")]
+pub use crate::libc::inotify::*;
+#[cfg(target_os = "linux")]
+pub use crate::libc::io_uring::*;
 pub use crate::libc::mman::*;
 pub use crate::libc::pthread::*;
 pub use crate::libc::pwd::*;
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::types::*;
+use crate::posix::Struct;
+
+pub const EPOLLIN: uint = 0x001;
+pub const EPOLLERR: uint = 0x008;
+pub const EPOLLHUP: uint = 0x010;
+
+pub const EPOLL_CTL_ADD: int = 1;
+pub const EPOLL_CTL_DEL: int = 2;
+pub const EPOLL_CTL_MOD: int = 3;
+
+// identical layout to the C struct which is packed on x86_64 only, the user data
+// is always used as u64
+#[repr(C)]
+#[cfg_attr(target_arch = "x86_64", repr(packed))]
+#[derive(Debug, Clone, Copy)]
+pub struct epoll_event {
+    pub events: uint,
+    pub data: u64,
+}
+impl Struct for epoll_event {}
+
+pub const EPOLL_CLOEXEC: int = crate::internal::EPOLL_CLOEXEC as _;
+
+pub unsafe fn epoll_create1(flags: int) -> int {
+    crate::internal::epoll_create1(flags)
+}
+
+pub unsafe fn epoll_ctl(epfd: int, op: int, fd: int, event: *mut epoll_event) -> int {
+    crate::internal::epoll_ctl(epfd, op, fd, event as *mut crate::internal::epoll_event)
+}
+
+pub unsafe fn epoll_wait(epfd: int, events: *mut epoll_event, maxevents: int, timeout: int) -> int {
+    crate::internal::epoll_wait(
+        epfd,
+        events as *mut crate::internal::epoll_event,
+        maxevents,
+        timeout,
+    )
+}
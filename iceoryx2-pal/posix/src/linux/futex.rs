@@ -0,0 +1,38 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::types::*;
+
+pub const FUTEX_WAIT: int = 0;
+pub const FUTEX_WAKE: int = 1;
+
+pub unsafe fn futex_wait(uaddr: *const u32, expected: u32, timeout: *const timespec) -> int {
+    crate::internal::syscall(
+        crate::internal::SYS_futex as _,
+        uaddr,
+        FUTEX_WAIT,
+        expected,
+        timeout,
+    ) as _
+}
+
+pub unsafe fn futex_wake(uaddr: *const u32, number_of_waiters: u32) -> int {
+    crate::internal::syscall(
+        crate::internal::SYS_futex as _,
+        uaddr,
+        FUTEX_WAKE,
+        number_of_waiters,
+    ) as _
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::types::*;
+use crate::posix::Struct;
+
+pub const IORING_SETUP_CLAMP: u32 = 1 << 4;
+
+pub const IORING_FEAT_SINGLE_MMAP: u32 = 1 << 0;
+pub const IORING_FEAT_NODROP: u32 = 1 << 1;
+pub const IORING_FEAT_EXT_ARG: u32 = 1 << 8;
+
+pub const IORING_OFF_SQ_RING: off_t = 0;
+pub const IORING_OFF_SQES: off_t = 0x10000000;
+
+pub const IORING_SQ_CQ_OVERFLOW: u32 = 1 << 1;
+
+pub const IORING_ENTER_GETEVENTS: u32 = 1 << 0;
+pub const IORING_ENTER_EXT_ARG: u32 = 1 << 3;
+
+pub const IORING_OP_POLL_ADD: u8 = 6;
+pub const IORING_OP_POLL_REMOVE: u8 = 7;
+
+pub const IORING_POLLIN: u32 = 0x001;
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_sqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub flags: u32,
+    pub dropped: u32,
+    pub array: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+impl Struct for io_sqring_offsets {}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_cqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub overflow: u32,
+    pub cqes: u32,
+    pub flags: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+impl Struct for io_cqring_offsets {}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_uring_params {
+    pub sq_entries: u32,
+    pub cq_entries: u32,
+    pub flags: u32,
+    pub sq_thread_cpu: u32,
+    pub sq_thread_idle: u32,
+    pub features: u32,
+    pub wq_fd: u32,
+    pub resv: [u32; 3],
+    pub sq_off: io_sqring_offsets,
+    pub cq_off: io_cqring_offsets,
+}
+impl Struct for io_uring_params {}
+
+// the unions of the C struct are represented by the member that is used for poll requests
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_uring_sqe {
+    pub opcode: u8,
+    pub flags: u8,
+    pub ioprio: u16,
+    pub fd: i32,
+    pub off: u64,
+    pub addr: u64,
+    pub len: u32,
+    pub poll32_events: u32,
+    pub user_data: u64,
+    pub buf_index: u16,
+    pub personality: u16,
+    pub splice_fd_in: i32,
+    pub addr3: u64,
+    pub __pad2: u64,
+}
+impl Struct for io_uring_sqe {}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_uring_cqe {
+    pub user_data: u64,
+    pub res: i32,
+    pub flags: u32,
+}
+impl Struct for io_uring_cqe {}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct __kernel_timespec {
+    pub tv_sec: i64,
+    pub tv_nsec: i64,
+}
+impl Struct for __kernel_timespec {}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct io_uring_getevents_arg {
+    pub sigmask: u64,
+    pub sigmask_sz: u32,
+    pub pad: u32,
+    pub ts: u64,
+}
+impl Struct for io_uring_getevents_arg {}
+
+pub unsafe fn io_uring_setup(entries: u32, params: *mut io_uring_params) -> int {
+    crate::internal::syscall(crate::internal::SYS_io_uring_setup as _, entries, params) as _
+}
+
+/// An expired timeout is reported as [`Errno::ETIMEDOUT`](crate::posix::Errno::ETIMEDOUT)
+/// since `ETIME` is not part of the portable errno set.
+pub unsafe fn io_uring_enter(
+    fd: int,
+    to_submit: u32,
+    min_complete: u32,
+    flags: u32,
+    arg: *const void,
+    argsz: size_t,
+) -> int {
+    let ret = crate::internal::syscall(
+        crate::internal::SYS_io_uring_enter as _,
+        fd,
+        to_submit,
+        min_complete,
+        flags,
+        arg,
+        argsz,
+    ) as int;
+
+    if ret == -1 && *crate::internal::__errno_location() == crate::internal::ETIME as int {
+        *crate::internal::__errno_location() = crate::internal::ETIMEDOUT as int;
+    }
+
+    ret
+}
@@ -12,9 +12,13 @@
 
 pub mod constants;
 pub mod dirent;
+pub mod epoll;
 pub mod errno;
 pub mod fcntl;
+pub mod futex;
 pub mod inet;
+pub mod inotify;
+pub mod io_uring;
 pub mod mman;
 pub mod pthread;
 pub mod pwd;
@@ -35,9 +39,13 @@ pub mod unistd;
 
 pub use crate::linux::constants::*;
 pub use crate::linux::dirent::*;
+pub use crate::linux::epoll::*;
 pub use crate::linux::errno::*;
 pub use crate::linux::fcntl::*;
+pub use crate::linux::futex::*;
 pub use crate::linux::inet::*;
+pub use crate::linux::inotify::*;
+pub use crate::linux::io_uring::*;
 pub use crate::linux::mman::*;
 pub use crate::linux::pthread::*;
 pub use crate::linux::pwd::*;
@@ -18,6 +18,7 @@ pub const POSIX_SUPPORT_USERS_AND_GROUPS: bool = false;
 pub const POSIX_SUPPORT_PERMISSIONS: bool = true;
 pub const POSIX_SUPPORT_FILE_LOCK: bool = false;
 pub const POSIX_SUPPORT_MEMORY_LOCK: bool = false;
+pub const POSIX_SUPPORT_HUGE_PAGES: bool = false;
 pub const POSIX_SUPPORT_MESSAGE_QUEUE: bool = false;
 pub const POSIX_SUPPORT_ADVANCED_SIGNAL_HANDLING: bool = false;
 pub const POSIX_SUPPORT_CONSOLE_SIGNAL_HANDLING: bool = true;
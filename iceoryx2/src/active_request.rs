@@ -14,7 +14,7 @@ use core::{fmt::Debug, marker::PhantomData, ops::Deref};
 
 use iceoryx2_bb_log::fatal_panic;
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
-use iceoryx2_cal::zero_copy_connection::{ChannelId, ZeroCopyReceiver, ZeroCopyReleaseError};
+use iceoryx2_cal::zero_copy_connection::ZeroCopyReleaseError;
 
 use crate::{
     port::{details::chunk_details::ChunkDetails, port_identifiers::UniqueClientId},
@@ -101,12 +101,7 @@ impl<
                 .unregister_offset(self.details.offset)
         };
 
-        match self
-            .details
-            .connection
-            .receiver
-            .release(self.details.offset, ChannelId::new(0))
-        {
+        match self.details.connection.release(self.details.offset) {
             Ok(()) => (),
             Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
                 fatal_panic!(from self, "This should never happen! The clients retrieve channel is full and the request cannot be returned.");
@@ -298,6 +298,8 @@ pub mod port;
 
 pub(crate) mod raw_sample;
 
+pub(crate) mod tracepoint;
+
 /// Represents a "connection" to a [`Client`](crate::port::client::Client) that corresponds to a
 /// previously received [`RequestMut`](crate::request_mut::RequestMut).
 pub mod active_request;
@@ -346,6 +348,18 @@ pub mod prelude;
 #[doc(hidden)]
 pub mod testing;
 
+/// Incremental discovery of [`Service`](crate::service::Service)s and
+/// [`Node`](crate::node::Node)s backed by an in-process cache.
+pub mod tracker;
+
+/// Defines how blocking waits of a [`Listener`](crate::port::listener::Listener) or a
+/// [`WaitSet`](crate::waitset::WaitSet) spin, yield and block.
+pub mod wait_policy;
+
 /// Event handling mechanism to wait on multiple [`Listener`](crate::port::listener::Listener)s
 /// in one call, realizing the reactor pattern. (Event multiplexer)
 pub mod waitset;
+
+/// Dispatches the events of a [`WaitSet`](crate::waitset::WaitSet) to a pool of worker
+/// threads.
+pub mod waitset_executor;
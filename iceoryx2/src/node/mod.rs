@@ -194,6 +194,11 @@ impl NodeId {
                         "This should never happen! The NodeId shall be always a valid FileName.")
     }
 
+    pub(crate) fn from_file_name(file_name: &FileName) -> Self {
+        let node_id = core::str::from_utf8(file_name.as_bytes()).unwrap();
+        NodeId(node_id.parse::<u128>().unwrap().into())
+    }
+
     /// Returns the underlying value of the [`NodeId`].
     pub fn value(&self) -> u128 {
         self.0.value()
@@ -876,8 +881,7 @@ impl<Service: service::Service> Node<Service> {
         match Self::list_all_nodes(&monitoring_config) {
             Ok(node_list) => {
                 for node_name in node_list {
-                    let node_id = core::str::from_utf8(node_name.as_bytes()).unwrap();
-                    let node_id = NodeId(node_id.parse::<u128>().unwrap().into());
+                    let node_id = NodeId::from_file_name(&node_name);
 
                     match NodeState::new(&node_id, config) {
                         Ok(Some(node_state)) => {
@@ -989,7 +993,7 @@ impl<Service: service::Service> Node<Service> {
         }
     }
 
-    fn list_all_nodes(
+    pub(crate) fn list_all_nodes(
         config: &<Service::Monitoring as NamedConceptMgmt>::Configuration,
     ) -> Result<Vec<FileName>, NodeListFailure> {
         let result = <Service::Monitoring as NamedConceptMgmt>::list_cfg(config);
@@ -1036,7 +1040,10 @@ impl<Service: service::Service> Node<Service> {
         }
     }
 
-    fn get_node_state(config: &Config, node_id: &NodeId) -> Result<State, NodeListFailure> {
+    pub(crate) fn get_node_state(
+        config: &Config,
+        node_id: &NodeId,
+    ) -> Result<State, NodeListFailure> {
         let my_pid = Process::from_self().id();
         let node_pid = node_id.0.pid();
 
@@ -45,7 +45,9 @@ use iceoryx2_bb_elementary::{cyclic_tagger::CyclicTagger, CallbackProgression};
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_log::{fail, warn};
 use iceoryx2_cal::{
-    dynamic_storage::DynamicStorage, shm_allocator::PointerOffset,
+    dynamic_storage::DynamicStorage,
+    shared_memory::{MemoryResidency, PageSize},
+    shm_allocator::PointerOffset,
     zero_copy_connection::ZeroCopyCreationError,
 };
 use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicUsize};
@@ -59,7 +61,10 @@ use crate::{
     request_mut_uninit::RequestMutUninit,
     service::{
         self,
-        dynamic_config::request_response::{ClientDetails, ServerDetails},
+        dynamic_config::{
+            publish_subscribe::StatisticsSlot,
+            request_response::{ClientDetails, ServerDetails},
+        },
         naming_scheme::data_segment_name,
         port_factory::client::{ClientCreateError, PortFactoryClient},
     },
@@ -284,6 +289,8 @@ impl<
             static_config.request_message_type_details.sample_layout(1),
             global_config,
             number_of_requests,
+            PageSize::Default,
+            MemoryResidency::OnDemand,
         );
 
         let data_segment = fail!(from origin,
@@ -320,6 +327,9 @@ impl<
                     sender_max_borrowed_samples: client_factory.max_loaned_requests,
                     unable_to_deliver_strategy: client_factory.unable_to_deliver_strategy,
                     message_type_details: static_config.request_message_type_details.clone(),
+                    broadcast_ring: None,
+                    memory_residency: MemoryResidency::OnDemand,
+                    statistics_slot: StatisticsSlot::unassigned(),
                 },
                 is_active: IoxAtomicBool::new(true),
                 server_list_state: UnsafeCell::new(unsafe { server_list.get_state() }),
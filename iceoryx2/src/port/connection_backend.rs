@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use serde::{Deserialize, Serialize};
+
+/// Defines how a [`Publisher`](crate::port::publisher::Publisher) delivers its
+/// [`Sample`](crate::sample::Sample)s to the connected
+/// [`Subscriber`](crate::port::subscriber::Subscriber)s.
+#[derive(Debug, Default, Eq, Hash, PartialEq, Clone, Copy, Serialize, Deserialize)]
+pub enum ConnectionBackend {
+    /// Every [`Subscriber`](crate::port::subscriber::Subscriber) has its own queue to
+    /// every [`Publisher`](crate::port::publisher::Publisher). Sending a
+    /// [`Sample`](crate::sample::Sample) costs one queue operation per
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) but every
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) can be served independently.
+    #[default]
+    SubscriberQueues,
+    /// Every [`Publisher`](crate::port::publisher::Publisher) writes into a single ring
+    /// buffer that is shared with all [`Subscriber`](crate::port::subscriber::Subscriber)s.
+    /// Every [`Subscriber`](crate::port::subscriber::Subscriber) only keeps a read cursor,
+    /// so the cost of sending does not grow with the number of
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s. The ring holds
+    /// `subscriber_max_buffer_size` [`Sample`](crate::sample::Sample)s. Without safe
+    /// overflow the slowest [`Subscriber`](crate::port::subscriber::Subscriber) holds
+    /// back the [`Publisher`](crate::port::publisher::Publisher) for all
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s.
+    BroadcastRing,
+}
@@ -0,0 +1,713 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Single producer, multi consumer ring in shared memory that is used by the
+//! [`ConnectionBackend::BroadcastRing`](crate::port::connection_backend::ConnectionBackend::BroadcastRing).
+//!
+//! The sender writes every offset exactly once into the ring and every receiver owns a read
+//! cursor. Since the receivers do not return their samples through a dedicated queue, every
+//! sample has a reference counter in the ring that the receivers increment while they
+//! borrow the sample. The sender recycles a slot only when the counter of the sample it
+//! contains is zero, otherwise the sample is kept until the last receiver released it.
+//!
+//! Borrowing a sample from a slot that the sender recycles concurrently is resolved with a
+//! sequence number per slot: the sender invalidates the sequence number before it reads the
+//! reference counter, the receiver increments the reference counter before it re-reads the
+//! sequence number. A sequentially consistent fence on both sides guarantees that at least
+//! one of them observes the other.
+//!
+//! A sender that waits until the receivers consumed the oldest slot announces it with a flag
+//! and sleeps on an inter-process semaphore. A receiver posts the semaphore when it advances
+//! its cursor or detaches while the flag is set.
+
+use core::cell::{Cell, UnsafeCell};
+use core::sync::atomic::{fence, Ordering};
+use core::time::Duration;
+
+use iceoryx2_bb_container::vec::RelocatableVec;
+use iceoryx2_bb_elementary::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_log::{fail, fatal_panic, warn};
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::semaphore::{
+    SemaphoreInterface, SemaphoreTimedWaitError, SemaphoreWaitError, UnnamedSemaphore,
+    UnnamedSemaphoreBuilder, UnnamedSemaphoreHandle,
+};
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_cal::dynamic_storage::{
+    DynamicStorage, DynamicStorageBuilder, DynamicStorageCreateError, DynamicStorageOpenError,
+    MemoryResidency,
+};
+use iceoryx2_cal::named_concept::NamedConceptBuilder;
+use iceoryx2_cal::shm_allocator::PointerOffset;
+use iceoryx2_cal::zero_copy_connection::ZeroCopyReceiveError;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU64, IoxAtomicU8};
+
+use crate::config;
+use crate::service;
+use crate::service::config_scheme::broadcast_ring_config;
+
+const INVALID_SEQUENCE_NUMBER: u64 = u64::MAX;
+
+// Handshake of a cursor whose receiver is checked with
+// `BroadcastRingSender::for_each_activated_receiver()`. Only then the receiver pays for the
+// fence on an empty receive. Until the receiver has acknowledged the request, it is always
+// reported as activated.
+const NOTIFY_ON_ACTIVATION_DISABLED: u8 = 0;
+const NOTIFY_ON_ACTIVATION_REQUESTED: u8 = 1;
+const NOTIFY_ON_ACTIVATION_ACKNOWLEDGED: u8 = 2;
+
+#[derive(Debug)]
+#[repr(C)]
+struct Slot {
+    sequence_number: IoxAtomicU64,
+    offset: IoxAtomicU64,
+    reference_counter_index: IoxAtomicU64,
+}
+
+impl Slot {
+    fn new() -> Self {
+        Self {
+            sequence_number: IoxAtomicU64::new(INVALID_SEQUENCE_NUMBER),
+            offset: IoxAtomicU64::new(0),
+            reference_counter_index: IoxAtomicU64::new(0),
+        }
+    }
+}
+
+#[derive(Debug)]
+#[repr(C)]
+struct Cursor {
+    owner_high: IoxAtomicU64,
+    owner_low: IoxAtomicU64,
+    position: IoxAtomicU64,
+    notify_on_activation: IoxAtomicU8,
+}
+
+impl Cursor {
+    fn new() -> Self {
+        Self {
+            owner_high: IoxAtomicU64::new(0),
+            owner_low: IoxAtomicU64::new(0),
+            position: IoxAtomicU64::new(0),
+            notify_on_activation: IoxAtomicU8::new(NOTIFY_ON_ACTIVATION_DISABLED),
+        }
+    }
+
+    fn attach(&self, owner: u128, position: u64) {
+        self.position.store(position, Ordering::Relaxed);
+        self.notify_on_activation
+            .store(NOTIFY_ON_ACTIVATION_DISABLED, Ordering::Relaxed);
+        self.owner_high
+            .store((owner >> 64) as u64, Ordering::Release);
+        self.owner_low.store(owner as u64, Ordering::Release);
+    }
+
+    fn detach(&self, owner: u128) {
+        // the cursor might already be reused by another receiver
+        let _ =
+            self.owner_low
+                .compare_exchange(owner as u64, 0, Ordering::Relaxed, Ordering::Relaxed);
+    }
+
+    fn position_of(&self, owner: u128) -> Option<u64> {
+        let low = self.owner_low.load(Ordering::Acquire) as u128;
+        let high = self.owner_high.load(Ordering::Acquire) as u128;
+
+        if (high << 64 | low) == owner {
+            Some(self.position.load(Ordering::Acquire))
+        } else {
+            None
+        }
+    }
+}
+
+/// The management data of a broadcast ring that is stored in the
+/// [`Service::BroadcastRing`](crate::service::Service::BroadcastRing).
+#[doc(hidden)]
+#[derive(Debug)]
+#[repr(C)]
+pub struct BroadcastRingState {
+    head: IoxAtomicU64,
+    sender_waits_for_consumption: IoxAtomicBool,
+    slot_consumed: UnnamedSemaphoreHandle,
+    slots: RelocatableVec<Slot>,
+    cursors: RelocatableVec<Cursor>,
+    sample_reference_counter: RelocatableVec<IoxAtomicU64>,
+}
+
+impl BroadcastRingState {
+    fn new_uninit(
+        capacity: usize,
+        number_of_cursors: usize,
+        number_of_reference_counters: usize,
+    ) -> Self {
+        Self {
+            head: IoxAtomicU64::new(0),
+            sender_waits_for_consumption: IoxAtomicBool::new(false),
+            slot_consumed: UnnamedSemaphoreHandle::new(),
+            slots: unsafe { RelocatableVec::new_uninit(capacity) },
+            cursors: unsafe { RelocatableVec::new_uninit(number_of_cursors) },
+            sample_reference_counter: unsafe {
+                RelocatableVec::new_uninit(number_of_reference_counters)
+            },
+        }
+    }
+
+    const fn const_memory_size(
+        capacity: usize,
+        number_of_cursors: usize,
+        number_of_reference_counters: usize,
+    ) -> usize {
+        RelocatableVec::<Slot>::const_memory_size(capacity)
+            + RelocatableVec::<Cursor>::const_memory_size(number_of_cursors)
+            + RelocatableVec::<IoxAtomicU64>::const_memory_size(number_of_reference_counters)
+    }
+
+    unsafe fn init(&mut self, allocator: &BumpAllocator) {
+        let msg = "Failed to initialize BroadcastRingState";
+        fatal_panic!(from self, when self.slots.init(allocator),
+            "{} since the slots could not be allocated. - This is an implementation bug!", msg);
+        self.slots.fill_with(Slot::new);
+
+        fatal_panic!(from self, when self.cursors.init(allocator),
+            "{} since the cursors could not be allocated. - This is an implementation bug!", msg);
+        self.cursors.fill_with(Cursor::new);
+
+        fatal_panic!(from self, when self.sample_reference_counter.init(allocator),
+            "{} since the reference counters could not be allocated. - This is an implementation bug!", msg);
+        self.sample_reference_counter
+            .fill_with(|| IoxAtomicU64::new(0));
+
+        fatal_panic!(from self, when UnnamedSemaphoreBuilder::new()
+                        .is_interprocess_capable(true)
+                        .initial_value(0)
+                        .create(&self.slot_consumed),
+            "{} since the semaphore to signal consumed slots could not be created.", msg);
+    }
+
+    fn slot_consumed(&self) -> UnnamedSemaphore<'_> {
+        unsafe { UnnamedSemaphore::from_ipc_handle(&self.slot_consumed) }
+    }
+
+    /// Wakes up a sender that is blocked in [`BroadcastRingSender::wait_until_consumed()`].
+    /// The semaphore is only posted when the sender announced that it is waiting. The flag
+    /// is read before it is swapped so that a consuming receiver does not write the shared
+    /// cache line when no sender waits.
+    fn wake_up_waiting_sender(&self) {
+        if !self.sender_waits_for_consumption.load(Ordering::Relaxed) {
+            return;
+        }
+
+        if self
+            .sender_waits_for_consumption
+            .swap(false, Ordering::SeqCst)
+        {
+            if let Err(e) = self.slot_consumed().post() {
+                warn!(from self,
+                    "Unable to wake up the waiting sender ({:?}). The sender will recover when its timeout is hit.", e);
+            }
+        }
+    }
+
+    fn capacity(&self) -> u64 {
+        self.slots.len() as u64
+    }
+}
+
+/// Defines how long [`BroadcastRingSender::push()`] waits for the receivers when the oldest
+/// slot in the ring was not yet consumed by every receiver.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) enum WaitForConsumption {
+    DoNotWait,
+    Forever,
+    AtMost(Duration),
+}
+
+#[derive(Debug)]
+pub(crate) struct BroadcastRingSender<Service: service::Service> {
+    storage: Service::BroadcastRing,
+    receivers: Vec<Cell<Option<u128>>>,
+    number_of_receivers: Cell<usize>,
+    min_receiver_position: Cell<u64>,
+    recycled_but_borrowed_samples: UnsafeCell<Vec<(PointerOffset, u64)>>,
+}
+
+impl<Service: service::Service> BroadcastRingSender<Service> {
+    pub(crate) fn create(
+        name: &FileName,
+        global_config: &config::Config,
+        capacity: usize,
+        max_number_of_receivers: usize,
+        number_of_reference_counters: usize,
+        memory_residency: MemoryResidency,
+    ) -> Result<Self, DynamicStorageCreateError> {
+        let origin = "BroadcastRingSender::create()";
+        let storage = fail!(from origin,
+                when <<Service::BroadcastRing as DynamicStorage<BroadcastRingState>>::Builder<'_> as NamedConceptBuilder<
+                    Service::BroadcastRing,
+                >>::new(name)
+                    .config(&broadcast_ring_config::<Service>(global_config))
+                    .supplementary_size(BroadcastRingState::const_memory_size(
+                        capacity,
+                        max_number_of_receivers,
+                        number_of_reference_counters,
+                    ))
+                    .initializer(|state, allocator| {
+                        unsafe { state.init(allocator) };
+                        true
+                    })
+                    .create(BroadcastRingState::new_uninit(
+                        capacity,
+                        max_number_of_receivers,
+                        number_of_reference_counters,
+                    )),
+                "Unable to create the broadcast ring since the underlying dynamic storage could not be created.");
+
+        if let Err(e) = storage.apply_memory_residency(memory_residency) {
+            fail!(from origin, with DynamicStorageCreateError::InternalError,
+                "Unable to create the broadcast ring since the memory residency {:?} could not be applied ({:?}).",
+                memory_residency, e);
+        }
+
+        Ok(Self {
+            storage,
+            receivers: (0..max_number_of_receivers)
+                .map(|_| Cell::new(None))
+                .collect(),
+            number_of_receivers: Cell::new(0),
+            min_receiver_position: Cell::new(0),
+            recycled_but_borrowed_samples: UnsafeCell::new(Vec::with_capacity(
+                number_of_reference_counters,
+            )),
+        })
+    }
+
+    fn state(&self) -> &BroadcastRingState {
+        self.storage.get()
+    }
+
+    pub(crate) fn start_update_connection_cycle(&self) {
+        for receiver in &self.receivers {
+            receiver.set(None);
+        }
+        self.number_of_receivers.set(0);
+    }
+
+    pub(crate) fn update_connection(&self, index: usize, receiver_port_id: u128) {
+        self.receivers[index].set(Some(receiver_port_id));
+        self.number_of_receivers
+            .set(self.number_of_receivers.get() + 1);
+        // a new receiver may start behind all others when it receives the history
+        self.min_receiver_position.set(0);
+    }
+
+    pub(crate) fn number_of_receivers(&self) -> usize {
+        self.number_of_receivers.get()
+    }
+
+    /// Calls `activated_receiver` with the index of every receiver that has consumed every
+    /// sample except the most recently pushed one, i.e. whose view of the ring was empty
+    /// before the last [`BroadcastRingSender::push()`]. Receivers that have not yet
+    /// acknowledged the notify-on-activation handshake are always reported.
+    pub(crate) fn for_each_activated_receiver<F: FnMut(usize)>(&self, mut activated_receiver: F) {
+        let state = self.state();
+        let last_sequence_number = state.head.load(Ordering::Relaxed).saturating_sub(1);
+        // a receiver that has drained the ring concurrently either sees the new sample or its
+        // updated position is seen here
+        fence(Ordering::SeqCst);
+
+        for (index, receiver) in self.receivers.iter().enumerate() {
+            if let Some(receiver_port_id) = receiver.get() {
+                let cursor = &state.cursors[index];
+                // the position is acquired first, so that the handshake state that a newly
+                // attached receiver has reset is seen
+                let position = match cursor.position_of(receiver_port_id) {
+                    Some(position) => position,
+                    None => continue,
+                };
+                let is_activated = match cursor.notify_on_activation.load(Ordering::Acquire) {
+                    NOTIFY_ON_ACTIVATION_ACKNOWLEDGED => position == last_sequence_number,
+                    NOTIFY_ON_ACTIVATION_DISABLED => {
+                        cursor
+                            .notify_on_activation
+                            .store(NOTIFY_ON_ACTIVATION_REQUESTED, Ordering::Relaxed);
+                        true
+                    }
+                    _ => true,
+                };
+
+                if is_activated {
+                    activated_receiver(index);
+                }
+            }
+        }
+    }
+
+    /// Releases all recycled samples that are no longer borrowed by any receiver.
+    pub(crate) fn retrieve_returned_samples<F: FnMut(PointerOffset)>(&self, mut release: F) {
+        let state = self.state();
+        unsafe { &mut *self.recycled_but_borrowed_samples.get() }.retain(
+            |(offset, reference_counter_index)| {
+                if state.sample_reference_counter[*reference_counter_index as usize]
+                    .load(Ordering::Acquire)
+                    == 0
+                {
+                    release(*offset);
+                    false
+                } else {
+                    true
+                }
+            },
+        );
+    }
+
+    fn update_min_receiver_position(&self) -> u64 {
+        let state = self.state();
+        let mut min_position = state.head.load(Ordering::Relaxed);
+        for (index, receiver) in self.receivers.iter().enumerate() {
+            if let Some(receiver_port_id) = receiver.get() {
+                if let Some(position) = state.cursors[index].position_of(receiver_port_id) {
+                    min_position = min_position.min(position);
+                }
+            }
+        }
+
+        self.min_receiver_position.set(min_position);
+        min_position
+    }
+
+    /// Returns true when every receiver consumed the sample with the given sequence number.
+    /// Instead of polling the cursors, the sender announces that it waits and sleeps on the
+    /// semaphore of the ring which is posted by the receivers when they advance or detach.
+    fn wait_until_consumed(&self, sequence_number: u64, wait: WaitForConsumption) -> bool {
+        let msg = "Unable to wait until all receivers consumed the oldest sample";
+        // the cursors are only scanned when the cached minimum does no longer suffice
+        let is_consumed = || {
+            self.min_receiver_position.get() > sequence_number
+                || self.update_min_receiver_position() > sequence_number
+        };
+
+        if is_consumed() {
+            return true;
+        }
+
+        let timeout = match wait {
+            WaitForConsumption::DoNotWait => return false,
+            WaitForConsumption::Forever => None,
+            WaitForConsumption::AtMost(timeout) => Some(timeout),
+        };
+
+        let state = self.state();
+        let start = Time::now();
+        loop {
+            let remaining_time = match timeout {
+                None => None,
+                Some(timeout) => {
+                    let elapsed = match start {
+                        Ok(ref start) => start.elapsed().unwrap_or(timeout),
+                        Err(_) => timeout,
+                    };
+
+                    if elapsed >= timeout {
+                        state
+                            .sender_waits_for_consumption
+                            .store(false, Ordering::SeqCst);
+                        return is_consumed();
+                    }
+
+                    Some(timeout - elapsed)
+                }
+            };
+
+            state
+                .sender_waits_for_consumption
+                .store(true, Ordering::SeqCst);
+            fence(Ordering::SeqCst);
+            // a receiver may have advanced before it was able to see the flag
+            if is_consumed() {
+                state
+                    .sender_waits_for_consumption
+                    .store(false, Ordering::SeqCst);
+                return true;
+            }
+
+            match remaining_time {
+                None => match state.slot_consumed().blocking_wait() {
+                    Ok(()) | Err(SemaphoreWaitError::Interrupt) => (),
+                    Err(e) => {
+                        warn!(from self, "{} since the semaphore wait failed ({:?}).", msg, e);
+                        return false;
+                    }
+                },
+                Some(remaining_time) => match state.slot_consumed().timed_wait(remaining_time) {
+                    Ok(_)
+                    | Err(SemaphoreTimedWaitError::SemaphoreWaitError(
+                        SemaphoreWaitError::Interrupt,
+                    )) => (),
+                    Err(e) => {
+                        warn!(from self, "{} since the semaphore wait failed ({:?}).", msg, e);
+                        return false;
+                    }
+                },
+            }
+
+            if is_consumed() {
+                return true;
+            }
+        }
+    }
+
+    /// Writes the offset into the next slot of the ring. When the ring is full the oldest slot
+    /// is recycled, with safe overflow right away otherwise only when every receiver consumed
+    /// it. Recycled samples that are not borrowed by any receiver are handed to `release`.
+    /// Returns false when the offset was not written.
+    pub(crate) fn push<F: FnMut(PointerOffset)>(
+        &self,
+        offset: PointerOffset,
+        reference_counter_index: usize,
+        enable_safe_overflow: bool,
+        wait: WaitForConsumption,
+        mut release: F,
+    ) -> bool {
+        let state = self.state();
+        let sequence_number = state.head.load(Ordering::Relaxed);
+        let capacity = state.capacity();
+        let slot = &state.slots[(sequence_number % capacity) as usize];
+
+        if capacity <= sequence_number {
+            let recycled_sequence_number = sequence_number - capacity;
+            if !enable_safe_overflow && !self.wait_until_consumed(recycled_sequence_number, wait) {
+                return false;
+            }
+
+            slot.sequence_number
+                .store(INVALID_SEQUENCE_NUMBER, Ordering::Relaxed);
+            fence(Ordering::SeqCst);
+
+            let recycled_offset = PointerOffset::from_value(slot.offset.load(Ordering::Relaxed));
+            let recycled_index = slot.reference_counter_index.load(Ordering::Relaxed);
+            if state.sample_reference_counter[recycled_index as usize].load(Ordering::Acquire) == 0
+            {
+                release(recycled_offset);
+            } else {
+                unsafe { &mut *self.recycled_but_borrowed_samples.get() }
+                    .push((recycled_offset, recycled_index));
+            }
+        }
+
+        slot.offset.store(offset.as_value(), Ordering::Relaxed);
+        slot.reference_counter_index
+            .store(reference_counter_index as u64, Ordering::Relaxed);
+        slot.sequence_number
+            .store(sequence_number, Ordering::Release);
+        state.head.store(sequence_number + 1, Ordering::Release);
+
+        true
+    }
+}
+
+#[derive(Debug)]
+pub(crate) struct BroadcastRingReceiver<Service: service::Service> {
+    storage: Service::BroadcastRing,
+    receiver_port_id: u128,
+    cursor_index: Cell<Option<usize>>,
+    position: Cell<u64>,
+    max_borrowed_samples: usize,
+    borrowed_samples: UnsafeCell<Vec<(PointerOffset, u64)>>,
+}
+
+impl<Service: service::Service> Drop for BroadcastRingReceiver<Service> {
+    fn drop(&mut self) {
+        if let Some(cursor_index) = self.cursor_index.get() {
+            self.state().cursors[cursor_index].detach(self.receiver_port_id);
+            // a detached receiver no longer holds back a waiting sender
+            self.state().wake_up_waiting_sender();
+        }
+    }
+}
+
+impl<Service: service::Service> BroadcastRingReceiver<Service> {
+    pub(crate) fn open(
+        name: &FileName,
+        global_config: &config::Config,
+        receiver_port_id: u128,
+        max_borrowed_samples: usize,
+        memory_residency: MemoryResidency,
+    ) -> Result<Self, DynamicStorageOpenError> {
+        let origin = "BroadcastRingReceiver::open()";
+        let storage = fail!(from origin,
+                when <<Service::BroadcastRing as DynamicStorage<BroadcastRingState>>::Builder<'_> as NamedConceptBuilder<
+                    Service::BroadcastRing,
+                >>::new(name)
+                    .config(&broadcast_ring_config::<Service>(global_config))
+                    .timeout(global_config.global.service.creation_timeout)
+                    .open(),
+                "Unable to open the broadcast ring since the underlying dynamic storage could not be opened.");
+
+        if let Err(e) = storage.apply_memory_residency(memory_residency) {
+            fail!(from origin, with DynamicStorageOpenError::InternalError,
+                "Unable to open the broadcast ring since the memory residency {:?} could not be applied ({:?}).",
+                memory_residency, e);
+        }
+
+        Ok(Self {
+            storage,
+            receiver_port_id,
+            cursor_index: Cell::new(None),
+            position: Cell::new(0),
+            max_borrowed_samples,
+            borrowed_samples: UnsafeCell::new(Vec::with_capacity(max_borrowed_samples)),
+        })
+    }
+
+    fn state(&self) -> &BroadcastRingState {
+        self.storage.get()
+    }
+
+    /// Registers the read cursor of the receiver. It starts with the `history_size` most recent
+    /// samples that are still contained in the ring.
+    pub(crate) fn attach(&self, cursor_index: usize, history_size: usize) {
+        let state = self.state();
+        let head = state.head.load(Ordering::Acquire);
+        let position = head.saturating_sub((history_size as u64).min(state.capacity()));
+
+        self.position.set(position);
+        state.cursors[cursor_index].attach(self.receiver_port_id, position);
+        self.cursor_index.set(Some(cursor_index));
+    }
+
+    pub(crate) fn has_data(&self) -> bool {
+        self.cursor_index.get().is_some()
+            && self.position.get() < self.state().head.load(Ordering::Acquire)
+    }
+
+    pub(crate) fn max_borrowed_samples(&self) -> usize {
+        self.max_borrowed_samples
+    }
+
+    fn advance_to(&self, cursor_index: usize, position: u64) {
+        self.position.set(position);
+        let state = self.state();
+        state.cursors[cursor_index]
+            .position
+            .store(position, Ordering::Release);
+        state.wake_up_waiting_sender();
+    }
+
+    pub(crate) fn receive(&self) -> Result<Option<PointerOffset>, ZeroCopyReceiveError> {
+        if let Some(offset) = self.receive_from_ring()? {
+            return Ok(Some(offset));
+        }
+
+        let cursor = match self.cursor_index.get() {
+            Some(cursor_index) => &self.state().cursors[cursor_index],
+            None => return Ok(None),
+        };
+
+        match cursor.notify_on_activation.load(Ordering::Relaxed) {
+            NOTIFY_ON_ACTIVATION_DISABLED => Ok(None),
+            notify_on_activation => {
+                if notify_on_activation == NOTIFY_ON_ACTIVATION_REQUESTED {
+                    cursor
+                        .notify_on_activation
+                        .store(NOTIFY_ON_ACTIVATION_ACKNOWLEDGED, Ordering::Release);
+                }
+                // pairs with the fence in `BroadcastRingSender::for_each_activated_receiver()`,
+                // either the sender sees the updated cursor or the new sample is seen here
+                fence(Ordering::SeqCst);
+                self.receive_from_ring()
+            }
+        }
+    }
+
+    /// Returns the [`PointerOffset`] that the next [`BroadcastRingReceiver::receive()`] would
+    /// acquire without borrowing it. Returns [`None`] when no sample is available or when the
+    /// next slot was already overwritten by the sender.
+    pub(crate) fn peek(&self) -> Option<PointerOffset> {
+        self.cursor_index.get()?;
+
+        let state = self.state();
+        let position = self.position.get();
+        let slot = &state.slots[(position % state.capacity()) as usize];
+        match slot.sequence_number.load(Ordering::Acquire) == position {
+            true => Some(PointerOffset::from_value(
+                slot.offset.load(Ordering::Relaxed),
+            )),
+            false => None,
+        }
+    }
+
+    fn receive_from_ring(&self) -> Result<Option<PointerOffset>, ZeroCopyReceiveError> {
+        let cursor_index = match self.cursor_index.get() {
+            Some(cursor_index) => cursor_index,
+            None => return Ok(None),
+        };
+
+        let borrowed_samples = unsafe { &mut *self.borrowed_samples.get() };
+        if self.max_borrowed_samples <= borrowed_samples.len() {
+            fail!(from self, with ZeroCopyReceiveError::ReceiveWouldExceedMaxBorrowValue,
+                "Unable to receive another sample since already {} samples were borrowed and this would exceed the max borrow value of {}.",
+                borrowed_samples.len(), self.max_borrowed_samples);
+        }
+
+        let state = self.state();
+        let capacity = state.capacity();
+        loop {
+            let position = self.position.get();
+            let slot = &state.slots[(position % capacity) as usize];
+            let sequence_number = slot.sequence_number.load(Ordering::Acquire);
+
+            if sequence_number == position {
+                let offset = PointerOffset::from_value(slot.offset.load(Ordering::Relaxed));
+                let reference_counter_index = slot.reference_counter_index.load(Ordering::Relaxed);
+                let reference_counter =
+                    &state.sample_reference_counter[reference_counter_index as usize];
+
+                reference_counter.fetch_add(1, Ordering::Relaxed);
+                fence(Ordering::SeqCst);
+                if slot.sequence_number.load(Ordering::Relaxed) == position {
+                    self.advance_to(cursor_index, position + 1);
+                    borrowed_samples.push((offset, reference_counter_index));
+                    return Ok(Some(offset));
+                }
+
+                // the sender recycled the slot while it was read
+                reference_counter.fetch_sub(1, Ordering::Relaxed);
+            } else if sequence_number == INVALID_SEQUENCE_NUMBER {
+                if state.head.load(Ordering::Acquire) < position + capacity {
+                    return Ok(None);
+                }
+            } else if sequence_number < position {
+                return Ok(None);
+            }
+
+            // the sender has overwritten the slot, continue with the oldest available sample
+            let oldest_position = state.head.load(Ordering::Acquire).saturating_sub(capacity);
+            self.advance_to(cursor_index, oldest_position.max(position + 1));
+        }
+    }
+
+    pub(crate) fn release(&self, offset: PointerOffset) {
+        let borrowed_samples = unsafe { &mut *self.borrowed_samples.get() };
+        match borrowed_samples.iter().position(|(o, _)| *o == offset) {
+            Some(index) => {
+                let (_, reference_counter_index) = borrowed_samples.swap_remove(index);
+                self.state().sample_reference_counter[reference_counter_index as usize]
+                    .fetch_sub(1, Ordering::Release);
+            }
+            None => {
+                warn!(from self, "Unable to release the sample {:?} since it was not borrowed from the broadcast ring.", offset);
+            }
+        }
+    }
+}
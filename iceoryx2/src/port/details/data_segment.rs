@@ -12,18 +12,20 @@
 
 use core::alloc::Layout;
 
-use iceoryx2_bb_log::fail;
+use iceoryx2_bb_elementary::math::align;
+use iceoryx2_bb_log::{fail, warn};
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_cal::{
     event::NamedConceptBuilder,
     resizable_shared_memory::*,
     shared_memory::{
-        SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError, SharedMemoryForPoolAllocator,
-        SharedMemoryOpenError, ShmPointer,
+        MemoryResidency, PageSize, SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError,
+        SharedMemoryForBuddyAllocator, SharedMemoryForPoolAllocator, SharedMemoryOpenError,
+        ShmPointer,
     },
     shm_allocator::{
-        self, pool_allocator::PoolAllocator, AllocationError, AllocationStrategy, PointerOffset,
-        SegmentId, ShmAllocationError,
+        self, buddy_allocator::BuddyAllocator, pool_allocator::PoolAllocator, AllocationError,
+        AllocationStrategy, PointerOffset, SegmentId, ShmAllocationError, ShmAllocator,
     },
 };
 
@@ -31,7 +33,9 @@ use crate::{
     config,
     service::{
         self,
-        config_scheme::{data_segment_config, resizable_data_segment_config},
+        config_scheme::{
+            buddy_data_segment_config, data_segment_config, resizable_data_segment_config,
+        },
     },
 };
 
@@ -41,6 +45,7 @@ use crate::{
 pub enum DataSegmentType {
     Dynamic,
     Static,
+    Buddy,
 }
 
 impl DataSegmentType {
@@ -56,6 +61,7 @@ impl DataSegmentType {
 enum MemoryType<Service: service::Service> {
     Static(Service::SharedMemory),
     Dynamic(Service::ResizableSharedMemory),
+    Buddy(Service::BuddySharedMemory),
 }
 
 #[derive(Debug)]
@@ -69,6 +75,8 @@ impl<Service: service::Service> DataSegment<Service> {
         chunk_layout: Layout,
         global_config: &config::Config,
         number_of_chunks: usize,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
     ) -> Result<Self, SharedMemoryCreateError> {
         let allocator_config = shm_allocator::pool_allocator::Config {
             bucket_layout: chunk_layout,
@@ -77,14 +85,31 @@ impl<Service: service::Service> DataSegment<Service> {
         let origin = "DataSegment::create_static_segment()";
 
         let segment_config = data_segment_config::<Service>(global_config);
-        let memory = fail!(from origin,
-                                when <<Service::SharedMemory as SharedMemory<PoolAllocator>>::Builder as NamedConceptBuilder<
-                                Service::SharedMemory,
-                                    >>::new(segment_name)
-                                    .config(&segment_config)
-                                    .size(chunk_layout.size() * number_of_chunks + chunk_layout.align() - 1)
-                                    .create(&allocator_config),
-                                "{msg}");
+        let create_memory = |page_size| {
+            <<Service::SharedMemory as SharedMemory<PoolAllocator>>::Builder as NamedConceptBuilder<
+                Service::SharedMemory,
+            >>::new(segment_name)
+            .config(&segment_config)
+            .size(chunk_layout.size() * number_of_chunks + chunk_layout.align() - 1)
+            .page_size(page_size)
+            .memory_residency(memory_residency)
+            .create(&allocator_config)
+        };
+
+        let memory = match create_memory(page_size) {
+            Ok(memory) => memory,
+            Err(SharedMemoryCreateError::HugePagesUnavailable)
+                if page_size != PageSize::Default =>
+            {
+                warn!(from origin,
+                    "Unable to back the static data segment with huge pages of the type {:?} since they are not available, falling back to the default page size.",
+                    page_size);
+                fail!(from origin, when create_memory(PageSize::Default), "{msg}")
+            }
+            Err(e) => {
+                fail!(from origin, with e, "{msg}");
+            }
+        };
 
         Ok(Self {
             memory: MemoryType::Static(memory),
@@ -97,35 +122,119 @@ impl<Service: service::Service> DataSegment<Service> {
         global_config: &config::Config,
         number_of_chunks: usize,
         allocation_strategy: AllocationStrategy,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
     ) -> Result<Self, SharedMemoryCreateError> {
         let msg = "Unable to create the dynamic data segment since the underlying shared memory could not be created.";
         let origin = "DataSegment::create_dynamic_segment()";
 
         let segment_config = resizable_data_segment_config::<Service>(global_config);
-        let memory = fail!(from origin,
-                    when <<Service::ResizableSharedMemory as ResizableSharedMemory<
-                        PoolAllocator,
-                        Service::SharedMemory,
-                    >>::MemoryBuilder as NamedConceptBuilder<Service::ResizableSharedMemory>>::new(
-                        segment_name,
-                    )
-                    .config(&segment_config)
-                    .max_number_of_chunks_hint(number_of_chunks)
-                    .max_chunk_layout_hint(chunk_layout)
-                    .allocation_strategy(allocation_strategy)
-                    .create(),
-                    "{msg}");
+        let create_memory = |page_size| {
+            <<Service::ResizableSharedMemory as ResizableSharedMemory<
+                PoolAllocator,
+                Service::SharedMemory,
+            >>::MemoryBuilder as NamedConceptBuilder<Service::ResizableSharedMemory>>::new(
+                segment_name,
+            )
+            .config(&segment_config)
+            .max_number_of_chunks_hint(number_of_chunks)
+            .max_chunk_layout_hint(chunk_layout)
+            .allocation_strategy(allocation_strategy)
+            .page_size(page_size)
+            .memory_residency(memory_residency)
+            .create()
+        };
+
+        let memory = match create_memory(page_size) {
+            Ok(memory) => memory,
+            Err(SharedMemoryCreateError::HugePagesUnavailable)
+                if page_size != PageSize::Default =>
+            {
+                warn!(from origin,
+                    "Unable to back the dynamic data segment with huge pages of the type {:?} since they are not available, falling back to the default page size.",
+                    page_size);
+                fail!(from origin, when create_memory(PageSize::Default), "{msg}")
+            }
+            Err(e) => {
+                fail!(from origin, with e, "{msg}");
+            }
+        };
 
         Ok(Self {
             memory: MemoryType::Dynamic(memory),
         })
     }
 
+    pub(crate) fn create_buddy_segment(
+        segment_name: &FileName,
+        min_chunk_layout: Layout,
+        max_chunk_layout: Layout,
+        global_config: &config::Config,
+        number_of_chunks: usize,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
+    ) -> Result<Self, SharedMemoryCreateError> {
+        let hint = BuddyAllocator::initial_setup_hint(max_chunk_layout, number_of_chunks);
+        // the segment provides the payload capacity of the pool allocator, rounded up once to
+        // the largest block instead of rounding up every chunk to a power of two
+        let max_block_size = max_chunk_layout
+            .size()
+            .max(max_chunk_layout.align())
+            .next_power_of_two();
+        let payload_size = align(max_chunk_layout.size() * number_of_chunks, max_block_size);
+        // a block smaller than the smallest chunk would only inflate the bookkeeping
+        let min_block_size = hint
+            .config
+            .min_block_layout
+            .size()
+            .max(min_chunk_layout.size().next_power_of_two());
+        let allocator_config = shm_allocator::buddy_allocator::Config {
+            min_block_layout: unsafe {
+                Layout::from_size_align_unchecked(min_block_size, max_chunk_layout.align())
+            },
+        };
+        let msg = "Unable to create the buddy data segment since the underlying shared memory could not be created.";
+        let origin = "DataSegment::create_buddy_segment()";
+
+        let segment_config = buddy_data_segment_config::<Service>(global_config);
+        let create_memory = |page_size| {
+            <<Service::BuddySharedMemory as SharedMemory<BuddyAllocator>>::Builder as NamedConceptBuilder<
+                Service::BuddySharedMemory,
+            >>::new(segment_name)
+            .config(&segment_config)
+            .size(payload_size + max_chunk_layout.align() - 1)
+            .page_size(page_size)
+            .memory_residency(memory_residency)
+            .create(&allocator_config)
+        };
+
+        let memory = match create_memory(page_size) {
+            Ok(memory) => memory,
+            Err(SharedMemoryCreateError::HugePagesUnavailable)
+                if page_size != PageSize::Default =>
+            {
+                warn!(from origin,
+                    "Unable to back the buddy data segment with huge pages of the type {:?} since they are not available, falling back to the default page size.",
+                    page_size);
+                fail!(from origin, when create_memory(PageSize::Default), "{msg}")
+            }
+            Err(e) => {
+                fail!(from origin, with e, "{msg}");
+            }
+        };
+
+        Ok(Self {
+            memory: MemoryType::Buddy(memory),
+        })
+    }
+
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ShmPointer, ShmAllocationError> {
         let msg = "Unable to allocate memory from the data segment";
         match &self.memory {
             MemoryType::Static(memory) => Ok(fail!(from self, when memory.allocate(layout),
                                             "{msg}.")),
+            MemoryType::Buddy(memory) => Ok(fail!(from self, when memory.allocate(layout),
+                                            "{msg}.")),
             MemoryType::Dynamic(memory) => match memory.allocate(layout) {
                 Ok(ptr) => Ok(ptr),
                 Err(ResizableShmAllocationError::ShmAllocationError(e)) => {
@@ -150,6 +259,7 @@ impl<Service: service::Service> DataSegment<Service> {
         match &self.memory {
             MemoryType::Static(memory) => memory.deallocate_bucket(offset),
             MemoryType::Dynamic(memory) => memory.deallocate_bucket(offset),
+            MemoryType::Buddy(memory) => memory.deallocate_block(offset),
         }
     }
 
@@ -157,12 +267,31 @@ impl<Service: service::Service> DataSegment<Service> {
         match &self.memory {
             MemoryType::Static(memory) => memory.bucket_size(),
             MemoryType::Dynamic(memory) => memory.bucket_size(segment_id),
+            // every allocation starts at a multiple of the min block size
+            MemoryType::Buddy(memory) => memory.min_block_size(),
+        }
+    }
+
+    /// Returns the number of samples every segment must be able to track. The buddy allocator
+    /// may place a sample at every min block.
+    pub(crate) fn number_of_samples_per_segment(&self, number_of_chunks: usize) -> usize {
+        match &self.memory {
+            MemoryType::Buddy(memory) => memory.number_of_min_blocks(),
+            _ => number_of_chunks,
+        }
+    }
+
+    pub(crate) fn page_size(&self) -> PageSize {
+        match &self.memory {
+            MemoryType::Static(memory) => memory.page_size(),
+            MemoryType::Dynamic(memory) => memory.page_size(),
+            MemoryType::Buddy(memory) => memory.page_size(),
         }
     }
 
     pub(crate) fn max_number_of_segments(data_segment_type: DataSegmentType) -> u8 {
         match data_segment_type {
-            DataSegmentType::Static => 1,
+            DataSegmentType::Static | DataSegmentType::Buddy => 1,
             DataSegmentType::Dynamic => {
                 (Service::ResizableSharedMemory::max_number_of_reallocations() - 1) as u8
             }
@@ -179,6 +308,7 @@ enum MemoryViewType<Service: service::Service> {
             Service::SharedMemory,
         >>::View,
     ),
+    Buddy(Service::BuddySharedMemory),
 }
 
 #[derive(Debug)]
@@ -190,6 +320,8 @@ impl<Service: service::Service> DataSegmentView<Service> {
     pub(crate) fn open_static_segment(
         segment_name: &FileName,
         global_config: &config::Config,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
     ) -> Result<Self, SharedMemoryOpenError> {
         let origin = "DataSegment::open()";
         let msg =
@@ -201,6 +333,8 @@ impl<Service: service::Service> DataSegmentView<Service> {
                                 Builder::new(segment_name)
                                 .config(&segment_config)
                                 .timeout(global_config.global.service.creation_timeout)
+                                .page_size(page_size)
+                                .memory_residency(memory_residency)
                                 .open(),
                             "{msg}");
 
@@ -209,9 +343,37 @@ impl<Service: service::Service> DataSegmentView<Service> {
         })
     }
 
+    pub(crate) fn open_buddy_segment(
+        segment_name: &FileName,
+        global_config: &config::Config,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let origin = "DataSegment::open()";
+        let msg =
+            "Unable to open data segment since the underlying shared memory could not be opened.";
+
+        let segment_config = buddy_data_segment_config::<Service>(global_config);
+        let memory = fail!(from origin,
+                            when <Service::BuddySharedMemory as SharedMemory<BuddyAllocator>>::
+                                Builder::new(segment_name)
+                                .config(&segment_config)
+                                .timeout(global_config.global.service.creation_timeout)
+                                .page_size(page_size)
+                                .memory_residency(memory_residency)
+                                .open(),
+                            "{msg}");
+
+        Ok(Self {
+            memory: MemoryViewType::Buddy(memory),
+        })
+    }
+
     pub(crate) fn open_dynamic_segment(
         segment_name: &FileName,
         global_config: &config::Config,
+        page_size: PageSize,
+        memory_residency: MemoryResidency,
     ) -> Result<Self, SharedMemoryOpenError> {
         let origin = "DataSegment::open()";
         let msg =
@@ -226,6 +388,8 @@ impl<Service: service::Service> DataSegmentView<Service> {
                         segment_name,
                     )
                     .config(&segment_config)
+                    .page_size(page_size)
+                    .memory_residency(memory_residency)
                     .open(),
                     "{msg}");
 
@@ -240,6 +404,7 @@ impl<Service: service::Service> DataSegmentView<Service> {
     ) -> Result<usize, SharedMemoryOpenError> {
         match &self.memory {
             MemoryViewType::Static(memory) => Ok(offset.offset() + memory.payload_start_address()),
+            MemoryViewType::Buddy(memory) => Ok(offset.offset() + memory.payload_start_address()),
             MemoryViewType::Dynamic(memory) => unsafe {
                 match memory.register_and_translate_offset(offset) {
                     Ok(ptr) => Ok(ptr as usize),
@@ -253,9 +418,82 @@ impl<Service: service::Service> DataSegmentView<Service> {
         }
     }
 
+    /// Translates the offset without registering it. Returns [`None`] when the offset belongs
+    /// to a segment of a dynamic data segment that is not yet mapped.
+    pub(crate) fn translate_offset(&self, offset: PointerOffset) -> Option<usize> {
+        match &self.memory {
+            MemoryViewType::Static(memory) => {
+                Some(offset.offset() + memory.payload_start_address())
+            }
+            MemoryViewType::Buddy(memory) => Some(offset.offset() + memory.payload_start_address()),
+            MemoryViewType::Dynamic(memory) => {
+                memory.translate_offset(offset).map(|ptr| ptr as usize)
+            }
+        }
+    }
+
     pub(crate) unsafe fn unregister_offset(&self, offset: PointerOffset) {
         if let MemoryViewType::Dynamic(memory) = &self.memory {
             memory.unregister_offset(offset);
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+    use iceoryx2_bb_testing::assert_that;
+
+    use super::*;
+    use crate::service::local;
+    use crate::testing::generate_isolated_config;
+
+    fn generate_segment_name() -> FileName {
+        FileName::new(format!("data_segment_{}", UniqueSystemId::new().unwrap().value()).as_bytes())
+            .unwrap()
+    }
+
+    fn segment_size(segment: &DataSegment<local::Service>) -> usize {
+        match &segment.memory {
+            MemoryType::Static(memory) => memory.size(),
+            MemoryType::Buddy(memory) => memory.size(),
+            MemoryType::Dynamic(_) => unreachable!(),
+        }
+    }
+
+    #[test]
+    fn buddy_segment_is_at_most_one_max_block_larger_than_static_segment() {
+        const NUMBER_OF_CHUNKS: usize = 100;
+        let config = generate_isolated_config();
+
+        for chunk_size in [64, 100, 1000, 4097, 65537] {
+            let min_chunk_layout = Layout::from_size_align(8, 8).unwrap();
+            let chunk_layout = Layout::from_size_align(chunk_size, 8).unwrap();
+
+            let static_segment = DataSegment::<local::Service>::create_static_segment(
+                &generate_segment_name(),
+                chunk_layout,
+                &config,
+                NUMBER_OF_CHUNKS,
+                PageSize::Default,
+                MemoryResidency::OnDemand,
+            )
+            .unwrap();
+            let buddy_segment = DataSegment::<local::Service>::create_buddy_segment(
+                &generate_segment_name(),
+                min_chunk_layout,
+                chunk_layout,
+                &config,
+                NUMBER_OF_CHUNKS,
+                PageSize::Default,
+                MemoryResidency::OnDemand,
+            )
+            .unwrap();
+
+            let static_size = segment_size(&static_segment);
+            let buddy_size = segment_size(&buddy_segment);
+            assert_that!(buddy_size, ge static_size);
+            assert_that!(buddy_size, lt static_size + chunk_size.next_power_of_two());
+        }
+    }
+}
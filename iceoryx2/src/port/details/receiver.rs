@@ -10,23 +10,30 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use core::cell::UnsafeCell;
+use core::cell::{Cell, RefCell, UnsafeCell};
 
 extern crate alloc;
+use super::broadcast_ring::BroadcastRingReceiver;
 use super::chunk::Chunk;
 use super::chunk_details::ChunkDetails;
 use super::data_segment::{DataSegmentType, DataSegmentView};
+use crate::port::connection_backend::ConnectionBackend;
+use crate::port::receive_policy::ReceivePolicy;
 use crate::port::update_connections::ConnectionFailure;
 use crate::port::{DegradationAction, DegradationCallback, ReceiveError};
-use crate::service::naming_scheme::data_segment_name;
+use crate::service::dynamic_config::publish_subscribe::{StatisticsSlot, SubscriberCounters};
+use crate::service::naming_scheme::{broadcast_ring_name, data_segment_name};
 use crate::service::static_config::message_type_details::MessageTypeDetails;
 use crate::service::ServiceState;
 use crate::service::{self, config_scheme::connection_config, naming_scheme::connection_name};
+use crate::tracepoint::tracepoint;
 use alloc::sync::Arc;
 use iceoryx2_bb_container::queue::Queue;
 use iceoryx2_bb_elementary::cyclic_tagger::*;
+use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_log::{fail, warn};
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
+use iceoryx2_cal::shared_memory::PageSize;
 use iceoryx2_cal::zero_copy_connection::*;
 
 #[derive(Clone, Copy)]
@@ -35,13 +42,21 @@ pub(crate) struct SenderDetails {
     pub(crate) number_of_samples: usize,
     pub(crate) max_number_of_segments: u8,
     pub(crate) data_segment_type: DataSegmentType,
+    pub(crate) page_size: PageSize,
+}
+
+#[derive(Debug)]
+pub(crate) enum Channel<Service: service::Service> {
+    Queue(<Service::Connection as ZeroCopyConnection>::Receiver),
+    BroadcastRing(BroadcastRingReceiver<Service>),
 }
 
 #[derive(Debug)]
 pub(crate) struct Connection<Service: service::Service> {
-    pub(crate) receiver: <Service::Connection as ZeroCopyConnection>::Receiver,
+    pub(crate) channel: Channel<Service>,
     pub(crate) data_segment: DataSegmentView<Service>,
     pub(crate) sender_port_id: u128,
+    pub(crate) weight: Cell<usize>,
     tag: Tag,
 }
 
@@ -55,6 +70,7 @@ impl<Service: service::Service> Connection<Service> {
     fn new(
         this: &Receiver<Service>,
         data_segment_type: DataSegmentType,
+        page_size: PageSize,
         sender_port_id: u128,
         number_of_samples: usize,
         max_number_of_segments: u8,
@@ -66,7 +82,8 @@ impl<Service: service::Service> Connection<Service> {
         );
 
         let global_config = this.service_state.shared_node.config();
-        let receiver = fail!(from this,
+        let channel = match this.connection_backend {
+            ConnectionBackend::SubscriberQueues => Channel::Queue(fail!(from this,
                         when <Service::Connection as ZeroCopyConnection>::
                             Builder::new( &connection_name(sender_port_id, this.receiver_port_id))
                                     .config(&connection_config::<Service>(global_config))
@@ -77,17 +94,45 @@ impl<Service: service::Service> Connection<Service> {
                                     .number_of_channels(1)
                                     .max_supported_shared_memory_segments(max_number_of_segments)
                                     .timeout(global_config.global.service.creation_timeout)
+                                    .memory_residency(this.memory_residency)
                                     .create_receiver(),
-                        "{} since the zero copy connection could not be established.", msg);
+                        "{} since the zero copy connection could not be established.", msg)),
+            ConnectionBackend::BroadcastRing => {
+                let broadcast_ring = fail!(from this,
+                        when BroadcastRingReceiver::open(
+                            &broadcast_ring_name(sender_port_id),
+                            global_config,
+                            this.receiver_port_id,
+                            this.receiver_max_borrowed_samples,
+                            this.memory_residency),
+                        "{} since the broadcast ring could not be opened.", msg);
+                if let Some(cursor_index) = this.broadcast_cursor_index.get() {
+                    broadcast_ring.attach(cursor_index, this.history_size);
+                }
+                Channel::BroadcastRing(broadcast_ring)
+            }
+        };
 
         let segment_name = data_segment_name(sender_port_id);
         let data_segment = match data_segment_type {
-            DataSegmentType::Static => {
-                DataSegmentView::open_static_segment(&segment_name, global_config)
-            }
-            DataSegmentType::Dynamic => {
-                DataSegmentView::open_dynamic_segment(&segment_name, global_config)
-            }
+            DataSegmentType::Static => DataSegmentView::open_static_segment(
+                &segment_name,
+                global_config,
+                page_size,
+                this.memory_residency,
+            ),
+            DataSegmentType::Dynamic => DataSegmentView::open_dynamic_segment(
+                &segment_name,
+                global_config,
+                page_size,
+                this.memory_residency,
+            ),
+            DataSegmentType::Buddy => DataSegmentView::open_buddy_segment(
+                &segment_name,
+                global_config,
+                page_size,
+                this.memory_residency,
+            ),
         };
 
         let data_segment = fail!(from this,
@@ -95,12 +140,57 @@ impl<Service: service::Service> Connection<Service> {
                                 "{} since the publishers data segment could not be opened.", msg);
 
         Ok(Self {
-            receiver,
+            channel,
             data_segment,
             sender_port_id,
+            weight: Cell::new(this.sender_weight(sender_port_id)),
             tag: cyclic_tagger.create_tag(),
         })
     }
+
+    pub(crate) fn has_data(&self) -> bool {
+        match &self.channel {
+            Channel::Queue(receiver) => receiver.has_data(ChannelId::new(0)),
+            Channel::BroadcastRing(broadcast_ring) => broadcast_ring.has_data(),
+        }
+    }
+
+    pub(crate) fn peek(&self) -> Option<PointerOffset> {
+        match &self.channel {
+            Channel::Queue(receiver) => receiver.peek(ChannelId::new(0)),
+            Channel::BroadcastRing(broadcast_ring) => broadcast_ring.peek(),
+        }
+    }
+
+    pub(crate) fn receive(&self) -> Result<Option<PointerOffset>, ZeroCopyReceiveError> {
+        match &self.channel {
+            Channel::Queue(receiver) => receiver.receive(ChannelId::new(0)),
+            Channel::BroadcastRing(broadcast_ring) => broadcast_ring.receive(),
+        }
+    }
+
+    pub(crate) fn release(&self, offset: PointerOffset) -> Result<(), ZeroCopyReleaseError> {
+        tracepoint!(
+            release,
+            crate::tracepoint::id_hi(self.sender_port_id),
+            crate::tracepoint::id_lo(self.sender_port_id),
+            offset.as_value()
+        );
+        match &self.channel {
+            Channel::Queue(receiver) => receiver.release(offset, ChannelId::new(0)),
+            Channel::BroadcastRing(broadcast_ring) => {
+                broadcast_ring.release(offset);
+                Ok(())
+            }
+        }
+    }
+
+    pub(crate) fn max_borrowed_samples(&self) -> usize {
+        match &self.channel {
+            Channel::Queue(receiver) => receiver.max_borrowed_samples(),
+            Channel::BroadcastRing(broadcast_ring) => broadcast_ring.max_borrowed_samples(),
+        }
+    }
 }
 
 #[derive(Debug)]
@@ -115,13 +205,49 @@ pub(crate) struct Receiver<Service: service::Service> {
     pub(crate) message_type_details: MessageTypeDetails,
     pub(crate) receiver_max_borrowed_samples: usize,
     pub(crate) enable_safe_overflow: bool,
+    pub(crate) receive_policy: ReceivePolicy,
+    pub(crate) round_robin_cursor: Cell<usize>,
+    pub(crate) served_from_cursor: Cell<usize>,
+    pub(crate) sender_weights: RefCell<Vec<(u128, usize)>>,
+    pub(crate) peek_send_timestamp: Option<unsafe fn(*const u8) -> Option<u64>>,
+    pub(crate) connection_backend: ConnectionBackend,
+    pub(crate) broadcast_cursor_index: Cell<Option<usize>>,
+    pub(crate) history_size: usize,
+    pub(crate) memory_residency: MemoryResidency,
+    pub(crate) statistics_slot: StatisticsSlot,
 }
 
 impl<Service: service::Service> Receiver<Service> {
+    #[inline(always)]
+    fn count<F: FnOnce(&SubscriberCounters)>(&self, count_call: F) {
+        if let Some(index) = self.statistics_slot.get() {
+            count_call(
+                self.service_state
+                    .dynamic_storage
+                    .get()
+                    .publish_subscribe()
+                    .subscriber_counters(index),
+            );
+        }
+    }
+
     pub(crate) fn receiver_port_id(&self) -> u128 {
         self.receiver_port_id
     }
 
+    /// Attaches the read cursor with the given index to the broadcast rings of all connected
+    /// senders. Connections that are established later attach the cursor on creation.
+    pub(crate) fn attach_broadcast_cursor(&self, cursor_index: usize) {
+        self.broadcast_cursor_index.set(Some(cursor_index));
+        for id in 0..self.len() {
+            if let Some(connection) = self.get(id) {
+                if let Channel::BroadcastRing(ref broadcast_ring) = connection.channel {
+                    broadcast_ring.attach(cursor_index, self.history_size);
+                }
+            }
+        }
+    }
+
     pub(crate) fn get(&self, index: usize) -> &Option<Arc<Connection<Service>>> {
         unsafe { &*self.connections[index].get() }
     }
@@ -143,6 +269,7 @@ impl<Service: service::Service> Receiver<Service> {
         *self.get_mut(index) = Some(Arc::new(Connection::new(
             self,
             sender_details.data_segment_type,
+            sender_details.page_size,
             sender_details.port_id,
             sender_details.number_of_samples,
             sender_details.max_number_of_segments,
@@ -155,7 +282,7 @@ impl<Service: service::Service> Receiver<Service> {
     pub(crate) fn prepare_connection_removal(&self, index: usize) {
         if let Some(to_be_removed_connections) = &self.to_be_removed_connections {
             if let Some(connection) = self.get(index) {
-                if connection.receiver.has_data(ChannelId::new(0))
+                if connection.has_data()
                     && !unsafe { &mut *to_be_removed_connections.get() }.push(connection.clone())
                 {
                     warn!(from self,
@@ -177,7 +304,7 @@ impl<Service: service::Service> Receiver<Service> {
     pub(crate) fn has_samples(&self) -> Result<bool, ConnectionFailure> {
         for id in 0..self.len() {
             if let Some(ref connection) = &self.get(id) {
-                if connection.receiver.has_data(ChannelId::new(0)) {
+                if connection.has_data() {
                     return Ok(true);
                 }
             }
@@ -191,10 +318,18 @@ impl<Service: service::Service> Receiver<Service> {
         connection: &Arc<Connection<Service>>,
     ) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
         let msg = "Unable to receive another sample";
-        match connection.receiver.receive(ChannelId::new(0)) {
+        match connection.receive() {
             Ok(data) => match data {
                 None => Ok(None),
                 Some(offset) => {
+                    tracepoint!(
+                        receive,
+                        crate::tracepoint::id_hi(self.receiver_port_id),
+                        crate::tracepoint::id_lo(self.receiver_port_id),
+                        crate::tracepoint::id_hi(connection.sender_port_id),
+                        crate::tracepoint::id_lo(connection.sender_port_id),
+                        offset.as_value()
+                    );
                     let details = ChunkDetails {
                         connection: connection.clone(),
                         offset,
@@ -213,6 +348,7 @@ impl<Service: service::Service> Receiver<Service> {
                         }
                     };
 
+                    self.count(|c| c.count_received_sample());
                     Ok(Some((
                         details,
                         Chunk::new(&self.message_type_details, offset),
@@ -220,9 +356,112 @@ impl<Service: service::Service> Receiver<Service> {
                 }
             },
             Err(ZeroCopyReceiveError::ReceiveWouldExceedMaxBorrowValue) => {
+                self.count(|c| c.count_exceeded_max_borrows());
                 fail!(from self, with ReceiveError::ExceedsMaxBorrows,
                     "{} since it would exceed the maximum {} of borrowed samples.",
-                    msg, connection.receiver.max_borrowed_samples());
+                    msg, connection.max_borrowed_samples());
+            }
+        }
+    }
+
+    /// Returns the weight of the sender with the given port id, senders without an explicitly
+    /// set weight have the weight 1.
+    pub(crate) fn sender_weight(&self, sender_port_id: u128) -> usize {
+        self.sender_weights
+            .borrow()
+            .iter()
+            .find(|(port_id, _)| *port_id == sender_port_id)
+            .map_or(1, |(_, weight)| *weight)
+    }
+
+    /// Defines how many consecutive chunks are received from the sender with the given port id
+    /// with [`ReceivePolicy::RoundRobin`] before the next connection is visited. The weight can
+    /// be set before the sender is connected, a weight of 0 is treated as 1.
+    pub(crate) fn set_sender_weight(&self, sender_port_id: u128, weight: usize) {
+        let weight = weight.max(1);
+        {
+            let mut sender_weights = self.sender_weights.borrow_mut();
+            sender_weights.retain(|(port_id, _)| *port_id != sender_port_id);
+            if weight != 1 {
+                sender_weights.push((sender_port_id, weight));
+            }
+        }
+
+        for id in 0..self.len() {
+            if let Some(connection) = self.get(id) {
+                if connection.sender_port_id == sender_port_id {
+                    connection.weight.set(weight);
+                }
+            }
+        }
+    }
+
+    fn send_timestamp_of_next_chunk(&self, connection: &Connection<Service>) -> Option<u64> {
+        let peek_send_timestamp = self.peek_send_timestamp?;
+        let offset = connection.peek()?;
+
+        match connection.data_segment.translate_offset(offset) {
+            Some(header) => unsafe { peek_send_timestamp(header as *const u8) },
+            // the segment is mapped on receive, visit the connection first to not starve it
+            None => Some(0),
+        }
+    }
+
+    fn oldest_connection(&self) -> usize {
+        let mut oldest_connection = 0;
+        let mut oldest_send_timestamp = u64::MAX;
+        for id in 0..self.len() {
+            if let Some(connection) = self.get(id) {
+                if let Some(send_timestamp) = self.send_timestamp_of_next_chunk(connection) {
+                    if send_timestamp < oldest_send_timestamp {
+                        oldest_connection = id;
+                        oldest_send_timestamp = send_timestamp;
+                    }
+                }
+            }
+        }
+
+        oldest_connection
+    }
+
+    fn first_connection_to_visit(&self) -> usize {
+        match self.receive_policy {
+            ReceivePolicy::Sequential => 0,
+            ReceivePolicy::RoundRobin => self.round_robin_cursor.get(),
+            ReceivePolicy::OldestFirst => self.oldest_connection(),
+        }
+    }
+
+    fn number_of_chunks_served_from(&self, index: usize) -> usize {
+        match index == self.round_robin_cursor.get() {
+            true => self.served_from_cursor.get(),
+            false => 0,
+        }
+    }
+
+    fn max_chunks_from_connection(&self, connection: &Connection<Service>, index: usize) -> usize {
+        match self.receive_policy {
+            ReceivePolicy::Sequential => usize::MAX,
+            ReceivePolicy::RoundRobin => connection
+                .weight
+                .get()
+                .saturating_sub(self.number_of_chunks_served_from(index))
+                .max(1),
+            ReceivePolicy::OldestFirst => 1,
+        }
+    }
+
+    fn mark_connection_as_served(&self, index: usize, number_of_chunks: usize) {
+        if self.receive_policy == ReceivePolicy::RoundRobin {
+            let served = self.number_of_chunks_served_from(index) + number_of_chunks;
+            let weight = self.get(index).as_ref().map_or(1, |c| c.weight.get());
+
+            if served < weight {
+                self.round_robin_cursor.set(index);
+                self.served_from_cursor.set(served);
+            } else {
+                self.round_robin_cursor.set((index + 1) % self.len());
+                self.served_from_cursor.set(0);
             }
         }
     }
@@ -242,11 +481,15 @@ impl<Service: service::Service> Receiver<Service> {
             }
         }
 
-        for id in 0..self.len() {
+        let number_of_connections = self.len();
+        let first_connection = self.first_connection_to_visit();
+        for n in 0..number_of_connections {
+            let id = (first_connection + n) % number_of_connections;
             if let Some(ref mut connection) = &mut self.get_mut(id) {
                 if let Some((details, absolute_address)) =
                     self.receive_from_connection(connection)?
                 {
+                    self.mark_connection_as_served(id, 1);
                     return Ok(Some((details, absolute_address)));
                 }
             }
@@ -255,6 +498,96 @@ impl<Service: service::Service> Receiver<Service> {
         Ok(None)
     }
 
+    /// Acquires up to `max_number_of_samples` from all connections and hands every received
+    /// chunk to the provided callback. In contrast to calling [`Receiver::receive()`]
+    /// repeatedly, the connections are not rescanned from the beginning for every chunk.
+    /// With [`ReceivePolicy::Sequential`] every connection is drained before the next one is
+    /// visited, with [`ReceivePolicy::RoundRobin`] up to weight chunks are taken from every
+    /// connection per round and with [`ReceivePolicy::OldestFirst`] the oldest connection is
+    /// determined again for every chunk. Returns the number of chunks that were handed to the
+    /// callback.
+    pub(crate) fn receive_batch<F: FnMut(ChunkDetails<Service>, Chunk) -> CallbackProgression>(
+        &self,
+        max_number_of_samples: usize,
+        mut callback: F,
+    ) -> Result<usize, ReceiveError> {
+        let mut number_of_received_samples = 0;
+
+        let mut drain = |connection: &Arc<Connection<Service>>,
+                         max_samples_from_connection: usize|
+         -> Result<(usize, CallbackProgression), ReceiveError> {
+            let mut number_of_samples_from_connection = 0;
+            while number_of_received_samples < max_number_of_samples
+                && number_of_samples_from_connection < max_samples_from_connection
+            {
+                match self.receive_from_connection(connection)? {
+                    Some((details, chunk)) => {
+                        number_of_received_samples += 1;
+                        number_of_samples_from_connection += 1;
+                        if callback(details, chunk) == CallbackProgression::Stop {
+                            return Ok((
+                                number_of_samples_from_connection,
+                                CallbackProgression::Stop,
+                            ));
+                        }
+                    }
+                    None => break,
+                }
+            }
+
+            if number_of_received_samples == max_number_of_samples {
+                Ok((number_of_samples_from_connection, CallbackProgression::Stop))
+            } else {
+                Ok((
+                    number_of_samples_from_connection,
+                    CallbackProgression::Continue,
+                ))
+            }
+        };
+
+        if let Some(to_be_removed_connections) = &self.to_be_removed_connections {
+            let to_be_removed_connections = unsafe { &mut *to_be_removed_connections.get() };
+
+            while let Some(connection) = to_be_removed_connections.peek() {
+                let (_, progression) = drain(connection, usize::MAX)?;
+                if progression == CallbackProgression::Stop {
+                    return Ok(number_of_received_samples);
+                }
+                to_be_removed_connections.pop();
+            }
+        }
+
+        let number_of_connections = self.len();
+        loop {
+            let mut has_received_samples = false;
+            let first_connection = self.first_connection_to_visit();
+            for n in 0..number_of_connections {
+                let id = (first_connection + n) % number_of_connections;
+                if let Some(ref connection) = &self.get(id) {
+                    let (number_of_samples, progression) =
+                        drain(connection, self.max_chunks_from_connection(connection, id))?;
+                    if number_of_samples != 0 {
+                        has_received_samples = true;
+                        self.mark_connection_as_served(id, number_of_samples);
+                    }
+
+                    if progression == CallbackProgression::Stop {
+                        return Ok(number_of_received_samples);
+                    }
+
+                    // the next oldest chunk can be in any connection
+                    if number_of_samples != 0 && self.receive_policy == ReceivePolicy::OldestFirst {
+                        break;
+                    }
+                }
+            }
+
+            if !has_received_samples || self.receive_policy == ReceivePolicy::Sequential {
+                return Ok(number_of_received_samples);
+            }
+        }
+    }
+
     pub(crate) fn start_update_connection_cycle(&self) {
         self.tagger.next_cycle();
     }
@@ -13,17 +13,19 @@
 use core::alloc::Layout;
 use core::cell::UnsafeCell;
 use core::sync::atomic::Ordering;
+use core::time::Duration;
 
 extern crate alloc;
 use alloc::sync::Arc;
 
 use iceoryx2_bb_elementary::cyclic_tagger::*;
 use iceoryx2_bb_log::{error, fail, fatal_panic, warn};
+use iceoryx2_bb_posix::clock::Time;
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
 use iceoryx2_cal::shm_allocator::{AllocationError, PointerOffset, ShmAllocationError};
 use iceoryx2_cal::zero_copy_connection::{
-    ChannelId, ZeroCopyConnection, ZeroCopyConnectionBuilder, ZeroCopyCreationError,
-    ZeroCopySendError, ZeroCopySender,
+    ChannelFillLevel, ChannelId, MemoryResidency, ZeroCopyConnection, ZeroCopyConnectionBuilder,
+    ZeroCopyCreationError, ZeroCopySendError, ZeroCopySender,
 };
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
 
@@ -31,10 +33,13 @@ use crate::node::SharedNode;
 use crate::port::{DegradationAction, DegradationCallback, LoanError, SendError};
 use crate::prelude::UnableToDeliverStrategy;
 use crate::service::config_scheme::connection_config;
+use crate::service::dynamic_config::publish_subscribe::{PublisherCounters, StatisticsSlot};
 use crate::service::static_config::message_type_details::{MessageTypeDetails, TypeVariant};
 use crate::service::ServiceState;
+use crate::tracepoint::tracepoint;
 use crate::{service, service::naming_scheme::connection_name};
 
+use super::broadcast_ring::{BroadcastRingSender, WaitForConsumption};
 use super::chunk::ChunkMut;
 use super::data_segment::DataSegment;
 use super::segment_state::SegmentState;
@@ -86,6 +91,7 @@ impl<Service: service::Service> Connection<Service> {
                                 .max_supported_shared_memory_segments(this.max_number_of_segments)
                                 .number_of_channels(1)
                                 .timeout(this.shared_node.config().global.service.creation_timeout)
+                                .memory_residency(this.memory_residency)
                                 .create_sender(),
                         "{}.", msg);
 
@@ -116,9 +122,25 @@ pub(crate) struct Sender<Service: service::Service> {
     pub(crate) loan_counter: IoxAtomicUsize,
     pub(crate) unable_to_deliver_strategy: UnableToDeliverStrategy,
     pub(crate) message_type_details: MessageTypeDetails,
+    pub(crate) broadcast_ring: Option<BroadcastRingSender<Service>>,
+    pub(crate) memory_residency: MemoryResidency,
+    pub(crate) statistics_slot: StatisticsSlot,
 }
 
 impl<Service: service::Service> Sender<Service> {
+    #[inline(always)]
+    fn count<F: FnOnce(&PublisherCounters)>(&self, count_call: F) {
+        if let Some(index) = self.statistics_slot.get() {
+            count_call(
+                self.service_state
+                    .dynamic_storage
+                    .get()
+                    .publish_subscribe()
+                    .publisher_counters(index),
+            );
+        }
+    }
+
     fn get(&self, index: usize) -> &Option<Connection<Service>> {
         unsafe { &(*self.connections[index].get()) }
     }
@@ -137,26 +159,101 @@ impl<Service: service::Service> Sender<Service> {
         offset: PointerOffset,
         sample_size: usize,
     ) -> Result<usize, SendError> {
+        self.deliver_offset_impl(offset, sample_size, None, None)
+    }
+
+    /// Delivers the offset like [`Sender::deliver_offset()`] but waits, independent of the
+    /// [`UnableToDeliverStrategy`], at most `timeout` in total for receivers with a full
+    /// buffer. Receivers whose buffer is still full afterwards do not get the sample.
+    pub(crate) fn deliver_offset_with_timeout(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        timeout: Duration,
+    ) -> Result<usize, SendError> {
+        self.deliver_offset_impl(offset, sample_size, Some(timeout), None)
+    }
+
+    /// Delivers the offset like [`Sender::deliver_offset()`] or, when a timeout is provided,
+    /// like [`Sender::deliver_offset_with_timeout()`] and calls `activated_receiver` with the
+    /// connection index of every receiver whose buffer was empty before the offset was
+    /// delivered.
+    pub(crate) fn deliver_offset_and_report_activated_receivers(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        timeout: Option<Duration>,
+        activated_receiver: &mut dyn FnMut(usize),
+    ) -> Result<usize, SendError> {
+        self.deliver_offset_impl(offset, sample_size, timeout, Some(activated_receiver))
+    }
+
+    fn deliver_offset_impl(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        timeout: Option<Duration>,
+        mut activated_receiver: Option<&mut dyn FnMut(usize)>,
+    ) -> Result<usize, SendError> {
+        tracepoint!(
+            deliver,
+            crate::tracepoint::id_hi(self.sender_port_id),
+            crate::tracepoint::id_lo(self.sender_port_id),
+            offset.as_value(),
+            sample_size
+        );
         self.retrieve_returned_samples();
-        let deliver_call = match self.unable_to_deliver_strategy {
-            UnableToDeliverStrategy::Block => {
-                <Service::Connection as ZeroCopyConnection>::Sender::blocking_send
+        self.count(|c| c.count_sent_sample());
+        if let Some(ref broadcast_ring) = self.broadcast_ring {
+            let number_of_recipients =
+                self.deliver_offset_to_broadcast_ring(broadcast_ring, offset, timeout);
+            if let Some(activated_receiver) = activated_receiver {
+                if number_of_recipients != 0 {
+                    broadcast_ring.for_each_activated_receiver(activated_receiver);
+                }
             }
-            UnableToDeliverStrategy::DiscardSample => {
-                <Service::Connection as ZeroCopyConnection>::Sender::try_send
+            return Ok(number_of_recipients);
+        }
+
+        let start = timeout.map(|_| Time::now());
+        let deliver_call = |sender: &<Service::Connection as ZeroCopyConnection>::Sender| {
+            let channel_id = ChannelId::new(0);
+            match timeout {
+                Some(timeout) => {
+                    let elapsed = match start {
+                        Some(Ok(ref start)) => start.elapsed().unwrap_or(timeout),
+                        _ => timeout,
+                    };
+                    sender.timed_send(
+                        offset,
+                        sample_size,
+                        channel_id,
+                        timeout.saturating_sub(elapsed),
+                    )
+                }
+                None => match self.unable_to_deliver_strategy {
+                    UnableToDeliverStrategy::Block => {
+                        sender.blocking_send(offset, sample_size, channel_id)
+                    }
+                    UnableToDeliverStrategy::DiscardSample => {
+                        sender.try_send(offset, sample_size, channel_id)
+                    }
+                },
             }
         };
 
         let mut number_of_recipients = 0;
         for i in 0..self.len() {
             if let Some(ref connection) = self.get(i) {
-                match deliver_call(&connection.sender, offset, sample_size, ChannelId::new(0)) {
+                match deliver_call(&connection.sender) {
                     Err(ZeroCopySendError::ReceiveBufferFull)
                     | Err(ZeroCopySendError::UsedChunkListFull) => {
                         /* causes no problem
                          *   blocking_send => can never happen
+                         *   timed_send => the receiver did not free space in time
                          *   try_send => we tried and expect that the buffer is full
                          * */
+                        self.count(|c| c.count_failed_delivery());
                     }
                     Err(ZeroCopySendError::ConnectionCorrupted) => match &self.degradation_callback
                     {
@@ -187,8 +284,21 @@ impl<Service: service::Service> Sender<Service> {
                         self.borrow_sample(offset);
                         number_of_recipients += 1;
 
-                        if let Some(old) = overflow {
-                            self.release_sample(old)
+                        match overflow {
+                            Some(old) => {
+                                self.count(|c| c.count_overflowed_sample());
+                                self.release_sample(old)
+                            }
+                            None => {
+                                if let Some(ref mut activated_receiver) = activated_receiver {
+                                    if connection
+                                        .sender
+                                        .is_receiver_activated_by_last_send(ChannelId::new(0))
+                                    {
+                                        activated_receiver(i);
+                                    }
+                                }
+                            }
                         }
                     }
                 }
@@ -197,6 +307,41 @@ impl<Service: service::Service> Sender<Service> {
         Ok(number_of_recipients)
     }
 
+    fn deliver_offset_to_broadcast_ring(
+        &self,
+        broadcast_ring: &BroadcastRingSender<Service>,
+        offset: PointerOffset,
+        timeout: Option<Duration>,
+    ) -> usize {
+        let wait = match timeout {
+            Some(timeout) => WaitForConsumption::AtMost(timeout),
+            None => match self.unable_to_deliver_strategy {
+                UnableToDeliverStrategy::Block => WaitForConsumption::Forever,
+                UnableToDeliverStrategy::DiscardSample => WaitForConsumption::DoNotWait,
+            },
+        };
+
+        if broadcast_ring.push(
+            offset,
+            self.sample_reference_counter_index(offset),
+            self.enable_safe_overflow,
+            wait,
+            |recycled_offset| self.release_sample(recycled_offset),
+        ) {
+            self.borrow_sample(offset);
+            broadcast_ring.number_of_receivers()
+        } else {
+            self.count(|c| c.count_failed_delivery());
+            0
+        }
+    }
+
+    fn sample_reference_counter_index(&self, offset: PointerOffset) -> usize {
+        let segment_id = offset.segment_id().value() as usize;
+        segment_id * self.number_of_samples
+            + self.segment_states[segment_id].sample_index(offset.offset())
+    }
+
     pub(crate) fn return_loaned_sample(&self, distance_to_chunk: PointerOffset) {
         self.release_sample(distance_to_chunk);
         self.loan_counter.fetch_sub(1, Ordering::Relaxed);
@@ -222,11 +367,28 @@ impl<Service: service::Service> Sender<Service> {
         self.connections.len()
     }
 
+    /// Returns the port id of every connected receiver together with the [`ChannelFillLevel`]
+    /// of its connection. The connections of a [`BroadcastRingSender`] have no queues and are
+    /// therefore not listed.
+    pub(crate) fn connection_fill_levels(
+        &self,
+    ) -> impl Iterator<Item = (u128, ChannelFillLevel)> + '_ {
+        (0..self.len()).filter_map(|i| {
+            self.get(i).as_ref().map(|connection| {
+                (
+                    connection.receiver_port_id,
+                    connection.sender.fill_level(ChannelId::new(0)),
+                )
+            })
+        })
+    }
+
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
         self.retrieve_returned_samples();
         let msg = "Unable to allocate data";
 
         if self.loan_counter.load(Ordering::Relaxed) >= self.sender_max_borrowed_samples {
+            self.count(|c| c.count_exceeded_max_loans());
             fail!(from self, with LoanError::ExceedsMaxLoans,
                 "{} {:?} since already {} samples were loaned and it would exceed the maximum of parallel loans of {}. Release or send a loaned sample to loan another sample.",
                 msg, layout, self.loan_counter.load(Ordering::Relaxed), self.sender_max_borrowed_samples);
@@ -274,6 +436,10 @@ impl<Service: service::Service> Sender<Service> {
     }
 
     pub(crate) fn retrieve_returned_samples(&self) {
+        if let Some(ref broadcast_ring) = self.broadcast_ring {
+            broadcast_ring.retrieve_returned_samples(|offset| self.release_sample(offset));
+        }
+
         for i in 0..self.len() {
             if let Some(ref connection) = self.get(i) {
                 loop {
@@ -317,6 +483,9 @@ impl<Service: service::Service> Sender<Service> {
 
     pub(crate) fn start_update_connection_cycle(&self) {
         self.tagger.next_cycle();
+        if let Some(ref broadcast_ring) = self.broadcast_ring {
+            broadcast_ring.start_update_connection_cycle();
+        }
     }
 
     pub(crate) fn update_connection<E: Fn(&Connection<Service>)>(
@@ -325,6 +494,12 @@ impl<Service: service::Service> Sender<Service> {
         receiver_details: ReceiverDetails,
         establish_new_connection_call: E,
     ) -> Result<(), ZeroCopyCreationError> {
+        // the receivers read directly from the broadcast ring, no connection is required
+        if let Some(ref broadcast_ring) = self.broadcast_ring {
+            broadcast_ring.update_connection(index, receiver_details.port_id);
+            return Ok(());
+        }
+
         let create_connection = match self.get(index) {
             None => true,
             Some(connection) => {
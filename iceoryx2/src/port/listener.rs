@@ -71,6 +71,7 @@ use crate::service::config_scheme::event_config;
 use crate::service::dynamic_config::event::ListenerDetails;
 use crate::service::naming_scheme::event_concept_name;
 use crate::service::ServiceState;
+use crate::wait_policy::{WaitPolicy, WaitStatistics, WaitStatisticsCounter};
 use crate::{port::port_identifiers::UniqueListenerId, service};
 use core::sync::atomic::Ordering;
 use core::time::Duration;
@@ -108,6 +109,8 @@ pub struct Listener<Service: service::Service> {
     listener: <Service::Event as iceoryx2_cal::event::Event>::Listener,
     service_state: Arc<ServiceState<Service>>,
     listener_id: UniqueListenerId,
+    wait_policy: WaitPolicy,
+    wait_statistics: WaitStatisticsCounter,
 }
 
 impl<Service: service::Service> FileDescriptorBased for Listener<Service>
@@ -137,7 +140,10 @@ impl<Service: service::Service> Drop for Listener<Service> {
 }
 
 impl<Service: service::Service> Listener<Service> {
-    pub(crate) fn new(service: &Service) -> Result<Self, ListenerCreateError> {
+    pub(crate) fn new(
+        service: &Service,
+        wait_policy: WaitPolicy,
+    ) -> Result<Self, ListenerCreateError> {
         let msg = "Failed to create listener";
         let origin = "Listener::new()";
         let listener_id = UniqueListenerId::new();
@@ -157,6 +163,8 @@ impl<Service: service::Service> Listener<Service> {
             dynamic_listener_handle: None,
             listener,
             listener_id,
+            wait_policy,
+            wait_statistics: WaitStatisticsCounter::default(),
         };
 
         core::sync::atomic::compiler_fence(Ordering::SeqCst);
@@ -206,13 +214,13 @@ impl<Service: service::Service> Listener<Service> {
     /// Blocking wait for new [`EventId`]s until the provided timeout has passed. Unblocks as soon
     /// as an [`EventId`] was received and then collects all [`EventId`]s that were received and
     /// calls the provided callback is with the [`EventId`] as input argument.
+    /// The wait is performed according to the [`WaitPolicy`] of the [`Listener`].
     pub fn timed_wait_all<F: FnMut(EventId)>(
         &self,
         callback: F,
         timeout: Duration,
     ) -> Result<(), ListenerWaitError> {
-        use iceoryx2_cal::event::Listener;
-        fail!(from self, when self.listener.timed_wait_all(callback, timeout),
+        fail!(from self, when self.wait_all_with_policy(callback, timeout),
             "Failed to while calling timed_wait({:?}) on underlying event::Listener", timeout);
         Ok(())
     }
@@ -220,12 +228,12 @@ impl<Service: service::Service> Listener<Service> {
     /// Blocking wait for new [`EventId`]s. Unblocks as soon
     /// as an [`EventId`] was received and then collects all [`EventId`]s that were received and
     /// calls the provided callback is with the [`EventId`] as input argument.
+    /// The wait is performed according to the [`WaitPolicy`] of the [`Listener`].
     pub fn blocking_wait_all<F: FnMut(EventId)>(
         &self,
         callback: F,
     ) -> Result<(), ListenerWaitError> {
-        use iceoryx2_cal::event::Listener;
-        fail!(from self, when self.listener.blocking_wait_all(callback),
+        fail!(from self, when self.wait_all_with_policy(callback, Duration::MAX),
             "Failed to while calling blocking_wait on underlying event::Listener");
         Ok(())
     }
@@ -243,9 +251,9 @@ impl<Service: service::Service> Listener<Service> {
     /// has passed. If no [`EventId`] was notified it returns [`None`].
     /// On error it returns [`ListenerWaitError`] is returned which describes the error
     /// in detail.
+    /// The wait is performed according to the [`WaitPolicy`] of the [`Listener`].
     pub fn timed_wait_one(&self, timeout: Duration) -> Result<Option<EventId>, ListenerWaitError> {
-        use iceoryx2_cal::event::Listener;
-        Ok(fail!(from self, when self.listener.timed_wait_one(timeout),
+        Ok(fail!(from self, when self.wait_one_with_policy(timeout),
             "Failed to while calling timed_wait({:?}) on underlying event::Listener", timeout))
     }
 
@@ -253,16 +261,77 @@ impl<Service: service::Service> Listener<Service> {
     /// Sporadic wakeups can occur and if no [`EventId`] was notified it returns [`None`].
     /// On error it returns [`ListenerWaitError`] is returned which describes the error
     /// in detail.
+    /// The wait is performed according to the [`WaitPolicy`] of the [`Listener`].
     pub fn blocking_wait_one(&self) -> Result<Option<EventId>, ListenerWaitError> {
-        use iceoryx2_cal::event::Listener;
-        Ok(fail!(from self, when self.listener.blocking_wait_one(),
-            "Failed to while calling blocking_wait on underlying event::Listener"))
+        Ok(
+            fail!(from self, when self.wait_one_with_policy(Duration::MAX),
+            "Failed to while calling blocking_wait on underlying event::Listener"),
+        )
     }
 
     /// Returns the [`UniqueListenerId`] of the [`Listener`]
     pub fn id(&self) -> UniqueListenerId {
         self.listener_id
     }
+
+    /// Returns the [`WaitPolicy`] with which the [`Listener`] was created.
+    pub fn wait_policy(&self) -> WaitPolicy {
+        self.wait_policy
+    }
+
+    /// Returns how often the blocking and timed waits were resolved in which phase of the
+    /// [`WaitPolicy`].
+    pub fn wait_statistics(&self) -> WaitStatistics {
+        self.wait_statistics.load()
+    }
+
+    fn wait_one_with_policy(
+        &self,
+        timeout: Duration,
+    ) -> Result<Option<EventId>, ListenerWaitError> {
+        use iceoryx2_cal::event::Listener;
+        self.wait_policy
+            .wait(&self.wait_statistics, timeout, |timeout| {
+                if timeout.is_zero() {
+                    self.listener.try_wait_one()
+                } else if timeout == Duration::MAX {
+                    self.listener.blocking_wait_one()
+                } else {
+                    self.listener.timed_wait_one(timeout)
+                }
+            })
+    }
+
+    fn wait_all_with_policy<F: FnMut(EventId)>(
+        &self,
+        mut callback: F,
+        timeout: Duration,
+    ) -> Result<(), ListenerWaitError> {
+        use iceoryx2_cal::event::Listener;
+        self.wait_policy
+            .wait(
+                &self.wait_statistics,
+                timeout,
+                |timeout| -> Result<Option<()>, ListenerWaitError> {
+                    let mut number_of_events = 0;
+                    let counting_callback = |id| {
+                        number_of_events += 1;
+                        callback(id)
+                    };
+
+                    if timeout.is_zero() {
+                        self.listener.try_wait_all(counting_callback)?;
+                    } else if timeout == Duration::MAX {
+                        self.listener.blocking_wait_all(counting_callback)?;
+                    } else {
+                        self.listener.timed_wait_all(counting_callback, timeout)?;
+                    }
+
+                    Ok((number_of_events > 0).then_some(()))
+                },
+            )
+            .map(|_| ())
+    }
 }
 
 pub(crate) unsafe fn remove_connection_of_listener<Service: service::Service>(
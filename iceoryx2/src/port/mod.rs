@@ -19,16 +19,22 @@ pub(crate) mod details;
 
 /// Sends requests to a [`Server`](crate::port::server::Server) and receives responses.
 pub mod client;
+/// Defines how a publisher delivers its samples to the connected subscribers.
+pub mod connection_backend;
 /// Defines the event id used to identify the source of an event.
 pub mod event_id;
 /// Receiving endpoint (port) for event based communication
 pub mod listener;
 /// Sending endpoint (port) for event based communication
 pub mod notifier;
+/// Defines how a publisher manages the memory of its samples.
+pub mod payload_allocator;
 /// Defines port specific unique ids. Used to identify source/destination while communicating.
 pub mod port_identifiers;
 /// Sending endpoint (port) for publish-subscribe based communication
 pub mod publisher;
+/// Defines the order in which a receiver acquires data from multiple senders.
+pub mod receive_policy;
 /// Receives requests from a [`Client`](crate::port::client::Client) port and sends back responses.
 pub mod server;
 /// Receiving endpoint (port) for publish-subscribe based communication
@@ -37,6 +37,7 @@
 
 use super::{event_id::EventId, port_identifiers::UniqueListenerId};
 use crate::{
+    node::NodeId,
     port::port_identifiers::UniqueNotifierId,
     service::{
         self,
@@ -45,6 +46,7 @@ use crate::{
         naming_scheme::event_concept_name,
         ServiceState,
     },
+    tracepoint::tracepoint,
 };
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
@@ -104,6 +106,7 @@ impl core::error::Error for NotifierNotifyError {}
 struct Connection<Service: service::Service> {
     notifier: <Service::Event as Event>::Notifier,
     listener_id: UniqueListenerId,
+    node_id: NodeId,
 }
 
 #[derive(Debug)]
@@ -128,9 +131,9 @@ impl<Service: service::Service> ListenerConnections<Service> {
         new_self
     }
 
-    fn create(&self, index: usize, listener_id: UniqueListenerId) {
+    fn create(&self, index: usize, details: &ListenerDetails) {
         let msg = "Unable to establish connection to listener";
-        let event_name = event_concept_name(&listener_id);
+        let event_name = event_concept_name(&details.listener_id);
         let event_config = event_config::<Service>(self.service_state.shared_node.config());
         if self.get(index).is_none() {
             match <Service::Event as iceoryx2_cal::event::Event>::NotifierBuilder::new(&event_name)
@@ -140,7 +143,8 @@ impl<Service: service::Service> ListenerConnections<Service> {
                 Ok(notifier) => {
                     *self.get_mut(index) = Some(Connection {
                         notifier,
-                        listener_id,
+                        listener_id: details.listener_id,
+                        node_id: details.node_id,
                     });
                 }
                 Err(
@@ -340,7 +344,7 @@ impl<Service: service::Service> Notifier<Service> {
                     };
 
                     if create_connection {
-                        self.listener_connections.create(i, details.listener_id);
+                        self.listener_connections.create(i, details);
                     }
                 }
                 None => self.listener_connections.remove(i),
@@ -380,6 +384,23 @@ impl<Service: service::Service> Notifier<Service> {
     pub fn notify_with_custom_event_id(
         &self,
         value: EventId,
+    ) -> Result<usize, NotifierNotifyError> {
+        self.notify_listeners(value, |_| true)
+    }
+
+    /// Notifies only the [`crate::port::listener::Listener`]s that were created by one of the
+    /// provided [`Node`](crate::node::Node)s with the default event id provided on creation.
+    pub(crate) fn notify_listeners_of_nodes(
+        &self,
+        node_ids: &[NodeId],
+    ) -> Result<usize, NotifierNotifyError> {
+        self.notify_listeners(self.default_event_id, |node_id| node_ids.contains(node_id))
+    }
+
+    fn notify_listeners<F: Fn(&NodeId) -> bool>(
+        &self,
+        value: EventId,
+        is_recipient: F,
     ) -> Result<usize, NotifierNotifyError> {
         let msg = "Unable to notify event";
         self.update_connections();
@@ -393,8 +414,19 @@ impl<Service: service::Service> Notifier<Service> {
                             msg, value, self.event_id_max_value);
         }
 
+        tracepoint!(
+            notify,
+            crate::tracepoint::id_hi(self.notifier_id.value()),
+            crate::tracepoint::id_lo(self.notifier_id.value()),
+            value.as_value()
+        );
+
         for i in 0..self.listener_connections.len() {
             if let Some(ref connection) = self.listener_connections.get(i) {
+                if !is_recipient(&connection.node_id) {
+                    continue;
+                }
+
                 match connection.notifier.notify(value) {
                     Err(iceoryx2_cal::event::NotifierNotifyError::Disconnected) => {
                         self.listener_connections.remove(i);
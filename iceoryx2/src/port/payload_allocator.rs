@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+/// Defines how the data segment of a [`Publisher`](crate::port::publisher::Publisher)
+/// manages the memory of the loaned [`SampleMut`](crate::sample_mut::SampleMut)s.
+#[derive(Debug, Default, Eq, Hash, PartialEq, Clone, Copy)]
+pub enum PayloadAllocator {
+    /// Every [`SampleMut`](crate::sample_mut::SampleMut) occupies a bucket that is sized for
+    /// the largest slice, independent of the actually loaned slice length. Allocations never
+    /// fragment the memory.
+    #[default]
+    Pool,
+    /// Every [`SampleMut`](crate::sample_mut::SampleMut) occupies a block that is rounded up to
+    /// the next power of two of its size. Small slices use only a fraction of the memory a
+    /// bucket of the [`PayloadAllocator::Pool`] would occupy and slices up to the total size
+    /// of the data segment can be loaned without reallocating it. The data segment has the
+    /// size of the [`PayloadAllocator::Pool`] data segment, rounded up to a multiple of the
+    /// largest block, so samples of the max slice len may run out of memory earlier. It is never
+    /// resized, the
+    /// [`AllocationStrategy`](crate::prelude::AllocationStrategy) is therefore ignored.
+    Buddy,
+}
@@ -101,52 +101,87 @@
 //! # }
 //! ```
 
+use super::connection_backend::ConnectionBackend;
+use super::details::broadcast_ring::BroadcastRingSender;
 use super::details::data_segment::{DataSegment, DataSegmentType};
 use super::details::segment_state::SegmentState;
+use super::notifier::Notifier;
+use super::payload_allocator::PayloadAllocator;
 use super::port_identifiers::UniquePublisherId;
 use super::{LoanError, SendError, UniqueSubscriberId};
+use crate::node::NodeId;
 use crate::port::details::sender::*;
 use crate::port::update_connections::{ConnectionFailure, UpdateConnections};
 use crate::prelude::UnableToDeliverStrategy;
 use crate::raw_sample::RawSampleMut;
 use crate::sample_mut_uninit::SampleMutUninit;
 use crate::service::builder::publish_subscribe::CustomPayloadMarker;
-use crate::service::config_scheme::{connection_config, data_segment_config};
-use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, SubscriberDetails};
+use crate::service::config_scheme::{
+    broadcast_ring_config, buddy_data_segment_config, connection_config, data_segment_config,
+};
+use crate::service::dynamic_config::publish_subscribe::{
+    PublisherDetails, StatisticsSlot, SubscriberDetails,
+};
 use crate::service::header::publish_subscribe::Header;
 use crate::service::naming_scheme::{
-    data_segment_name, extract_publisher_id_from_connection, extract_subscriber_id_from_connection,
+    broadcast_ring_name, data_segment_name, extract_publisher_id_from_connection,
+    extract_subscriber_id_from_connection,
 };
 use crate::service::port_factory::publisher::LocalPublisherConfig;
 use crate::service::static_config::message_type_details::TypeVariant;
 use crate::service::static_config::publish_subscribe;
 use crate::service::{self, ServiceState};
+use crate::tracepoint::tracepoint;
 use crate::{config, sample_mut::SampleMut};
 use core::any::TypeId;
 use core::cell::UnsafeCell;
 use core::fmt::Debug;
 use core::sync::atomic::Ordering;
+use core::time::Duration;
 use core::{marker::PhantomData, mem::MaybeUninit};
 use iceoryx2_bb_container::queue::Queue;
 use iceoryx2_bb_elementary::cyclic_tagger::CyclicTagger;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_log::{debug, fail, warn};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
 use iceoryx2_cal::event::NamedConceptMgmt;
 use iceoryx2_cal::named_concept::{NamedConceptListError, NamedConceptRemoveError};
+use iceoryx2_cal::shared_memory::{PageSize, SharedMemory};
+use iceoryx2_cal::shm_allocator::buddy_allocator::BuddyAllocator;
+use iceoryx2_cal::shm_allocator::pool_allocator::PoolAllocator;
 use iceoryx2_cal::shm_allocator::{AllocationStrategy, PointerOffset};
 use iceoryx2_cal::zero_copy_connection::{
     ChannelId, ZeroCopyConnection, ZeroCopyCreationError, ZeroCopyPortDetails,
     ZeroCopyPortRemoveError, ZeroCopySender,
 };
-use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicUsize};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU64, IoxAtomicUsize};
 
 extern crate alloc;
 use alloc::sync::Arc;
 
+pub use iceoryx2_cal::zero_copy_connection::QueueFillLevel;
+
+/// Describes the backlog of the connection from a [`Publisher`] to a
+/// [`Subscriber`](crate::port::subscriber::Subscriber). The submission queue contains the
+/// samples the [`Subscriber`](crate::port::subscriber::Subscriber) did not yet receive, the
+/// completion queue the samples it released but the [`Publisher`] did not yet reclaim.
+/// A submission queue that stays close to its capacity indicates a slow consumer.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ConnectionStatistics {
+    /// The [`UniquePublisherId`] of the sending side of the connection.
+    pub publisher_id: UniquePublisherId,
+    /// The [`UniqueSubscriberId`] of the receiving side of the connection.
+    pub subscriber_id: UniqueSubscriberId,
+    /// The fill level of the queue with the samples that were not yet received.
+    pub submission_queue: QueueFillLevel,
+    /// The fill level of the queue with the samples that were released but not yet reclaimed.
+    pub completion_queue: QueueFillLevel,
+}
+
 /// Defines a failure that can occur when a [`Publisher`] is created with
 /// [`crate::service::port_factory::publisher::PortFactoryPublisher`].
 #[derive(Debug, PartialEq, Eq, Copy, Clone)]
@@ -158,6 +193,9 @@ pub enum PublisherCreateError {
     ExceedsMaxSupportedPublishers,
     /// The datasegment in which the payload of the [`Publisher`] is stored, could not be created.
     UnableToCreateDataSegment,
+    /// The requested [`MemoryResidency`](crate::prelude::MemoryResidency) could not be applied to the dynamic service config,
+    /// for instance because the lockable memory limit of the process is exceeded.
+    UnableToApplyMemoryResidency,
 }
 
 impl core::fmt::Display for PublisherCreateError {
@@ -189,8 +227,12 @@ pub(crate) struct PublisherBackend<Service: service::Service> {
 
     pub(crate) sender: Sender<Service>,
     subscriber_list_state: UnsafeCell<ContainerState<SubscriberDetails>>,
+    subscriber_nodes: UnsafeCell<Vec<Option<NodeId>>>,
+    activated_nodes: UnsafeCell<Vec<NodeId>>,
     history: Option<UnsafeCell<Queue<OffsetAndSize>>>,
     is_active: IoxAtomicBool,
+    enable_send_tracking: bool,
+    next_sequence_number: IoxAtomicU64,
 }
 
 impl<Service: service::Service> PublisherBackend<Service> {
@@ -215,9 +257,12 @@ impl<Service: service::Service> PublisherBackend<Service> {
 
     fn force_update_connections(&self) -> Result<(), ZeroCopyCreationError> {
         let mut result = Ok(());
+        let subscriber_nodes = unsafe { &mut *self.subscriber_nodes.get() };
+        subscriber_nodes.fill(None);
         self.sender.start_update_connection_cycle();
         unsafe {
             (*self.subscriber_list_state.get()).for_each(|h, port| {
+                subscriber_nodes[h.index() as usize] = Some(port.node_id);
                 let inner_result = self.sender.update_connection(
                     h.index() as usize,
                     ReceiverDetails {
@@ -291,8 +336,11 @@ impl<Service: service::Service> PublisherBackend<Service> {
 
     pub(crate) fn send_sample(
         &self,
+        header: &mut Header,
         offset: PointerOffset,
         sample_size: usize,
+        timeout: Option<Duration>,
+        notifier: Option<&Notifier<Service>>,
     ) -> Result<usize, SendError> {
         let msg = "Unable to send sample";
         if !self.is_active.load(Ordering::Relaxed) {
@@ -303,8 +351,68 @@ impl<Service: service::Service> PublisherBackend<Service> {
         fail!(from self, when self.update_connections(),
             "{} since the connections could not be updated.", msg);
 
+        if self.enable_send_tracking {
+            let send_timestamp = match Time::now_with_clock(ClockType::Monotonic) {
+                Ok(now) => now.as_duration(),
+                Err(e) => {
+                    warn!(from self, "Unable to acquire the send timestamp ({:?}), the sample is sent with a zero timestamp.", e);
+                    Duration::ZERO
+                }
+            };
+
+            header.set_send_tracking(
+                self.next_sequence_number.fetch_add(1, Ordering::Relaxed),
+                send_timestamp,
+            );
+        }
+
         self.add_sample_to_history(offset, sample_size);
-        self.sender.deliver_offset(offset, sample_size)
+        match (notifier, timeout) {
+            (Some(notifier), _) => {
+                self.deliver_sample_and_notify(offset, sample_size, timeout, notifier)
+            }
+            (None, Some(timeout)) => {
+                self.sender
+                    .deliver_offset_with_timeout(offset, sample_size, timeout)
+            }
+            (None, None) => self.sender.deliver_offset(offset, sample_size),
+        }
+    }
+
+    /// Delivers the sample and notifies the listeners of the nodes whose subscribers had an
+    /// empty buffer before the sample arrived. Subscribers that still have unconsumed samples
+    /// were already notified and will find the sample anyway.
+    fn deliver_sample_and_notify(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        timeout: Option<Duration>,
+        notifier: &Notifier<Service>,
+    ) -> Result<usize, SendError> {
+        let subscriber_nodes = unsafe { &*self.subscriber_nodes.get() };
+        let activated_nodes = unsafe { &mut *self.activated_nodes.get() };
+        activated_nodes.clear();
+
+        let number_of_recipients = self.sender.deliver_offset_and_report_activated_receivers(
+            offset,
+            sample_size,
+            timeout,
+            &mut |index| {
+                if let Some(node_id) = subscriber_nodes[index] {
+                    if !activated_nodes.contains(&node_id) {
+                        activated_nodes.push(node_id);
+                    }
+                }
+            },
+        )?;
+
+        if !activated_nodes.is_empty() {
+            if let Err(e) = notifier.notify_listeners_of_nodes(activated_nodes) {
+                warn!(from self, "The sample was delivered but the subscribers could not be notified ({:?}).", e);
+            }
+        }
+
+        Ok(number_of_recipients)
     }
 }
 
@@ -326,6 +434,9 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug> Drop
 {
     fn drop(&mut self) {
         if let Some(handle) = self.dynamic_publisher_handle {
+            // samples that outlive the publisher must not count for a publisher that
+            // reuses the slot
+            self.backend.sender.statistics_slot.unassign();
             self.backend
                 .service_state
                 .dynamic_storage
@@ -363,8 +474,12 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         }
         .required_amount_of_samples_per_data_segment(config.max_loaned_samples);
 
-        let data_segment_type =
-            DataSegmentType::new_from_allocation_strategy(config.allocation_strategy);
+        let data_segment_type = match config.payload_allocator {
+            PayloadAllocator::Pool => {
+                DataSegmentType::new_from_allocation_strategy(config.allocation_strategy)
+            }
+            PayloadAllocator::Buddy => DataSegmentType::Buddy,
+        };
 
         let sample_layout = static_config
             .message_type_details
@@ -373,23 +488,17 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         let max_slice_len = config.initial_max_slice_len;
         let max_number_of_segments =
             DataSegment::<Service>::max_number_of_segments(data_segment_type);
-        let publisher_details = PublisherDetails {
-            data_segment_type,
-            publisher_id: port_id,
-            number_of_samples,
-            max_slice_len,
-            node_id: *service.__internal_state().shared_node.id(),
-            max_number_of_segments,
-        };
         let global_config = service.__internal_state().shared_node.config();
 
-        let segment_name = data_segment_name(publisher_details.publisher_id.value());
+        let segment_name = data_segment_name(port_id.value());
         let data_segment = match data_segment_type {
             DataSegmentType::Static => DataSegment::create_static_segment(
                 &segment_name,
                 sample_layout,
                 global_config,
                 number_of_samples,
+                config.page_size,
+                config.memory_residency,
             ),
             DataSegmentType::Dynamic => DataSegment::create_dynamic_segment(
                 &segment_name,
@@ -397,6 +506,17 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
                 global_config,
                 number_of_samples,
                 config.allocation_strategy,
+                config.page_size,
+                config.memory_residency,
+            ),
+            DataSegmentType::Buddy => DataSegment::create_buddy_segment(
+                &segment_name,
+                static_config.message_type_details.sample_layout(1),
+                sample_layout,
+                global_config,
+                number_of_samples,
+                config.page_size,
+                config.memory_residency,
             ),
         };
 
@@ -405,6 +525,37 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
                 with PublisherCreateError::UnableToCreateDataSegment,
                 "{} since the data segment could not be acquired.", msg);
 
+        let number_of_samples = data_segment.number_of_samples_per_segment(number_of_samples);
+        let publisher_details = PublisherDetails {
+            data_segment_type,
+            publisher_id: port_id,
+            number_of_samples,
+            max_slice_len,
+            node_id: *service.__internal_state().shared_node.id(),
+            max_number_of_segments,
+            page_size: data_segment.page_size(),
+        };
+
+        fail!(from origin,
+            when service.__internal_state().dynamic_storage.apply_memory_residency(config.memory_residency),
+            with PublisherCreateError::UnableToApplyMemoryResidency,
+            "{} since the memory residency {:?} could not be applied to the dynamic service config.",
+            msg, config.memory_residency);
+
+        let broadcast_ring = match static_config.connection_backend {
+            ConnectionBackend::SubscriberQueues => None,
+            ConnectionBackend::BroadcastRing => Some(fail!(from origin,
+                when BroadcastRingSender::create(
+                    &broadcast_ring_name(port_id.value()),
+                    global_config,
+                    static_config.subscriber_max_buffer_size,
+                    subscriber_list.capacity(),
+                    number_of_samples * max_number_of_segments as usize,
+                    config.memory_residency),
+                with PublisherCreateError::UnableToCreateDataSegment,
+                "{} since the broadcast ring could not be created.", msg)),
+        };
+
         let backend = Arc::new(PublisherBackend {
             is_active: IoxAtomicBool::new(true),
             service_state: service.__internal_state().clone(),
@@ -435,13 +586,23 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
                 sender_max_borrowed_samples: config.max_loaned_samples,
                 unable_to_deliver_strategy: config.unable_to_deliver_strategy,
                 message_type_details: static_config.message_type_details.clone(),
+                broadcast_ring,
+                memory_residency: config.memory_residency,
+                statistics_slot: StatisticsSlot::unassigned(),
             },
             config,
             subscriber_list_state: UnsafeCell::new(unsafe { subscriber_list.get_state() }),
-            history: match static_config.history_size == 0 {
+            subscriber_nodes: UnsafeCell::new(vec![None; subscriber_list.capacity()]),
+            activated_nodes: UnsafeCell::new(Vec::with_capacity(subscriber_list.capacity())),
+            // with a broadcast ring the ring itself contains the history
+            history: match static_config.history_size == 0
+                || static_config.connection_backend == ConnectionBackend::BroadcastRing
+            {
                 true => None,
                 false => Some(UnsafeCell::new(Queue::new(static_config.history_size))),
             },
+            enable_send_tracking: static_config.enable_send_tracking,
+            next_sequence_number: IoxAtomicU64::new(0),
         });
 
         let mut new_self = Self {
@@ -475,6 +636,11 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         };
 
         new_self.dynamic_publisher_handle = Some(dynamic_publisher_handle);
+        new_self
+            .backend
+            .sender
+            .statistics_slot
+            .assign(dynamic_publisher_handle);
 
         Ok(new_self)
     }
@@ -484,6 +650,43 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         UniquePublisherId(UniqueSystemId::from(self.backend.sender.sender_port_id))
     }
 
+    /// Returns the [`ConnectionStatistics`] of every connected
+    /// [`Subscriber`](crate::port::subscriber::Subscriber). Services with the
+    /// [`ConnectionBackend::BroadcastRing`] have no per subscriber queues and therefore do
+    /// not provide any [`ConnectionStatistics`].
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .open_or_create()?;
+    /// let publisher = service.publisher_builder().create()?;
+    /// for connection in publisher.connection_stats() {
+    ///     if connection.submission_queue.len == connection.submission_queue.capacity {
+    ///         println!("subscriber {:?} falls behind", connection.subscriber_id);
+    ///     }
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn connection_stats(&self) -> impl Iterator<Item = ConnectionStatistics> + '_ {
+        let publisher_id = self.id();
+        self.backend
+            .sender
+            .connection_fill_levels()
+            .map(
+                move |(subscriber_port_id, fill_level)| ConnectionStatistics {
+                    publisher_id,
+                    subscriber_id: UniqueSubscriberId(UniqueSystemId::from(subscriber_port_id)),
+                    submission_queue: fill_level.submission_queue,
+                    completion_queue: fill_level.completion_queue,
+                },
+            )
+    }
+
     /// Returns the strategy the [`Publisher`] follows when a [`SampleMut`] cannot be delivered
     /// since the [`Subscriber`](crate::port::subscriber::Subscriber)s buffer is full.
     pub fn unable_to_deliver_strategy(&self) -> UnableToDeliverStrategy {
@@ -494,6 +697,20 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
     pub fn initial_max_slice_len(&self) -> usize {
         self.backend.config.initial_max_slice_len
     }
+
+    /// Returns the [`PayloadAllocator`] that manages the data segment of the [`Publisher`].
+    pub fn payload_allocator(&self) -> PayloadAllocator {
+        self.backend.config.payload_allocator
+    }
+
+    /// Returns the [`PageSize`] of the pages that back the data segment of the [`Publisher`].
+    /// When huge pages were requested with
+    /// [`PortFactoryPublisher::page_size()`](crate::service::port_factory::publisher::PortFactoryPublisher::page_size())
+    /// but are not available on the system, the [`Publisher`] falls back to
+    /// [`PageSize::Default`].
+    pub fn page_size(&self) -> PageSize {
+        self.backend.sender.data_segment.page_size()
+    }
 }
 
 ////////////////////////
@@ -532,6 +749,41 @@ impl<Service: service::Service, Payload: Debug + Sized, UserHeader: Debug>
         sample.write_payload(value).send()
     }
 
+    /// Copies the input `value` into a [`crate::sample_mut::SampleMut`] and delivers it like
+    /// [`Publisher::send_copy()`]. Subscribers with a full buffer are waited for at most
+    /// `timeout` in total, see [`SampleMut::send_with_timeout()`].
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use core::time::Duration;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .open_or_create()?;
+    /// #
+    /// # let publisher = service.publisher_builder()
+    ///                          .create()?;
+    ///
+    /// publisher.send_copy_with_timeout(1234, Duration::from_millis(10))?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_copy_with_timeout(
+        &self,
+        value: Payload,
+        timeout: Duration,
+    ) -> Result<usize, SendError> {
+        let msg = "Unable to send copy of payload with timeout";
+        let sample = fail!(from self, when self.loan_uninit(),
+                                    "{} since the loan of a sample failed.", msg);
+
+        sample.write_payload(value).send_with_timeout(timeout)
+    }
+
     /// Loans/allocates a [`SampleMutUninit`] from the underlying data segment of the [`Publisher`].
     /// The user has to initialize the payload before it can be sent.
     ///
@@ -713,7 +965,8 @@ impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
         underlying_number_of_slice_elements: usize,
     ) -> Result<SampleMutUninit<Service, [MaybeUninit<Payload>], UserHeader>, LoanError> {
         let max_slice_len = self.backend.config.initial_max_slice_len;
-        if self.backend.config.allocation_strategy == AllocationStrategy::Static
+        if self.backend.config.payload_allocator == PayloadAllocator::Pool
+            && self.backend.config.allocation_strategy == AllocationStrategy::Static
             && max_slice_len < slice_len
         {
             fail!(from self, with LoanError::ExceedsMaxLoanSize,
@@ -723,6 +976,13 @@ impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
 
         let sample_layout = self.backend.sender.sample_layout(slice_len);
         let chunk = self.backend.sender.allocate(sample_layout)?;
+        tracepoint!(
+            loan,
+            crate::tracepoint::id_hi(self.backend.sender.sender_port_id),
+            crate::tracepoint::id_lo(self.backend.sender.sender_port_id),
+            chunk.offset.as_value(),
+            chunk.size
+        );
         let header_ptr = chunk.header as *mut Header;
         unsafe { header_ptr.write(Header::new(self.id(), slice_len as _)) };
 
@@ -794,10 +1054,33 @@ pub(crate) unsafe fn remove_data_segment_of_publisher<Service: service::Service>
         port_id
     );
 
-    fail!(from origin, when <Service::SharedMemory as NamedConceptMgmt>::remove_cfg(
-            &data_segment_name(port_id.value()),
-            &data_segment_config::<Service>(config),
-        ), "Unable to remove the publishers data segment."
+    // the publisher details are no longer available, therefore the huge page backed data
+    // segments are removed as well but only when a hugetlbfs for the page size is mounted
+    for page_size in [PageSize::Default, PageSize::Huge2MiB, PageSize::Huge1GiB] {
+        if page_size != PageSize::Default && page_size.mount_point().is_none() {
+            continue;
+        }
+
+        fail!(from origin, when <Service::SharedMemory as SharedMemory<PoolAllocator>>::remove_with_page_size_cfg(
+                &data_segment_name(port_id.value()),
+                &data_segment_config::<Service>(config),
+                page_size,
+            ), "Unable to remove the publishers data segment with the page size {:?}.", page_size
+        );
+
+        fail!(from origin, when <Service::BuddySharedMemory as SharedMemory<BuddyAllocator>>::remove_with_page_size_cfg(
+                &data_segment_name(port_id.value()),
+                &buddy_data_segment_config::<Service>(config),
+                page_size,
+            ), "Unable to remove the publishers buddy data segment with the page size {:?}.", page_size
+        );
+    }
+
+    // the broadcast ring exists only when the service uses the corresponding connection backend
+    fail!(from origin, when <Service::BroadcastRing as NamedConceptMgmt>::remove_cfg(
+            &broadcast_ring_name(port_id.value()),
+            &broadcast_ring_config::<Service>(config),
+        ), "Unable to remove the publishers broadcast ring."
     );
 
     Ok(())
@@ -0,0 +1,39 @@
+// Copyright (c) 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+/// Defines the order in which a receiver acquires data from its connected senders.
+#[derive(Debug, Default, Eq, PartialEq, Clone, Copy)]
+pub enum ReceivePolicy {
+    /// Every receive call starts with the first connected
+    /// [`Publisher`](crate::port::publisher::Publisher) and moves on to the next one only
+    /// when the buffer of the current one is empty. A fast
+    /// [`Publisher`](crate::port::publisher::Publisher) can starve all the others when it
+    /// produces faster than the [`Subscriber`](crate::port::subscriber::Subscriber) consumes.
+    #[default]
+    Sequential,
+    /// Every receive call continues with the
+    /// [`Publisher`](crate::port::publisher::Publisher) that follows the one from which the
+    /// last [`Sample`](crate::sample::Sample) was received. Every connected
+    /// [`Publisher`](crate::port::publisher::Publisher) is served fairly, one
+    /// [`Sample`](crate::sample::Sample) at a time. With
+    /// [`Subscriber::set_publisher_weight()`](crate::port::subscriber::Subscriber::set_publisher_weight())
+    /// a [`Publisher`](crate::port::publisher::Publisher) can be served with up to `weight`
+    /// consecutive [`Sample`](crate::sample::Sample)s before the next one is visited.
+    RoundRobin,
+    /// Every receive call acquires the [`Sample`](crate::sample::Sample) with the oldest send
+    /// timestamp of all the next [`Sample`](crate::sample::Sample)s of the connected
+    /// [`Publisher`](crate::port::publisher::Publisher)s. The timestamps are only available
+    /// when the [`Service`](crate::service::Service) was created with
+    /// [`enable_send_tracking()`](crate::service::builder::publish_subscribe::Builder::enable_send_tracking()),
+    /// otherwise it behaves like [`ReceivePolicy::Sequential`].
+    OldestFirst,
+}
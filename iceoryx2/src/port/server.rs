@@ -35,14 +35,17 @@
 extern crate alloc;
 
 use alloc::sync::Arc;
-use core::{cell::UnsafeCell, sync::atomic::Ordering};
+use core::{
+    cell::{Cell, RefCell, UnsafeCell},
+    sync::atomic::Ordering,
+};
 use core::{fmt::Debug, marker::PhantomData};
 
 use iceoryx2_bb_elementary::{cyclic_tagger::CyclicTagger, CallbackProgression};
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_log::{fail, warn};
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
-use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::dynamic_storage::{DynamicStorage, MemoryResidency, PageSize};
 
 use crate::{
     active_request::ActiveRequest,
@@ -50,19 +53,24 @@ use crate::{
     raw_sample::RawSample,
     service::{
         self,
-        dynamic_config::request_response::{ClientDetails, ServerDetails},
+        dynamic_config::{
+            publish_subscribe::StatisticsSlot,
+            request_response::{ClientDetails, ServerDetails},
+        },
         port_factory::server::{PortFactoryServer, ServerCreateError},
         ServiceState,
     },
 };
 
 use super::{
+    connection_backend::ConnectionBackend,
     details::{
         chunk::Chunk,
         chunk_details::ChunkDetails,
         data_segment::DataSegmentType,
         receiver::{Receiver, SenderDetails},
     },
+    receive_policy::ReceivePolicy,
     update_connections::{ConnectionFailure, UpdateConnections},
     ReceiveError, UniqueServerId,
 };
@@ -151,6 +159,16 @@ impl<
             tagger: CyclicTagger::new(),
             to_be_removed_connections: None,
             degradation_callback: server_factory.degradation_callback,
+            receive_policy: ReceivePolicy::Sequential,
+            round_robin_cursor: Cell::new(0),
+            served_from_cursor: Cell::new(0),
+            sender_weights: RefCell::new(Vec::new()),
+            peek_send_timestamp: None,
+            connection_backend: ConnectionBackend::SubscriberQueues,
+            broadcast_cursor_index: Cell::new(None),
+            history_size: 0,
+            memory_residency: MemoryResidency::OnDemand,
+            statistics_slot: StatisticsSlot::unassigned(),
         };
 
         let mut new_self = Self {
@@ -218,6 +236,7 @@ impl<
                         number_of_samples: details.number_of_requests,
                         max_number_of_segments: 1,
                         data_segment_type: DataSegmentType::Static,
+                        page_size: PageSize::Default,
                     },
                 );
 
@@ -32,7 +32,7 @@
 //! ```
 
 use core::any::TypeId;
-use core::cell::UnsafeCell;
+use core::cell::{Cell, RefCell, UnsafeCell};
 use core::fmt::Debug;
 use core::marker::PhantomData;
 use core::sync::atomic::Ordering;
@@ -48,7 +48,9 @@ use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
 
 use crate::service::builder::publish_subscribe::CustomPayloadMarker;
-use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, SubscriberDetails};
+use crate::service::dynamic_config::publish_subscribe::{
+    PublisherDetails, StatisticsSlot, SubscriberDetails,
+};
 use crate::service::header::publish_subscribe::Header;
 use crate::service::port_factory::subscriber::SubscriberConfig;
 use crate::service::static_config::publish_subscribe::StaticConfig;
@@ -57,7 +59,8 @@ use crate::{raw_sample::RawSample, sample::Sample, service};
 use super::details::chunk::Chunk;
 use super::details::chunk_details::ChunkDetails;
 use super::details::receiver::*;
-use super::port_identifiers::UniqueSubscriberId;
+use super::port_identifiers::{UniquePublisherId, UniqueSubscriberId};
+use super::receive_policy::ReceivePolicy;
 use super::update_connections::{ConnectionFailure, UpdateConnections};
 use super::ReceiveError;
 
@@ -73,6 +76,9 @@ pub enum SubscriberCreateError {
     /// When the [`Subscriber`] requires a larger buffer size than the
     /// [`Service`](crate::service::Service) offers the creation will fail.
     BufferSizeExceedsMaxSupportedBufferSizeOfService,
+    /// The requested [`MemoryResidency`](crate::prelude::MemoryResidency) could not be applied to the dynamic service config,
+    /// for instance because the lockable memory limit of the process is exceeded.
+    UnableToApplyMemoryResidency,
 }
 
 impl core::fmt::Display for SubscriberCreateError {
@@ -144,6 +150,12 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
             None => static_config.subscriber_max_buffer_size,
         };
 
+        fail!(from origin,
+            when service.__internal_state().dynamic_storage.apply_memory_residency(config.memory_residency),
+            with SubscriberCreateError::UnableToApplyMemoryResidency,
+            "{} since the memory residency {:?} could not be applied to the dynamic service config.",
+            msg, config.memory_residency);
+
         let receiver = Receiver {
             connections: (0..publisher_list.capacity())
                 .map(|_| UnsafeCell::new(None))
@@ -165,6 +177,16 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
                     .subscriber_expired_connection_buffer,
             ))),
             degradation_callback: config.degradation_callback,
+            receive_policy: config.receive_policy,
+            round_robin_cursor: Cell::new(0),
+            served_from_cursor: Cell::new(0),
+            sender_weights: RefCell::new(Vec::new()),
+            peek_send_timestamp: Some(Header::peek_send_timestamp_in_ns),
+            connection_backend: static_config.connection_backend,
+            broadcast_cursor_index: Cell::new(None),
+            history_size: static_config.history_size.min(buffer_size),
+            memory_residency: config.memory_residency,
+            statistics_slot: StatisticsSlot::unassigned(),
         };
 
         let mut new_self = Self {
@@ -202,6 +224,13 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         };
 
         new_self.dynamic_subscriber_handle = Some(dynamic_subscriber_handle);
+        new_self
+            .receiver
+            .statistics_slot
+            .assign(dynamic_subscriber_handle);
+        new_self
+            .receiver
+            .attach_broadcast_cursor(dynamic_subscriber_handle.index() as usize);
 
         Ok(new_self)
     }
@@ -219,6 +248,7 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
                         number_of_samples: details.number_of_samples,
                         max_number_of_segments: details.max_number_of_segments,
                         data_segment_type: details.data_segment_type,
+                        page_size: details.page_size,
                     },
                 );
 
@@ -244,6 +274,29 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
         self.receiver.buffer_size
     }
 
+    /// Returns the [`ReceivePolicy`] that defines in which order the samples of multiple
+    /// connected [`crate::port::publisher::Publisher`]s are received.
+    pub fn receive_policy(&self) -> ReceivePolicy {
+        self.receiver.receive_policy
+    }
+
+    /// Defines how many consecutive [`Sample`]s are received from the
+    /// [`crate::port::publisher::Publisher`] with the given [`UniquePublisherId`] before the
+    /// next one is visited when the [`Subscriber`] uses [`ReceivePolicy::RoundRobin`]. Every
+    /// [`crate::port::publisher::Publisher`] has the weight 1 by default, a weight of 0 is
+    /// treated as 1. The weight can be set before the
+    /// [`crate::port::publisher::Publisher`] is connected.
+    pub fn set_publisher_weight(&self, publisher_id: UniquePublisherId, weight: usize) {
+        self.receiver
+            .set_sender_weight(publisher_id.value(), weight);
+    }
+
+    /// Returns the weight of the [`crate::port::publisher::Publisher`] with the given
+    /// [`UniquePublisherId`], see [`Subscriber::set_publisher_weight()`].
+    pub fn publisher_weight(&self, publisher_id: UniquePublisherId) -> usize {
+        self.receiver.sender_weight(publisher_id.value())
+    }
+
     /// Returns true if the [`Subscriber`] has samples in the buffer that can be received with [`Subscriber::receive`].
     pub fn has_samples(&self) -> Result<bool, ConnectionFailure> {
         fail!(from self, when self.update_connections(),
@@ -260,6 +313,20 @@ impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug>
 
         self.receiver.receive()
     }
+
+    fn receive_batch_impl<F: FnMut(ChunkDetails<Service>, Chunk) -> CallbackProgression>(
+        &self,
+        max_number_of_samples: usize,
+        callback: F,
+    ) -> Result<usize, ReceiveError> {
+        if let Err(e) = self.update_connections() {
+            fail!(from self,
+                with ReceiveError::ConnectionFailure(e),
+                "Some samples are not being received since not all connections to publishers could be established.");
+        }
+
+        self.receiver.receive_batch(max_number_of_samples, callback)
+    }
 }
 
 impl<Service: service::Service, Payload: Debug + ?Sized, UserHeader: Debug> UpdateConnections
@@ -300,6 +367,32 @@ impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
             },
         }))
     }
+
+    /// Receives up to `max_number_of_samples` [`crate::sample::Sample`]s from all connected
+    /// [`crate::port::publisher::Publisher`]s and calls the provided callback for every one of
+    /// them. The connections are updated only once and are visited in the order defined by the
+    /// [`ReceivePolicy`]. The iteration can be stopped early by returning
+    /// [`CallbackProgression::Stop`] from the callback.
+    /// Returns the number of received [`crate::sample::Sample`]s, if a failure occurs
+    /// [`ReceiveError`] is returned.
+    pub fn receive_batch<F: FnMut(Sample<Service, Payload, UserHeader>) -> CallbackProgression>(
+        &self,
+        max_number_of_samples: usize,
+        mut callback: F,
+    ) -> Result<usize, ReceiveError> {
+        self.receive_batch_impl(max_number_of_samples, |details, chunk| {
+            callback(Sample {
+                details,
+                ptr: unsafe {
+                    RawSample::new_unchecked(
+                        chunk.header.cast(),
+                        chunk.user_header.cast(),
+                        chunk.payload.cast(),
+                    )
+                },
+            })
+        })
+    }
 }
 
 impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
@@ -326,6 +419,39 @@ impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
             }
         }))
     }
+
+    /// Receives up to `max_number_of_samples` [`crate::sample::Sample`]s from all connected
+    /// [`crate::port::publisher::Publisher`]s and calls the provided callback for every one of
+    /// them. The connections are updated only once and are visited in the order defined by the
+    /// [`ReceivePolicy`]. The iteration can be stopped early by returning
+    /// [`CallbackProgression::Stop`] from the callback.
+    /// Returns the number of received [`crate::sample::Sample`]s, if a failure occurs
+    /// [`ReceiveError`] is returned.
+    pub fn receive_batch<
+        F: FnMut(Sample<Service, [Payload], UserHeader>) -> CallbackProgression,
+    >(
+        &self,
+        max_number_of_samples: usize,
+        mut callback: F,
+    ) -> Result<usize, ReceiveError> {
+        debug_assert!(TypeId::of::<Payload>() != TypeId::of::<CustomPayloadMarker>());
+
+        self.receive_batch_impl(max_number_of_samples, |details, chunk| {
+            let header_ptr = chunk.header as *const Header;
+            let number_of_elements = unsafe { (*header_ptr).number_of_elements() };
+
+            callback(Sample {
+                details,
+                ptr: unsafe {
+                    RawSample::<Header, UserHeader, [Payload]>::new_slice_unchecked(
+                        header_ptr,
+                        chunk.user_header.cast(),
+                        core::slice::from_raw_parts(chunk.payload.cast(), number_of_elements as _),
+                    )
+                },
+            })
+        })
+    }
 }
 
 impl<Service: service::Service, UserHeader: Debug>
@@ -361,4 +487,34 @@ impl<Service: service::Service, UserHeader: Debug>
             }
         }))
     }
+
+    /// # Safety
+    ///
+    ///  * see [`Subscriber::receive_custom_payload()`]
+    #[doc(hidden)]
+    pub unsafe fn receive_custom_payload_batch<
+        F: FnMut(Sample<Service, [CustomPayloadMarker], UserHeader>) -> CallbackProgression,
+    >(
+        &self,
+        max_number_of_samples: usize,
+        mut callback: F,
+    ) -> Result<usize, ReceiveError> {
+        let payload_size = self.receiver.payload_size();
+        self.receive_batch_impl(max_number_of_samples, |details, chunk| {
+            let header_ptr = chunk.header as *const Header;
+            let number_of_elements = unsafe { (*header_ptr).number_of_elements() };
+            let number_of_bytes = number_of_elements as usize * payload_size;
+
+            callback(Sample {
+                details,
+                ptr: unsafe {
+                    RawSample::<Header, UserHeader, [CustomPayloadMarker]>::new_slice_unchecked(
+                        header_ptr,
+                        chunk.user_header.cast(),
+                        core::slice::from_raw_parts(chunk.payload.cast(), number_of_bytes),
+                    )
+                },
+            })
+        })
+    }
 }
@@ -12,13 +12,17 @@
 
 pub use crate::config::Config;
 pub use crate::node::{node_name::NodeName, Node, NodeBuilder, NodeState};
-pub use crate::port::{event_id::EventId, unable_to_deliver_strategy::UnableToDeliverStrategy};
+pub use crate::port::{
+    connection_backend::ConnectionBackend, event_id::EventId, payload_allocator::PayloadAllocator,
+    receive_policy::ReceivePolicy, unable_to_deliver_strategy::UnableToDeliverStrategy,
+};
 pub use crate::service::messaging_pattern::MessagingPattern;
 pub use crate::service::{
     attribute::AttributeSet, attribute::AttributeSpecifier, attribute::AttributeVerifier, ipc,
     local, port_factory::PortFactory, service_name::ServiceName, Service, ServiceDetails,
 };
 pub use crate::signal_handling_mode::SignalHandlingMode;
+pub use crate::wait_policy::WaitPolicy;
 pub use crate::waitset::{WaitSet, WaitSetAttachmentId, WaitSetBuilder, WaitSetGuard};
 pub use iceoryx2_bb_derive_macros::PlacementDefault;
 pub use iceoryx2_bb_derive_macros::ZeroCopySend;
@@ -32,4 +36,5 @@ pub use iceoryx2_bb_log::set_log_level_from_env_or_default;
 pub use iceoryx2_bb_log::LogLevel;
 pub use iceoryx2_bb_posix::file_descriptor::{FileDescriptor, FileDescriptorBased};
 pub use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
+pub use iceoryx2_cal::shared_memory::{MemoryResidency, PageSize};
 pub use iceoryx2_cal::shm_allocator::AllocationStrategy;
@@ -164,6 +164,13 @@ impl<Header, UserHeader, Payload: ?Sized> RawSampleMut<Header, UserHeader, Paylo
         unsafe { &*self.header }
     }
 
+    /// Acquires the underlying header as mutable reference.
+    #[must_use]
+    #[inline(always)]
+    pub(crate) fn as_header_mut(&mut self) -> &mut Header {
+        unsafe { &mut *self.header }
+    }
+
     /// Acquires the underlying payload as reference.
     #[must_use]
     #[inline(always)]
@@ -36,7 +36,7 @@ extern crate alloc;
 
 use iceoryx2_bb_log::fatal_panic;
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
-use iceoryx2_cal::zero_copy_connection::{ChannelId, ZeroCopyReceiver, ZeroCopyReleaseError};
+use iceoryx2_cal::zero_copy_connection::ZeroCopyReleaseError;
 
 use crate::port::details::chunk_details::ChunkDetails;
 use crate::port::port_identifiers::UniquePublisherId;
@@ -86,12 +86,7 @@ impl<Service: crate::service::Service, Payload: Debug + ?Sized, UserHeader> Drop
                 .unregister_offset(self.details.offset)
         };
 
-        match self
-            .details
-            .connection
-            .receiver
-            .release(self.details.offset, ChannelId::new(0))
-        {
+        match self.details.connection.release(self.details.offset) {
             Ok(()) => (),
             Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
                 fatal_panic!(from self, "This should never happen! The publishers retrieve channel is full and the sample cannot be returned.");
@@ -64,13 +64,14 @@
 //! ```
 
 use crate::{
-    port::publisher::PublisherBackend, port::SendError, raw_sample::RawSampleMut,
-    service::header::publish_subscribe::Header,
+    port::notifier::Notifier, port::publisher::PublisherBackend, port::SendError,
+    raw_sample::RawSampleMut, service::header::publish_subscribe::Header,
 };
 use iceoryx2_cal::shared_memory::*;
 
 use core::fmt::{Debug, Formatter};
 use core::ops::{Deref, DerefMut};
+use core::time::Duration;
 
 extern crate alloc;
 use alloc::sync::Arc;
@@ -309,8 +310,110 @@ impl<
     /// # Ok(())
     /// # }
     /// ```
-    pub fn send(self) -> Result<usize, SendError> {
-        self.publisher_backend
-            .send_sample(self.offset_to_chunk, self.sample_size)
+    pub fn send(mut self) -> Result<usize, SendError> {
+        self.publisher_backend.send_sample(
+            self.ptr.as_header_mut(),
+            self.offset_to_chunk,
+            self.sample_size,
+            None,
+            None,
+        )
+    }
+
+    /// Sends the [`SampleMut`] like [`SampleMut::send()`] but waits at most `timeout` in total
+    /// for [`crate::port::subscriber::Subscriber`]s whose buffer is full and that do not
+    /// allow safe overflow, independent of the configured
+    /// [`UnableToDeliverStrategy`](crate::port::unable_to_deliver_strategy::UnableToDeliverStrategy).
+    /// The publisher sleeps while waiting and is woken up as soon as the subscriber consumes
+    /// a sample. [`crate::port::subscriber::Subscriber`]s that still have no space left after
+    /// the timeout do not receive the sample.
+    ///
+    /// On success the number of [`crate::port::subscriber::Subscriber`]s that received
+    /// the data is returned, otherwise a [`SendError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use core::time::Duration;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .open_or_create()?;
+    /// # let publisher = service.publisher_builder().create()?;
+    ///
+    /// let mut sample = publisher.loan()?;
+    /// *sample.payload_mut() = 4567;
+    ///
+    /// sample.send_with_timeout(Duration::from_millis(10))?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_with_timeout(mut self, timeout: Duration) -> Result<usize, SendError> {
+        self.publisher_backend.send_sample(
+            self.ptr.as_header_mut(),
+            self.offset_to_chunk,
+            self.sample_size,
+            Some(timeout),
+            None,
+        )
+    }
+
+    /// Sends the [`SampleMut`] like [`SampleMut::send()`] and notifies the
+    /// [`Listener`](crate::port::listener::Listener)s of the provided [`Notifier`]s service in
+    /// the same call. Only the [`Listener`](crate::port::listener::Listener)s of the
+    /// [`Node`](crate::node::Node)s whose [`crate::port::subscriber::Subscriber`]s had
+    /// no unconsumed sample before this sample arrived are notified. A subscriber that is still
+    /// busy with older samples will find the new sample anyway, so its wakeup is skipped and
+    /// notifications are only emitted when a buffer transitions from empty to non-empty.
+    /// Until a [`crate::port::subscriber::Subscriber`] has received from its empty buffer
+    /// once after the first call, its [`Node`](crate::node::Node) is notified with every
+    /// call.
+    ///
+    /// The notification is sent with the default [`EventId`](crate::port::event_id::EventId)
+    /// of the [`Notifier`]. A failed notification is reported in the log but does not fail
+    /// the send.
+    ///
+    /// On success the number of [`crate::port::subscriber::Subscriber`]s that received
+    /// the data is returned, otherwise a [`SendError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service_name: ServiceName = "My/Funk/ServiceName".try_into()?;
+    /// # let pubsub_service = node.service_builder(&service_name)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .open_or_create()?;
+    /// # let event_service = node.service_builder(&service_name)
+    /// #     .event()
+    /// #     .open_or_create()?;
+    /// # let publisher = pubsub_service.publisher_builder().create()?;
+    /// let notifier = event_service.notifier_builder().create()?;
+    ///
+    /// let mut sample = publisher.loan()?;
+    /// *sample.payload_mut() = 4567;
+    ///
+    /// sample.send_and_notify(&notifier)?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_and_notify(mut self, notifier: &Notifier<Service>) -> Result<usize, SendError> {
+        self.publisher_backend.send_sample(
+            self.ptr.as_header_mut(),
+            self.offset_to_chunk,
+            self.sample_size,
+            None,
+            Some(notifier),
+        )
     }
 }
@@ -205,9 +205,20 @@ impl<ServiceType: service::Service> Builder<ServiceType> {
             verify_notifier_dropped_event: false,
         };
 
-        new_self.base.service_config.messaging_pattern = MessagingPattern::Event(
-            static_config::event::StaticConfig::new(new_self.base.shared_node.config()),
-        );
+        let mut static_config =
+            static_config::event::StaticConfig::new(new_self.base.shared_node.config());
+
+        // every listener of an event with a trigger id limit allocates resources for all
+        // event ids, therefore the default is bounded by the event implementation
+        if let Some(trigger_id_max) =
+            <ServiceType::Event as iceoryx2_cal::event::Event>::default_trigger_id_max()
+        {
+            static_config.event_id_max_value = static_config
+                .event_id_max_value
+                .min(trigger_id_max.as_value());
+        }
+
+        new_self.base.service_config.messaging_pattern = MessagingPattern::Event(static_config);
 
         new_self
     }
@@ -16,6 +16,7 @@
 //!
 use core::marker::PhantomData;
 
+use crate::port::connection_backend::ConnectionBackend;
 use crate::service;
 use crate::service::dynamic_config::publish_subscribe::DynamicConfigSettings;
 use crate::service::header::publish_subscribe::Header;
@@ -74,6 +75,10 @@ pub enum PublishSubscribeOpenError {
     DoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     IncompatibleOverflowBehavior,
+    /// The [`Service`] required send tracking setting is not compatible.
+    IncompatibleSendTrackingSetting,
+    /// The [`Service`] required [`ConnectionBackend`] is not compatible.
+    IncompatibleConnectionBackend,
     /// The process has not enough permissions to open the [`Service`]
     InsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing, corrupted or unaccessible.
@@ -235,6 +240,8 @@ pub struct Builder<
     verify_subscriber_max_borrowed_samples: bool,
     verify_publisher_history_size: bool,
     verify_enable_safe_overflow: bool,
+    verify_enable_send_tracking: bool,
+    verify_connection_backend: bool,
     verify_max_nodes: bool,
     _data: PhantomData<Payload>,
     _user_header: PhantomData<UserHeader>,
@@ -255,6 +262,8 @@ impl<
             verify_publisher_history_size: false,
             verify_subscriber_max_borrowed_samples: false,
             verify_enable_safe_overflow: false,
+            verify_enable_send_tracking: false,
+            verify_connection_backend: false,
             verify_max_nodes: false,
             override_alignment: None,
             override_payload_type: None,
@@ -334,6 +343,27 @@ impl<
         self
     }
 
+    /// If the [`Service`] is created, defines if every [`crate::sample::Sample`] carries a
+    /// sequence number and a send timestamp in its
+    /// [`Header`](crate::service::header::publish_subscribe::Header). If an existing
+    /// [`Service`] is opened it requires the service to have the defined setting.
+    pub fn enable_send_tracking(mut self, value: bool) -> Self {
+        self.config_details_mut().enable_send_tracking = value;
+        self.verify_enable_send_tracking = true;
+        self
+    }
+
+    /// If the [`Service`] is created, defines the [`ConnectionBackend`] that is used to
+    /// deliver the [`crate::sample::Sample`]s from the
+    /// [`Publisher`](crate::port::publisher::Publisher)s to the
+    /// [`crate::port::subscriber::Subscriber`]s. If an existing [`Service`] is opened it
+    /// requires the service to use the defined [`ConnectionBackend`].
+    pub fn connection_backend(mut self, value: ConnectionBackend) -> Self {
+        self.config_details_mut().connection_backend = value;
+        self.verify_connection_backend = true;
+        self
+    }
+
     /// If the [`Service`] is created it defines how many [`crate::sample::Sample`] a
     /// [`crate::port::subscriber::Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -498,6 +528,22 @@ impl<
                                 msg);
         }
 
+        if self.verify_enable_send_tracking
+            && existing_settings.enable_send_tracking != required_settings.enable_send_tracking
+        {
+            fail!(from self, with PublishSubscribeOpenError::IncompatibleSendTrackingSetting,
+                                "{} since the service has an incompatible send tracking setting.",
+                                msg);
+        }
+
+        if self.verify_connection_backend
+            && existing_settings.connection_backend != required_settings.connection_backend
+        {
+            fail!(from self, with PublishSubscribeOpenError::IncompatibleConnectionBackend,
+                                "{} since the service uses the connection backend {:?} but {:?} is required.",
+                                msg, existing_settings.connection_backend, required_settings.connection_backend);
+        }
+
         if self.verify_max_nodes && existing_settings.max_nodes < required_settings.max_nodes {
             fail!(from self, with PublishSubscribeOpenError::DoesNotSupportRequestedAmountOfNodes,
                                 "{} since the service supports only {} nodes but {} are required.",
@@ -66,6 +66,15 @@ pub(crate) fn data_segment_config<Service: crate::service::Service>(
         .path_hint(global_config.global.root_path())
 }
 
+pub(crate) fn buddy_data_segment_config<Service: crate::service::Service>(
+    global_config: &config::Config,
+) -> <Service::BuddySharedMemory as NamedConceptMgmt>::Configuration {
+    <<Service::BuddySharedMemory as NamedConceptMgmt>::Configuration>::default()
+        .prefix(&global_config.global.prefix)
+        .suffix(&global_config.global.service.publisher_data_segment_suffix)
+        .path_hint(global_config.global.root_path())
+}
+
 pub(crate) fn resizable_data_segment_config<Service: crate::service::Service>(
     global_config: &config::Config,
 ) -> <Service::ResizableSharedMemory as NamedConceptMgmt>::Configuration {
@@ -75,6 +84,15 @@ pub(crate) fn resizable_data_segment_config<Service: crate::service::Service>(
         .path_hint(global_config.global.root_path())
 }
 
+pub(crate) fn broadcast_ring_config<Service: crate::service::Service>(
+    global_config: &config::Config,
+) -> <Service::BroadcastRing as NamedConceptMgmt>::Configuration {
+    <<Service::BroadcastRing as NamedConceptMgmt>::Configuration>::default()
+        .prefix(&global_config.global.prefix)
+        .suffix(&global_config.global.service.publisher_data_segment_suffix)
+        .path_hint(global_config.global.root_path())
+}
+
 pub(crate) fn node_monitoring_config<Service: crate::service::Service>(
     global_config: &config::Config,
 ) -> <Service::Monitoring as NamedConceptMgmt>::Configuration {
@@ -84,6 +102,14 @@ pub(crate) fn node_monitoring_config<Service: crate::service::Service>(
         .path_hint(&global_config.global.node_dir())
 }
 
+pub(crate) fn node_dir_watch_config<Service: crate::service::Service>(
+    global_config: &config::Config,
+) -> <Service::StaticStorage as NamedConceptMgmt>::Configuration {
+    <<Service::StaticStorage as NamedConceptMgmt>::Configuration>::default()
+        .prefix(&global_config.global.prefix)
+        .path_hint(&global_config.global.node_dir())
+}
+
 pub(crate) fn node_details_path(
     global_config: &config::Config,
     node_id: &NodeId,
@@ -23,13 +23,23 @@
 //!
 //! println!("number of active publishers:      {:?}", pubsub.dynamic_config().number_of_publishers());
 //! println!("number of active subscribers:     {:?}", pubsub.dynamic_config().number_of_subscribers());
+//!
+//! pubsub.dynamic_config().list_publisher_statistics(|id, statistics| {
+//!     println!("publisher {:?} sent {} samples", id, statistics.sent_samples);
+//!     CallbackProgression::Continue
+//! });
 //! # Ok(())
 //! # }
 //! ```
+use core::sync::atomic::Ordering;
+
+use iceoryx2_bb_container::vec::RelocatableVec;
 use iceoryx2_bb_elementary::relocatable_container::RelocatableContainer;
 use iceoryx2_bb_lock_free::mpmc::{container::*, unique_index_set::ReleaseMode};
 use iceoryx2_bb_log::fatal_panic;
 use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_cal::shared_memory::PageSize;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicU64, IoxAtomicUsize};
 
 use crate::{
     node::NodeId,
@@ -58,6 +68,7 @@ pub struct PublisherDetails {
     pub max_slice_len: usize,
     pub data_segment_type: DataSegmentType,
     pub max_number_of_segments: u8,
+    pub page_size: PageSize,
 }
 
 #[doc(hidden)]
@@ -69,6 +80,158 @@ pub struct SubscriberDetails {
     pub buffer_size: usize,
 }
 
+/// Snapshot of the statistics counters of a [`crate::port::publisher::Publisher`]. The
+/// counters start at zero when the [`crate::port::publisher::Publisher`] is created.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct PublisherStatistics {
+    /// The number of samples that were sent.
+    pub sent_samples: u64,
+    /// The number of deliveries that failed since the buffer of a
+    /// [`crate::port::subscriber::Subscriber`] was full.
+    pub failed_deliveries: u64,
+    /// The number of samples that were removed from the buffer of a
+    /// [`crate::port::subscriber::Subscriber`] to make room for a newer sample.
+    pub overflowed_samples: u64,
+    /// The number of loans that failed with
+    /// [`LoanError::ExceedsMaxLoans`](crate::port::LoanError::ExceedsMaxLoans).
+    pub exceeded_max_loans: u64,
+}
+
+/// Snapshot of the statistics counters of a [`crate::port::subscriber::Subscriber`]. The
+/// counters start at zero when the [`crate::port::subscriber::Subscriber`] is created.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct SubscriberStatistics {
+    /// The number of samples that were received.
+    pub received_samples: u64,
+    /// The number of receive calls that failed with
+    /// [`ReceiveError::ExceedsMaxBorrows`](crate::port::ReceiveError::ExceedsMaxBorrows).
+    pub exceeded_max_borrows: u64,
+}
+
+// every port owns a full cache line so that ports that count concurrently do not
+// invalidate each others cache lines
+#[repr(C, align(64))]
+#[derive(Debug)]
+pub(crate) struct PublisherCounters {
+    sent_samples: IoxAtomicU64,
+    failed_deliveries: IoxAtomicU64,
+    overflowed_samples: IoxAtomicU64,
+    exceeded_max_loans: IoxAtomicU64,
+}
+
+impl PublisherCounters {
+    fn new() -> Self {
+        Self {
+            sent_samples: IoxAtomicU64::new(0),
+            failed_deliveries: IoxAtomicU64::new(0),
+            overflowed_samples: IoxAtomicU64::new(0),
+            exceeded_max_loans: IoxAtomicU64::new(0),
+        }
+    }
+
+    fn reset(&self) {
+        self.sent_samples.store(0, Ordering::Relaxed);
+        self.failed_deliveries.store(0, Ordering::Relaxed);
+        self.overflowed_samples.store(0, Ordering::Relaxed);
+        self.exceeded_max_loans.store(0, Ordering::Relaxed);
+    }
+
+    fn load(&self) -> PublisherStatistics {
+        PublisherStatistics {
+            sent_samples: self.sent_samples.load(Ordering::Relaxed),
+            failed_deliveries: self.failed_deliveries.load(Ordering::Relaxed),
+            overflowed_samples: self.overflowed_samples.load(Ordering::Relaxed),
+            exceeded_max_loans: self.exceeded_max_loans.load(Ordering::Relaxed),
+        }
+    }
+
+    pub(crate) fn count_sent_sample(&self) {
+        self.sent_samples.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn count_failed_delivery(&self) {
+        self.failed_deliveries.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn count_overflowed_sample(&self) {
+        self.overflowed_samples.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn count_exceeded_max_loans(&self) {
+        self.exceeded_max_loans.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+#[repr(C, align(64))]
+#[derive(Debug)]
+pub(crate) struct SubscriberCounters {
+    received_samples: IoxAtomicU64,
+    exceeded_max_borrows: IoxAtomicU64,
+}
+
+impl SubscriberCounters {
+    fn new() -> Self {
+        Self {
+            received_samples: IoxAtomicU64::new(0),
+            exceeded_max_borrows: IoxAtomicU64::new(0),
+        }
+    }
+
+    fn reset(&self) {
+        self.received_samples.store(0, Ordering::Relaxed);
+        self.exceeded_max_borrows.store(0, Ordering::Relaxed);
+    }
+
+    fn load(&self) -> SubscriberStatistics {
+        SubscriberStatistics {
+            received_samples: self.received_samples.load(Ordering::Relaxed),
+            exceeded_max_borrows: self.exceeded_max_borrows.load(Ordering::Relaxed),
+        }
+    }
+
+    pub(crate) fn count_received_sample(&self) {
+        self.received_samples.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn count_exceeded_max_borrows(&self) {
+        self.exceeded_max_borrows.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+/// The index of the counters of a port in the [`DynamicConfig`]. It is assigned when the
+/// port is registered in the [`DynamicConfig`] and stays unassigned for ports of other
+/// messaging patterns, which therefore do not count. With the feature
+/// `disable_port_statistics` no port counts.
+#[derive(Debug)]
+pub(crate) struct StatisticsSlot(IoxAtomicUsize);
+
+impl StatisticsSlot {
+    const UNASSIGNED: usize = usize::MAX;
+
+    pub(crate) fn unassigned() -> Self {
+        Self(IoxAtomicUsize::new(Self::UNASSIGNED))
+    }
+
+    pub(crate) fn assign(&self, handle: ContainerHandle) {
+        self.0.store(handle.index() as usize, Ordering::Relaxed);
+    }
+
+    pub(crate) fn unassign(&self) {
+        self.0.store(Self::UNASSIGNED, Ordering::Relaxed);
+    }
+
+    pub(crate) fn get(&self) -> Option<usize> {
+        if cfg!(feature = "disable_port_statistics") {
+            return None;
+        }
+
+        match self.0.load(Ordering::Relaxed) {
+            Self::UNASSIGNED => None,
+            index => Some(index),
+        }
+    }
+}
+
 /// The dynamic configuration of an [`crate::service::messaging_pattern::MessagingPattern::Event`]
 /// based service. Contains dynamic parameters like the connected endpoints etc..
 #[repr(C)]
@@ -76,6 +239,8 @@ pub struct SubscriberDetails {
 pub struct DynamicConfig {
     pub(crate) subscribers: Container<SubscriberDetails>,
     pub(crate) publishers: Container<PublisherDetails>,
+    subscriber_counters: RelocatableVec<SubscriberCounters>,
+    publisher_counters: RelocatableVec<PublisherCounters>,
 }
 
 impl DynamicConfig {
@@ -83,6 +248,10 @@ impl DynamicConfig {
         Self {
             subscribers: unsafe { Container::new_uninit(config.number_of_subscribers) },
             publishers: unsafe { Container::new_uninit(config.number_of_publishers) },
+            subscriber_counters: unsafe {
+                RelocatableVec::new_uninit(config.number_of_subscribers)
+            },
+            publisher_counters: unsafe { RelocatableVec::new_uninit(config.number_of_publishers) },
         }
     }
 
@@ -93,11 +262,21 @@ impl DynamicConfig {
         fatal_panic!(from self,
             when self.publishers.init(allocator),
             "This should never happen! Unable to initialize publisher port id container.");
+        fatal_panic!(from self,
+            when self.subscriber_counters.init(allocator),
+            "This should never happen! Unable to initialize subscriber statistics counters.");
+        self.subscriber_counters.fill_with(SubscriberCounters::new);
+        fatal_panic!(from self,
+            when self.publisher_counters.init(allocator),
+            "This should never happen! Unable to initialize publisher statistics counters.");
+        self.publisher_counters.fill_with(PublisherCounters::new);
     }
 
     pub(crate) fn memory_size(config: &DynamicConfigSettings) -> usize {
         Container::<SubscriberDetails>::memory_size(config.number_of_subscribers)
             + Container::<PublisherDetails>::memory_size(config.number_of_publishers)
+            + RelocatableVec::<SubscriberCounters>::const_memory_size(config.number_of_subscribers)
+            + RelocatableVec::<PublisherCounters>::const_memory_size(config.number_of_publishers)
     }
 
     pub(crate) unsafe fn remove_dead_node_id<
@@ -164,8 +343,54 @@ impl DynamicConfig {
         });
     }
 
+    /// Calls the provided callback with the [`PublisherStatistics`] of every
+    /// [`crate::port::publisher::Publisher`] that is currently connected.
+    pub fn list_publisher_statistics<
+        F: FnMut(UniquePublisherId, PublisherStatistics) -> CallbackProgression,
+    >(
+        &self,
+        mut callback: F,
+    ) {
+        let state = unsafe { self.publishers.get_state() };
+
+        state.for_each(|handle, details| {
+            callback(
+                details.publisher_id,
+                self.publisher_counters(handle.index() as usize).load(),
+            )
+        });
+    }
+
+    /// Calls the provided callback with the [`SubscriberStatistics`] of every
+    /// [`crate::port::subscriber::Subscriber`] that is currently connected.
+    pub fn list_subscriber_statistics<
+        F: FnMut(UniqueSubscriberId, SubscriberStatistics) -> CallbackProgression,
+    >(
+        &self,
+        mut callback: F,
+    ) {
+        let state = unsafe { self.subscribers.get_state() };
+
+        state.for_each(|handle, details| {
+            callback(
+                details.subscriber_id,
+                self.subscriber_counters(handle.index() as usize).load(),
+            )
+        });
+    }
+
+    pub(crate) fn publisher_counters(&self, index: usize) -> &PublisherCounters {
+        unsafe { &self.publisher_counters.as_slice()[index] }
+    }
+
+    pub(crate) fn subscriber_counters(&self, index: usize) -> &SubscriberCounters {
+        unsafe { &self.subscriber_counters.as_slice()[index] }
+    }
+
     pub(crate) fn add_subscriber_id(&self, details: SubscriberDetails) -> Option<ContainerHandle> {
-        unsafe { self.subscribers.add(details).ok() }
+        let handle = unsafe { self.subscribers.add(details).ok() }?;
+        self.subscriber_counters(handle.index() as usize).reset();
+        Some(handle)
     }
 
     pub(crate) fn release_subscriber_handle(&self, handle: ContainerHandle) {
@@ -173,7 +398,9 @@ impl DynamicConfig {
     }
 
     pub(crate) fn add_publisher_id(&self, details: PublisherDetails) -> Option<ContainerHandle> {
-        unsafe { self.publishers.add(details).ok() }
+        let handle = unsafe { self.publishers.add(details).ok() }?;
+        self.publisher_counters(handle.index() as usize).reset();
+        Some(handle)
     }
 
     pub(crate) fn release_publisher_handle(&self, handle: ContainerHandle) {
@@ -31,6 +31,8 @@
 //! # }
 //! ```
 
+use core::time::Duration;
+
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 
 use crate::port::port_identifiers::UniquePublisherId;
@@ -42,6 +44,9 @@ use crate::port::port_identifiers::UniquePublisherId;
 pub struct Header {
     publisher_port_id: UniquePublisherId,
     number_of_elements: u64,
+    sequence_number: u64,
+    send_timestamp_in_ns: u64,
+    has_send_tracking: bool,
 }
 
 impl Header {
@@ -49,6 +54,32 @@ impl Header {
         Self {
             publisher_port_id,
             number_of_elements,
+            sequence_number: 0,
+            send_timestamp_in_ns: 0,
+            has_send_tracking: false,
+        }
+    }
+
+    pub(crate) fn set_send_tracking(&mut self, sequence_number: u64, send_timestamp: Duration) {
+        self.sequence_number = sequence_number;
+        self.send_timestamp_in_ns = send_timestamp.as_nanos() as u64;
+        self.has_send_tracking = true;
+    }
+
+    /// Reads the send timestamp in nanoseconds from the [`Header`] at the given address. It is
+    /// used to order samples that are still in the buffer of the subscriber, the publisher may
+    /// recycle them concurrently, therefore the fields are read without creating a reference.
+    ///
+    /// # Safety
+    ///
+    ///  * `header` must point to the [`Header`] of a chunk in a mapped data segment
+    pub(crate) unsafe fn peek_send_timestamp_in_ns(header: *const u8) -> Option<u64> {
+        let header = header as *const Header;
+        let has_send_tracking = core::ptr::addr_of!((*header).has_send_tracking) as *const u8;
+
+        match has_send_tracking.read_volatile() != 0 {
+            true => Some(core::ptr::addr_of!((*header).send_timestamp_in_ns).read_volatile()),
+            false => None,
         }
     }
 
@@ -69,4 +100,30 @@ impl Header {
     pub fn number_of_elements(&self) -> u64 {
         self.number_of_elements
     }
+
+    /// Returns the sequence number the source [`crate::port::publisher::Publisher`] assigned
+    /// when the sample was sent. The sequence number starts at 0 and is incremented with every
+    /// sent sample, so a gap indicates that samples were lost, e.g. due to safe overflow.
+    ///
+    /// Returns [`None`] when the [`crate::service::Service`] was created without
+    /// [`enable_send_tracking()`](crate::service::builder::publish_subscribe::Builder::enable_send_tracking()).
+    pub fn sequence_number(&self) -> Option<u64> {
+        match self.has_send_tracking {
+            true => Some(self.sequence_number),
+            false => None,
+        }
+    }
+
+    /// Returns the time of the monotonic system clock at which the sample was sent. It can be
+    /// compared with [`Time::now_with_clock(ClockType::Monotonic)`](iceoryx2_bb_posix::clock::Time::now_with_clock())
+    /// on the same host to acquire the end-to-end latency.
+    ///
+    /// Returns [`None`] when the [`crate::service::Service`] was created without
+    /// [`enable_send_tracking()`](crate::service::builder::publish_subscribe::Builder::enable_send_tracking()).
+    pub fn send_timestamp(&self) -> Option<Duration> {
+        match self.has_send_tracking {
+            true => Some(Duration::from_nanos(self.send_timestamp_in_ns)),
+            false => None,
+        }
+    }
 }
@@ -35,7 +35,9 @@
 extern crate alloc;
 use alloc::sync::Arc;
 
+use crate::port::details::broadcast_ring::BroadcastRingState;
 use crate::service::dynamic_config::DynamicConfig;
+use iceoryx2_cal::shm_allocator::buddy_allocator::BuddyAllocator;
 use iceoryx2_cal::shm_allocator::pool_allocator::PoolAllocator;
 use iceoryx2_cal::*;
 
@@ -55,9 +57,14 @@ impl crate::service::Service for Service {
     type SharedMemory = shared_memory::posix::Memory<PoolAllocator>;
     type ResizableSharedMemory =
         resizable_shared_memory::dynamic::DynamicMemory<PoolAllocator, Self::SharedMemory>;
+    type BuddySharedMemory = shared_memory::posix::Memory<BuddyAllocator>;
     type Connection = zero_copy_connection::posix_shared_memory::Connection;
+    type BroadcastRing = dynamic_storage::posix_shared_memory::Storage<BroadcastRingState>;
     type Event = event::unix_datagram_socket::EventImpl;
     type Monitoring = monitoring::file_lock::FileLockMonitoring;
+    #[cfg(target_os = "linux")]
+    type Reactor = reactor::epoll::Reactor;
+    #[cfg(not(target_os = "linux"))]
     type Reactor = reactor::posix_select::Reactor;
 }
 
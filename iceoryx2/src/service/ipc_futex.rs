@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Inter-process communication setup that is identical to [`ipc`](crate::service::ipc)
+//! except for the event mechanism. Notifications are tracked in a bitset in shared memory
+//! and the [`Notifier`](crate::port::notifier::Notifier) issues a futex wake up only when
+//! the [`Listener`](crate::port::listener::Listener) is waiting, so that most notifications
+//! do not require any syscall.
+//!
+//! Every [`Listener`](crate::port::listener::Listener) allocates one bit per event id,
+//! therefore event services use an
+//! [`event_id_max_value`](crate::service::builder::event::Builder::event_id_max_value())
+//! of at most [`u16::MAX`] by default. All processes that use a service must use the same
+//! service variant.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::service::ipc_futex;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc_futex::Service>()?;
+//!
+//! // use `ipc_futex` as communication variant
+//! let event = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .event()
+//!     .open_or_create()?;
+//!
+//! let listener = event.listener_builder().create()?;
+//! let notifier = event.notifier_builder().create()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
+//! See [`Service`](crate::service) for more detailed examples.
+
+extern crate alloc;
+use alloc::sync::Arc;
+
+use crate::port::details::broadcast_ring::BroadcastRingState;
+use crate::service::dynamic_config::DynamicConfig;
+use iceoryx2_cal::shm_allocator::buddy_allocator::BuddyAllocator;
+use iceoryx2_cal::shm_allocator::pool_allocator::PoolAllocator;
+use iceoryx2_cal::*;
+
+use super::ServiceState;
+
+/// Defines a zero copy inter-process communication setup based on posix mechanisms that
+/// uses the Linux futex for events.
+#[derive(Debug)]
+pub struct Service {
+    state: Arc<ServiceState<Self>>,
+}
+
+impl crate::service::Service for Service {
+    type StaticStorage = static_storage::file::Storage;
+    type ConfigSerializer = serialize::toml::Toml;
+    type DynamicStorage = dynamic_storage::posix_shared_memory::Storage<DynamicConfig>;
+    type ServiceNameHasher = hash::sha1::Sha1;
+    type SharedMemory = shared_memory::posix::Memory<PoolAllocator>;
+    type ResizableSharedMemory =
+        resizable_shared_memory::dynamic::DynamicMemory<PoolAllocator, Self::SharedMemory>;
+    type BuddySharedMemory = shared_memory::posix::Memory<BuddyAllocator>;
+    type Connection = zero_copy_connection::posix_shared_memory::Connection;
+    type BroadcastRing = dynamic_storage::posix_shared_memory::Storage<BroadcastRingState>;
+    type Event = event::futex_bitset_posix_shared_memory::EventImpl;
+    type Monitoring = monitoring::file_lock::FileLockMonitoring;
+    type Reactor = reactor::epoll::Reactor;
+}
+
+impl crate::service::internal::ServiceInternal<Service> for Service {
+    fn __internal_from_state(state: ServiceState<Self>) -> Self {
+        Self {
+            state: Arc::new(state),
+        }
+    }
+
+    fn __internal_state(&self) -> &Arc<ServiceState<Self>> {
+        &self.state
+    }
+}
@@ -36,7 +36,9 @@ extern crate alloc;
 
 use alloc::sync::Arc;
 
+use crate::port::details::broadcast_ring::BroadcastRingState;
 use crate::service::dynamic_config::DynamicConfig;
+use iceoryx2_cal::shm_allocator::buddy_allocator::BuddyAllocator;
 use iceoryx2_cal::shm_allocator::pool_allocator::PoolAllocator;
 use iceoryx2_cal::*;
 
@@ -56,9 +58,14 @@ impl crate::service::Service for Service {
     type SharedMemory = shared_memory::process_local::Memory<PoolAllocator>;
     type ResizableSharedMemory =
         resizable_shared_memory::dynamic::DynamicMemory<PoolAllocator, Self::SharedMemory>;
+    type BuddySharedMemory = shared_memory::process_local::Memory<BuddyAllocator>;
     type Connection = zero_copy_connection::process_local::Connection;
+    type BroadcastRing = dynamic_storage::process_local::Storage<BroadcastRingState>;
     type Event = event::process_local_socketpair::EventImpl;
     type Monitoring = monitoring::process_local::ProcessLocalMonitoring;
+    #[cfg(target_os = "linux")]
+    type Reactor = reactor::epoll::Reactor;
+    #[cfg(not(target_os = "linux"))]
     type Reactor = reactor::posix_select::Reactor;
 }
 
@@ -164,6 +164,11 @@ pub mod local;
 /// A configuration when communicating between different processes using posix mechanisms.
 pub mod ipc;
 
+/// A configuration when communicating between different processes using posix mechanisms
+/// and the Linux futex for events.
+#[cfg(target_os = "linux")]
+pub mod ipc_futex;
+
 pub(crate) mod config_scheme;
 pub(crate) mod naming_scheme;
 
@@ -175,7 +180,13 @@ use alloc::sync::Arc;
 
 use crate::config;
 use crate::node::{NodeId, NodeListFailure, NodeState, SharedNode};
+use crate::port::details::broadcast_ring::BroadcastRingState;
+use crate::port::port_identifiers::{UniquePublisherId, UniqueSubscriberId};
+use crate::port::publisher::ConnectionStatistics;
 use crate::service::config_scheme::dynamic_config_storage_config;
+use crate::service::dynamic_config::publish_subscribe::{
+    PublisherStatistics, SubscriberStatistics,
+};
 use crate::service::dynamic_config::DynamicConfig;
 use crate::service::static_config::*;
 use config_scheme::service_tag_config;
@@ -193,9 +204,9 @@ use iceoryx2_cal::named_concept::*;
 use iceoryx2_cal::reactor::Reactor;
 use iceoryx2_cal::resizable_shared_memory::ResizableSharedMemoryForPoolAllocator;
 use iceoryx2_cal::serialize::Serialize;
-use iceoryx2_cal::shared_memory::SharedMemoryForPoolAllocator;
+use iceoryx2_cal::shared_memory::{SharedMemoryForBuddyAllocator, SharedMemoryForPoolAllocator};
 use iceoryx2_cal::static_storage::*;
-use iceoryx2_cal::zero_copy_connection::ZeroCopyConnection;
+use iceoryx2_cal::zero_copy_connection::{ChannelId, ZeroCopyConnection};
 use service_id::ServiceId;
 
 use self::dynamic_config::DeregisterNodeState;
@@ -279,6 +290,21 @@ pub struct ServiceDetails<S: Service> {
     pub dynamic_details: Option<ServiceDynamicDetails<S>>,
 }
 
+/// The statistics of a publish-subscribe [`Service`] that one can acquire with
+/// [`Service::list_publish_subscribe_statistics()`] without opening the [`Service`].
+#[derive(Debug, Clone, Default)]
+pub struct PublishSubscribeStatistics {
+    /// The number of [`Node`](crate::node::Node)s that are registered at the [`Service`].
+    pub number_of_nodes: usize,
+    /// The [`PublisherStatistics`] of every [`Publisher`](crate::port::publisher::Publisher).
+    pub publishers: Vec<(UniquePublisherId, PublisherStatistics)>,
+    /// The [`SubscriberStatistics`] of every
+    /// [`Subscriber`](crate::port::subscriber::Subscriber).
+    pub subscribers: Vec<(UniqueSubscriberId, SubscriberStatistics)>,
+    /// The [`ConnectionStatistics`] of every established connection.
+    pub connections: Vec<ConnectionStatistics>,
+}
+
 /// Represents the [`Service`]s state.
 #[derive(Debug)]
 pub struct ServiceState<S: Service> {
@@ -560,9 +586,21 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> {
     /// The dynamic memory used to store dynamic payload
     type ResizableSharedMemory: ResizableSharedMemoryForPoolAllocator<Self::SharedMemory>;
 
+    /// The memory used to store the payload when the
+    /// [`PayloadAllocator::Buddy`](crate::port::payload_allocator::PayloadAllocator::Buddy)
+    /// is used.
+    type BuddySharedMemory: SharedMemoryForBuddyAllocator;
+
     /// The connection used to exchange pointers to the payload
     type Connection: ZeroCopyConnection;
 
+    /// Defines the construct used to store the ring a
+    /// [`Publisher`](crate::port::publisher::Publisher) shares with all
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s when the
+    /// [`ConnectionBackend::BroadcastRing`](crate::port::connection_backend::ConnectionBackend::BroadcastRing)
+    /// is used.
+    type BroadcastRing: DynamicStorage<BroadcastRingState>;
+
     /// The mechanism used to signal events between endpoints.
     type Event: Event;
 
@@ -649,15 +687,7 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> {
         config: &config::Config,
         mut callback: F,
     ) -> Result<(), ServiceListError> {
-        let msg = "Unable to list all services";
-        let origin = "Service::list_from_config()";
-        let static_storage_config = config_scheme::static_config_storage_config::<Self>(config);
-
-        let service_uuids = fail!(from origin,
-                when <Self::StaticStorage as NamedConceptMgmt>::list_cfg(&static_storage_config),
-                map NamedConceptListError::InsufficientPermissions => ServiceListError::InsufficientPermissions,
-                unmatched ServiceListError::InternalError,
-                "{} due to a failure while collecting all active services for config: {:?}", msg, config);
+        let service_uuids = list_service_uuids::<Self>(config, "Unable to list all services")?;
 
         for uuid in &service_uuids {
             if let Ok(Some(service_details)) = details::<Self>(config, uuid) {
@@ -669,6 +699,256 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> {
 
         Ok(())
     }
+
+    /// Calls the provided callback with the [`StaticConfig`] and the
+    /// [`PublishSubscribeStatistics`] of every publish-subscribe [`Service`] created under a
+    /// given [`config::Config`] without opening the [`Service`]s. The dynamic config of
+    /// every [`Service`] is mapped once per call and every connection is opened once to read
+    /// its fill level. Intended for monitoring tools that sample all [`Service`]s
+    /// periodically.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// ipc::Service::list_publish_subscribe_statistics(
+    ///     Config::global_config(),
+    ///     |static_details, statistics| {
+    ///         println!("{}: {:?}", static_details.name(), statistics);
+    ///         CallbackProgression::Continue
+    ///     },
+    /// )?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    fn list_publish_subscribe_statistics<
+        F: FnMut(&StaticConfig, PublishSubscribeStatistics) -> CallbackProgression,
+    >(
+        config: &config::Config,
+        mut callback: F,
+    ) -> Result<(), ServiceListError> {
+        let service_uuids = list_service_uuids::<Self>(
+            config,
+            "Unable to list the statistics of all publish-subscribe services",
+        )?;
+
+        for uuid in &service_uuids {
+            let static_details = match read_static_config::<Self>(config, uuid) {
+                Ok(Some(static_details)) => static_details,
+                Ok(None) | Err(_) => continue,
+            };
+
+            let dynamic_config =
+                match open_publish_subscribe_dynamic_config::<Self>(&static_details, config) {
+                    Ok(Some(dynamic_config)) => dynamic_config,
+                    Ok(None) | Err(_) => continue,
+                };
+
+            let mut statistics = PublishSubscribeStatistics::default();
+            dynamic_config.get().list_node_ids(|_| {
+                statistics.number_of_nodes += 1;
+                CallbackProgression::Continue
+            });
+
+            let dynamic_config = dynamic_config.get().publish_subscribe();
+            dynamic_config.list_publisher_statistics(|id, publisher_statistics| {
+                statistics.publishers.push((id, publisher_statistics));
+                CallbackProgression::Continue
+            });
+            dynamic_config.list_subscriber_statistics(|id, subscriber_statistics| {
+                statistics.subscribers.push((id, subscriber_statistics));
+                CallbackProgression::Continue
+            });
+            for_each_connection_stats::<Self, _>(dynamic_config, config, |connection| {
+                statistics.connections.push(connection);
+                CallbackProgression::Continue
+            });
+
+            if callback(&static_details, statistics) == CallbackProgression::Stop {
+                break;
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Calls the provided callback with the [`ConnectionStatistics`] of every connection
+    /// between a [`Publisher`](crate::port::publisher::Publisher) and a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) of a publish-subscribe [`Service`].
+    /// Every connection is opened to read its fill level, therefore the statistics are not
+    /// part of the [`ServiceDetails`] acquired with [`Service::list()`]. Connections that
+    /// are not yet or no longer established are skipped. For any other messaging pattern
+    /// the callback is never called.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// ipc::Service::list(Config::global_config(), |service| {
+    ///     let _ = ipc::Service::list_connection_stats(
+    ///         &service.static_details,
+    ///         Config::global_config(),
+    ///         |connection| {
+    ///             println!("{:?}", connection);
+    ///             CallbackProgression::Continue
+    ///         },
+    ///     );
+    ///     CallbackProgression::Continue
+    /// })?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    fn list_connection_stats<F: FnMut(ConnectionStatistics) -> CallbackProgression>(
+        static_details: &StaticConfig,
+        config: &config::Config,
+        callback: F,
+    ) -> Result<(), ServiceDetailsError> {
+        list_connection_stats::<Self, F>(static_details, config, callback)
+    }
+
+    /// Calls the provided callback with the [`PublisherStatistics`] of every
+    /// [`Publisher`](crate::port::publisher::Publisher) of a publish-subscribe [`Service`]
+    /// without opening the [`Service`]. Only the shared statistics counters are read,
+    /// therefore the observed processes are not affected. For any other messaging pattern
+    /// the callback is never called.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// ipc::Service::list(Config::global_config(), |service| {
+    ///     let _ = ipc::Service::list_publisher_statistics(
+    ///         &service.static_details,
+    ///         Config::global_config(),
+    ///         |id, statistics| {
+    ///             println!("{:?}: {:?}", id, statistics);
+    ///             CallbackProgression::Continue
+    ///         },
+    ///     );
+    ///     CallbackProgression::Continue
+    /// })?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    fn list_publisher_statistics<
+        F: FnMut(UniquePublisherId, PublisherStatistics) -> CallbackProgression,
+    >(
+        static_details: &StaticConfig,
+        config: &config::Config,
+        callback: F,
+    ) -> Result<(), ServiceDetailsError> {
+        if let Some(dynamic_config) =
+            open_publish_subscribe_dynamic_config::<Self>(static_details, config)?
+        {
+            dynamic_config
+                .get()
+                .publish_subscribe()
+                .list_publisher_statistics(callback);
+        }
+
+        Ok(())
+    }
+
+    /// Calls the provided callback with the [`SubscriberStatistics`] of every
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) of a publish-subscribe [`Service`]
+    /// without opening the [`Service`]. See [`Service::list_publisher_statistics()`].
+    fn list_subscriber_statistics<
+        F: FnMut(UniqueSubscriberId, SubscriberStatistics) -> CallbackProgression,
+    >(
+        static_details: &StaticConfig,
+        config: &config::Config,
+        callback: F,
+    ) -> Result<(), ServiceDetailsError> {
+        if let Some(dynamic_config) =
+            open_publish_subscribe_dynamic_config::<Self>(static_details, config)?
+        {
+            dynamic_config
+                .get()
+                .publish_subscribe()
+                .list_subscriber_statistics(callback);
+        }
+
+        Ok(())
+    }
+}
+
+fn open_publish_subscribe_dynamic_config<S: Service>(
+    static_details: &StaticConfig,
+    config: &config::Config,
+) -> Result<Option<S::DynamicStorage>, ServiceDetailsError> {
+    if !matches!(
+        static_details.messaging_pattern(),
+        static_config::messaging_pattern::MessagingPattern::PublishSubscribe(_)
+    ) {
+        return Ok(None);
+    }
+
+    open_dynamic_config::<S>(config, static_details.service_id())
+}
+
+fn list_connection_stats<S: Service, F: FnMut(ConnectionStatistics) -> CallbackProgression>(
+    static_details: &StaticConfig,
+    config: &config::Config,
+    mut callback: F,
+) -> Result<(), ServiceDetailsError> {
+    let dynamic_config = match open_publish_subscribe_dynamic_config::<S>(static_details, config)? {
+        Some(dynamic_config) => dynamic_config,
+        None => return Ok(()),
+    };
+
+    for_each_connection_stats::<S, _>(
+        dynamic_config.get().publish_subscribe(),
+        config,
+        &mut callback,
+    );
+    Ok(())
+}
+
+fn for_each_connection_stats<S: Service, F: FnMut(ConnectionStatistics) -> CallbackProgression>(
+    dynamic_config: &dynamic_config::publish_subscribe::DynamicConfig,
+    config: &config::Config,
+    mut callback: F,
+) {
+    let mut publisher_ids = vec![];
+    dynamic_config.__internal_list_publishers(|details| publisher_ids.push(details.publisher_id));
+    let mut subscriber_ids = vec![];
+    dynamic_config
+        .__internal_list_subscribers(|details| subscriber_ids.push(details.subscriber_id));
+
+    let connection_config = config_scheme::connection_config::<S>(config);
+    for publisher_id in &publisher_ids {
+        for subscriber_id in &subscriber_ids {
+            let name = naming_scheme::connection_name(publisher_id.value(), subscriber_id.value());
+            let fill_level = match <S::Connection as ZeroCopyConnection>::fill_level(
+                &name,
+                &connection_config,
+                ChannelId::new(0),
+            ) {
+                Ok(fill_level) => fill_level,
+                Err(_) => continue,
+            };
+
+            let stats = ConnectionStatistics {
+                publisher_id: *publisher_id,
+                subscriber_id: *subscriber_id,
+                submission_queue: fill_level.submission_queue,
+                completion_queue: fill_level.completion_queue,
+            };
+
+            if callback(stats) == CallbackProgression::Stop {
+                return;
+            }
+        }
+    }
 }
 
 pub(crate) unsafe fn remove_static_service_config<S: Service>(
@@ -687,10 +967,60 @@ pub(crate) unsafe fn remove_static_service_config<S: Service>(
     }
 }
 
-fn details<S: Service>(
+fn list_service_uuids<S: Service>(
+    config: &config::Config,
+    msg: &str,
+) -> Result<Vec<FileName>, ServiceListError> {
+    let origin = "Service::list_from_config()";
+    let static_storage_config = config_scheme::static_config_storage_config::<S>(config);
+
+    Ok(fail!(from origin,
+            when <S::StaticStorage as NamedConceptMgmt>::list_cfg(&static_storage_config),
+            map NamedConceptListError::InsufficientPermissions => ServiceListError::InsufficientPermissions,
+            unmatched ServiceListError::InternalError,
+            "{} due to a failure while collecting all active services for config: {:?}", msg, config))
+}
+
+pub(crate) fn details<S: Service>(
     config: &config::Config,
     uuid: &FileName,
 ) -> Result<Option<ServiceDetails<S>>, ServiceDetailsError> {
+    let origin = "Service::details()";
+    let service_config = match read_static_config::<S>(config, uuid)? {
+        Some(service_config) => service_config,
+        None => return Ok(None),
+    };
+
+    let dynamic_config = open_dynamic_config::<S>(config, service_config.service_id())?;
+    let dynamic_details = if let Some(d) = dynamic_config {
+        let mut nodes = vec![];
+        d.get().list_node_ids(|node_id| {
+            match NodeState::new(node_id, config) {
+                Ok(Some(state)) => nodes.push(state),
+                Ok(None)
+                | Err(NodeListFailure::InsufficientPermissions)
+                | Err(NodeListFailure::Interrupt) => (),
+                Err(NodeListFailure::InternalError) => {
+                    debug!(from origin, "Unable to acquire NodeState for service \"{:?}\"", uuid);
+                }
+            };
+            CallbackProgression::Continue
+        });
+        Some(ServiceDynamicDetails { nodes })
+    } else {
+        None
+    };
+
+    Ok(Some(ServiceDetails {
+        static_details: service_config,
+        dynamic_details,
+    }))
+}
+
+fn read_static_config<S: Service>(
+    config: &config::Config,
+    uuid: &FileName,
+) -> Result<Option<StaticConfig>, ServiceDetailsError> {
     let msg = "Unable to acquire servic details";
     let origin = "Service::details()";
     let static_storage_config = config_scheme::static_config_storage_config::<S>(config);
@@ -735,30 +1065,7 @@ fn details<S: Service>(
                 msg, service_config, uuid, config);
     }
 
-    let dynamic_config = open_dynamic_config::<S>(config, service_config.service_id())?;
-    let dynamic_details = if let Some(d) = dynamic_config {
-        let mut nodes = vec![];
-        d.get().list_node_ids(|node_id| {
-            match NodeState::new(node_id, config) {
-                Ok(Some(state)) => nodes.push(state),
-                Ok(None)
-                | Err(NodeListFailure::InsufficientPermissions)
-                | Err(NodeListFailure::Interrupt) => (),
-                Err(NodeListFailure::InternalError) => {
-                    debug!(from origin, "Unable to acquire NodeState for service \"{:?}\"", uuid);
-                }
-            };
-            CallbackProgression::Continue
-        });
-        Some(ServiceDynamicDetails { nodes })
-    } else {
-        None
-    };
-
-    Ok(Some(ServiceDetails {
-        static_details: service_config,
-        dynamic_details,
-    }))
+    Ok(Some(service_config))
 }
 
 fn open_dynamic_config<S: Service>(
@@ -55,3 +55,14 @@ pub(crate) fn data_segment_name(port_id_value: u128) -> FileName {
                  when FileName::new(port_id_value.to_string().as_bytes()),
                  "{}", msg)
 }
+
+pub(crate) fn broadcast_ring_name(port_id_value: u128) -> FileName {
+    let msg = "The system does not support the required file name length for the broadcast ring.";
+    let origin = "broadcast_ring_name()";
+
+    let mut file = fatal_panic!(from origin,
+                 when FileName::new(port_id_value.to_string().as_bytes()),
+                 "{}", msg);
+    fatal_panic!(from origin, when file.push_bytes(b"_ring"), "{}", msg);
+    file
+}
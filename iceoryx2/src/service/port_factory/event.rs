@@ -144,6 +144,6 @@ impl<Service: service::Service> PortFactory<Service> {
     /// # }
     /// ```
     pub fn listener_builder(&self) -> PortFactoryListener<Service> {
-        PortFactoryListener { factory: self }
+        PortFactoryListener::new(self)
     }
 }
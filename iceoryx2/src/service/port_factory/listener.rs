@@ -31,6 +31,7 @@ use iceoryx2_bb_log::fail;
 
 use crate::port::{listener::Listener, listener::ListenerCreateError};
 use crate::service;
+use crate::wait_policy::WaitPolicy;
 
 use super::event::PortFactory;
 
@@ -40,12 +41,29 @@ use super::event::PortFactory;
 #[derive(Debug)]
 pub struct PortFactoryListener<'factory, Service: service::Service> {
     pub(crate) factory: &'factory PortFactory<Service>,
+    wait_policy: WaitPolicy,
 }
 
-impl<Service: service::Service> PortFactoryListener<'_, Service> {
+impl<'factory, Service: service::Service> PortFactoryListener<'factory, Service> {
+    pub(crate) fn new(factory: &'factory PortFactory<Service>) -> Self {
+        Self {
+            factory,
+            wait_policy: WaitPolicy::default(),
+        }
+    }
+
+    /// Defines the [`WaitPolicy`] of the blocking and timed waits of the [`Listener`].
+    /// By default the [`Listener`] blocks immediately.
+    pub fn wait_policy(mut self, value: WaitPolicy) -> Self {
+        self.wait_policy = value;
+        self
+    }
+
     /// Creates the [`Listener`] port or returns a [`ListenerCreateError`] on failure.
     pub fn create(self) -> Result<Listener<Service>, ListenerCreateError> {
-        Ok(fail!(from self, when Listener::new(&self.factory.service),
-                    "Failed to create new Listener port."))
+        Ok(
+            fail!(from self, when Listener::new(&self.factory.service, self.wait_policy),
+                    "Failed to create new Listener port."),
+        )
     }
 }
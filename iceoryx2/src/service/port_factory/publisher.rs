@@ -57,11 +57,13 @@
 use core::fmt::Debug;
 
 use iceoryx2_bb_log::fail;
+use iceoryx2_cal::shared_memory::{MemoryResidency, PageSize};
 use iceoryx2_cal::shm_allocator::AllocationStrategy;
 
 use super::publish_subscribe::PortFactory;
 use crate::{
     port::{
+        payload_allocator::PayloadAllocator,
         publisher::{Publisher, PublisherCreateError},
         unable_to_deliver_strategy::UnableToDeliverStrategy,
         DegradationAction, DegradationCallback,
@@ -76,6 +78,9 @@ pub(crate) struct LocalPublisherConfig {
     pub(crate) degradation_callback: Option<DegradationCallback<'static>>,
     pub(crate) initial_max_slice_len: usize,
     pub(crate) allocation_strategy: AllocationStrategy,
+    pub(crate) payload_allocator: PayloadAllocator,
+    pub(crate) page_size: PageSize,
+    pub(crate) memory_residency: MemoryResidency,
 }
 
 /// Factory to create a new [`Publisher`] port/endpoint for
@@ -99,8 +104,11 @@ impl<'factory, Service: service::Service, Payload: Debug + ?Sized, UserHeader: D
         Self {
             config: LocalPublisherConfig {
                 allocation_strategy: AllocationStrategy::Static,
+                payload_allocator: PayloadAllocator::Pool,
                 degradation_callback: None,
                 initial_max_slice_len: 1,
+                page_size: PageSize::Default,
+                memory_residency: MemoryResidency::OnDemand,
                 max_loaned_samples: factory
                     .service
                     .__internal_state()
@@ -136,6 +144,25 @@ impl<'factory, Service: service::Service, Payload: Debug + ?Sized, UserHeader: D
         self
     }
 
+    /// Defines the [`PageSize`] of the pages that back the data segment of the [`Publisher`].
+    /// Huge pages reduce the TLB pressure for large payloads. If the system has no huge pages
+    /// of the requested type reserved, the [`Publisher`] falls back to [`PageSize::Default`].
+    /// The actually used [`PageSize`] is returned by [`Publisher::page_size()`].
+    pub fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
+    /// Defines the [`MemoryResidency`] of the data segment, the connections and the dynamic
+    /// service config of the [`Publisher`]. With [`MemoryResidency::PreFaulted`] or
+    /// [`MemoryResidency::Locked`] all pages are mapped when the [`Publisher`] is created so
+    /// that the first [`Publisher::send()`](crate::sample_mut::SampleMut::send()) does not
+    /// cause page faults.
+    pub fn memory_residency(mut self, value: MemoryResidency) -> Self {
+        self.config.memory_residency = value;
+        self
+    }
+
     /// Sets the [`DegradationCallback`] of the [`Publisher`]. Whenever a connection to a
     /// [`crate::port::subscriber::Subscriber`] is corrupted or it seems to be dead, this callback
     /// is called and depending on the returned [`DegradationAction`] measures will be taken.
@@ -181,4 +208,18 @@ impl<Service: service::Service, Payload: Debug, UserHeader: Debug>
         self.config.allocation_strategy = value;
         self
     }
+
+    /// Defines the [`PayloadAllocator`] of the data segment. With
+    /// [`PayloadAllocator::Buddy`] slices of varying length occupy only the memory they require,
+    /// rounded up to the next power of two, instead of a bucket sized for the largest slice.
+    /// The data segment has the capacity of the [`PayloadAllocator::Pool`], rounded up to a
+    /// multiple of the largest block, and a single [`Publisher::loan_slice()`] can exceed the
+    /// [`PortFactoryPublisher::initial_max_slice_len()`] as long as a large enough block is free.
+    /// When every sample in flight has the initial max slice len, fewer samples fit into the
+    /// data segment than with the [`PayloadAllocator::Pool`] since every sample occupies a
+    /// power of two block.
+    pub fn payload_allocator(mut self, value: PayloadAllocator) -> Self {
+        self.config.payload_allocator = value;
+        self
+    }
 }
@@ -31,9 +31,11 @@
 use core::fmt::Debug;
 
 use iceoryx2_bb_log::fail;
+use iceoryx2_cal::shared_memory::MemoryResidency;
 
 use crate::{
     port::{
+        receive_policy::ReceivePolicy,
         subscriber::{Subscriber, SubscriberCreateError},
         DegradationAction, DegradationCallback,
     },
@@ -46,6 +48,8 @@ use super::publish_subscribe::PortFactory;
 pub(crate) struct SubscriberConfig {
     pub(crate) buffer_size: Option<usize>,
     pub(crate) degradation_callback: Option<DegradationCallback<'static>>,
+    pub(crate) receive_policy: ReceivePolicy,
+    pub(crate) memory_residency: MemoryResidency,
 }
 
 /// Factory to create a new [`Subscriber`] port/endpoint for
@@ -70,6 +74,8 @@ impl<'factory, Service: service::Service, PayloadType: Debug + ?Sized, UserHeade
             config: SubscriberConfig {
                 buffer_size: None,
                 degradation_callback: None,
+                receive_policy: ReceivePolicy::default(),
+                memory_residency: MemoryResidency::OnDemand,
             },
             factory,
         }
@@ -81,6 +87,24 @@ impl<'factory, Service: service::Service, PayloadType: Debug + ?Sized, UserHeade
         self
     }
 
+    /// Defines the [`ReceivePolicy`] of the [`Subscriber`], the order in which the samples of
+    /// multiple connected [`crate::port::publisher::Publisher`]s are received. If not set
+    /// [`ReceivePolicy::Sequential`] is used.
+    pub fn receive_policy(mut self, value: ReceivePolicy) -> Self {
+        self.config.receive_policy = value;
+        self
+    }
+
+    /// Defines the [`MemoryResidency`] of the connections, the mapped data segments of the
+    /// connected [`crate::port::publisher::Publisher`]s and the dynamic service config of the
+    /// [`Subscriber`]. With [`MemoryResidency::PreFaulted`] or [`MemoryResidency::Locked`] all
+    /// pages are mapped when a connection is established so that receiving does not cause
+    /// page faults.
+    pub fn memory_residency(mut self, value: MemoryResidency) -> Self {
+        self.config.memory_residency = value;
+        self
+    }
+
     /// Sets the [`DegradationCallback`] of the [`Subscriber`]. Whenever a connection to a
     /// [`crate::port::subscriber::Subscriber`] is corrupted or it seems to be dead, this callback
     /// is called and depending on the returned [`DegradationAction`] measures will be taken.
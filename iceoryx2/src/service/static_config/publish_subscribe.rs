@@ -28,6 +28,7 @@
 //! println!("history size:                     {:?}", pubsub.static_config().history_size());
 //! println!("subscriber max borrowed samples:  {:?}", pubsub.static_config().subscriber_max_borrowed_samples());
 //! println!("safe overflow:                    {:?}", pubsub.static_config().has_safe_overflow());
+//! println!("connection backend:               {:?}", pubsub.static_config().connection_backend());
 //!
 //! # Ok(())
 //! # }
@@ -35,6 +36,7 @@
 
 use super::message_type_details::MessageTypeDetails;
 use crate::config;
+use crate::port::connection_backend::ConnectionBackend;
 use serde::{Deserialize, Serialize};
 
 /// The static configuration of an
@@ -50,6 +52,10 @@ pub struct StaticConfig {
     pub(crate) subscriber_max_buffer_size: usize,
     pub(crate) subscriber_max_borrowed_samples: usize,
     pub(crate) enable_safe_overflow: bool,
+    #[serde(default)]
+    pub(crate) enable_send_tracking: bool,
+    #[serde(default)]
+    pub(crate) connection_backend: ConnectionBackend,
     pub(crate) message_type_details: MessageTypeDetails,
 }
 
@@ -69,6 +75,8 @@ impl StaticConfig {
                 .publish_subscribe
                 .subscriber_max_borrowed_samples,
             enable_safe_overflow: config.defaults.publish_subscribe.enable_safe_overflow,
+            enable_send_tracking: false,
+            connection_backend: ConnectionBackend::default(),
             message_type_details: MessageTypeDetails::default(),
         }
     }
@@ -77,10 +85,20 @@ impl StaticConfig {
         &self,
         publisher_max_loaned_data: usize,
     ) -> usize {
-        self.max_subscribers
-            * (self.subscriber_max_buffer_size + self.subscriber_max_borrowed_samples)
-            + self.history_size
-            + publisher_max_loaned_data
+        match self.connection_backend {
+            ConnectionBackend::SubscriberQueues => {
+                self.max_subscribers
+                    * (self.subscriber_max_buffer_size + self.subscriber_max_borrowed_samples)
+                    + self.history_size
+                    + publisher_max_loaned_data
+            }
+            // the ring is shared by all subscribers and serves also as history
+            ConnectionBackend::BroadcastRing => {
+                self.subscriber_max_buffer_size
+                    + self.max_subscribers * self.subscriber_max_borrowed_samples
+                    + publisher_max_loaned_data
+            }
+        }
     }
 
     /// Returns the maximum supported amount of [`Node`](crate::node::Node)s that can open the
@@ -123,6 +141,19 @@ impl StaticConfig {
         self.enable_safe_overflow
     }
 
+    /// Returns true if every [`crate::sample::Sample`] of the [`crate::service::Service`] carries
+    /// a sequence number and a send timestamp in its
+    /// [`Header`](crate::service::header::publish_subscribe::Header), otherwise false.
+    pub fn has_send_tracking(&self) -> bool {
+        self.enable_send_tracking
+    }
+
+    /// Returns the [`ConnectionBackend`] the [`crate::port::publisher::Publisher`]s use to
+    /// deliver their [`crate::sample::Sample`]s to the [`crate::port::subscriber::Subscriber`]s.
+    pub fn connection_backend(&self) -> ConnectionBackend {
+        self.connection_backend
+    }
+
     /// Returns the type details of the [`crate::service::Service`].
     pub fn message_type_details(&self) -> &MessageTypeDetails {
         &self.message_type_details
@@ -0,0 +1,207 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Static tracepoints in the data path. When the feature `tracepoints` is enabled on Linux
+//! (x86_64 and aarch64), every tracepoint is a single `nop` instruction accompanied by a
+//! SystemTap SDT note in the binary, so that tools like `bpftrace` or `perf` can attach
+//! USDT probes at runtime without rebuilding. Without the feature the tracepoints and
+//! their arguments are removed at compile time.
+//!
+//! All probes belong to the provider `iceoryx2`. Port ids are 128-bit values and are
+//! passed as two arguments, the upper and the lower 64 bits. Offsets are the raw value of
+//! the [`PointerOffset`](iceoryx2_cal::shm_allocator::PointerOffset) as seen by the
+//! sending port and identify a sample across processes.
+//!
+//! | probe                  | arguments                                                       |
+//! |------------------------|-----------------------------------------------------------------|
+//! | `loan`                 | publisher id (hi, lo), offset, sample size                      |
+//! | `deliver`              | sender port id (hi, lo), offset, sample size                    |
+//! | `receive`              | receiver port id (hi, lo), sender port id (hi, lo), offset      |
+//! | `release`              | sender port id (hi, lo), offset                                 |
+//! | `notify`               | notifier id (hi, lo), event id                                  |
+//! | `waitset_notification` | file descriptor of the triggered attachment                     |
+//! | `waitset_polling`      | index of the triggered polling attachment                       |
+//!
+//! Reconstruct the per sample latency between loan and receive, for instance:
+//!
+//! ```text
+//! bpftrace -e '
+//!   usdt:./app:iceoryx2:loan    { @loaned[arg2] = nsecs; }
+//!   usdt:./app:iceoryx2:receive /@loaned[arg4]/ {
+//!       @latency = hist(nsecs - @loaned[arg4]); delete(@loaned[arg4]); }'
+//! ```
+
+#[cfg(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+))]
+pub(crate) mod sdt {
+    /// Returns the upper 64 bits of a port id.
+    #[inline(always)]
+    pub(crate) const fn id_hi(value: u128) -> u64 {
+        (value >> 64) as u64
+    }
+
+    /// Returns the lower 64 bits of a port id.
+    #[inline(always)]
+    pub(crate) const fn id_lo(value: u128) -> u64 {
+        value as u64
+    }
+
+    // The note layout follows sys/sdt.h of SystemTap: the address of the nop, the address
+    // of the `.stapsdt.base` section to detect prelink adjustments and the address of the
+    // semaphore, which is not used, followed by provider, name and argument description.
+    #[cfg(target_arch = "x86_64")]
+    macro_rules! sdt_probe {
+        ($name:ident, $args:literal $(, $arg:expr)*) => {{
+            #[allow(named_asm_labels)]
+            unsafe {
+                core::arch::asm!(
+                    concat!(
+                        ".ifndef _.stapsdt.base\n",
+                        ".pushsection .stapsdt.base, \"aG\", \"progbits\", .stapsdt.base, comdat\n",
+                        ".weak _.stapsdt.base\n",
+                        ".hidden _.stapsdt.base\n",
+                        "_.stapsdt.base: .space 1\n",
+                        ".size _.stapsdt.base, 1\n",
+                        ".popsection\n",
+                        ".endif\n",
+                        "990: nop\n",
+                        ".pushsection .note.stapsdt, \"\", \"note\"\n",
+                        ".balign 4\n",
+                        ".4byte 992f-991f, 994f-993f, 3\n",
+                        "991: .asciz \"stapsdt\"\n",
+                        "992: .balign 4\n",
+                        "993: .8byte 990b\n",
+                        ".8byte _.stapsdt.base\n",
+                        ".8byte 0\n",
+                        ".asciz \"iceoryx2\"\n",
+                        ".asciz \"", stringify!($name), "\"\n",
+                        ".asciz \"", $args, "\"\n",
+                        "994: .balign 4\n",
+                        ".popsection\n"
+                    ),
+                    $(in(reg) ($arg) as u64,)*
+                    options(att_syntax, readonly, nostack, preserves_flags)
+                );
+            }
+        }};
+    }
+
+    #[cfg(target_arch = "aarch64")]
+    macro_rules! sdt_probe {
+        ($name:ident, $args:literal $(, $arg:expr)*) => {{
+            #[allow(named_asm_labels)]
+            unsafe {
+                core::arch::asm!(
+                    concat!(
+                        ".ifndef _.stapsdt.base\n",
+                        ".pushsection .stapsdt.base, \"aG\", \"progbits\", .stapsdt.base, comdat\n",
+                        ".weak _.stapsdt.base\n",
+                        ".hidden _.stapsdt.base\n",
+                        "_.stapsdt.base: .space 1\n",
+                        ".size _.stapsdt.base, 1\n",
+                        ".popsection\n",
+                        ".endif\n",
+                        "990: nop\n",
+                        ".pushsection .note.stapsdt, \"\", \"note\"\n",
+                        ".balign 4\n",
+                        ".4byte 992f-991f, 994f-993f, 3\n",
+                        "991: .asciz \"stapsdt\"\n",
+                        "992: .balign 4\n",
+                        "993: .8byte 990b\n",
+                        ".8byte _.stapsdt.base\n",
+                        ".8byte 0\n",
+                        ".asciz \"iceoryx2\"\n",
+                        ".asciz \"", stringify!($name), "\"\n",
+                        ".asciz \"", $args, "\"\n",
+                        "994: .balign 4\n",
+                        ".popsection\n"
+                    ),
+                    $(in(reg) ($arg) as u64,)*
+                    options(readonly, nostack, preserves_flags)
+                );
+            }
+        }};
+    }
+
+    pub(crate) use sdt_probe;
+}
+
+#[cfg(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+))]
+pub(crate) use sdt::{id_hi, id_lo};
+
+/// Emits the static tracepoint `$name` of the provider `iceoryx2` with up to six arguments
+/// that are converted into `u64`.
+#[cfg(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+))]
+macro_rules! tracepoint {
+    ($name:ident) => {
+        $crate::tracepoint::sdt::sdt_probe!($name, "")
+    };
+    ($name:ident, $a0:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!($name, "8@{0}", $a0)
+    };
+    ($name:ident, $a0:expr, $a1:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!($name, "8@{0} 8@{1}", $a0, $a1)
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!($name, "8@{0} 8@{1} 8@{2}", $a0, $a1, $a2)
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr, $a3:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!($name, "8@{0} 8@{1} 8@{2} 8@{3}", $a0, $a1, $a2, $a3)
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr, $a3:expr, $a4:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!(
+            $name,
+            "8@{0} 8@{1} 8@{2} 8@{3} 8@{4}",
+            $a0,
+            $a1,
+            $a2,
+            $a3,
+            $a4
+        )
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr, $a3:expr, $a4:expr, $a5:expr) => {
+        $crate::tracepoint::sdt::sdt_probe!(
+            $name,
+            "8@{0} 8@{1} 8@{2} 8@{3} 8@{4} 8@{5}",
+            $a0,
+            $a1,
+            $a2,
+            $a3,
+            $a4,
+            $a5
+        )
+    };
+}
+
+/// Without the feature `tracepoints` or on unsupported platforms the tracepoint, including
+/// the evaluation of its arguments, is removed.
+#[cfg(not(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+)))]
+macro_rules! tracepoint {
+    ($($arguments:tt)*) => {};
+}
+
+pub(crate) use tracepoint;
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Incremental discovery of [`Service`](crate::service::Service)s and
+//! [`Node`](crate::node::Node)s. A tracker keeps the discovered entities in an in-process
+//! cache and reports on every [`sync`](crate::tracker::service::Tracker::sync()) only what
+//! was added, removed or changed since the previous call. The names of the entities are
+//! enumerated only when an entity was created or removed, the expensive part of the
+//! discovery, opening and deserializing the static configuration, is performed once per
+//! new entity.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::tracker::service::Tracker;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let mut tracker = Tracker::<ipc::Service>::new(Config::global_config());
+//!
+//! let changes = tracker.sync()?;
+//! for service_id in &changes.added {
+//!     if let Some(service) = tracker.get(service_id) {
+//!         println!("new service: {}", service.name());
+//!     }
+//! }
+//! for service in &changes.removed {
+//!     println!("removed service: {}", service.name());
+//! }
+//! # Ok(())
+//! # }
+//! ```
+
+/// Tracks the [`Node`](crate::node::Node)s of the system.
+pub mod node;
+
+/// Tracks the [`Service`](crate::service::Service)s of the system.
+pub mod service;
@@ -0,0 +1,278 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use std::collections::{HashMap, HashSet};
+
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_cal::monitoring::State;
+use iceoryx2_cal::static_storage::{StaticStorage, StaticStorageWatcher};
+
+use crate::config::Config;
+use crate::node::{Node, NodeId, NodeListFailure, NodeState};
+use crate::service::config_scheme::{node_dir_watch_config, node_monitoring_config};
+use crate::service::Service;
+
+/// The changes of the [`Node`]s since the previous [`Tracker::sync()`].
+#[derive(Debug)]
+pub struct NodeChanges<S: Service> {
+    /// The [`NodeId`]s of the [`Node`]s that were discovered. Their [`NodeState`] can be
+    /// acquired with [`Tracker::get()`].
+    pub added: Vec<NodeId>,
+    /// The [`NodeId`]s of the [`Node`]s whose [`NodeState`] changed, for instance a
+    /// [`Node`] that died.
+    pub changed: Vec<NodeId>,
+    /// The last known [`NodeState`]s of the [`Node`]s that no longer exist.
+    pub removed: Vec<NodeState<S>>,
+}
+
+impl<S: Service> Default for NodeChanges<S> {
+    fn default() -> Self {
+        Self {
+            added: Vec::new(),
+            changed: Vec::new(),
+            removed: Vec::new(),
+        }
+    }
+}
+
+impl<S: Service> NodeChanges<S> {
+    /// Returns true when no [`Node`] was added, changed or removed.
+    pub fn is_empty(&self) -> bool {
+        self.added.is_empty() && self.changed.is_empty() && self.removed.is_empty()
+    }
+}
+
+/// Keeps the [`NodeState`] of every [`Node`] in an in-process cache and updates it
+/// incrementally with [`Tracker::sync()`]. The details of a [`Node`] are read once when it
+/// is discovered, afterwards only its liveness is checked.
+///
+/// The [`Tracker`] watches the node directory, for instance with inotify on Linux for
+/// inter-process nodes, and lists the [`Node`]s only when one was created or removed. The
+/// death of a [`Node`] is not signaled by the system, therefore the liveness of every
+/// cached [`Node`] that is not yet dead is checked on every [`Tracker::sync()`].
+#[derive(Debug)]
+pub struct Tracker<S: Service> {
+    config: Config,
+    nodes: HashMap<NodeId, NodeState<S>>,
+    watcher: Option<<S::StaticStorage as StaticStorage>::Watcher>,
+    // set when a node could not be read in the previous sync
+    requires_rescan: bool,
+}
+
+impl<S: Service> Tracker<S> {
+    /// Creates a new [`Tracker`] with an empty cache. The first [`Tracker::sync()`] reports
+    /// all existing [`Node`]s as added.
+    pub fn new(config: &Config) -> Self {
+        let mut new_self = Self {
+            config: config.clone(),
+            nodes: HashMap::new(),
+            watcher: None,
+            requires_rescan: true,
+        };
+        new_self.recreate_watcher();
+        new_self
+    }
+
+    fn recreate_watcher(&mut self) {
+        // when the node directory does not yet exist no watcher can be created, every
+        // sync lists the nodes and retries until it exists
+        self.watcher = <S::StaticStorage as StaticStorage>::watch_cfg(&node_dir_watch_config::<S>(
+            &self.config,
+        ))
+        .ok();
+    }
+
+    fn has_changed(&mut self) -> bool {
+        match self.watcher.as_mut().map(|watcher| watcher.has_changed()) {
+            // without a file descriptor the creation of the monitoring token, which follows
+            // the creation of the node details, is not signaled
+            Some(Ok(has_changed)) => has_changed || self.file_descriptor().is_none(),
+            Some(Err(_)) | None => {
+                self.recreate_watcher();
+                true
+            }
+        }
+    }
+
+    /// Updates the cache and returns the [`NodeChanges`] since the previous call. The
+    /// [`Node`]s are listed only when one was created or removed since the previous call,
+    /// afterwards the liveness of every cached [`Node`] that is not yet dead is checked.
+    pub fn sync(&mut self) -> Result<NodeChanges<S>, NodeListFailure> {
+        let mut changes = NodeChanges::default();
+
+        // consumes the pending changes before the nodes are listed, a change that happens
+        // while listing is reported again in the next sync
+        if self.has_changed() || self.requires_rescan {
+            // stays set when the listing fails so that the consumed changes are not lost
+            self.requires_rescan = true;
+            self.rescan(&mut changes)?;
+        }
+
+        self.update_liveness(&mut changes);
+
+        Ok(changes)
+    }
+
+    fn rescan(&mut self, changes: &mut NodeChanges<S>) -> Result<(), NodeListFailure> {
+        let msg = "Unable to synchronize the node tracker";
+        let monitoring_config = node_monitoring_config::<S>(&self.config);
+        let node_list = fail!(from self, when Node::<S>::list_all_nodes(&monitoring_config),
+                                "{} since the node list could not be acquired.", msg);
+
+        let mut existing_nodes = HashSet::with_capacity(node_list.len());
+        let mut has_pending_nodes = false;
+
+        for node_name in node_list {
+            let node_id = NodeId::from_file_name(&node_name);
+
+            if !self.nodes.contains_key(&node_id) {
+                match NodeState::new(&node_id, &self.config) {
+                    Ok(Some(node_state)) => {
+                        changes.added.push(node_id);
+                        self.nodes.insert(node_id, node_state);
+                    }
+                    Ok(None) => continue,
+                    // the node is reported as added in one of the next syncs
+                    Err(e) => {
+                        warn!(from self,
+                            "Skipping the node {:?} since its state could not be acquired ({:?}).",
+                            node_id, e);
+                        has_pending_nodes = true;
+                        continue;
+                    }
+                }
+            }
+
+            existing_nodes.insert(node_id);
+        }
+
+        if existing_nodes.len() != self.nodes.len() {
+            let removed_nodes: Vec<NodeId> = self
+                .nodes
+                .keys()
+                .filter(|node_id| !existing_nodes.contains(*node_id))
+                .copied()
+                .collect();
+
+            for node_id in removed_nodes {
+                if let Some(node_state) = self.nodes.remove(&node_id) {
+                    changes.removed.push(node_state);
+                }
+            }
+        }
+
+        self.requires_rescan = has_pending_nodes;
+        Ok(())
+    }
+
+    fn update_liveness(&mut self, changes: &mut NodeChanges<S>) {
+        // a dead node stays dead until it is cleaned up, which removes its monitoring token
+        // and is signaled by the watcher
+        let monitored_nodes: Vec<NodeId> = self
+            .nodes
+            .iter()
+            .filter(|(node_id, node_state)| {
+                !matches!(node_state, NodeState::Dead(_)) && !changes.added.contains(*node_id)
+            })
+            .map(|(node_id, _)| *node_id)
+            .collect();
+
+        for node_id in monitored_nodes {
+            let state = Node::<S>::get_node_state(&self.config, &node_id);
+            // the removal is reported by the next rescan
+            if let Ok(State::DoesNotExist) = state {
+                continue;
+            }
+
+            let has_state_changed = match self.nodes.get(&node_id) {
+                Some(cached_state) => has_changed(cached_state, &state),
+                None => false,
+            };
+
+            if has_state_changed {
+                match NodeState::new(&node_id, &self.config) {
+                    Ok(Some(node_state)) => {
+                        changes.changed.push(node_id);
+                        self.nodes.insert(node_id, node_state);
+                    }
+                    Ok(None) => (),
+                    // the cached state is kept and the change is reported in one of the
+                    // next syncs
+                    Err(e) => {
+                        warn!(from self,
+                            "Keeping the previous state of the node {:?} since its new state could not be acquired ({:?}).",
+                            node_id, e);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Returns the [`FileDescriptor`] that becomes readable when a [`Node`] was created or
+    /// removed. Attach it to a [`WaitSet`](crate::waitset::WaitSet) to call
+    /// [`Tracker::sync()`] when something changed, the sync makes it unreadable again. The
+    /// death of a [`Node`] does not make it readable, therefore [`Tracker::sync()`] must
+    /// also be called periodically, for instance with an interval attachment, when dead
+    /// [`Node`]s shall be detected. Returns [`None`] when the [`Service`] variant or the
+    /// platform provides no change notifications, for instance for process local
+    /// [`Node`]s, or when the node directory does not exist. The [`FileDescriptor`] can
+    /// change with [`Tracker::sync()`] when the node directory was recreated.
+    pub fn file_descriptor(&self) -> Option<&FileDescriptor> {
+        self.watcher
+            .as_ref()
+            .and_then(|watcher| watcher.file_descriptor())
+    }
+
+    /// Returns the cached [`NodeState`] of the [`Node`] with the provided [`NodeId`].
+    pub fn get(&self, node_id: &NodeId) -> Option<&NodeState<S>> {
+        self.nodes.get(node_id)
+    }
+
+    /// Calls the provided callback for every cached [`Node`] without accessing the system.
+    pub fn list<F: FnMut(&NodeState<S>) -> CallbackProgression>(&self, mut callback: F) {
+        for node_state in self.nodes.values() {
+            if callback(node_state) == CallbackProgression::Stop {
+                break;
+            }
+        }
+    }
+
+    /// Returns the number of cached [`Node`]s.
+    pub fn len(&self) -> usize {
+        self.nodes.len()
+    }
+
+    /// Returns true when no [`Node`] is cached.
+    pub fn is_empty(&self) -> bool {
+        self.nodes.is_empty()
+    }
+}
+
+fn has_changed<S: Service>(
+    cached_state: &NodeState<S>,
+    state: &Result<State, NodeListFailure>,
+) -> bool {
+    !matches!(
+        (cached_state, state),
+        (NodeState::Alive(_), Ok(State::Alive))
+            | (NodeState::Dead(_), Ok(State::Dead))
+            | (
+                NodeState::Inaccessible(_),
+                Err(NodeListFailure::InsufficientPermissions)
+            )
+            | (NodeState::Undefined(_), Err(NodeListFailure::InternalError))
+            // an interrupted state acquisition does not indicate a change
+            | (_, Err(NodeListFailure::Interrupt))
+    )
+}
@@ -0,0 +1,209 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use std::collections::{HashMap, HashSet};
+
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_cal::named_concept::{NamedConceptListError, NamedConceptMgmt};
+use iceoryx2_cal::static_storage::{StaticStorage, StaticStorageWatcher};
+
+use crate::config::Config;
+use crate::service::config_scheme::static_config_storage_config;
+use crate::service::service_id::ServiceId;
+use crate::service::static_config::StaticConfig;
+use crate::service::{details, Service, ServiceListError};
+
+/// The changes of the [`Service`]s since the previous [`Tracker::sync()`].
+#[derive(Debug, Default)]
+pub struct ServiceChanges {
+    /// The [`ServiceId`]s of the [`Service`]s that were discovered. Their [`StaticConfig`] can
+    /// be acquired with [`Tracker::get()`].
+    pub added: Vec<ServiceId>,
+    /// The [`StaticConfig`]s of the [`Service`]s that no longer exist.
+    pub removed: Vec<StaticConfig>,
+}
+
+impl ServiceChanges {
+    /// Returns true when no [`Service`] was added or removed.
+    pub fn is_empty(&self) -> bool {
+        self.added.is_empty() && self.removed.is_empty()
+    }
+}
+
+/// Keeps the [`StaticConfig`] of every [`Service`] in an in-process cache and updates it
+/// incrementally with [`Tracker::sync()`]. The static configuration of a [`Service`] never
+/// changes during its lifetime, therefore a [`Service`] is either added or removed. The
+/// [`Node`](crate::node::Node)s that use a [`Service`] are tracked with
+/// [`crate::tracker::node::Tracker`].
+///
+/// The [`Tracker`] watches the creation and removal of [`Service`]s, for instance with
+/// inotify on Linux for inter-process services, and lists the [`Service`]s only when
+/// something changed.
+#[derive(Debug)]
+pub struct Tracker<S: Service> {
+    config: Config,
+    services: HashMap<FileName, StaticConfig>,
+    watcher: Option<<S::StaticStorage as StaticStorage>::Watcher>,
+    // set when a service was not yet fully created or could not be read in the previous sync
+    requires_rescan: bool,
+    _service: core::marker::PhantomData<S>,
+}
+
+impl<S: Service> Tracker<S> {
+    /// Creates a new [`Tracker`] with an empty cache. The first [`Tracker::sync()`] reports
+    /// all existing [`Service`]s as added.
+    pub fn new(config: &Config) -> Self {
+        let mut new_self = Self {
+            config: config.clone(),
+            services: HashMap::new(),
+            watcher: None,
+            requires_rescan: true,
+            _service: core::marker::PhantomData,
+        };
+        new_self.recreate_watcher();
+        new_self
+    }
+
+    fn recreate_watcher(&mut self) {
+        // when the service directory does not yet exist no watcher can be created, every
+        // sync lists the services and retries until it exists
+        self.watcher = <S::StaticStorage as StaticStorage>::watch_cfg(
+            &static_config_storage_config::<S>(&self.config),
+        )
+        .ok();
+    }
+
+    fn has_changed(&mut self) -> bool {
+        match self.watcher.as_mut().map(|watcher| watcher.has_changed()) {
+            Some(Ok(has_changed)) => has_changed,
+            Some(Err(_)) | None => {
+                self.recreate_watcher();
+                true
+            }
+        }
+    }
+
+    /// Updates the cache and returns the [`ServiceChanges`] since the previous call. Only
+    /// the [`Service`]s that were added since the previous call are opened and deserialized.
+    /// When no [`Service`] was created or removed since the previous call it returns without
+    /// listing the [`Service`]s.
+    pub fn sync(&mut self) -> Result<ServiceChanges, ServiceListError> {
+        let msg = "Unable to synchronize the service tracker";
+
+        // consumes the pending changes before the services are listed, a change that
+        // happens while listing is reported again in the next sync
+        if !self.has_changed() && !self.requires_rescan {
+            return Ok(ServiceChanges::default());
+        }
+
+        // stays set when the listing fails so that the consumed changes are not lost
+        self.requires_rescan = true;
+        let static_storage_config = static_config_storage_config::<S>(&self.config);
+
+        let service_uuids = fail!(from self,
+                when <S::StaticStorage as NamedConceptMgmt>::list_cfg(&static_storage_config),
+                map NamedConceptListError::InsufficientPermissions => ServiceListError::InsufficientPermissions,
+                unmatched ServiceListError::InternalError,
+                "{} due to a failure while collecting all active services.", msg);
+
+        let mut changes = ServiceChanges::default();
+        let mut existing_uuids = HashSet::with_capacity(service_uuids.len());
+        let mut has_pending_services = false;
+
+        for uuid in service_uuids {
+            if !self.services.contains_key(&uuid) {
+                match details::<S>(&self.config, &uuid) {
+                    Ok(Some(details)) => {
+                        changes
+                            .added
+                            .push(details.static_details.service_id().clone());
+                        self.services.insert(uuid.clone(), details.static_details);
+                    }
+                    // the service is not yet fully created or was removed in the meantime,
+                    // it will be reported in one of the next syncs
+                    Ok(None) => {
+                        has_pending_services = true;
+                        continue;
+                    }
+                    Err(e) => {
+                        warn!(from self,
+                            "Skipping the service \"{}\" since its details could not be acquired ({:?}).",
+                            uuid, e);
+                        has_pending_services = true;
+                        continue;
+                    }
+                }
+            }
+
+            existing_uuids.insert(uuid);
+        }
+
+        if existing_uuids.len() != self.services.len() {
+            let removed_uuids: Vec<FileName> = self
+                .services
+                .keys()
+                .filter(|uuid| !existing_uuids.contains(*uuid))
+                .cloned()
+                .collect();
+
+            for uuid in removed_uuids {
+                if let Some(static_config) = self.services.remove(&uuid) {
+                    changes.removed.push(static_config);
+                }
+            }
+        }
+
+        self.requires_rescan = has_pending_services;
+        Ok(changes)
+    }
+
+    /// Returns the [`FileDescriptor`] that becomes readable when a [`Service`] was created or
+    /// removed. Attach it to a [`WaitSet`](crate::waitset::WaitSet) to call
+    /// [`Tracker::sync()`] only when something changed, the sync makes it unreadable again.
+    /// Returns [`None`] when the [`Service`] variant or the platform provides no change
+    /// notifications, for instance for process local [`Service`]s, or when the service
+    /// directory does not exist. The [`FileDescriptor`] can change with
+    /// [`Tracker::sync()`] when the service directory was recreated.
+    pub fn file_descriptor(&self) -> Option<&FileDescriptor> {
+        self.watcher
+            .as_ref()
+            .and_then(|watcher| watcher.file_descriptor())
+    }
+
+    /// Returns the cached [`StaticConfig`] of the [`Service`] with the provided [`ServiceId`].
+    pub fn get(&self, service_id: &ServiceId) -> Option<&StaticConfig> {
+        self.services.get(&service_id.0.clone().into())
+    }
+
+    /// Calls the provided callback for every cached [`Service`] without accessing the
+    /// system.
+    pub fn list<F: FnMut(&StaticConfig) -> CallbackProgression>(&self, mut callback: F) {
+        for static_config in self.services.values() {
+            if callback(static_config) == CallbackProgression::Stop {
+                break;
+            }
+        }
+    }
+
+    /// Returns the number of cached [`Service`]s.
+    pub fn len(&self) -> usize {
+        self.services.len()
+    }
+
+    /// Returns true when no [`Service`] is cached.
+    pub fn is_empty(&self) -> bool {
+        self.services.is_empty()
+    }
+}
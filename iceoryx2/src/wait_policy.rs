@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::sync::atomic::Ordering;
+use core::time::Duration;
+
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_posix::scheduler::yield_now;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
+
+/// Defines how a blocking wait of a [`Listener`](crate::port::listener::Listener) or a
+/// [`WaitSet`](crate::waitset::WaitSet) is performed. The wait busy polls for
+/// [`WaitPolicy::spin_duration()`], then yields the CPU for [`WaitPolicy::yield_duration()`]
+/// and finally blocks in the operating system. A wakeup that is resolved while spinning or
+/// yielding does not pay the latency of the scheduler but consumes CPU time while waiting.
+///
+/// The default policy blocks immediately.
+#[derive(Default, Debug, Clone, Copy, PartialEq, Eq)]
+pub struct WaitPolicy {
+    spin_duration: Duration,
+    yield_duration: Duration,
+}
+
+impl WaitPolicy {
+    /// Creates a new [`WaitPolicy`] that spins for `spin_duration`, then yields for
+    /// `yield_duration` and then blocks.
+    pub const fn new(spin_duration: Duration, yield_duration: Duration) -> Self {
+        Self {
+            spin_duration,
+            yield_duration,
+        }
+    }
+
+    /// Creates a [`WaitPolicy`] that blocks immediately.
+    pub const fn blocking() -> Self {
+        Self::new(Duration::ZERO, Duration::ZERO)
+    }
+
+    /// Returns how long the wait busy polls before it starts to yield.
+    pub fn spin_duration(&self) -> Duration {
+        self.spin_duration
+    }
+
+    /// Returns how long the wait yields after spinning before it blocks.
+    pub fn yield_duration(&self) -> Duration {
+        self.yield_duration
+    }
+
+    /// Returns true if the wait blocks immediately, otherwise false.
+    pub fn is_blocking(&self) -> bool {
+        self.spin_duration.is_zero() && self.yield_duration.is_zero()
+    }
+
+    /// Waits with `wait_call` according to the policy and records in which phase the wait
+    /// was resolved. `wait_call` gets the timeout as argument whereby [`Duration::ZERO`]
+    /// stands for a non-blocking and [`Duration::MAX`] for an infinitely blocking call.
+    /// A blocking policy records nothing, so that the default wait stays free of shared
+    /// counter updates.
+    pub(crate) fn wait<T, E, F: FnMut(Duration) -> Result<Option<T>, E>>(
+        &self,
+        statistics: &WaitStatisticsCounter,
+        timeout: Duration,
+        mut wait_call: F,
+    ) -> Result<Option<T>, E> {
+        if self.is_blocking() || timeout.is_zero() {
+            return wait_call(timeout);
+        }
+
+        // when the clock is not available the spin and yield phase are skipped
+        let start = Time::now_with_clock(ClockType::Monotonic).ok();
+        let elapsed = || {
+            start
+                .as_ref()
+                .and_then(|s| s.elapsed().ok())
+                .unwrap_or(Duration::MAX)
+        };
+
+        let spin_end = self.spin_duration.min(timeout);
+        while elapsed() < spin_end {
+            if let Some(v) = wait_call(Duration::ZERO)? {
+                statistics
+                    .resolved_by_spinning
+                    .fetch_add(1, Ordering::Relaxed);
+                return Ok(Some(v));
+            }
+            core::hint::spin_loop();
+        }
+
+        // yields instead of sleeping, a sleep would overshoot the yield phase by the timer
+        // slack of the operating system
+        let yield_end = spin_end.saturating_add(self.yield_duration).min(timeout);
+        while elapsed() < yield_end {
+            if let Some(v) = wait_call(Duration::ZERO)? {
+                statistics
+                    .resolved_by_yielding
+                    .fetch_add(1, Ordering::Relaxed);
+                return Ok(Some(v));
+            }
+            yield_now();
+        }
+
+        let remaining = if timeout == Duration::MAX {
+            Duration::MAX
+        } else {
+            timeout.saturating_sub(elapsed())
+        };
+
+        let result = wait_call(remaining)?;
+        if result.is_some() {
+            statistics
+                .resolved_by_blocking
+                .fetch_add(1, Ordering::Relaxed);
+        }
+        Ok(result)
+    }
+}
+
+/// Reports how often a wait with a [`WaitPolicy`] was resolved in which phase. Waits that
+/// ended with a timeout or a sporadic wakeup are not counted and neither are waits with a
+/// blocking [`WaitPolicy`].
+#[derive(Default, Debug, Clone, Copy, PartialEq, Eq)]
+pub struct WaitStatistics {
+    /// The number of waits that were resolved while spinning.
+    pub resolved_by_spinning: u64,
+    /// The number of waits that were resolved while yielding.
+    pub resolved_by_yielding: u64,
+    /// The number of waits that were resolved while blocking.
+    pub resolved_by_blocking: u64,
+}
+
+#[derive(Debug)]
+pub(crate) struct WaitStatisticsCounter {
+    resolved_by_spinning: IoxAtomicU64,
+    resolved_by_yielding: IoxAtomicU64,
+    resolved_by_blocking: IoxAtomicU64,
+}
+
+impl Default for WaitStatisticsCounter {
+    fn default() -> Self {
+        Self {
+            resolved_by_spinning: IoxAtomicU64::new(0),
+            resolved_by_yielding: IoxAtomicU64::new(0),
+            resolved_by_blocking: IoxAtomicU64::new(0),
+        }
+    }
+}
+
+impl WaitStatisticsCounter {
+    pub(crate) fn load(&self) -> WaitStatistics {
+        WaitStatistics {
+            resolved_by_spinning: self.resolved_by_spinning.load(Ordering::Relaxed),
+            resolved_by_yielding: self.resolved_by_yielding.load(Ordering::Relaxed),
+            resolved_by_blocking: self.resolved_by_blocking.load(Ordering::Relaxed),
+        }
+    }
+}
@@ -31,6 +31,10 @@
 //!     wakes up and informs the user that the time has passed by.
 //!     This is useful when a [`Publisher`](crate::port::publisher::Publisher) shall send an
 //!     heartbeat every 100ms.
+//! * **Polling** - A predicate that the [`WaitSet`](crate::waitset::WaitSet) evaluates
+//!     whenever it waits. It is meant for objects without a file descriptor like a
+//!     [`Subscriber`](crate::port::subscriber::Subscriber) that shall be checked for new
+//!     samples without an additional notification.
 //!
 //! The [`WaitSet`](crate::waitset::WaitSet) allows the user to attach multiple
 //! [`Listener`](crate::port::listener::Listener) from multiple [`Node`](crate::node::Node)s,
@@ -214,7 +218,11 @@
 //! # }
 
 use core::{
-    cell::RefCell, fmt::Debug, hash::Hash, marker::PhantomData, sync::atomic::Ordering,
+    cell::{Cell, RefCell},
+    fmt::Debug,
+    hash::Hash,
+    marker::PhantomData,
+    sync::atomic::Ordering,
     time::Duration,
 };
 use std::collections::HashMap;
@@ -222,6 +230,7 @@ use std::collections::HashMap;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_log::fail;
 use iceoryx2_bb_posix::{
+    clock::{ClockType, Time},
     deadline_queue::{DeadlineQueue, DeadlineQueueBuilder, DeadlineQueueGuard, DeadlineQueueIndex},
     file_descriptor::FileDescriptor,
     file_descriptor_set::SynchronousMultiplexing,
@@ -231,6 +240,8 @@ use iceoryx2_cal::reactor::*;
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
 
 use crate::signal_handling_mode::SignalHandlingMode;
+use crate::tracepoint::tracepoint;
+use crate::wait_policy::{WaitPolicy, WaitStatistics, WaitStatisticsCounter};
 
 /// States why the [`WaitSet::wait_and_process()`] method returned.
 #[derive(Debug, PartialEq, Eq, Copy, Clone)]
@@ -304,13 +315,24 @@ enum AttachmentIdType {
     Tick(u64, DeadlineQueueIndex),
     Deadline(u64, i32, DeadlineQueueIndex),
     Notification(u64, i32),
+    Polling(u64, u64),
 }
 
-/// Represents an attachment to the [`WaitSet`]
+// Identifies the attachment that emitted an event independent of the event kind. The
+// notification and the missed deadline of a deadline attachment share the same origin.
+#[derive(Debug, Clone, Copy, Hash, Eq, PartialEq)]
+pub(crate) enum AttachmentOrigin {
+    Reactor(u64, i32),
+    DeadlineQueue(u64, DeadlineQueueIndex),
+    Polling(u64, u64),
+}
+
+/// Represents an attachment to the [`WaitSet`]. It contains only an identifier and can
+/// therefore be sent to and shared between threads.
 #[derive(Clone, Copy)]
 pub struct WaitSetAttachmentId<Service: crate::service::Service> {
     attachment_type: AttachmentIdType,
-    _data: PhantomData<Service>,
+    _data: PhantomData<fn() -> Service>,
 }
 
 impl<Service: crate::service::Service> Debug for WaitSetAttachmentId<Service> {
@@ -326,8 +348,8 @@ impl<Service: crate::service::Service> Debug for WaitSetAttachmentId<Service> {
 
 impl<Service: crate::service::Service> WaitSetAttachmentId<Service> {
     /// Creates an [`WaitSetAttachmentId`] from a [`WaitSetGuard`] that was returned via
-    /// [`WaitSet::attach_interval()`], [`WaitSet::attach_notification()`] or
-    /// [`WaitSet::attach_deadline()`].
+    /// [`WaitSet::attach_interval()`], [`WaitSet::attach_notification()`],
+    /// [`WaitSet::attach_deadline()`] or [`WaitSet::attach_polling()`].
     pub fn from_guard(guard: &WaitSetGuard<Service>) -> Self {
         match &guard.guard_type {
             GuardType::Tick(t) => WaitSetAttachmentId::tick(guard.waitset, t.index()),
@@ -341,6 +363,9 @@ impl<Service: crate::service::Service> WaitSetAttachmentId<Service> {
                     r.file_descriptor().native_handle()
                 })
             }
+            GuardType::Polling(polling_idx) => {
+                WaitSetAttachmentId::polling(guard.waitset, *polling_idx)
+            }
         }
     }
 }
@@ -407,10 +432,42 @@ impl<Service: crate::service::Service> WaitSetAttachmentId<Service> {
         }
     }
 
-    /// Returns true if an event was emitted from a notification or deadline attachment
-    /// corresponding to [`WaitSetGuard`].
+    fn polling(waitset: &WaitSet<Service>, polling_idx: u64) -> Self {
+        Self {
+            attachment_type: AttachmentIdType::Polling(
+                waitset as *const WaitSet<Service> as u64,
+                polling_idx,
+            ),
+            _data: PhantomData,
+        }
+    }
+
+    pub(crate) fn origin(&self) -> AttachmentOrigin {
+        match self.attachment_type {
+            AttachmentIdType::Tick(waitset, deadline_queue_idx) => {
+                AttachmentOrigin::DeadlineQueue(waitset, deadline_queue_idx)
+            }
+            AttachmentIdType::Deadline(waitset, reactor_idx, _)
+            | AttachmentIdType::Notification(waitset, reactor_idx) => {
+                AttachmentOrigin::Reactor(waitset, reactor_idx)
+            }
+            AttachmentIdType::Polling(waitset, polling_idx) => {
+                AttachmentOrigin::Polling(waitset, polling_idx)
+            }
+        }
+    }
+
+    /// Returns true if an event was emitted from a notification, deadline or polling
+    /// attachment corresponding to [`WaitSetGuard`].
     pub fn has_event_from(&self, other: &WaitSetGuard<Service>) -> bool {
-        let other_attachment = WaitSetAttachmentId::from_guard(other);
+        self.has_event_from_id(&WaitSetAttachmentId::from_guard(other))
+    }
+
+    /// Returns true if an event was emitted from a notification or deadline attachment
+    /// corresponding to the [`WaitSetAttachmentId`] that was created with
+    /// [`WaitSetAttachmentId::from_guard()`]. In contrast to the [`WaitSetGuard`], the
+    /// [`WaitSetAttachmentId`] can be used in callbacks that are called from other threads.
+    pub fn has_event_from_id(&self, other_attachment: &WaitSetAttachmentId<Service>) -> bool {
         if let AttachmentIdType::Deadline(other_waitset, other_reactor_idx, _) =
             other_attachment.attachment_type
         {
@@ -444,6 +501,7 @@ where
         DeadlineQueueGuard<'waitset>,
     ),
     Notification(<Service::Reactor as Reactor>::Guard<'waitset, 'attachment>),
+    Polling(u64),
 }
 
 /// Is returned when something is attached to the [`WaitSet`]. As soon as it goes out
@@ -458,18 +516,39 @@ where
 
 impl<Service: crate::service::Service> Drop for WaitSetGuard<'_, '_, Service> {
     fn drop(&mut self) {
-        if let GuardType::Deadline(r, t) = &self.guard_type {
-            self.waitset
-                .remove_deadline(unsafe { r.file_descriptor().native_handle() }, t.index())
+        match &self.guard_type {
+            GuardType::Deadline(r, t) => self
+                .waitset
+                .remove_deadline(unsafe { r.file_descriptor().native_handle() }, t.index()),
+            GuardType::Polling(polling_idx) => self.waitset.remove_polling(*polling_idx),
+            _ => (),
         }
         self.waitset.detach();
     }
 }
 
+/// The default interval in which a blocking [`WaitSet`] evaluates the attachments of
+/// [`WaitSet::attach_polling()`].
+pub const DEFAULT_POLL_INTERVAL: Duration = Duration::from_millis(1);
+
 /// The builder for the [`WaitSet`].
-#[derive(Default, Debug)]
+#[derive(Debug)]
 pub struct WaitSetBuilder {
     signal_handling_mode: SignalHandlingMode,
+    timer_slack: Duration,
+    wait_policy: WaitPolicy,
+    poll_interval: Duration,
+}
+
+impl Default for WaitSetBuilder {
+    fn default() -> Self {
+        Self {
+            signal_handling_mode: SignalHandlingMode::default(),
+            timer_slack: Duration::ZERO,
+            wait_policy: WaitPolicy::default(),
+            poll_interval: DEFAULT_POLL_INTERVAL,
+        }
+    }
 }
 
 impl WaitSetBuilder {
@@ -487,12 +566,42 @@ impl WaitSetBuilder {
         self
     }
 
+    /// Defines the timer slack of the [`WaitSet`]. Deadlines and intervals attached with
+    /// [`WaitSet::attach_deadline()`] and [`WaitSet::attach_interval()`] are delayed up to
+    /// the next multiple of the timer slack so that timeouts which are close to each other
+    /// are handled together with one wakeup. A timeout is never reported too early.
+    /// By default it is [`Duration::ZERO`].
+    pub fn timer_slack(mut self, value: Duration) -> Self {
+        self.timer_slack = value;
+        self
+    }
+
+    /// Defines the [`WaitPolicy`] of [`WaitSet::wait_and_process()`],
+    /// [`WaitSet::wait_and_process_once()`] and
+    /// [`WaitSet::wait_and_process_once_with_timeout()`]. By default the [`WaitSet`] blocks
+    /// immediately.
+    pub fn wait_policy(mut self, value: WaitPolicy) -> Self {
+        self.wait_policy = value;
+        self
+    }
+
+    /// Defines how often a blocking [`WaitSet`] evaluates the attachments of
+    /// [`WaitSet::attach_polling()`]. Since they cannot wake up the [`WaitSet`], it blocks at
+    /// most for the poll interval before it evaluates them again. A shorter interval reduces
+    /// the latency of the polling attachments but causes more wakeups, [`Duration::ZERO`]
+    /// busy polls. It has no effect as long as no polling attachment is attached.
+    /// By default it is [`DEFAULT_POLL_INTERVAL`].
+    pub fn poll_interval(mut self, value: Duration) -> Self {
+        self.poll_interval = value;
+        self
+    }
+
     /// Creates the [`WaitSet`].
     pub fn create<Service: crate::service::Service>(
         self,
     ) -> Result<WaitSet<Service>, WaitSetCreateError> {
         let msg = "Unable to create WaitSet";
-        let deadline_queue = fail!(from self, when DeadlineQueueBuilder::new().create(),
+        let deadline_queue = fail!(from self, when DeadlineQueueBuilder::new().timer_slack(self.timer_slack).create(),
                 with WaitSetCreateError::InternalError,
                 "{msg} since the underlying Timer could not be created.");
 
@@ -504,6 +613,11 @@ impl WaitSetBuilder {
                 deadline_to_attachment: RefCell::new(HashMap::new()),
                 attachment_counter: IoxAtomicUsize::new(0),
                 signal_handling_mode: self.signal_handling_mode,
+                wait_policy: self.wait_policy,
+                wait_statistics: WaitStatisticsCounter::default(),
+                polling_attachments: RefCell::new(vec![]),
+                polling_attachment_counter: Cell::new(0),
+                poll_interval: self.poll_interval,
             }),
             Err(ReactorCreateError::UnknownError(e)) => {
                 fail!(from self, with WaitSetCreateError::InternalError,
@@ -522,6 +636,8 @@ impl WaitSetBuilder {
 /// An struct must implement [`SynchronousMultiplexing`] to be attachable. The
 /// [`Listener`](crate::port::listener::Listener) can be attached as well as sockets or anything else that
 /// is [`FileDescriptorBased`](iceoryx2_bb_posix::file_descriptor::FileDescriptorBased).
+/// Everything else, like a [`Subscriber`](crate::port::subscriber::Subscriber), can be polled
+/// with [`WaitSet::attach_polling()`].
 ///
 /// Can be created via the [`WaitSetBuilder`].
 #[derive(Debug)]
@@ -532,6 +648,25 @@ pub struct WaitSet<Service: crate::service::Service> {
     deadline_to_attachment: RefCell<HashMap<DeadlineQueueIndex, i32>>,
     attachment_counter: IoxAtomicUsize,
     signal_handling_mode: SignalHandlingMode,
+    wait_policy: WaitPolicy,
+    wait_statistics: WaitStatisticsCounter,
+    polling_attachments: RefCell<Vec<PollingAttachment>>,
+    polling_attachment_counter: Cell<u64>,
+    poll_interval: Duration,
+}
+
+// A predicate that is evaluated in every wait of the WaitSet. The index is taken from a
+// counter that only grows, so that an index is never reused by a later attachment.
+struct PollingAttachment {
+    index: u64,
+    predicate: Box<dyn Fn() -> bool>,
+    is_suspended: Cell<bool>,
+}
+
+impl Debug for PollingAttachment {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "PollingAttachment {{ polling_idx: {} }}", self.index)
+    }
 }
 
 impl<Service: crate::service::Service> WaitSet<Service> {
@@ -558,6 +693,130 @@ impl<Service: crate::service::Service> WaitSet<Service> {
             .remove(&deadline_queue_idx);
     }
 
+    fn remove_polling(&self, polling_idx: u64) {
+        self.polling_attachments
+            .borrow_mut()
+            .retain(|attachment| attachment.index != polling_idx);
+    }
+
+    // Excludes the attachment that emitted the event from all waits until
+    // `resume_attachment()` is called, so that the events it still holds do not wake up the
+    // WaitSet over and over again. Ticks and missed deadlines are always reported.
+    pub(crate) fn suspend_attachment(
+        &self,
+        attachment_id: &WaitSetAttachmentId<Service>,
+    ) -> Result<(), ReactorModifyError> {
+        self.set_attachment_suspended(attachment_id, true)
+    }
+
+    pub(crate) fn resume_attachment(
+        &self,
+        attachment_id: &WaitSetAttachmentId<Service>,
+    ) -> Result<(), ReactorModifyError> {
+        self.set_attachment_suspended(attachment_id, false)
+    }
+
+    fn set_attachment_suspended(
+        &self,
+        attachment_id: &WaitSetAttachmentId<Service>,
+        value: bool,
+    ) -> Result<(), ReactorModifyError> {
+        match attachment_id.origin() {
+            AttachmentOrigin::Reactor(_, reactor_idx) => {
+                let fd = match FileDescriptor::non_owning_new(reactor_idx) {
+                    Some(fd) => fd,
+                    None => {
+                        fail!(from self, with ReactorModifyError::NotAttached,
+                            "Unable to modify the attachment {reactor_idx} since its file descriptor is no longer valid.");
+                    }
+                };
+
+                if value {
+                    self.reactor.suspend(&fd)
+                } else {
+                    self.reactor.resume(&fd)
+                }
+            }
+            AttachmentOrigin::Polling(_, polling_idx) => {
+                match self
+                    .polling_attachments
+                    .borrow()
+                    .iter()
+                    .find(|attachment| attachment.index == polling_idx)
+                {
+                    Some(attachment) => {
+                        attachment.is_suspended.set(value);
+                        Ok(())
+                    }
+                    None => {
+                        fail!(from self, with ReactorModifyError::NotAttached,
+                            "Unable to modify the polling attachment {polling_idx} since it is not attached.");
+                    }
+                }
+            }
+            AttachmentOrigin::DeadlineQueue(..) => Ok(()),
+        }
+    }
+
+    fn poll_attachments(&self, triggered_polling_attachments: &mut Vec<u64>) {
+        for attachment in self.polling_attachments.borrow().iter() {
+            if !attachment.is_suspended.get() && (attachment.predicate)() {
+                triggered_polling_attachments.push(attachment.index);
+            }
+        }
+    }
+
+    // The polling attachments cannot wake up the reactor, therefore the reactor waits at
+    // most for the poll interval before the polling attachments are evaluated again.
+    fn wait_with_polling<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Duration,
+        triggered_polling_attachments: &mut Vec<u64>,
+        mut collect_triggered_fds: F,
+    ) -> Result<usize, ReactorWaitError> {
+        // when the clock is not available a finite timeout is handled like a try wait
+        let start = Time::now_with_clock(ClockType::Monotonic).ok();
+
+        loop {
+            self.poll_attachments(triggered_polling_attachments);
+
+            let remaining = if timeout == Duration::MAX {
+                Duration::MAX
+            } else {
+                let elapsed = start
+                    .as_ref()
+                    .and_then(|s| s.elapsed().ok())
+                    .unwrap_or(Duration::MAX);
+                timeout.saturating_sub(elapsed)
+            };
+
+            let reactor_timeout = if triggered_polling_attachments.is_empty() {
+                remaining.min(self.poll_interval)
+            } else {
+                Duration::ZERO
+            };
+
+            let number_of_notifications = if reactor_timeout == Duration::MAX {
+                self.reactor.blocking_wait(&mut collect_triggered_fds)?
+            } else if reactor_timeout.is_zero() {
+                self.reactor.try_wait(&mut collect_triggered_fds)?
+            } else {
+                self.reactor
+                    .timed_wait(&mut collect_triggered_fds, reactor_timeout)?
+            };
+
+            // a polling attachment may have become ready while the reactor was waiting
+            if number_of_notifications > 0 && triggered_polling_attachments.is_empty() {
+                self.poll_attachments(triggered_polling_attachments);
+            }
+
+            let number_of_events = number_of_notifications + triggered_polling_attachments.len();
+            if number_of_events > 0 || reactor_timeout == remaining {
+                return Ok(number_of_events);
+            }
+        }
+    }
+
     fn reset_deadline(
         &self,
         reactor_idx: i32,
@@ -606,6 +865,7 @@ impl<Service: crate::service::Service> WaitSet<Service> {
     fn handle_all_attachments<F: FnMut(WaitSetAttachmentId<Service>) -> CallbackProgression>(
         &self,
         triggered_file_descriptors: &Vec<i32>,
+        triggered_polling_attachments: &Vec<u64>,
         fn_call: &mut F,
         error_msg: &str,
     ) -> Result<WaitSetRunResult, WaitSetRunError> {
@@ -626,12 +886,22 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         };
 
         for fd in triggered_file_descriptors {
+            tracepoint!(waitset_notification, *fd);
             if let CallbackProgression::Stop = fn_call(WaitSetAttachmentId::notification(self, *fd))
             {
                 return Ok(WaitSetRunResult::StopRequest);
             }
         }
 
+        for polling_idx in triggered_polling_attachments {
+            tracepoint!(waitset_polling, *polling_idx);
+            if let CallbackProgression::Stop =
+                fn_call(WaitSetAttachmentId::polling(self, *polling_idx))
+            {
+                return Ok(WaitSetRunResult::StopRequest);
+            }
+        }
+
         Ok(WaitSetRunResult::AllEventsHandled)
     }
 
@@ -697,6 +967,69 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         })
     }
 
+    /// Attaches a predicate that is polled by the [`WaitSet`]. It is meant for objects that
+    /// are not [`SynchronousMultiplexing`] like a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) that is checked with
+    /// [`Subscriber::has_samples()`](crate::port::subscriber::Subscriber::has_samples()), so
+    /// that no additional event service and notification is required. Whenever the predicate
+    /// returns true, the [`WaitSet`] informs the user in [`WaitSet::wait_and_process()`].
+    ///
+    /// The predicate is evaluated in every spin and yield iteration of the [`WaitPolicy`] and
+    /// at least every [`WaitSetBuilder::poll_interval()`] while the [`WaitSet`] blocks. It
+    /// must be cheap, must not block and must not attach to or detach from the [`WaitSet`].
+    ///
+    /// # Example
+    ///
+    /// ```no_run
+    /// use iceoryx2::prelude::*;
+    /// use std::rc::Rc;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"MyServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .open_or_create()?;
+    ///
+    /// let subscriber = Rc::new(service.subscriber_builder().create()?);
+    ///
+    /// let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+    /// let polled_subscriber = subscriber.clone();
+    /// let guard =
+    ///     waitset.attach_polling(move || polled_subscriber.has_samples().unwrap_or(false))?;
+    ///
+    /// waitset.wait_and_process_once(|attachment_id| {
+    ///     if attachment_id.has_event_from(&guard) {
+    ///         while let Ok(Some(sample)) = subscriber.receive() {
+    ///             println!("received: {:?}", *sample);
+    ///         }
+    ///     }
+    ///     CallbackProgression::Continue
+    /// })?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn attach_polling<F: Fn() -> bool + 'static>(
+        &self,
+        predicate: F,
+    ) -> Result<WaitSetGuard<Service>, WaitSetAttachmentError> {
+        self.attach()?;
+
+        let polling_idx = self.polling_attachment_counter.get();
+        self.polling_attachment_counter.set(polling_idx + 1);
+        self.polling_attachments
+            .borrow_mut()
+            .push(PollingAttachment {
+                index: polling_idx,
+                predicate: Box::new(predicate),
+                is_suspended: Cell::new(false),
+            });
+
+        Ok(WaitSetGuard {
+            waitset: self,
+            guard_type: GuardType::Polling(polling_idx),
+        })
+    }
+
     /// Waits until an event arrives on the [`WaitSet`], then collects all events by calling the
     /// provided `fn_call` callback with the corresponding [`WaitSetAttachmentId`]. In contrast
     /// to [`WaitSet::wait_and_process_once()`] it will never return until the user explicitly
@@ -889,24 +1222,56 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         let next_timeout = next_timeout.min(timeout);
 
         let mut triggered_file_descriptors = vec![];
-        let collect_triggered_fds = |fd: &FileDescriptor| {
+        let mut triggered_polling_attachments = vec![];
+        let has_polling_attachments = !self.polling_attachments.borrow().is_empty();
+        let mut collect_triggered_fds = |fd: &FileDescriptor| {
             let fd = unsafe { fd.native_handle() };
             triggered_file_descriptors.push(fd);
         };
 
+        let reactor_timeout = if self.deadline_queue.is_empty() || next_timeout == Duration::MAX {
+            Duration::MAX
+        } else {
+            next_timeout
+        };
+
         // Collect all triggered file descriptors. We need to collect them first, then reset
         // the deadline and then call the callback, otherwise a long callback may destroy the
         // deadline contract.
-        let reactor_wait_result = if self.deadline_queue.is_empty() || next_timeout == Duration::MAX
-        {
-            self.reactor.blocking_wait(collect_triggered_fds)
-        } else {
-            self.reactor.timed_wait(collect_triggered_fds, next_timeout)
-        };
+        let reactor_wait_result = self
+            .wait_policy
+            .wait(
+                &self.wait_statistics,
+                reactor_timeout,
+                |timeout| -> Result<Option<usize>, ReactorWaitError> {
+                    let number_of_notifications = if has_polling_attachments {
+                        self.wait_with_polling(
+                            timeout,
+                            &mut triggered_polling_attachments,
+                            &mut collect_triggered_fds,
+                        )?
+                    } else if timeout == Duration::MAX {
+                        self.reactor.blocking_wait(&mut collect_triggered_fds)?
+                    } else if timeout.is_zero() {
+                        self.reactor.try_wait(&mut collect_triggered_fds)?
+                    } else {
+                        self.reactor
+                            .timed_wait(&mut collect_triggered_fds, timeout)?
+                    };
+
+                    Ok((number_of_notifications > 0).then_some(number_of_notifications))
+                },
+            )
+            .map(|v| v.unwrap_or(0));
 
         match reactor_wait_result {
             Ok(0) => self.handle_deadlines(&mut fn_call, msg),
-            Ok(_) => self.handle_all_attachments(&triggered_file_descriptors, &mut fn_call, msg),
+            Ok(_) => self.handle_all_attachments(
+                &triggered_file_descriptors,
+                &triggered_polling_attachments,
+                &mut fn_call,
+                msg,
+            ),
             Err(ReactorWaitError::Interrupt) => Ok(WaitSetRunResult::Interrupt),
             Err(ReactorWaitError::InsufficientPermissions) => {
                 fail!(from self, with WaitSetRunError::InsufficientPermissions,
@@ -939,6 +1304,27 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         self.signal_handling_mode
     }
 
+    /// Returns the timer slack with which the [`WaitSet`] was created.
+    pub fn timer_slack(&self) -> Duration {
+        self.deadline_queue.timer_slack()
+    }
+
+    /// Returns the [`WaitPolicy`] with which the [`WaitSet`] was created.
+    pub fn wait_policy(&self) -> WaitPolicy {
+        self.wait_policy
+    }
+
+    /// Returns the poll interval with which the [`WaitSet`] was created.
+    pub fn poll_interval(&self) -> Duration {
+        self.poll_interval
+    }
+
+    /// Returns how often the waits of the [`WaitSet`] were resolved in which phase of the
+    /// [`WaitPolicy`].
+    pub fn wait_statistics(&self) -> WaitStatistics {
+        self.wait_statistics.load()
+    }
+
     fn attach_to_reactor<'waitset, 'attachment, T: SynchronousMultiplexing + Debug>(
         &'waitset self,
         attachment: &'attachment T,
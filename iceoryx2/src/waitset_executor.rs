@@ -0,0 +1,528 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! The [`WaitSetExecutor`] waits on a [`WaitSet`] in the calling thread and
+//! dispatches every event to a pool of worker threads. A slow callback of one attachment
+//! therefore does not delay the handling of the other attachments. The events of one
+//! attachment are never processed concurrently, so the callback never handles the same
+//! [`Listener`](crate::port::listener::Listener) in two threads at once.
+//!
+//! Since the callback is called from multiple threads it must be [`Sync`]. The
+//! [`WaitSetGuard`](crate::waitset::WaitSetGuard) cannot be shared with the worker threads,
+//! therefore the attachments are identified with
+//! [`WaitSetAttachmentId::has_event_from_id()`].
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::waitset_executor::WaitSetExecutorBuilder;
+//! # use core::time::Duration;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+//! let fast_guard = waitset.attach_interval(Duration::from_millis(10))?;
+//! let slow_guard = waitset.attach_interval(Duration::from_millis(100))?;
+//! let fast_id = WaitSetAttachmentId::from_guard(&fast_guard);
+//! let slow_id = WaitSetAttachmentId::from_guard(&slow_guard);
+//!
+//! let executor = WaitSetExecutorBuilder::new()
+//!     .number_of_threads(2)
+//!     .create(&waitset);
+//!
+//! executor.run(|attachment_id| {
+//!     if attachment_id.has_event_from_id(&fast_id) {
+//!         println!("fast interval");
+//!     } else if attachment_id.has_event_from_id(&slow_id) {
+//!         // does not delay the fast interval
+//!         std::thread::sleep(Duration::from_millis(50));
+//!     }
+//!
+//!     CallbackProgression::Continue
+//! })?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use std::collections::{HashMap, VecDeque};
+use std::sync::{Condvar, Mutex, MutexGuard};
+
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_posix::{
+    config::temp_directory,
+    creation_mode::CreationMode,
+    scheduler::Scheduler,
+    thread::{Thread, ThreadBuilder, ThreadName},
+    unique_system_id::UniqueSystemId,
+    unix_datagram_socket::{
+        UnixDatagramReceiver, UnixDatagramReceiverBuilder, UnixDatagramSender,
+        UnixDatagramSenderBuilder,
+    },
+};
+use iceoryx2_bb_system_types::{file_name::FileName, file_path::FilePath};
+
+use crate::waitset::{
+    AttachmentOrigin, WaitSet, WaitSetAttachmentId, WaitSetRunError, WaitSetRunResult,
+};
+
+/// The builder for the [`WaitSetExecutor`].
+#[derive(Debug, Clone)]
+pub struct WaitSetExecutorBuilder {
+    number_of_threads: usize,
+    cpu_affinity: Vec<usize>,
+    priority: Option<u8>,
+    scheduler: Option<Scheduler>,
+}
+
+impl Default for WaitSetExecutorBuilder {
+    fn default() -> Self {
+        Self {
+            number_of_threads: 1,
+            cpu_affinity: vec![],
+            priority: None,
+            scheduler: None,
+        }
+    }
+}
+
+impl WaitSetExecutorBuilder {
+    /// Creates a new [`WaitSetExecutorBuilder`].
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Defines the number of worker threads that call the callback. It is at least 1.
+    pub fn number_of_threads(mut self, value: usize) -> Self {
+        self.number_of_threads = value.max(1);
+        self
+    }
+
+    /// Defines the CPU cores on which the worker threads run. The worker `n` is pinned to
+    /// the CPU core `value[n % value.len()]`. By default the workers can run on every core.
+    pub fn cpu_affinity(mut self, value: &[usize]) -> Self {
+        self.cpu_affinity = value.to_vec();
+        self
+    }
+
+    /// Defines the priority of the worker threads whereby `0` represents the lowest and
+    /// `255` the highest priority. By default the workers inherit the scheduling attributes
+    /// of the thread that calls [`WaitSetExecutor::run()`].
+    ///
+    /// The priority has no effect with the default time sharing scheduler of most
+    /// platforms, therefore the workers use [`Scheduler::Fifo`] when no
+    /// [`WaitSetExecutorBuilder::scheduler()`] is defined.
+    pub fn priority(mut self, value: u8) -> Self {
+        self.priority = Some(value);
+        self
+    }
+
+    /// Defines the [`Scheduler`] of the worker threads. By default the workers inherit the
+    /// scheduling attributes of the thread that calls [`WaitSetExecutor::run()`].
+    pub fn scheduler(mut self, value: Scheduler) -> Self {
+        self.scheduler = Some(value);
+        self
+    }
+
+    /// Creates the [`WaitSetExecutor`] for the provided [`WaitSet`].
+    pub fn create<Service: crate::service::Service>(
+        self,
+        waitset: &WaitSet<Service>,
+    ) -> WaitSetExecutor<'_, Service> {
+        WaitSetExecutor {
+            waitset,
+            config: self,
+        }
+    }
+
+    fn thread_builder(&self, worker_idx: usize) -> ThreadBuilder {
+        let mut builder = ThreadBuilder::new().name(&ThreadName::from_bytes_truncated(
+            format!("iox2-ws-w{}", worker_idx).as_bytes(),
+        ));
+
+        if !self.cpu_affinity.is_empty() {
+            builder = builder.affinity(self.cpu_affinity[worker_idx % self.cpu_affinity.len()]);
+        }
+
+        if self.priority.is_some() || self.scheduler.is_some() {
+            builder = builder.inherit_scheduling_attributes(false);
+        }
+
+        match (self.scheduler, self.priority) {
+            (Some(scheduler), _) => builder = builder.scheduler(scheduler),
+            (None, Some(_)) => builder = builder.scheduler(Scheduler::Fifo),
+            (None, None) => (),
+        }
+
+        if let Some(priority) = self.priority {
+            builder = builder.priority(priority);
+        }
+
+        builder
+    }
+}
+
+#[derive(Debug)]
+struct DispatchState<Service: crate::service::Service> {
+    // every attachment that is currently processed by a worker with the events that
+    // arrived in the meantime
+    in_flight: HashMap<AttachmentOrigin, VecDeque<WaitSetAttachmentId<Service>>>,
+    // the attachments whose processing has finished and that must be resumed by the
+    // dispatcher
+    completed: Vec<WaitSetAttachmentId<Service>>,
+    number_of_queued: usize,
+    next_worker: usize,
+    keep_running: bool,
+    stop_requested: bool,
+}
+
+#[derive(Debug)]
+struct WorkerPool<Service: crate::service::Service> {
+    queues: Vec<Mutex<VecDeque<WaitSetAttachmentId<Service>>>>,
+    state: Mutex<DispatchState<Service>>,
+    has_work: Condvar,
+}
+
+impl<Service: crate::service::Service> WorkerPool<Service> {
+    fn new(number_of_workers: usize) -> Self {
+        Self {
+            queues: (0..number_of_workers)
+                .map(|_| Mutex::new(VecDeque::new()))
+                .collect(),
+            state: Mutex::new(DispatchState {
+                in_flight: HashMap::new(),
+                completed: vec![],
+                number_of_queued: 0,
+                next_worker: 0,
+                keep_running: true,
+                stop_requested: false,
+            }),
+            has_work: Condvar::new(),
+        }
+    }
+
+    fn state(&self) -> MutexGuard<'_, DispatchState<Service>> {
+        self.state.lock().unwrap()
+    }
+
+    // Marks the attachments of the ids as in flight and stores them in `new_ids`. Ids whose
+    // attachment is already in flight are handled by the same worker afterwards.
+    fn acquire(
+        &self,
+        attachment_ids: &[WaitSetAttachmentId<Service>],
+        new_ids: &mut Vec<WaitSetAttachmentId<Service>>,
+    ) {
+        let mut state = self.state();
+
+        for id in attachment_ids {
+            if let Some(pending) = state.in_flight.get_mut(&id.origin()) {
+                if !pending.contains(id) {
+                    pending.push_back(*id);
+                }
+                continue;
+            }
+
+            state.in_flight.insert(id.origin(), VecDeque::new());
+            new_ids.push(*id);
+        }
+    }
+
+    // Hands the ids that were acquired with `acquire()` to the workers.
+    fn dispatch(&self, attachment_ids: &[WaitSetAttachmentId<Service>]) {
+        let mut state = self.state();
+
+        for id in attachment_ids {
+            let worker = state.next_worker;
+            state.next_worker = (worker + 1) % self.queues.len();
+            state.number_of_queued += 1;
+            self.queues[worker].lock().unwrap().push_back(*id);
+        }
+
+        match attachment_ids.len() {
+            0 => (),
+            1 => self.has_work.notify_one(),
+            _ => self.has_work.notify_all(),
+        }
+    }
+
+    fn take_completed(&self, completed_ids: &mut Vec<WaitSetAttachmentId<Service>>) {
+        completed_ids.append(&mut self.state().completed);
+    }
+
+    fn shutdown(&self) {
+        self.state().keep_running = false;
+        self.has_work.notify_all();
+    }
+
+    // takes the next id from the own queue, when it is empty the oldest id of another
+    // worker is stolen
+    fn take_work(&self, worker_idx: usize) -> Option<WaitSetAttachmentId<Service>> {
+        let number_of_workers = self.queues.len();
+        if let Some(id) = self.queues[worker_idx].lock().unwrap().pop_front() {
+            return Some(id);
+        }
+
+        (1..number_of_workers).find_map(|n| {
+            self.queues[(worker_idx + n) % number_of_workers]
+                .lock()
+                .unwrap()
+                .pop_back()
+        })
+    }
+
+    fn run_worker<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression>(
+        &self,
+        worker_idx: usize,
+        fn_call: &F,
+        wakeup: &UnixDatagramSender,
+    ) {
+        loop {
+            let mut id = match self.take_work(worker_idx) {
+                Some(id) => {
+                    let mut state = self.state();
+                    state.number_of_queued -= 1;
+                    // all unhandled events are discarded after a stop request
+                    if !state.keep_running {
+                        return;
+                    }
+                    id
+                }
+                None => {
+                    let mut state = self.state();
+                    while state.keep_running && state.number_of_queued == 0 {
+                        state = self.has_work.wait(state).unwrap();
+                    }
+
+                    if !state.keep_running {
+                        return;
+                    }
+                    continue;
+                }
+            };
+
+            // processes all events of the attachment that arrived while it was processed
+            loop {
+                let progression = fn_call(id);
+
+                let mut state = self.state();
+                if progression == CallbackProgression::Stop && !state.stop_requested {
+                    state.stop_requested = true;
+                    if let Err(e) = wakeup.try_send(&[0]) {
+                        warn!(from "WaitSetExecutor::run()",
+                            "Unable to wake up the dispatcher after a stop request ({:?}). The stop request is handled with the next event.", e);
+                    }
+                }
+
+                let next_id = match state.in_flight.get_mut(&id.origin()) {
+                    Some(pending) => pending.pop_front(),
+                    None => None,
+                };
+
+                match next_id {
+                    Some(next_id) if state.keep_running && !state.stop_requested => id = next_id,
+                    _ => {
+                        state.in_flight.remove(&id.origin());
+                        // ticks are never suspended and do not need to be resumed
+                        if !matches!(id.origin(), AttachmentOrigin::DeadlineQueue(..)) {
+                            state.completed.push(id);
+                            if state.completed.len() == 1 {
+                                if let Err(e) = wakeup.try_send(&[0]) {
+                                    warn!(from "WaitSetExecutor::run()",
+                                        "Unable to wake up the dispatcher after the attachment was processed ({:?}). The attachment is resumed with the next event.", e);
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Waits on a [`WaitSet`] and dispatches the events to a pool of worker threads. Created by
+/// the [`WaitSetExecutorBuilder`].
+#[derive(Debug)]
+pub struct WaitSetExecutor<'waitset, Service: crate::service::Service> {
+    waitset: &'waitset WaitSet<Service>,
+    config: WaitSetExecutorBuilder,
+}
+
+impl<Service: crate::service::Service> WaitSetExecutor<'_, Service> {
+    /// Returns the number of worker threads.
+    pub fn number_of_threads(&self) -> usize {
+        self.config.number_of_threads
+    }
+
+    fn suspend(&self, attachment_id: &WaitSetAttachmentId<Service>) -> bool {
+        match self.waitset.suspend_attachment(attachment_id) {
+            Ok(()) => true,
+            Err(e) => {
+                warn!(from self,
+                    "Unable to suspend the attachment while it is processed ({:?}). Its events may wake up the dispatcher until it is processed.", e);
+                false
+            }
+        }
+    }
+
+    fn resume(&self, attachment_id: &WaitSetAttachmentId<Service>) {
+        if let Err(e) = self.waitset.resume_attachment(attachment_id) {
+            warn!(from self,
+                "Unable to resume the attachment after it was processed ({:?}). It does not wake up the WaitSet anymore.", e);
+        }
+    }
+
+    fn create_wakeup(&self) -> Result<(UnixDatagramReceiver, UnixDatagramSender), WaitSetRunError> {
+        let msg = "Unable to create the wakeup mechanism of the WaitSetExecutor";
+        let id = fail!(from self, when UniqueSystemId::new(),
+            with WaitSetRunError::InternalError,
+            "{msg} since no unique id could be generated.");
+
+        let file_name = fail!(from self,
+            when FileName::new(format!("iox2_waitset_executor_{}", id.value()).as_bytes()),
+            with WaitSetRunError::InternalError,
+            "{msg} since the socket name is invalid.");
+        let socket_name = fail!(from self,
+            when FilePath::from_path_and_file(&temp_directory(), &file_name),
+            with WaitSetRunError::InternalError,
+            "{msg} since the socket path is invalid.");
+
+        let receiver = fail!(from self,
+            when UnixDatagramReceiverBuilder::new(&socket_name)
+                .creation_mode(CreationMode::PurgeAndCreate)
+                .create(),
+            with WaitSetRunError::InternalError,
+            "{msg} since the receiving socket could not be created.");
+        let sender = fail!(from self,
+            when UnixDatagramSenderBuilder::new(&socket_name).create(),
+            with WaitSetRunError::InternalError,
+            "{msg} since the sending socket could not be created.");
+
+        Ok((receiver, sender))
+    }
+
+    /// Waits on the [`WaitSet`] until the user explicitly requests to stop by returning
+    /// [`CallbackProgression::Stop`] or a signal was received, like
+    /// [`WaitSet::wait_and_process()`]. Every event is handed to one of the worker threads
+    /// which calls `fn_call` with the corresponding [`WaitSetAttachmentId`]. The events of
+    /// one attachment are never handled concurrently. Events that arrive while the
+    /// attachment is handled are handled afterwards by the same worker.
+    ///
+    /// While an attachment is handled it is suspended in the [`WaitSet`], so that its
+    /// unconsumed events do not wake up the dispatcher over and over again. Therefore, a
+    /// deadline attachment whose callback runs longer than its deadline reports a missed
+    /// deadline afterwards.
+    ///
+    /// When the callback returns [`CallbackProgression::Stop`] all events that were not yet
+    /// handled are lost and the call returns [`WaitSetRunResult::StopRequest`] after all
+    /// callbacks that are currently running have returned.
+    pub fn run<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync>(
+        &self,
+        fn_call: F,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        let msg = "Unable to run the WaitSetExecutor";
+        if self.waitset.is_empty() {
+            fail!(from self, with WaitSetRunError::NoAttachments,
+                "{msg} since the WaitSet has no attachments, therefore the call would end up in a deadlock.");
+        }
+
+        let (wakeup_receiver, wakeup_sender) = self.create_wakeup()?;
+        let wakeup_guard = fail!(from self,
+            when self.waitset.attach_notification(&wakeup_receiver),
+            with WaitSetRunError::InternalError,
+            "{msg} since the wakeup mechanism could not be attached to the WaitSet.");
+        let wakeup_id = WaitSetAttachmentId::from_guard(&wakeup_guard);
+
+        let pool = WorkerPool::<Service>::new(self.config.number_of_threads);
+        let mut workers: Vec<Thread> = Vec::with_capacity(self.config.number_of_threads);
+        for worker_idx in 0..self.config.number_of_threads {
+            let pool = &pool;
+            let fn_call = &fn_call;
+            let wakeup_sender = &wakeup_sender;
+            match self
+                .config
+                .thread_builder(worker_idx)
+                .spawn(move || pool.run_worker(worker_idx, fn_call, wakeup_sender))
+            {
+                Ok(thread) => workers.push(thread),
+                Err(e) => {
+                    pool.shutdown();
+                    drop(workers);
+                    fail!(from self, with WaitSetRunError::InternalError,
+                        "{msg} since the worker thread {worker_idx} could not be spawned ({:?}).", e);
+                }
+            }
+        }
+
+        let mut triggered_ids = vec![];
+        let mut new_ids = vec![];
+        let mut completed_ids = vec![];
+        let mut suspended_ids = vec![];
+        let result = loop {
+            triggered_ids.clear();
+            new_ids.clear();
+            let wait_result = self.waitset.wait_and_process_once(|id| {
+                if id == wakeup_id {
+                    let mut buffer = [0u8; 16];
+                    while let Ok(n) = wakeup_receiver.try_receive(&mut buffer) {
+                        if n == 0 {
+                            break;
+                        }
+                    }
+                } else {
+                    triggered_ids.push(id);
+                }
+                CallbackProgression::Continue
+            });
+
+            match wait_result {
+                Ok(WaitSetRunResult::AllEventsHandled) => (),
+                Ok(v) => break Ok(v),
+                Err(e) => break Err(e),
+            }
+
+            if pool.state().stop_requested {
+                break Ok(WaitSetRunResult::StopRequest);
+            }
+
+            pool.take_completed(&mut completed_ids);
+            for id in completed_ids.drain(..) {
+                if let Some(n) = suspended_ids
+                    .iter()
+                    .position(|suspended_id| suspended_id.origin() == id.origin())
+                {
+                    self.resume(&suspended_ids.swap_remove(n));
+                }
+            }
+
+            pool.acquire(&triggered_ids, &mut new_ids);
+            for id in &new_ids {
+                if !matches!(id.origin(), AttachmentOrigin::DeadlineQueue(..)) && self.suspend(id) {
+                    suspended_ids.push(*id);
+                }
+            }
+            pool.dispatch(&new_ids);
+        };
+
+        pool.shutdown();
+        // joins all workers
+        drop(workers);
+
+        for id in &suspended_ids {
+            self.resume(id);
+        }
+
+        result
+    }
+}
@@ -12,12 +12,18 @@
 
 #[generic_tests::define]
 mod listener {
+    use core::time::Duration;
     use std::collections::HashSet;
+    use std::sync::Barrier;
+    use std::time::Instant;
 
     use iceoryx2::testing::*;
+    use iceoryx2::wait_policy::{WaitPolicy, WaitStatistics};
     use iceoryx2::{node::NodeBuilder, port::listener::ListenerCreateError, service::Service};
     use iceoryx2_bb_testing::assert_that;
 
+    const TIMEOUT: Duration = Duration::from_millis(25);
+
     #[test]
     fn create_error_display_works<S: Service>() {
         assert_that!(
@@ -50,6 +56,147 @@ mod listener {
         }
     }
 
+    #[test]
+    fn wait_policy_can_be_configured<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let wait_policy = WaitPolicy::new(Duration::from_micros(50), Duration::from_micros(100));
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener_1 = sut.listener_builder().create().unwrap();
+        let listener_2 = sut
+            .listener_builder()
+            .wait_policy(wait_policy)
+            .create()
+            .unwrap();
+
+        assert_that!(listener_1.wait_policy(), eq WaitPolicy::blocking());
+        assert_that!(listener_2.wait_policy(), eq wait_policy);
+    }
+
+    #[test]
+    fn wait_resolved_while_spinning_is_counted<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut
+            .listener_builder()
+            .wait_policy(WaitPolicy::new(Duration::from_secs(60), Duration::ZERO))
+            .create()
+            .unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        notifier.notify().unwrap();
+        let event_id = listener.blocking_wait_one().unwrap();
+
+        assert_that!(event_id, is_some);
+        let statistics = listener.wait_statistics();
+        assert_that!(statistics.resolved_by_spinning, eq 1);
+        assert_that!(statistics.resolved_by_yielding, eq 0);
+        assert_that!(statistics.resolved_by_blocking, eq 0);
+    }
+
+    #[test]
+    fn wait_resolved_while_blocking_is_counted<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+        let barrier = Barrier::new(2);
+
+        std::thread::scope(|s| {
+            let t = s.spawn(|| {
+                let listener = sut
+                    .listener_builder()
+                    .wait_policy(WaitPolicy::new(
+                        Duration::from_micros(1),
+                        Duration::from_micros(1),
+                    ))
+                    .create()
+                    .unwrap();
+                barrier.wait();
+
+                let mut counter = 0;
+                listener.blocking_wait_all(|_| counter += 1).unwrap();
+
+                assert_that!(counter, eq 1);
+                let statistics = listener.wait_statistics();
+                assert_that!(statistics.resolved_by_spinning, eq 0);
+                assert_that!(statistics.resolved_by_yielding, eq 0);
+                assert_that!(statistics.resolved_by_blocking, eq 1);
+            });
+
+            barrier.wait();
+            std::thread::sleep(Duration::from_millis(100));
+            notifier.notify().unwrap();
+            t.join().unwrap();
+        });
+    }
+
+    #[test]
+    fn waits_with_blocking_policy_are_not_counted<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        notifier.notify().unwrap();
+        let mut counter = 0;
+        listener.blocking_wait_all(|_| counter += 1).unwrap();
+
+        assert_that!(counter, eq 1);
+        assert_that!(listener.wait_statistics(), eq WaitStatistics::default());
+    }
+
+    #[test]
+    fn timed_wait_with_wait_policy_respects_timeout<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut
+            .listener_builder()
+            .wait_policy(WaitPolicy::new(TIMEOUT / 5, TIMEOUT / 5))
+            .create()
+            .unwrap();
+
+        let start = Instant::now();
+        let event_id = listener.timed_wait_one(TIMEOUT).unwrap();
+
+        assert_that!(event_id, is_none);
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+        assert_that!(listener.wait_statistics(), eq WaitStatistics::default());
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
@@ -20,6 +20,7 @@ mod node_death_tests {
     use iceoryx2::prelude::*;
     use iceoryx2::service::Service;
     use iceoryx2::testing::*;
+    use iceoryx2::tracker::node::Tracker;
     use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
     use iceoryx2_bb_testing::watchdog::Watchdog;
     use iceoryx2_bb_testing::{assert_that, test_fail};
@@ -463,6 +464,43 @@ mod node_death_tests {
         assert_that!(number_of_nodes(), eq 0);
     }
 
+    #[test]
+    fn node_tracker_reports_dead_node_as_changed_and_cleaned_up_node_as_removed<S: Test>() {
+        let mut config = generate_isolated_config();
+        config.global.node.cleanup_dead_nodes_on_creation = false;
+
+        let mut sut = Tracker::<S::Service>::new(&config);
+        let mut node = S::create_test_node(&config).node;
+        let node_id = *node.id();
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, eq vec![node_id]);
+        assert_that!(matches!(sut.get(&node_id), Some(NodeState::Alive(_))), eq true);
+
+        S::staged_death(&mut node);
+        core::mem::forget(node);
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, len 0);
+        assert_that!(changes.changed, eq vec![node_id]);
+        assert_that!(matches!(sut.get(&node_id), Some(NodeState::Dead(_))), eq true);
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.is_empty(), eq true);
+
+        match sut.get(&node_id) {
+            Some(NodeState::Dead(state)) => {
+                assert_that!(state.clone().remove_stale_resources(), eq Ok(true));
+            }
+            _ => test_fail!("the node shall be dead"),
+        }
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.removed, len 1);
+        assert_that!(*changes.removed[0].node_id(), eq node_id);
+        assert_that!(sut.is_empty(), eq true);
+    }
+
     #[instantiate_tests(<ZeroCopy>)]
     mod ipc {}
 }
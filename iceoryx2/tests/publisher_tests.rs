@@ -213,6 +213,108 @@ mod publisher {
         Ok(())
     }
 
+    #[test]
+    fn publisher_with_buddy_allocator_delivers_slices_of_varying_length<Sut: Service>(
+    ) -> TestResult<()> {
+        const NUMBER_OF_ELEMENTS: usize = 1024;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .payload_allocator(PayloadAllocator::Buddy)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        assert_that!(sut.payload_allocator(), eq PayloadAllocator::Buddy);
+
+        for n in 0..4 * NUMBER_OF_ELEMENTS {
+            let len = (n * 37) % NUMBER_OF_ELEMENTS;
+            sut.loan_slice_uninit(len)?
+                .write_from_fn(|i| (n + i) as u64)
+                .send()?;
+
+            let sample = subscriber.receive()?.unwrap();
+            assert_that!(sample.payload(), len len);
+            for (i, element) in sample.payload().iter().enumerate() {
+                let expected = (n + i) as u64;
+                assert_that!(*element, eq expected);
+            }
+        }
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_with_buddy_allocator_loans_many_small_slices_in_parallel<Sut: Service>(
+    ) -> TestResult<()> {
+        const NUMBER_OF_ELEMENTS: usize = 1024;
+        const MAX_LOANED_SAMPLES: usize = 16;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .max_publishers(1)
+            .max_subscribers(1)
+            .subscriber_max_buffer_size(1)
+            .history_size(0)
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .max_loaned_samples(MAX_LOANED_SAMPLES)
+            .payload_allocator(PayloadAllocator::Buddy)
+            .create()?;
+
+        let mut samples = vec![];
+        for _ in 0..MAX_LOANED_SAMPLES {
+            samples.push(sut.loan_slice(1)?);
+        }
+
+        // the small slices occupy only a fraction of the memory, a slice that is larger than
+        // the initial max slice len still fits
+        samples.pop();
+        let sample = sut.loan_slice(2 * NUMBER_OF_ELEMENTS);
+        assert_that!(sample, is_ok);
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_with_buddy_allocator_fails_with_out_of_memory_when_slice_does_not_fit<
+        Sut: Service,
+    >() -> TestResult<()> {
+        const NUMBER_OF_ELEMENTS: usize = 128;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .payload_allocator(PayloadAllocator::Buddy)
+            .create()?;
+
+        let sample = sut.loan_slice(NUMBER_OF_ELEMENTS * NUMBER_OF_ELEMENTS * 1024);
+        assert_that!(sample, is_err);
+        assert_that!(sample.err().unwrap(), eq LoanError::OutOfMemory);
+
+        Ok(())
+    }
+
     #[test]
     fn publisher_loan_unit_and_send_sample_works<Sut: Service>() -> TestResult<()> {
         let service_name = generate_name()?;
@@ -405,6 +507,8 @@ mod publisher {
             format!("{}", PublisherCreateError::ExceedsMaxSupportedPublishers), eq "PublisherCreateError::ExceedsMaxSupportedPublishers");
         assert_that!(
             format!("{}", PublisherCreateError::UnableToCreateDataSegment), eq "PublisherCreateError::UnableToCreateDataSegment");
+        assert_that!(
+            format!("{}", PublisherCreateError::UnableToApplyMemoryResidency), eq "PublisherCreateError::UnableToApplyMemoryResidency");
     }
 
     #[test]
@@ -559,6 +663,182 @@ mod publisher {
         Ok(())
     }
 
+    #[test]
+    fn publisher_with_huge_pages_delivers_samples_or_falls_back<Sut: Service>() -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .page_size(PageSize::Huge2MiB)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        assert_that!([PageSize::Default, PageSize::Huge2MiB], contains sut.page_size());
+
+        sut.send_copy(8127)?;
+        let sample = subscriber.receive()?;
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 8127);
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_uses_default_page_size_by_default<Sut: Service>() -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+
+        assert_that!(sut.page_size(), eq PageSize::Default);
+
+        Ok(())
+    }
+
+    #[test]
+    fn pre_faulted_publisher_delivers_samples<Sut: Service>() -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(128)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .memory_residency(MemoryResidency::PreFaulted)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        sut.loan_slice_uninit(1024)?
+            .write_from_fn(|_| 9127)
+            .send()?;
+        let sample = subscriber.receive()?;
+        assert_that!(sample, is_some);
+        assert_that!(sample.unwrap().payload(), eq [9127; 1024]);
+
+        Ok(())
+    }
+
+    #[test]
+    fn locked_publisher_delivers_samples_or_reports_memory_lock_failure<Sut: Service>(
+    ) -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        // the lockable memory is restricted by RLIMIT_MEMLOCK, therefore the creation is
+        // allowed to fail in constrained environments
+        match service
+            .publisher_builder()
+            .memory_residency(MemoryResidency::Locked)
+            .create()
+        {
+            Ok(sut) => {
+                let subscriber = service.subscriber_builder().create()?;
+                sut.send_copy(4412)?;
+                let sample = subscriber.receive()?;
+                assert_that!(sample, is_some);
+                assert_that!(*sample.unwrap(), eq 4412);
+            }
+            Err(e) => {
+                assert_that!([PublisherCreateError::UnableToCreateDataSegment,
+                              PublisherCreateError::UnableToApplyMemoryResidency], contains e);
+            }
+        }
+
+        Ok(())
+    }
+
+    #[test]
+    fn connection_stats_report_backlog_of_subscriber<Sut: Service>() -> TestResult<()> {
+        const BUFFER_SIZE: usize = 4;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        assert_that!(sut.connection_stats().count(), eq 0);
+
+        let subscriber = service.subscriber_builder().create()?;
+        for n in 0..3 {
+            sut.send_copy(n)?;
+        }
+
+        let stats: Vec<_> = sut.connection_stats().collect();
+        assert_that!(stats, len 1);
+        assert_that!(stats[0].publisher_id, eq sut.id());
+        assert_that!(stats[0].subscriber_id, eq subscriber.id());
+        assert_that!(stats[0].submission_queue.len, eq 3);
+        assert_that!(stats[0].submission_queue.high_water_mark, eq 3);
+        assert_that!(stats[0].submission_queue.capacity, ge BUFFER_SIZE);
+
+        while subscriber.receive()?.is_some() {}
+
+        let stats: Vec<_> = sut.connection_stats().collect();
+        assert_that!(stats[0].submission_queue.len, eq 0);
+        assert_that!(stats[0].submission_queue.high_water_mark, eq 3);
+        assert_that!(stats[0].completion_queue.high_water_mark, ge 1);
+
+        Ok(())
+    }
+
+    #[test]
+    fn connection_stats_can_be_listed_without_a_port<Sut: Service>() -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let subscriber = service.subscriber_builder().create()?;
+        publisher.send_copy(123)?;
+        publisher.send_copy(456)?;
+
+        let details = Sut::details(&service_name, &config, MessagingPattern::PublishSubscribe)?;
+        assert_that!(details, is_some);
+
+        let mut stats = vec![];
+        Sut::list_connection_stats(&details.unwrap().static_details, &config, |connection| {
+            stats.push(connection);
+            CallbackProgression::Continue
+        })?;
+
+        assert_that!(stats, len 1);
+        assert_that!(stats[0].publisher_id, eq publisher.id());
+        assert_that!(stats[0].subscriber_id, eq subscriber.id());
+        assert_that!(stats[0].submission_queue.len, eq 2);
+        assert_that!(stats[0].submission_queue.high_water_mark, eq 2);
+
+        Ok(())
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
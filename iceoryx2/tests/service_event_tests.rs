@@ -273,6 +273,36 @@ mod service_event {
         assert_that!(sut2, is_ok);
     }
 
+    #[test]
+    fn default_event_id_max_value_is_bounded_by_the_event_implementation<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+
+        let expected_event_id_max_value =
+            match <Sut::Event as iceoryx2_cal::event::Event>::default_trigger_id_max() {
+                Some(trigger_id_max) => config
+                    .defaults
+                    .event
+                    .event_id_max_value
+                    .min(trigger_id_max.as_value()),
+                None => config.defaults.event.event_id_max_value,
+            };
+        assert_that!(sut.static_config().event_id_max_value(), eq expected_event_id_max_value);
+
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+        let event_id = EventId::new(expected_event_id_max_value);
+        assert_that!(notifier.notify_with_custom_event_id(event_id), is_ok);
+        assert_that!(listener.try_wait_one().unwrap(), eq Some(event_id));
+    }
+
     #[test]
     fn open_uses_predefined_settings_when_nothing_is_specified<Sut: Service>() {
         let service_name = generate_name();
@@ -1407,4 +1437,8 @@ mod service_event {
 
     #[instantiate_tests(<iceoryx2::service::local::Service>)]
     mod local {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2::service::ipc_futex::Service>)]
+    mod ipc_futex {}
 }
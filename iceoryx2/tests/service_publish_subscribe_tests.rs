@@ -13,18 +13,23 @@
 #[generic_tests::define]
 mod service_publish_subscribe {
     use core::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+    use core::time::Duration;
     use std::sync::{Barrier, Mutex};
     use std::thread;
+    use std::time::Instant;
 
     use iceoryx2::config::Config;
     use iceoryx2::port::publisher::PublisherCreateError;
     use iceoryx2::port::subscriber::SubscriberCreateError;
     use iceoryx2::port::update_connections::UpdateConnections;
-    use iceoryx2::port::LoanError;
+    use iceoryx2::port::{LoanError, ReceiveError};
     use iceoryx2::prelude::{AllocationStrategy, *};
     use iceoryx2::service::builder::publish_subscribe::PublishSubscribeCreateError;
     use iceoryx2::service::builder::publish_subscribe::PublishSubscribeOpenError;
     use iceoryx2::service::builder::publish_subscribe::{CustomHeaderMarker, CustomPayloadMarker};
+    use iceoryx2::service::dynamic_config::publish_subscribe::{
+        PublisherStatistics, SubscriberStatistics,
+    };
     use iceoryx2::service::messaging_pattern::MessagingPattern;
     use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
     use iceoryx2::service::{Service, ServiceDetails};
@@ -33,6 +38,7 @@ mod service_publish_subscribe {
     use iceoryx2_bb_elementary::alignment::Alignment;
     use iceoryx2_bb_elementary::CallbackProgression;
     use iceoryx2_bb_log::{set_log_level, LogLevel};
+    use iceoryx2_bb_posix::clock::{ClockType, Time};
     use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
     use iceoryx2_bb_testing::assert_that;
     use iceoryx2_bb_testing::watchdog::Watchdog;
@@ -395,6 +401,58 @@ mod service_publish_subscribe {
         assert_that!(sut2, is_ok);
     }
 
+    #[test]
+    fn open_fails_when_service_does_not_satisfy_send_tracking_requirement<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_send_tracking(true)
+            .create();
+        assert_that!(sut, is_ok);
+        assert_that!(sut.as_ref().unwrap().static_config().has_send_tracking(), eq true);
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_send_tracking(false)
+            .open();
+
+        assert_that!(sut2, is_err);
+        assert_that!(
+            sut2.err().unwrap(), eq
+            PublishSubscribeOpenError::IncompatibleSendTrackingSetting
+        );
+    }
+
+    #[test]
+    fn open_fails_when_service_does_not_satisfy_connection_backend_requirement<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .create();
+        assert_that!(sut, is_ok);
+        assert_that!(sut.as_ref().unwrap().static_config().connection_backend(), eq ConnectionBackend::BroadcastRing);
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .connection_backend(ConnectionBackend::SubscriberQueues)
+            .open();
+
+        assert_that!(sut2, is_err);
+        assert_that!(
+            sut2.err().unwrap(), eq
+            PublishSubscribeOpenError::IncompatibleConnectionBackend
+        );
+    }
+
     #[test]
     fn open_fails_when_service_does_not_satisfy_safe_overflow_requirement<Sut: Service>() {
         let service_name = generate_name();
@@ -1516,6 +1574,100 @@ mod service_publish_subscribe {
         }
     }
 
+    #[test]
+    fn send_with_timeout_skips_full_subscriber_after_timeout<Sut: Service>() {
+        const TIMEOUT: Duration = Duration::from_millis(25);
+        const BUFFER_SIZE: usize = 2;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let publisher = sut
+            .publisher_builder()
+            .unable_to_deliver_strategy(UnableToDeliverStrategy::Block)
+            .create()
+            .unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(publisher.send_copy_with_timeout(i, TIMEOUT), eq Ok(1));
+        }
+
+        let start = Instant::now();
+        assert_that!(publisher.send_copy_with_timeout(123, TIMEOUT), eq Ok(0));
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+
+        let sample = publisher.loan().unwrap();
+        assert_that!(sample.send_with_timeout(TIMEOUT), eq Ok(0));
+
+        for i in 0..BUFFER_SIZE {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample, eq i);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn send_with_timeout_is_woken_up_when_subscriber_receives<Sut: Service>() {
+        const BUFFER_SIZE: usize = 1;
+        let _watchdog = Watchdog::new();
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = Mutex::new(NodeBuilder::new().config(&config).create::<Sut>().unwrap());
+        let barrier = Barrier::new(2);
+
+        let sut = node
+            .lock()
+            .unwrap()
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        thread::scope(|s| {
+            s.spawn(|| {
+                let sut = node
+                    .lock()
+                    .unwrap()
+                    .service_builder(&service_name)
+                    .publish_subscribe::<usize>()
+                    .open()
+                    .unwrap();
+                let subscriber = sut.subscriber_builder().create().unwrap();
+                barrier.wait();
+                barrier.wait();
+                thread::sleep(Duration::from_millis(25));
+
+                let sample = subscriber.receive().unwrap().unwrap();
+                assert_that!(*sample, eq 1);
+                barrier.wait();
+
+                let sample = subscriber.receive().unwrap().unwrap();
+                assert_that!(*sample, eq 2);
+            });
+
+            barrier.wait();
+            assert_that!(publisher.send_copy(1), eq Ok(1));
+            barrier.wait();
+            assert_that!(
+                publisher.send_copy_with_timeout(2, Duration::from_secs(3600)),
+                eq Ok(1)
+            );
+            barrier.wait();
+        });
+    }
+
     #[test]
     fn publish_non_overflow_with_greater_history_than_buffer_fails<Sut: Service>() {
         let service_name = generate_name();
@@ -1537,6 +1689,70 @@ mod service_publish_subscribe {
         );
     }
 
+    #[test]
+    fn header_contains_no_sequence_number_and_timestamp_by_default<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        assert_that!(publisher.send_copy(1234), is_ok);
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(sample.header().sequence_number(), is_none);
+        assert_that!(sample.header().send_timestamp(), is_none);
+    }
+
+    #[test]
+    fn header_contains_sequence_number_and_timestamp_with_send_tracking<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: u64 = 5;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_safe_overflow(true)
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .enable_send_tracking(true)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        let start = Time::now_with_clock(ClockType::Monotonic)
+            .unwrap()
+            .as_duration();
+        // the oldest sample is lost due to the safe overflow
+        for i in 0..NUMBER_OF_SAMPLES + 1 {
+            assert_that!(publisher.send_copy(i), is_ok);
+        }
+        let end = Time::now_with_clock(ClockType::Monotonic)
+            .unwrap()
+            .as_duration();
+
+        let mut last_timestamp = start;
+        for i in 1..NUMBER_OF_SAMPLES + 1 {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(sample.header().sequence_number(), eq Some(i));
+
+            let timestamp = sample.header().send_timestamp().unwrap();
+            assert_that!(timestamp, ge last_timestamp);
+            assert_that!(timestamp, le end);
+            last_timestamp = timestamp;
+        }
+    }
+
     #[test]
     fn publish_history_is_delivered_on_subscription<Sut: Service>() {
         const BUFFER_SIZE: usize = 2;
@@ -2753,6 +2969,8 @@ mod service_publish_subscribe {
                                   "PublishSubscribeOpenError::DoesNotSupportRequestedAmountOfNodes");
         assert_that!(format!("{}", PublishSubscribeOpenError::IncompatibleOverflowBehavior), eq
                                   "PublishSubscribeOpenError::IncompatibleOverflowBehavior");
+        assert_that!(format!("{}", PublishSubscribeOpenError::IncompatibleSendTrackingSetting), eq
+                                  "PublishSubscribeOpenError::IncompatibleSendTrackingSetting");
         assert_that!(format!("{}", PublishSubscribeOpenError::InsufficientPermissions), eq
                                   "PublishSubscribeOpenError::InsufficientPermissions");
         assert_that!(format!("{}", PublishSubscribeOpenError::ServiceInCorruptedState), eq
@@ -2904,108 +3122,892 @@ mod service_publish_subscribe {
     }
 
     #[test]
-    fn communication_with_custom_payload_works<Sut: Service>() {
-        set_log_level(LogLevel::Error);
-        const NUMBER_OF_ELEMENTS: usize = 1;
+    fn receive_batch_receives_samples_of_all_publishers<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 4;
         let service_name = generate_name();
         let config = generate_isolated_config();
         let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
-        let mut type_details = TypeDetail::__internal_new::<u8>(TypeVariant::FixedSize);
-        type_details.size = 1024;
-        type_details.alignment = 1024;
 
-        let sut = unsafe {
-            node.service_builder(&service_name)
-                .publish_subscribe::<[CustomPayloadMarker]>()
-                .__internal_set_payload_type_details(&type_details)
-                .create()
-                .unwrap()
-        };
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
 
-        let publisher = sut.publisher_builder().create().unwrap();
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
         let subscriber = sut.subscriber_builder().create().unwrap();
 
-        let sample = unsafe { publisher.loan_custom_payload(NUMBER_OF_ELEMENTS).unwrap() };
-        assert_that!(sample.payload(), len type_details.size);
-        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
-        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
 
-        unsafe { sample.assume_init().send().unwrap() };
+        let mut received = vec![];
+        let result = subscriber.receive_batch(2 * NUMBER_OF_SAMPLES, |sample| {
+            received.push(*sample);
+            CallbackProgression::Continue
+        });
 
-        let sample = unsafe { subscriber.receive_custom_payload().unwrap().unwrap() };
-        assert_that!(sample.payload(), len type_details.size);
-        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
-        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+        assert_that!(result, eq Ok(2 * NUMBER_OF_SAMPLES));
+        received.sort();
+        for (i, value) in received.iter().enumerate() {
+            assert_that!(*value, eq i);
+        }
+        assert_that!(subscriber.has_samples().unwrap(), eq false);
     }
 
     #[test]
-    fn communication_with_custom_slice_payload_works<Sut: Service>() {
-        set_log_level(LogLevel::Error);
-        const NUMBER_OF_ELEMENTS: usize = 7;
+    fn receive_batch_stops_at_max_number_of_samples<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 5;
         let service_name = generate_name();
         let config = generate_isolated_config();
         let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
-        let mut type_details = TypeDetail::__internal_new::<u8>(TypeVariant::Dynamic);
-        type_details.size = 2048;
-        type_details.alignment = 2048;
-
-        let sut = unsafe {
-            node.service_builder(&service_name)
-                .publish_subscribe::<[CustomPayloadMarker]>()
-                .__internal_set_payload_type_details(&type_details)
-                .create()
-                .unwrap()
-        };
 
-        let publisher = sut
-            .publisher_builder()
-            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
             .create()
             .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
         let subscriber = sut.subscriber_builder().create().unwrap();
 
-        let sample = unsafe { publisher.loan_custom_payload(NUMBER_OF_ELEMENTS).unwrap() };
-        assert_that!(sample.payload(), len type_details.size * NUMBER_OF_ELEMENTS);
-        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
-        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher.send_copy(i), is_ok);
+        }
 
-        unsafe { sample.assume_init().send().unwrap() };
+        let result = subscriber.receive_batch(2, |_| CallbackProgression::Continue);
+        assert_that!(result, eq Ok(2));
 
-        let sample = unsafe { subscriber.receive_custom_payload().unwrap().unwrap() };
-        assert_that!(sample.payload(), len type_details.size * NUMBER_OF_ELEMENTS);
-        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
-        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+        let mut counter = 0;
+        let result = subscriber.receive_batch(NUMBER_OF_SAMPLES, |sample| {
+            assert_that!(*sample, eq 2);
+            counter += 1;
+            CallbackProgression::Stop
+        });
+        assert_that!(result, eq Ok(1));
+        assert_that!(counter, eq 1);
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(*sample, eq 3);
     }
 
     #[test]
-    fn send_increasing_samples_with_static_allocation_strategy_fails<Sut: Service>() {
-        const SLICE_SIZE: usize = 1024;
+    fn receive_batch_acquires_samples_of_disconnected_publisher<Sut: Service>() {
+        set_log_level(LogLevel::Error);
         let service_name = generate_name();
         let config = generate_isolated_config();
         let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
 
-        let service_pub = node
+        let sut = node
             .service_builder(&service_name)
-            .publish_subscribe::<[u8]>()
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(2)
+            .max_publishers(1)
             .create()
             .unwrap();
 
-        let publisher = service_pub
-            .publisher_builder()
-            .initial_max_slice_len(SLICE_SIZE)
-            .allocation_strategy(AllocationStrategy::Static)
-            .create()
-            .unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
 
-        let sample = publisher.loan_slice(SLICE_SIZE - 1);
-        assert_that!(sample, is_ok);
+        assert_that!(publisher.send_copy(123), is_ok);
+        drop(publisher);
 
-        let sample = publisher.loan_slice(SLICE_SIZE);
-        assert_that!(sample, is_ok);
+        let publisher = sut.publisher_builder().create().unwrap();
+        assert_that!(publisher.send_copy(456), is_ok);
 
-        let sample = publisher.loan_slice(SLICE_SIZE + 1);
-        assert_that!(sample, is_err);
-        assert_that!(sample.err(), eq Some(LoanError::ExceedsMaxLoanSize));
+        let mut received = vec![];
+        let result = subscriber.receive_batch(10, |sample| {
+            received.push(*sample);
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, eq Ok(2));
+        assert_that!(received, eq vec![123, 456]);
+    }
+
+    #[test]
+    fn subscriber_with_sequential_receive_policy_drains_first_publisher_first<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::Sequential)
+            .create()
+            .unwrap();
+        assert_that!(subscriber.receive_policy(), eq ReceivePolicy::Sequential);
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
+
+        let first_sample = *subscriber.receive().unwrap().unwrap();
+        let is_first_publisher_served_first = first_sample < NUMBER_OF_SAMPLES;
+        for i in 1..NUMBER_OF_SAMPLES {
+            let sample = *subscriber.receive().unwrap().unwrap();
+            assert_that!(sample < NUMBER_OF_SAMPLES, eq is_first_publisher_served_first);
+            assert_that!(sample, eq first_sample + i);
+        }
+    }
+
+    #[test]
+    fn subscriber_with_round_robin_receive_policy_alternates_between_publishers<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::RoundRobin)
+            .create()
+            .unwrap();
+        assert_that!(subscriber.receive_policy(), eq ReceivePolicy::RoundRobin);
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
+
+        let mut last_origin_was_first_publisher = None;
+        for _ in 0..2 * NUMBER_OF_SAMPLES {
+            let sample = *subscriber.receive().unwrap().unwrap();
+            let origin_is_first_publisher = sample < NUMBER_OF_SAMPLES;
+            if let Some(last) = last_origin_was_first_publisher {
+                assert_that!(origin_is_first_publisher, ne last);
+            }
+            last_origin_was_first_publisher = Some(origin_is_first_publisher);
+        }
+
+        assert_that!(subscriber.has_samples().unwrap(), eq false);
+    }
+
+    #[test]
+    fn receive_batch_with_round_robin_receive_policy_alternates_between_publishers<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::RoundRobin)
+            .create()
+            .unwrap();
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
+
+        let mut origins = vec![];
+        let result = subscriber.receive_batch(2 * NUMBER_OF_SAMPLES, |sample| {
+            origins.push(*sample < NUMBER_OF_SAMPLES);
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, eq Ok(2 * NUMBER_OF_SAMPLES));
+        for pair in origins.windows(2) {
+            assert_that!(pair[0], ne pair[1]);
+        }
+    }
+
+    #[test]
+    fn subscriber_with_round_robin_receive_policy_serves_publishers_by_weight<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 4;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::RoundRobin)
+            .create()
+            .unwrap();
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        assert_that!(subscriber.publisher_weight(publisher_1.id()), eq 1);
+        subscriber.set_publisher_weight(publisher_1.id(), 2);
+        assert_that!(subscriber.publisher_weight(publisher_1.id()), eq 2);
+        assert_that!(subscriber.publisher_weight(publisher_2.id()), eq 1);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
+
+        // independent of the publisher that is served first, three rounds deliver two samples
+        // of the first and one sample of the second publisher each
+        let mut number_of_samples_from_first_publisher = 0;
+        for _ in 0..6 {
+            let sample = *subscriber.receive().unwrap().unwrap();
+            if sample < NUMBER_OF_SAMPLES {
+                number_of_samples_from_first_publisher += 1;
+            }
+        }
+        assert_that!(number_of_samples_from_first_publisher, eq 4);
+
+        subscriber.set_publisher_weight(publisher_1.id(), 1);
+        assert_that!(subscriber.publisher_weight(publisher_1.id()), eq 1);
+    }
+
+    #[test]
+    fn receive_batch_with_round_robin_receive_policy_serves_publishers_by_weight<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 4;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::RoundRobin)
+            .create()
+            .unwrap();
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+        subscriber.set_publisher_weight(publisher_1.id(), 2);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher_1.send_copy(i), is_ok);
+            assert_that!(publisher_2.send_copy(i + NUMBER_OF_SAMPLES), is_ok);
+        }
+
+        let mut number_of_samples_from_first_publisher = 0;
+        let result = subscriber.receive_batch(6, |sample| {
+            if *sample < NUMBER_OF_SAMPLES {
+                number_of_samples_from_first_publisher += 1;
+            }
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, eq Ok(6));
+        assert_that!(number_of_samples_from_first_publisher, eq 4);
+    }
+
+    #[test]
+    fn subscriber_with_oldest_first_receive_policy_receives_in_send_order<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .enable_send_tracking(true)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::OldestFirst)
+            .create()
+            .unwrap();
+        assert_that!(subscriber.receive_policy(), eq ReceivePolicy::OldestFirst);
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        let senders = [
+            &publisher_2,
+            &publisher_1,
+            &publisher_1,
+            &publisher_2,
+            &publisher_2,
+            &publisher_1,
+        ];
+        for (i, publisher) in senders.iter().enumerate() {
+            assert_that!(publisher.send_copy(i), is_ok);
+            // distinct send timestamps also on platforms with a coarse clock
+            thread::sleep(Duration::from_millis(1));
+        }
+
+        for i in 0..senders.len() {
+            assert_that!(*subscriber.receive().unwrap().unwrap(), eq i);
+        }
+        assert_that!(subscriber.has_samples().unwrap(), eq false);
+    }
+
+    #[test]
+    fn receive_batch_with_oldest_first_receive_policy_receives_in_send_order<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_publishers(2)
+            .enable_send_tracking(true)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .receive_policy(ReceivePolicy::OldestFirst)
+            .create()
+            .unwrap();
+
+        let publisher_1 = sut.publisher_builder().create().unwrap();
+        let publisher_2 = sut.publisher_builder().create().unwrap();
+
+        let senders = [
+            &publisher_1,
+            &publisher_2,
+            &publisher_2,
+            &publisher_1,
+            &publisher_2,
+            &publisher_1,
+        ];
+        for (i, publisher) in senders.iter().enumerate() {
+            assert_that!(publisher.send_copy(i), is_ok);
+            // distinct send timestamps also on platforms with a coarse clock
+            thread::sleep(Duration::from_millis(1));
+        }
+
+        let mut received = vec![];
+        let result = subscriber.receive_batch(senders.len(), |sample| {
+            received.push(*sample);
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, eq Ok(senders.len()));
+        assert_that!(received, eq(0..senders.len()).collect::<Vec<_>>());
+    }
+
+    #[test]
+    fn broadcast_ring_delivers_samples_to_all_subscribers<Sut: Service>() {
+        const NUMBER_OF_SUBSCRIBERS: usize = 4;
+        const NUMBER_OF_SAMPLES: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .max_subscribers(NUMBER_OF_SUBSCRIBERS)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let mut subscribers = vec![];
+        for _ in 0..NUMBER_OF_SUBSCRIBERS {
+            subscribers.push(sut.subscriber_builder().create().unwrap());
+        }
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher.send_copy(i), eq Ok(NUMBER_OF_SUBSCRIBERS));
+        }
+
+        for subscriber in &subscribers {
+            assert_that!(subscriber.has_samples(), eq Ok(true));
+            for i in 0..NUMBER_OF_SAMPLES {
+                let sample = subscriber.receive().unwrap();
+                assert_that!(sample, is_some);
+                assert_that!(*sample.unwrap(), eq i);
+            }
+            assert_that!(subscriber.receive().unwrap(), is_none);
+        }
+    }
+
+    fn send_and_notify_notifies_only_when_buffer_was_empty<Sut: Service>(
+        connection_backend: ConnectionBackend,
+    ) {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let pubsub = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(connection_backend)
+            .subscriber_max_buffer_size(4)
+            .create()
+            .unwrap();
+        let event = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+
+        let publisher = pubsub.publisher_builder().create().unwrap();
+        let subscriber = pubsub.subscriber_builder().create().unwrap();
+        let listener = event.listener_builder().create().unwrap();
+        let notifier = event.notifier_builder().create().unwrap();
+
+        // until the subscriber has acknowledged the notify on activation handshake with an
+        // empty receive, every send notifies
+        for n in 0..2 {
+            let sample = publisher.loan_uninit().unwrap().write_payload(n);
+            assert_that!(sample.send_and_notify(&notifier), eq Ok(1));
+            assert_that!(listener.try_wait_one().unwrap(), is_some);
+            assert_that!(listener.try_wait_one().unwrap(), is_none);
+        }
+
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 0);
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 1);
+        assert_that!(subscriber.receive().unwrap(), is_none);
+
+        let sample = publisher.loan_uninit().unwrap().write_payload(2);
+        assert_that!(sample.send_and_notify(&notifier), eq Ok(1));
+        assert_that!(listener.try_wait_one().unwrap(), is_some);
+
+        // the subscriber did not consume the previous sample and does not need another wakeup
+        let sample = publisher.loan_uninit().unwrap().write_payload(3);
+        assert_that!(sample.send_and_notify(&notifier), eq Ok(1));
+        assert_that!(listener.try_wait_one().unwrap(), is_none);
+
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 2);
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 3);
+        assert_that!(subscriber.receive().unwrap(), is_none);
+
+        let sample = publisher.loan_uninit().unwrap().write_payload(4);
+        assert_that!(sample.send_and_notify(&notifier), eq Ok(1));
+        assert_that!(listener.try_wait_one().unwrap(), is_some);
+    }
+
+    #[test]
+    fn send_and_notify_notifies_only_when_buffer_was_empty_with_queues<Sut: Service>() {
+        send_and_notify_notifies_only_when_buffer_was_empty::<Sut>(
+            ConnectionBackend::SubscriberQueues,
+        );
+    }
+
+    #[test]
+    fn send_and_notify_notifies_only_when_buffer_was_empty_with_broadcast_ring<Sut: Service>() {
+        send_and_notify_notifies_only_when_buffer_was_empty::<Sut>(
+            ConnectionBackend::BroadcastRing,
+        );
+    }
+
+    #[test]
+    fn send_and_notify_does_not_notify_listeners_of_nodes_without_subscribers<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let publisher_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let subscriber_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let other_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let pubsub = publisher_node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .create()
+            .unwrap();
+        let event = publisher_node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let publisher = pubsub.publisher_builder().create().unwrap();
+        let notifier = event.notifier_builder().create().unwrap();
+
+        let subscriber = subscriber_node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .open()
+            .unwrap()
+            .subscriber_builder()
+            .create()
+            .unwrap();
+        let subscriber_listener = subscriber_node
+            .service_builder(&service_name)
+            .event()
+            .open()
+            .unwrap()
+            .listener_builder()
+            .create()
+            .unwrap();
+        let other_listener = other_node
+            .service_builder(&service_name)
+            .event()
+            .open()
+            .unwrap()
+            .listener_builder()
+            .create()
+            .unwrap();
+
+        let sample = publisher.loan_uninit().unwrap().write_payload(42);
+        assert_that!(sample.send_and_notify(&notifier), eq Ok(1));
+
+        assert_that!(subscriber_listener.try_wait_one().unwrap(), is_some);
+        assert_that!(other_listener.try_wait_one().unwrap(), is_none);
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 42);
+    }
+
+    #[test]
+    fn broadcast_ring_with_safe_overflow_overwrites_oldest_samples<Sut: Service>() {
+        const BUFFER_SIZE: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .enable_safe_overflow(true)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        for i in 0..2 * BUFFER_SIZE {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+        }
+
+        for i in BUFFER_SIZE..2 * BUFFER_SIZE {
+            let sample = subscriber.receive().unwrap();
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn broadcast_ring_without_safe_overflow_discards_sample_when_full<Sut: Service>() {
+        const BUFFER_SIZE: usize = 2;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let publisher = sut
+            .publisher_builder()
+            .unable_to_deliver_strategy(UnableToDeliverStrategy::DiscardSample)
+            .create()
+            .unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+        }
+        assert_that!(publisher.send_copy(BUFFER_SIZE), eq Ok(0));
+
+        let sample = subscriber.receive().unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 0);
+
+        assert_that!(publisher.send_copy(BUFFER_SIZE + 1), eq Ok(1));
+        for i in 1..BUFFER_SIZE {
+            assert_that!(*subscriber.receive().unwrap().unwrap(), eq i);
+        }
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq BUFFER_SIZE + 1);
+    }
+
+    #[test]
+    fn broadcast_ring_send_with_timeout_is_woken_up_when_subscriber_receives<Sut: Service>() {
+        const BUFFER_SIZE: usize = 1;
+        let _watchdog = Watchdog::new();
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = Mutex::new(NodeBuilder::new().config(&config).create::<Sut>().unwrap());
+        let barrier = Barrier::new(2);
+
+        let sut = node
+            .lock()
+            .unwrap()
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+        let publisher = sut
+            .publisher_builder()
+            .unable_to_deliver_strategy(UnableToDeliverStrategy::Block)
+            .create()
+            .unwrap();
+
+        thread::scope(|s| {
+            s.spawn(|| {
+                let sut = node
+                    .lock()
+                    .unwrap()
+                    .service_builder(&service_name)
+                    .publish_subscribe::<usize>()
+                    .open()
+                    .unwrap();
+                let subscriber = sut.subscriber_builder().create().unwrap();
+                barrier.wait();
+                barrier.wait();
+                thread::sleep(Duration::from_millis(25));
+
+                let sample = subscriber.receive().unwrap().unwrap();
+                assert_that!(*sample, eq 1);
+                drop(sample);
+                barrier.wait();
+
+                let sample = subscriber.receive().unwrap().unwrap();
+                assert_that!(*sample, eq 2);
+            });
+
+            barrier.wait();
+            assert_that!(publisher.send_copy(1), eq Ok(1));
+            barrier.wait();
+            assert_that!(
+                publisher.send_copy_with_timeout(2, Duration::from_secs(3600)),
+                eq Ok(1)
+            );
+            barrier.wait();
+        });
+    }
+
+    #[test]
+    fn broadcast_ring_keeps_samples_borrowed_by_subscriber_valid<Sut: Service>() {
+        const BUFFER_SIZE: usize = 2;
+        const MAX_BORROWED_SAMPLES: usize = 2;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .enable_safe_overflow(true)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .subscriber_max_borrowed_samples(MAX_BORROWED_SAMPLES)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        assert_that!(publisher.send_copy(0), eq Ok(1));
+        assert_that!(publisher.send_copy(1), eq Ok(1));
+        let sample_1 = subscriber.receive().unwrap().unwrap();
+        let sample_2 = subscriber.receive().unwrap().unwrap();
+
+        assert_that!(publisher.send_copy(2), eq Ok(1));
+        assert_that!(subscriber.receive().err(), eq Some(ReceiveError::ExceedsMaxBorrows));
+
+        // the overwritten samples stay valid until the subscriber releases them
+        for i in 3..100 {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+            assert_that!(*sample_1, eq 0);
+            assert_that!(*sample_2, eq 1);
+        }
+
+        drop(sample_1);
+        drop(sample_2);
+
+        // the released samples are reclaimed, the publisher does not run out of memory
+        for i in 100..200 {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+            assert_that!(*subscriber.receive().unwrap().unwrap(), ge i - 1);
+        }
+    }
+
+    #[test]
+    fn broadcast_ring_delivers_history_to_new_subscriber<Sut: Service>() {
+        const HISTORY_SIZE: usize = 2;
+        const BUFFER_SIZE: usize = 4;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<usize>()
+            .connection_backend(ConnectionBackend::BroadcastRing)
+            .history_size(HISTORY_SIZE)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        for i in 0..BUFFER_SIZE {
+            assert_that!(publisher.send_copy(i), eq Ok(0));
+        }
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        for i in BUFFER_SIZE - HISTORY_SIZE..BUFFER_SIZE {
+            assert_that!(*subscriber.receive().unwrap().unwrap(), eq i);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn communication_with_custom_payload_works<Sut: Service>() {
+        set_log_level(LogLevel::Error);
+        const NUMBER_OF_ELEMENTS: usize = 1;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut type_details = TypeDetail::__internal_new::<u8>(TypeVariant::FixedSize);
+        type_details.size = 1024;
+        type_details.alignment = 1024;
+
+        let sut = unsafe {
+            node.service_builder(&service_name)
+                .publish_subscribe::<[CustomPayloadMarker]>()
+                .__internal_set_payload_type_details(&type_details)
+                .create()
+                .unwrap()
+        };
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        let sample = unsafe { publisher.loan_custom_payload(NUMBER_OF_ELEMENTS).unwrap() };
+        assert_that!(sample.payload(), len type_details.size);
+        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
+        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+
+        unsafe { sample.assume_init().send().unwrap() };
+
+        let sample = unsafe { subscriber.receive_custom_payload().unwrap().unwrap() };
+        assert_that!(sample.payload(), len type_details.size);
+        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
+        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+    }
+
+    #[test]
+    fn communication_with_custom_slice_payload_works<Sut: Service>() {
+        set_log_level(LogLevel::Error);
+        const NUMBER_OF_ELEMENTS: usize = 7;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut type_details = TypeDetail::__internal_new::<u8>(TypeVariant::Dynamic);
+        type_details.size = 2048;
+        type_details.alignment = 2048;
+
+        let sut = unsafe {
+            node.service_builder(&service_name)
+                .publish_subscribe::<[CustomPayloadMarker]>()
+                .__internal_set_payload_type_details(&type_details)
+                .create()
+                .unwrap()
+        };
+
+        let publisher = sut
+            .publisher_builder()
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .create()
+            .unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        let sample = unsafe { publisher.loan_custom_payload(NUMBER_OF_ELEMENTS).unwrap() };
+        assert_that!(sample.payload(), len type_details.size * NUMBER_OF_ELEMENTS);
+        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
+        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+
+        unsafe { sample.assume_init().send().unwrap() };
+
+        let sample = unsafe { subscriber.receive_custom_payload().unwrap().unwrap() };
+        assert_that!(sample.payload(), len type_details.size * NUMBER_OF_ELEMENTS);
+        assert_that!((sample.payload().as_ptr() as usize % type_details.alignment), eq 0);
+        assert_that!(sample.header().number_of_elements(), eq NUMBER_OF_ELEMENTS as u64);
+    }
+
+    #[test]
+    fn send_increasing_samples_with_static_allocation_strategy_fails<Sut: Service>() {
+        const SLICE_SIZE: usize = 1024;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let service_pub = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()
+            .unwrap();
+
+        let publisher = service_pub
+            .publisher_builder()
+            .initial_max_slice_len(SLICE_SIZE)
+            .allocation_strategy(AllocationStrategy::Static)
+            .create()
+            .unwrap();
+
+        let sample = publisher.loan_slice(SLICE_SIZE - 1);
+        assert_that!(sample, is_ok);
+
+        let sample = publisher.loan_slice(SLICE_SIZE);
+        assert_that!(sample, is_ok);
+
+        let sample = publisher.loan_slice(SLICE_SIZE + 1);
+        assert_that!(sample, is_err);
+        assert_that!(sample.err(), eq Some(LoanError::ExceedsMaxLoanSize));
     }
 
     fn send_and_receives_increasing_samples_works<Sut: Service>(
@@ -3283,6 +4285,246 @@ mod service_publish_subscribe {
         });
     }
 
+    #[test]
+    fn publisher_statistics_count_sent_overflowed_samples_and_exceeded_loans<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_safe_overflow(true)
+            .subscriber_max_buffer_size(1)
+            .create()
+            .unwrap();
+
+        let publisher = sut
+            .publisher_builder()
+            .max_loaned_samples(1)
+            .create()
+            .unwrap();
+        let _subscriber = sut.subscriber_builder().create().unwrap();
+
+        for n in 0..3 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        let sample = publisher.loan().unwrap();
+        assert_that!(publisher.loan().err(), eq Some(LoanError::ExceedsMaxLoans));
+        drop(sample);
+
+        let mut statistics = vec![];
+        sut.dynamic_config()
+            .list_publisher_statistics(|id, publisher_statistics| {
+                statistics.push((id, publisher_statistics));
+                CallbackProgression::Continue
+            });
+
+        assert_that!(statistics, len 1);
+        assert_that!(statistics[0].0, eq publisher.id());
+        assert_that!(statistics[0].1.sent_samples, eq 3);
+        assert_that!(statistics[0].1.overflowed_samples, eq 2);
+        assert_that!(statistics[0].1.failed_deliveries, eq 0);
+        assert_that!(statistics[0].1.exceeded_max_loans, eq 1);
+    }
+
+    #[test]
+    fn publisher_statistics_count_failed_deliveries<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(1)
+            .create()
+            .unwrap();
+
+        let publisher = sut
+            .publisher_builder()
+            .unable_to_deliver_strategy(UnableToDeliverStrategy::DiscardSample)
+            .create()
+            .unwrap();
+        let _subscriber = sut.subscriber_builder().create().unwrap();
+
+        for n in 0..4 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        let mut statistics = vec![];
+        sut.dynamic_config()
+            .list_publisher_statistics(|_, publisher_statistics| {
+                statistics.push(publisher_statistics);
+                CallbackProgression::Continue
+            });
+
+        assert_that!(statistics, len 1);
+        assert_that!(statistics[0].sent_samples, eq 4);
+        assert_that!(statistics[0].failed_deliveries, eq 3);
+        assert_that!(statistics[0].overflowed_samples, eq 0);
+    }
+
+    #[test]
+    fn subscriber_statistics_count_received_samples_and_exceeded_borrows<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_borrowed_samples(1)
+            .subscriber_max_buffer_size(2)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        publisher.send_copy(1).unwrap();
+        publisher.send_copy(2).unwrap();
+
+        let sample = subscriber.receive().unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(subscriber.receive().err(), eq Some(ReceiveError::ExceedsMaxBorrows));
+        drop(sample);
+
+        let mut statistics = vec![];
+        sut.dynamic_config()
+            .list_subscriber_statistics(|id, subscriber_statistics| {
+                statistics.push((id, subscriber_statistics));
+                CallbackProgression::Continue
+            });
+
+        assert_that!(statistics, len 1);
+        assert_that!(statistics[0].0, eq subscriber.id());
+        assert_that!(statistics[0].1.received_samples, eq 1);
+        assert_that!(statistics[0].1.exceeded_max_borrows, eq 1);
+    }
+
+    #[test]
+    fn statistics_of_a_new_port_start_at_zero<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .max_subscribers(1)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        publisher.send_copy(1).unwrap();
+        assert_that!(subscriber.receive().unwrap(), is_some);
+        drop(subscriber);
+        drop(publisher);
+
+        let _publisher = sut.publisher_builder().create().unwrap();
+        let _subscriber = sut.subscriber_builder().create().unwrap();
+
+        let mut publisher_statistics = vec![];
+        sut.dynamic_config().list_publisher_statistics(|_, s| {
+            publisher_statistics.push(s);
+            CallbackProgression::Continue
+        });
+        let mut subscriber_statistics = vec![];
+        sut.dynamic_config().list_subscriber_statistics(|_, s| {
+            subscriber_statistics.push(s);
+            CallbackProgression::Continue
+        });
+
+        assert_that!(publisher_statistics, eq vec![PublisherStatistics::default()]);
+        assert_that!(subscriber_statistics, eq vec![SubscriberStatistics::default()]);
+    }
+
+    #[test]
+    fn statistics_can_be_listed_without_opening_the_service<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        publisher.send_copy(1).unwrap();
+        publisher.send_copy(2).unwrap();
+        assert_that!(subscriber.receive().unwrap(), is_some);
+
+        let details = Sut::details(&service_name, &config, MessagingPattern::PublishSubscribe)
+            .unwrap()
+            .unwrap();
+
+        let mut publisher_statistics = vec![];
+        Sut::list_publisher_statistics(&details.static_details, &config, |id, s| {
+            publisher_statistics.push((id, s));
+            CallbackProgression::Continue
+        })
+        .unwrap();
+        let mut subscriber_statistics = vec![];
+        Sut::list_subscriber_statistics(&details.static_details, &config, |id, s| {
+            subscriber_statistics.push((id, s));
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(publisher_statistics, len 1);
+        assert_that!(publisher_statistics[0].0, eq publisher.id());
+        assert_that!(publisher_statistics[0].1.sent_samples, eq 2);
+        assert_that!(subscriber_statistics, len 1);
+        assert_that!(subscriber_statistics[0].0, eq subscriber.id());
+        assert_that!(subscriber_statistics[0].1.received_samples, eq 1);
+    }
+
+    #[test]
+    fn publish_subscribe_statistics_of_all_services_can_be_listed<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let _event = node
+            .service_builder(&generate_name())
+            .event()
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        publisher.send_copy(1).unwrap();
+        publisher.send_copy(2).unwrap();
+        assert_that!(subscriber.receive().unwrap(), is_some);
+
+        let mut services = vec![];
+        Sut::list_publish_subscribe_statistics(&config, |static_details, statistics| {
+            services.push((static_details.name().clone(), statistics));
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(services, len 1);
+        let (name, statistics) = &services[0];
+        assert_that!(*name, eq service_name);
+        assert_that!(statistics.number_of_nodes, eq 1);
+        assert_that!(statistics.publishers, len 1);
+        assert_that!(statistics.publishers[0].0, eq publisher.id());
+        assert_that!(statistics.publishers[0].1.sent_samples, eq 2);
+        assert_that!(statistics.subscribers, len 1);
+        assert_that!(statistics.subscribers[0].0, eq subscriber.id());
+        assert_that!(statistics.subscribers[0].1.received_samples, eq 1);
+        assert_that!(statistics.connections, len 1);
+        assert_that!(statistics.connections[0].submission_queue.len, eq 1);
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
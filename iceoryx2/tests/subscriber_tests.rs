@@ -20,6 +20,7 @@ mod subscriber {
     use iceoryx2::{
         node::NodeBuilder,
         port::subscriber::SubscriberCreateError,
+        prelude::MemoryResidency,
         service::{service_name::ServiceName, Service},
         testing::*,
     };
@@ -46,6 +47,8 @@ mod subscriber {
             format!("{}", SubscriberCreateError::ExceedsMaxSupportedSubscribers), eq "SubscriberCreateError::ExceedsMaxSupportedSubscribers");
         assert_that!(
             format!("{}", SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService), eq "SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService");
+        assert_that!(
+            format!("{}", SubscriberCreateError::UnableToApplyMemoryResidency), eq "SubscriberCreateError::UnableToApplyMemoryResidency");
     }
 
     #[test]
@@ -72,6 +75,31 @@ mod subscriber {
         }
     }
 
+    #[test]
+    fn pre_faulted_subscriber_receives_samples<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let publisher = service.publisher_builder().create().unwrap();
+        let sut = service
+            .subscriber_builder()
+            .memory_residency(MemoryResidency::PreFaulted)
+            .create()
+            .unwrap();
+
+        publisher.send_copy(1829).unwrap();
+        let sample = sut.receive().unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 1829);
+    }
+
     #[test]
     #[should_panic]
     #[cfg(debug_assertions)]
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[generic_tests::define]
+mod tracker {
+    use core::time::Duration;
+    use iceoryx2::prelude::*;
+    use iceoryx2::service::Service;
+    use iceoryx2::testing::*;
+    use iceoryx2::tracker::node::Tracker as NodeTracker;
+    use iceoryx2::tracker::service::Tracker as ServiceTracker;
+    use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+    use iceoryx2_bb_testing::assert_that;
+
+    const TIMEOUT: Duration = Duration::from_millis(100);
+
+    #[test]
+    fn service_tracker_reports_added_and_removed_services<Sut: Service>() {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut sut = ServiceTracker::<Sut>::new(&config);
+
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+        assert_that!(sut.is_empty(), eq true);
+
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, len 1);
+        assert_that!(changes.removed, len 0);
+        assert_that!(changes.added[0], eq service.service_id().clone());
+        let static_config = sut.get(service.service_id()).unwrap();
+        assert_that!(*static_config.name(), eq service_name);
+        assert_that!(sut.len(), eq 1);
+
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+
+        let service_id = service.service_id().clone();
+        drop(service);
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, len 0);
+        assert_that!(changes.removed, len 1);
+        assert_that!(*changes.removed[0].service_id(), eq service_id);
+        assert_that!(sut.get(&service_id), is_none);
+        assert_that!(sut.is_empty(), eq true);
+    }
+
+    #[test]
+    fn service_tracker_lists_cached_services<Sut: Service>() {
+        const NUMBER_OF_SERVICES: usize = 4;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut sut = ServiceTracker::<Sut>::new(&config);
+
+        let mut services = vec![];
+        for _ in 0..NUMBER_OF_SERVICES {
+            services.push(
+                node.service_builder(&generate_service_name())
+                    .event()
+                    .create()
+                    .unwrap(),
+            );
+        }
+
+        assert_that!(sut.sync().unwrap().added, len NUMBER_OF_SERVICES);
+
+        let mut listed = vec![];
+        sut.list(|static_config| {
+            listed.push(static_config.service_id().clone());
+            CallbackProgression::Continue
+        });
+
+        assert_that!(listed, len NUMBER_OF_SERVICES);
+        for service in &services {
+            assert_that!(listed, contains service.service_id().clone());
+        }
+    }
+
+    #[test]
+    fn service_tracker_reports_services_created_after_unchanged_syncs<Sut: Service>() {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let _service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .create()
+            .unwrap();
+        let mut sut = ServiceTracker::<Sut>::new(&config);
+
+        assert_that!(sut.sync().unwrap().added, len 1);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+
+        let other_service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .create()
+            .unwrap();
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, eq vec![other_service.service_id().clone()]);
+        assert_that!(sut.len(), eq 2);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+    }
+
+    #[test]
+    fn service_tracker_file_descriptor_signals_created_services<Sut: Service>() {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        // the service directory that is watched exists after the first service was created
+        let _service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .create()
+            .unwrap();
+        let mut sut = ServiceTracker::<Sut>::new(&config);
+        assert_that!(sut.sync().unwrap().added, len 1);
+
+        // process local services and platforms without inotify provide no file descriptor
+        let Some(file_descriptor) = sut.file_descriptor() else {
+            return;
+        };
+        let file_descriptor =
+            FileDescriptor::non_owning_new(unsafe { file_descriptor.native_handle() }).unwrap();
+
+        let waitset = WaitSetBuilder::new().create::<Sut>().unwrap();
+        let guard = waitset.attach_notification(&file_descriptor).unwrap();
+
+        let _other_service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .create()
+            .unwrap();
+
+        let mut has_triggered = false;
+        waitset
+            .wait_and_process_once_with_timeout(
+                |id| {
+                    has_triggered |= id.has_event_from(&guard);
+                    CallbackProgression::Continue
+                },
+                TIMEOUT,
+            )
+            .unwrap();
+        assert_that!(has_triggered, eq true);
+
+        assert_that!(sut.sync().unwrap().added, len 1);
+    }
+
+    #[test]
+    fn node_tracker_reports_added_and_removed_nodes<Sut: Service>() {
+        let config = generate_isolated_config();
+        let mut sut = NodeTracker::<Sut>::new(&config);
+
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+
+        let node = NodeBuilder::new()
+            .name(&generate_node_name())
+            .config(&config)
+            .create::<Sut>()
+            .unwrap();
+        let node_id = *node.id();
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, eq vec![node_id]);
+        assert_that!(changes.changed, len 0);
+        assert_that!(changes.removed, len 0);
+        assert_that!(sut.get(&node_id), is_some);
+
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+
+        drop(node);
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, len 0);
+        assert_that!(changes.removed, len 1);
+        assert_that!(*changes.removed[0].node_id(), eq node_id);
+        assert_that!(sut.get(&node_id), is_none);
+    }
+
+    #[test]
+    fn node_tracker_reports_nodes_created_after_unchanged_syncs<Sut: Service>() {
+        let config = generate_isolated_config();
+        let _node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut sut = NodeTracker::<Sut>::new(&config);
+
+        assert_that!(sut.sync().unwrap().added, len 1);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+
+        let other_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let changes = sut.sync().unwrap();
+        assert_that!(changes.added, eq vec![*other_node.id()]);
+        assert_that!(sut.len(), eq 2);
+        assert_that!(sut.sync().unwrap().is_empty(), eq true);
+    }
+
+    #[test]
+    fn node_tracker_file_descriptor_signals_created_nodes<Sut: Service>() {
+        let config = generate_isolated_config();
+        // the node directory that is watched exists after the first node was created
+        let _node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let mut sut = NodeTracker::<Sut>::new(&config);
+        assert_that!(sut.sync().unwrap().added, len 1);
+
+        // process local nodes and platforms without inotify provide no file descriptor
+        let Some(file_descriptor) = sut.file_descriptor() else {
+            return;
+        };
+        let file_descriptor =
+            FileDescriptor::non_owning_new(unsafe { file_descriptor.native_handle() }).unwrap();
+
+        let waitset = WaitSetBuilder::new().create::<Sut>().unwrap();
+        let guard = waitset.attach_notification(&file_descriptor).unwrap();
+
+        let _other_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let mut has_triggered = false;
+        waitset
+            .wait_and_process_once_with_timeout(
+                |id| {
+                    has_triggered |= id.has_event_from(&guard);
+                    CallbackProgression::Continue
+                },
+                TIMEOUT,
+            )
+            .unwrap();
+        assert_that!(has_triggered, eq true);
+
+        assert_that!(sut.sync().unwrap().added, len 1);
+    }
+
+    #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
+    mod ipc {}
+
+    #[instantiate_tests(<iceoryx2::service::local::Service>)]
+    mod local {}
+}
@@ -0,0 +1,282 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[generic_tests::define]
+mod waitset_executor {
+    use core::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+    use core::time::Duration;
+    use std::thread::ThreadId;
+
+    use iceoryx2::prelude::*;
+    use iceoryx2::waitset::WaitSetRunError;
+    use iceoryx2::waitset::WaitSetRunResult;
+    use iceoryx2::waitset_executor::WaitSetExecutorBuilder;
+    use iceoryx2_bb_posix::config::test_directory;
+    use iceoryx2_bb_posix::directory::Directory;
+    use iceoryx2_bb_posix::file::Permission;
+    use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+    use iceoryx2_bb_posix::unix_datagram_socket::{
+        UnixDatagramReceiver, UnixDatagramReceiverBuilder, UnixDatagramSender,
+        UnixDatagramSenderBuilder,
+    };
+    use iceoryx2_bb_system_types::file_path::*;
+    use iceoryx2_bb_system_types::path::*;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_bb_testing::watchdog::Watchdog;
+
+    const INTERVAL: Duration = Duration::from_millis(10);
+
+    fn create_socket() -> (UnixDatagramReceiver, UnixDatagramSender) {
+        let mut path = test_directory();
+        Directory::create(&path, Permission::OWNER_ALL).unwrap();
+        let _ = path.add_path_entry(
+            &Path::new(
+                &format!(
+                    "waitset_executor_tests_{}",
+                    UniqueSystemId::new().unwrap().value()
+                )
+                .as_bytes(),
+            )
+            .unwrap(),
+        );
+        let uds_name = FilePath::new(path.as_bytes()).unwrap();
+
+        let receiver = UnixDatagramReceiverBuilder::new(&uds_name)
+            .create()
+            .unwrap();
+        let sender = UnixDatagramSenderBuilder::new(&uds_name).create().unwrap();
+
+        (receiver, sender)
+    }
+
+    #[test]
+    fn number_of_threads_is_at_least_one<S: Service>() {
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(0)
+            .create(&waitset);
+        assert_that!(sut.number_of_threads(), eq 1);
+
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(4)
+            .create(&waitset);
+        assert_that!(sut.number_of_threads(), eq 4);
+    }
+
+    #[test]
+    fn run_on_empty_waitset_fails<S: Service>() {
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let sut = WaitSetExecutorBuilder::new().create(&waitset);
+
+        let result = sut.run(|_| CallbackProgression::Continue);
+
+        assert_that!(result.err(), eq Some(WaitSetRunError::NoAttachments));
+        assert_that!(waitset.is_empty(), eq true);
+    }
+
+    #[test]
+    fn callbacks_are_called_from_worker_threads<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let guard = waitset.attach_interval(INTERVAL).unwrap();
+        let interval_id = WaitSetAttachmentId::from_guard(&guard);
+        let main_thread: ThreadId = std::thread::current().id();
+
+        let counter = AtomicUsize::new(0);
+        let called_from_main_thread = AtomicBool::new(false);
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(2)
+            .create(&waitset);
+
+        let result = sut
+            .run(|id| {
+                assert_that!(id.has_event_from_id(&interval_id), eq true);
+                if std::thread::current().id() == main_thread {
+                    called_from_main_thread.store(true, Ordering::Relaxed);
+                }
+
+                if counter.fetch_add(1, Ordering::Relaxed) + 1 == 3 {
+                    CallbackProgression::Stop
+                } else {
+                    CallbackProgression::Continue
+                }
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::StopRequest);
+        assert_that!(counter.load(Ordering::Relaxed), ge 3);
+        assert_that!(called_from_main_thread.load(Ordering::Relaxed), eq false);
+        assert_that!(waitset.len(), eq 1);
+    }
+
+    #[test]
+    fn attachment_is_never_processed_concurrently<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let _guard = waitset.attach_interval(Duration::from_millis(1)).unwrap();
+
+        let is_processed = AtomicBool::new(false);
+        let has_concurrent_processing = AtomicBool::new(false);
+        let counter = AtomicUsize::new(0);
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(4)
+            .create(&waitset);
+
+        sut.run(|_| {
+            if is_processed.swap(true, Ordering::Relaxed) {
+                has_concurrent_processing.store(true, Ordering::Relaxed);
+            }
+            std::thread::sleep(Duration::from_millis(5));
+            is_processed.store(false, Ordering::Relaxed);
+
+            if counter.fetch_add(1, Ordering::Relaxed) + 1 == 10 {
+                CallbackProgression::Stop
+            } else {
+                CallbackProgression::Continue
+            }
+        })
+        .unwrap();
+
+        assert_that!(has_concurrent_processing.load(Ordering::Relaxed), eq false);
+    }
+
+    #[test]
+    fn slow_callback_does_not_delay_other_attachments<S: Service>() {
+        const NUMBER_OF_FAST_EVENTS: usize = 5;
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let slow_guard = waitset.attach_interval(INTERVAL).unwrap();
+        let fast_guard = waitset.attach_interval(INTERVAL).unwrap();
+        let slow_id = WaitSetAttachmentId::from_guard(&slow_guard);
+        let fast_id = WaitSetAttachmentId::from_guard(&fast_guard);
+
+        let fast_counter = AtomicUsize::new(0);
+        let fast_counter_after_slow_callback = AtomicUsize::new(0);
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(2)
+            .create(&waitset);
+
+        sut.run(|id| {
+            if id.has_event_from_id(&fast_id) {
+                fast_counter.fetch_add(1, Ordering::Relaxed);
+            } else if id.has_event_from_id(&slow_id) {
+                while fast_counter.load(Ordering::Relaxed) < NUMBER_OF_FAST_EVENTS {
+                    std::thread::sleep(INTERVAL);
+                }
+                fast_counter_after_slow_callback
+                    .store(fast_counter.load(Ordering::Relaxed), Ordering::Relaxed);
+                return CallbackProgression::Stop;
+            }
+
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(fast_counter_after_slow_callback.load(Ordering::Relaxed), ge NUMBER_OF_FAST_EVENTS);
+    }
+
+    #[test]
+    fn notifications_are_dispatched<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let (receiver, sender) = create_socket();
+        let guard = waitset.attach_notification(&receiver).unwrap();
+        let receiver_id = WaitSetAttachmentId::from_guard(&guard);
+
+        sender.try_send(b"bla").unwrap();
+
+        let received_bytes = AtomicUsize::new(0);
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(2)
+            .create(&waitset);
+
+        let result = sut
+            .run(|id| {
+                assert_that!(id.has_event_from_id(&receiver_id), eq true);
+                let mut buffer = [0u8; 8];
+                received_bytes.store(
+                    receiver.try_receive(&mut buffer).unwrap() as usize,
+                    Ordering::Relaxed,
+                );
+                CallbackProgression::Stop
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::StopRequest);
+        assert_that!(received_bytes.load(Ordering::Relaxed), eq 3);
+    }
+
+    #[test]
+    fn notification_is_dispatched_again_after_it_was_processed<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let (receiver, sender) = create_socket();
+        let _guard = waitset.attach_notification(&receiver).unwrap();
+
+        sender.try_send(b"bla").unwrap();
+
+        let counter = AtomicUsize::new(0);
+        let sut = WaitSetExecutorBuilder::new()
+            .number_of_threads(2)
+            .create(&waitset);
+
+        let result = sut
+            .run(|_| {
+                let mut buffer = [0u8; 8];
+                let _ = receiver.try_receive(&mut buffer);
+                if counter.fetch_add(1, Ordering::Relaxed) == 0 {
+                    sender.try_send(b"fuu").unwrap();
+                    return CallbackProgression::Continue;
+                }
+
+                CallbackProgression::Stop
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::StopRequest);
+        assert_that!(counter.load(Ordering::Relaxed), eq 2);
+    }
+
+    #[test]
+    fn attachments_are_resumed_when_run_returns<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let waitset = WaitSetBuilder::new().create::<S>().unwrap();
+        let (receiver, sender) = create_socket();
+        let guard = waitset.attach_notification(&receiver).unwrap();
+        let receiver_id = WaitSetAttachmentId::from_guard(&guard);
+
+        sender.try_send(b"bla").unwrap();
+
+        let sut = WaitSetExecutorBuilder::new().create(&waitset);
+        sut.run(|_| CallbackProgression::Stop).unwrap();
+
+        let mut has_event = false;
+        waitset
+            .wait_and_process_once_with_timeout(
+                |id| {
+                    has_event |= id.has_event_from_id(&receiver_id);
+                    CallbackProgression::Continue
+                },
+                Duration::from_secs(1),
+            )
+            .unwrap();
+
+        assert_that!(has_event, eq true);
+    }
+
+    #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
+    mod ipc {}
+
+    #[instantiate_tests(<iceoryx2::service::local::Service>)]
+    mod local {}
+}
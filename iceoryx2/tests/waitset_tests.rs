@@ -12,14 +12,18 @@
 
 #[generic_tests::define]
 mod waitset {
+    use core::sync::atomic::{AtomicBool, Ordering};
     use core::time::Duration;
+    use std::rc::Rc;
+    use std::sync::Arc;
     use std::time::Instant;
 
     use iceoryx2::port::listener::Listener;
     use iceoryx2::port::notifier::Notifier;
     use iceoryx2::prelude::{WaitSetBuilder, *};
     use iceoryx2::testing::*;
-    use iceoryx2::waitset::{WaitSetAttachmentError, WaitSetRunError};
+    use iceoryx2::wait_policy::{WaitPolicy, WaitStatistics};
+    use iceoryx2::waitset::{WaitSetAttachmentError, WaitSetRunError, DEFAULT_POLL_INTERVAL};
     use iceoryx2_bb_posix::config::test_directory;
     use iceoryx2_bb_posix::directory::Directory;
     use iceoryx2_bb_posix::file::Permission;
@@ -599,9 +603,340 @@ mod waitset {
         assert_that!(sut.signal_handling_mode(), eq SignalHandlingMode::HandleTerminationRequests);
     }
 
+    #[test]
+    fn timer_slack_can_be_configured<S: Service>() {
+        let timer_slack = Duration::from_millis(25);
+        let sut_1 = WaitSetBuilder::new().create::<S>().unwrap();
+        let sut_2 = WaitSetBuilder::new()
+            .timer_slack(timer_slack)
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(sut_1.timer_slack(), eq Duration::ZERO);
+        assert_that!(sut_2.timer_slack(), eq timer_slack);
+    }
+
+    #[test]
+    fn intervals_within_timer_slack_are_handled_with_one_wakeup<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let timer_slack = TIMEOUT * 4;
+        let sut = WaitSetBuilder::new()
+            .timer_slack(timer_slack)
+            .create::<S>()
+            .unwrap();
+
+        let guard_1 = sut.attach_interval(TIMEOUT).unwrap();
+        let guard_2 = sut.attach_interval(TIMEOUT * 2).unwrap();
+
+        let mut guard_1_called = false;
+        let mut guard_2_called = false;
+        let start = Instant::now();
+        sut.wait_and_process_once(|id| {
+            guard_1_called |= id.has_event_from(&guard_1);
+            guard_2_called |= id.has_event_from(&guard_2);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(guard_1_called, eq true);
+        assert_that!(guard_2_called, eq true);
+        assert_that!(start.elapsed(), time_at_least TIMEOUT * 2);
+    }
+
+    #[test]
+    fn wait_policy_can_be_configured<S: Service>() {
+        let wait_policy = WaitPolicy::new(Duration::from_micros(50), Duration::from_micros(100));
+        let sut_1 = WaitSetBuilder::new().create::<S>().unwrap();
+        let sut_2 = WaitSetBuilder::new()
+            .wait_policy(wait_policy)
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(sut_1.wait_policy(), eq WaitPolicy::blocking());
+        assert_that!(sut_2.wait_policy(), eq wait_policy);
+    }
+
+    #[test]
+    fn wait_resolved_while_spinning_is_counted<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new()
+            .wait_policy(WaitPolicy::new(Duration::from_secs(60), Duration::ZERO))
+            .create::<S>()
+            .unwrap();
+
+        let (listener, notifier) = create_event::<S>(&node);
+        let guard = sut.attach_notification(&listener).unwrap();
+
+        notifier.notify().unwrap();
+        let mut listener_triggered = false;
+        sut.wait_and_process_once(|id| {
+            listener_triggered |= id.has_event_from(&guard);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(listener_triggered, eq true);
+        let statistics = sut.wait_statistics();
+        assert_that!(statistics.resolved_by_spinning, eq 1);
+        assert_that!(statistics.resolved_by_yielding, eq 0);
+        assert_that!(statistics.resolved_by_blocking, eq 0);
+    }
+
+    #[test]
+    fn deadline_is_not_delayed_by_wait_policy<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new()
+            .wait_policy(WaitPolicy::new(TIMEOUT * 10, TIMEOUT * 10))
+            .create::<S>()
+            .unwrap();
+
+        let guard = sut.attach_interval(TIMEOUT).unwrap();
+
+        let mut interval_triggered = false;
+        let start = Instant::now();
+        sut.wait_and_process_once(|id| {
+            interval_triggered |= id.has_event_from(&guard);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(interval_triggered, eq true);
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+        assert_that!(start.elapsed(), lt TIMEOUT * 10);
+        assert_that!(sut.wait_statistics(), eq WaitStatistics::default());
+    }
+
+    #[test]
+    fn poll_interval_can_be_configured<S: Service>() {
+        let poll_interval = Duration::from_micros(250);
+        let sut_1 = WaitSetBuilder::new().create::<S>().unwrap();
+        let sut_2 = WaitSetBuilder::new()
+            .poll_interval(poll_interval)
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(sut_1.poll_interval(), eq DEFAULT_POLL_INTERVAL);
+        assert_that!(sut_2.poll_interval(), eq poll_interval);
+    }
+
+    #[test]
+    fn attach_and_detach_polling_works<S: Service>() {
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let guard_1 = sut.attach_polling(|| false).unwrap();
+        let guard_2 = sut.attach_polling(|| false).unwrap();
+        assert_that!(sut.len(), eq 2);
+        assert_that!(WaitSetAttachmentId::from_guard(&guard_1), ne WaitSetAttachmentId::from_guard(&guard_2));
+
+        drop(guard_1);
+        assert_that!(sut.len(), eq 1);
+        drop(guard_2);
+        assert_that!(sut.is_empty(), eq true);
+    }
+
+    #[test]
+    fn polling_attachment_id_is_not_reused_after_detach<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let polling_guard = sut.attach_polling(|| false).unwrap();
+        let polling_id = WaitSetAttachmentId::from_guard(&polling_guard);
+        drop(polling_guard);
+
+        let new_polling_guard = sut.attach_polling(|| true).unwrap();
+        assert_that!(WaitSetAttachmentId::from_guard(&new_polling_guard), ne polling_id);
+
+        let mut stale_id_triggered = false;
+        let mut new_guard_triggered = false;
+        sut.wait_and_process_once(|id| {
+            stale_id_triggered |= id.has_event_from_id(&polling_id);
+            new_guard_triggered |= id.has_event_from(&new_polling_guard);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(stale_id_triggered, eq false);
+        assert_that!(new_guard_triggered, eq true);
+    }
+
+    #[test]
+    fn run_lists_ready_polling_attachments<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let ready_guard = sut.attach_polling(|| true).unwrap();
+        let idle_guard = sut.attach_polling(|| false).unwrap();
+
+        let mut ready_triggered = false;
+        let mut idle_triggered = false;
+        sut.wait_and_process_once(|id| {
+            ready_triggered |= id.has_event_from(&ready_guard);
+            idle_triggered |= id.has_event_from(&idle_guard);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(ready_triggered, eq true);
+        assert_that!(idle_triggered, eq false);
+    }
+
+    #[test]
+    fn detached_polling_attachment_is_not_reported<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let polling_guard = sut.attach_polling(|| true).unwrap();
+        let polling_id = WaitSetAttachmentId::from_guard(&polling_guard);
+        drop(polling_guard);
+        let _interval_guard = sut.attach_interval(TIMEOUT).unwrap();
+
+        let mut polling_triggered = false;
+        sut.wait_and_process_once(|id| {
+            polling_triggered |= id.has_event_from_id(&polling_id);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(polling_triggered, eq false);
+    }
+
+    #[test]
+    fn blocking_run_detects_polling_attachment_that_becomes_ready<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new()
+            .poll_interval(Duration::from_millis(5))
+            .create::<S>()
+            .unwrap();
+
+        let is_ready = Arc::new(AtomicBool::new(false));
+        let polled_is_ready = is_ready.clone();
+        let guard = sut
+            .attach_polling(move || polled_is_ready.load(Ordering::Relaxed))
+            .unwrap();
+
+        let start = Instant::now();
+        std::thread::scope(|s| {
+            s.spawn(|| {
+                std::thread::sleep(TIMEOUT);
+                is_ready.store(true, Ordering::Relaxed);
+            });
+
+            let mut polling_triggered = false;
+            sut.wait_and_process_once(|id| {
+                polling_triggered |= id.has_event_from(&guard);
+                CallbackProgression::Continue
+            })
+            .unwrap();
+
+            assert_that!(polling_triggered, eq true);
+        });
+
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+    }
+
+    #[test]
+    fn run_with_polling_attachment_does_not_block_longer_than_provided_timeout<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let guard = sut.attach_polling(|| false).unwrap();
+
+        let mut polling_triggered = false;
+        let start = Instant::now();
+        sut.wait_and_process_once_with_timeout(
+            |id| {
+                polling_triggered |= id.has_event_from(&guard);
+                CallbackProgression::Continue
+            },
+            TIMEOUT,
+        )
+        .unwrap();
+
+        assert_that!(polling_triggered, eq false);
+        assert_that!(start.elapsed(), time_at_least TIMEOUT);
+    }
+
+    #[test]
+    fn run_lists_polling_attachments_and_notifications<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let _watchdog = Watchdog::new();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let (listener, notifier) = create_event::<S>(&node);
+        let notification_guard = sut.attach_notification(&listener).unwrap();
+        let polling_guard = sut.attach_polling(|| true).unwrap();
+
+        notifier.notify().unwrap();
+
+        let mut notification_triggered = false;
+        let mut polling_triggered = false;
+        sut.wait_and_process_once(|id| {
+            notification_triggered |= id.has_event_from(&notification_guard);
+            polling_triggered |= id.has_event_from(&polling_guard);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(notification_triggered, eq true);
+        assert_that!(polling_triggered, eq true);
+    }
+
+    #[test]
+    fn polled_subscriber_is_reported_when_it_has_samples<S: Service>() {
+        let _watchdog = Watchdog::new();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let service = node
+            .service_builder(&generate_name())
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        let subscriber = Rc::new(service.subscriber_builder().create().unwrap());
+
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+        let polled_subscriber = subscriber.clone();
+        let guard = sut
+            .attach_polling(move || polled_subscriber.has_samples().unwrap_or(false))
+            .unwrap();
+
+        let mut subscriber_triggered = false;
+        sut.wait_and_process_once_with_timeout(
+            |id| {
+                subscriber_triggered |= id.has_event_from(&guard);
+                CallbackProgression::Continue
+            },
+            TIMEOUT,
+        )
+        .unwrap();
+        assert_that!(subscriber_triggered, eq false);
+
+        publisher.send_copy(1234).unwrap();
+
+        let mut received_payload = None;
+        sut.wait_and_process_once(|id| {
+            if id.has_event_from(&guard) {
+                received_payload = subscriber.receive().unwrap().map(|sample| *sample);
+            }
+            CallbackProgression::Continue
+        })
+        .unwrap();
+        assert_that!(received_payload, eq Some(1234));
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
     #[instantiate_tests(<iceoryx2::service::local::Service>)]
     mod local {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2::service::ipc_futex::Service>)]
+    mod ipc_futex {}
 }